@@ -39,5 +39,6 @@
 #define CI_LAB_SB_SUBSCRIBE_HK_ERR_EID  13
 #define CI_LAB_SB_SUBSCRIBE_UL_ERR_EID  14
 #define CI_LAB_CMD_LEN_ERR_EID          16
+#define CI_LAB_POLLSET_ERR_EID          17
 
 #endif
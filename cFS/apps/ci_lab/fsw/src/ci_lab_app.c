@@ -49,9 +49,12 @@ CI_LAB_GlobalData_t CI_LAB_Global;
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *  * *  * * * * **/
 void CI_LAB_AppMain(void)
 {
-    CFE_Status_t     status;
-    uint32           RunStatus = CFE_ES_RunStatus_APP_RUN;
-    CFE_SB_Buffer_t *SBBufPtr;
+    CFE_Status_t      status;
+    int32             OsStatus;
+    uint32            RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_SB_Buffer_t * SBBufPtr;
+    OS_PollSetEvent_t Events[2];
+    uint32            EventCount;
 
     CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
 
@@ -64,8 +67,31 @@ void CI_LAB_AppMain(void)
     {
         CFE_ES_PerfLogExit(CI_LAB_MAIN_TASK_PERF_ID);
 
-        /* Receive SB buffer, configurable timeout */
-        status = CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, CI_LAB_PLATFORM_SB_RECEIVE_TIMEOUT);
+        if (CI_LAB_Global.EventDriven)
+        {
+            /*
+             * Wait for either a command on the pipe or a datagram on the uplink socket,
+             * whichever comes first.  Both sources are then checked without blocking,
+             * and anything left over keeps the poll set ready for the next pass.
+             */
+            OsStatus = OS_PollSetWait(CI_LAB_Global.PollSetID, Events, sizeof(Events) / sizeof(Events[0]),
+                                      &EventCount, CI_LAB_PLATFORM_SB_RECEIVE_TIMEOUT);
+            if (OsStatus != OS_SUCCESS && OsStatus != OS_ERROR_TIMEOUT)
+            {
+                /* Errors here do not clear by themselves, so do not spin on them */
+                CFE_EVS_SendEvent(CI_LAB_POLLSET_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CI: wait on poll set failed, RC = %d", (int)OsStatus);
+                RunStatus = CFE_ES_RunStatus_APP_ERROR;
+                continue;
+            }
+
+            status = CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, CFE_SB_POLL);
+        }
+        else
+        {
+            /* Receive SB buffer, configurable timeout */
+            status = CFE_SB_ReceiveBuffer(&SBBufPtr, CI_LAB_Global.CommandPipe, CI_LAB_PLATFORM_SB_RECEIVE_TIMEOUT);
+        }
 
         CFE_ES_PerfLogEntry(CI_LAB_MAIN_TASK_PERF_ID);
 
@@ -172,6 +198,11 @@ void CI_LAB_TaskInit(void)
         }
     }
 
+    if (CI_LAB_Global.SocketConnected)
+    {
+        CI_LAB_PollSetInit();
+    }
+
     CI_LAB_ResetCounters_Internal();
 
     /*
@@ -188,6 +219,48 @@ void CI_LAB_TaskInit(void)
     CFE_EVS_SendEvent(CI_LAB_INIT_INF_EID, CFE_EVS_EventType_INFORMATION, "CI Lab Initialized.%s", VersionString);
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/*  Purpose:                                                                  */
+/*         This function sets up a poll set containing both the command pipe  */
+/*         and the uplink socket, so the main loop can block on both at once. */
+/*         If the OS cannot poll either one, the main loop falls back to      */
+/*         waiting on the pipe and polling the socket after each timeout.     */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * *  * * * * * * *  * *  * * * * */
+void CI_LAB_PollSetInit(void)
+{
+    int32     status;
+    osal_id_t PipeWaitId;
+
+    status = OS_PollSetCreate(&CI_LAB_Global.PollSetID, "CI_LAB_POLLSET", 0);
+    if (status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    status = CFE_SB_GetPipeWaitId(CI_LAB_Global.CommandPipe, &PipeWaitId);
+    if (status == CFE_SUCCESS)
+    {
+        status = OS_PollSetAdd(CI_LAB_Global.PollSetID, PipeWaitId, OS_STREAM_STATE_READABLE);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        status = OS_PollSetAdd(CI_LAB_Global.PollSetID, CI_LAB_Global.SocketID, OS_STREAM_STATE_READABLE);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        CI_LAB_Global.EventDriven = true;
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("CI_LAB: Event driven uplink not available, RC = %d\n", (int)status);
+        OS_PollSetDelete(CI_LAB_Global.PollSetID);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /*  Purpose:                                                                  */
@@ -56,8 +56,10 @@ typedef struct
     bool            SocketConnected;
     bool            Scheduled;
     bool            AllowPassthrough;
+    bool            EventDriven;
     CFE_SB_PipeId_t CommandPipe;
     osal_id_t       SocketID;
+    osal_id_t       PollSetID;
     OS_SockAddr_t   SocketAddress;
 
     CI_LAB_HkTlm_t HkTlm;
@@ -76,6 +78,7 @@ typedef struct
 */
 void CI_LAB_AppMain(void);
 void CI_LAB_TaskInit(void);
+void CI_LAB_PollSetInit(void);
 void CI_LAB_ResetCounters_Internal(void);
 void CI_LAB_ReadUpLink(void);
 
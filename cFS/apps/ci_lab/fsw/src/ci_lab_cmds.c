@@ -79,6 +79,12 @@ CFE_Status_t CI_LAB_SendHkCmd(const CI_LAB_SendHkCmd_t *cmd)
 CFE_Status_t CI_LAB_ReadUplinkCmd(const CI_LAB_ReadUplinkCmd_t *cmd)
 {
     /* Any occurrence of this request will cause CI to read ONLY on this request thereafter */
+    if (!CI_LAB_Global.Scheduled && CI_LAB_Global.EventDriven)
+    {
+        /* Pending uplink data must no longer wake the main loop */
+        OS_PollSetRemove(CI_LAB_Global.PollSetID, CI_LAB_Global.SocketID);
+    }
+
     CI_LAB_Global.Scheduled = true;
     CI_LAB_ReadUpLink();
     return CFE_SUCCESS;
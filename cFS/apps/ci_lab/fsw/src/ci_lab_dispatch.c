@@ -22,6 +22,7 @@
  */
 
 #include "cfe.h"
+#include "cfe_msg_inline.h"
 #include "ci_lab_app.h"
 #include "ci_lab_dispatch.h"
 #include "ci_lab_cmds.h"
@@ -39,15 +40,15 @@ bool CI_LAB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     CFE_MSG_FcnCode_t FcnCode      = 0;
     CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
 
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    ActualLength = CFE_MSG_InlineGetSize(MsgPtr);
 
     /*
     ** Verify the command packet length...
     */
     if (ExpectedLength != ActualLength)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+        MsgId   = CFE_MSG_InlineGetMsgId(MsgPtr);
+        FcnCode = CFE_MSG_InlineGetFcnCode(MsgPtr);
 
         CFE_EVS_SendEvent(CI_LAB_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
@@ -60,6 +61,20 @@ bool CI_LAB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     return result;
 }
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(CI_LAB_NoopCmd_t, CI_LAB_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CI_LAB_ResetCountersCmd_t, CI_LAB_ResetCountersCmd)
+
+/*
+ * Dispatch table for CI ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CI_LAB_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CI_LAB_NOOP_CC, CI_LAB_NoopCmd_t, CI_LAB_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CI_LAB_RESET_COUNTERS_CC, CI_LAB_ResetCountersCmd_t, CI_LAB_ResetCountersCmd),
+};
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
 /* CI ground commands                                                         */
@@ -68,30 +83,19 @@ bool CI_LAB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
 
 void CI_LAB_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t FcnCode = 0;
+    CFE_MSG_FcnCode_t                FcnCode = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
+    FcnCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
     /* Process "known" CI task ground commands */
-    switch (FcnCode)
+    Entry = CFE_SB_GetCmdDispatchEntry(CI_LAB_CMD_DISPATCH_TABLE,
+                                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CI_LAB_CMD_DISPATCH_TABLE), FcnCode);
+
+    /* unknown codes are already found during FC vs length test */
+    if (Entry != NULL && CI_LAB_VerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
     {
-        case CI_LAB_NOOP_CC:
-            if (CI_LAB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CI_LAB_NoopCmd_t)))
-            {
-                CI_LAB_NoopCmd((const CI_LAB_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CI_LAB_RESET_COUNTERS_CC:
-            if (CI_LAB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CI_LAB_ResetCountersCmd_t)))
-            {
-                CI_LAB_ResetCountersCmd((const CI_LAB_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /* default case already found during FC vs length test */
-        default:
-            break;
+        Entry->Handler(SBBufPtr);
     }
 }
 
@@ -122,7 +126,7 @@ void CI_LAB_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
         READ_UPLINK_MID = CFE_SB_ValueToMsgId(CI_LAB_READ_UPLINK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+    MsgId = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     /* Process all SB messages */
     if (CFE_SB_MsgId_Equal(MsgId, SEND_HK_MID))
@@ -0,0 +1,248 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_ci_lab_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the CI Lab main loop
+**
+** Notes:
+** These cases drive CI_LAB_AppMain() through a single pass of the run loop
+** for each way the poll set wait can complete: timeout, error, a command
+** ready on the pipe and a datagram ready on the uplink socket.
+*/
+
+/*
+ * Includes
+ */
+#include <string.h>
+
+#include "cfe.h"
+#include "ci_lab_app.h"
+#include "ci_lab_eventids.h"
+#include "ci_lab_dispatch.h"
+#include "ci_lab_decode.h"
+
+#include "utassert.h"
+#include "uttest.h"
+#include "utstubs.h"
+
+#define ADD_TEST(test) UtTest_Add((Test_##test), CI_LAB_UT_Setup, CI_LAB_UT_TearDown, #test)
+
+#define CI_LAB_UT_MAX_EVENTS 8
+
+static uint8           UT_UplinkBuffer[64];
+static CFE_SB_Buffer_t UT_CmdBuffer;
+static uint16          UT_EventIds[CI_LAB_UT_MAX_EVENTS];
+static uint32          UT_ExitStatus;
+
+/*
+ * Hand out a fixed buffer in place of the network input buffer
+ */
+static void UT_Handler_CI_LAB_GetInputBuffer(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void **  BufferOut = UT_Hook_GetArgValueByName(Context, "BufferOut", void **);
+    size_t * SizeOut   = UT_Hook_GetArgValueByName(Context, "SizeOut", size_t *);
+
+    *BufferOut = UT_UplinkBuffer;
+    *SizeOut   = sizeof(UT_UplinkBuffer);
+}
+
+/*
+ * Pass the received datagram straight through, as the passthru decoder does
+ */
+static void UT_Handler_CI_LAB_DecodeInputMessage(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *            SourceBuffer  = UT_Hook_GetArgValueByName(Context, "SourceBuffer", void *);
+    CFE_SB_Buffer_t **DestBufferOut = UT_Hook_GetArgValueByName(Context, "DestBufferOut", CFE_SB_Buffer_t **);
+
+    *DestBufferOut = SourceBuffer;
+}
+
+/*
+ * Record the status the app exits with
+ */
+static void UT_Handler_CFE_ES_ExitApp(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_ExitStatus = UT_Hook_GetArgValueByName(Context, "ExitStatus", uint32);
+}
+
+/*
+ * Checks whether the given event was sent at any point during the test
+ */
+static bool UT_EventWasSent(uint16 EventId)
+{
+    size_t Count = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    size_t i;
+
+    if (Count > CI_LAB_UT_MAX_EVENTS)
+    {
+        Count = CI_LAB_UT_MAX_EVENTS;
+    }
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (UT_EventIds[i] == EventId)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_CI_LAB_AppMain_Timeout(void)
+{
+    /*
+     * Nothing became ready before the timeout: the pipe is checked without
+     * blocking, the socket is polled once, and the app keeps running.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetWait), 1, OS_ERROR_TIMEOUT);
+
+    CI_LAB_AppMain();
+
+    UtAssert_BOOL_TRUE(CI_LAB_Global.EventDriven);
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 1);
+    UtAssert_STUB_COUNT(CI_LAB_TaskPipe, 0);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_BOOL_FALSE(UT_EventWasSent(CI_LAB_POLLSET_ERR_EID));
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_CI_LAB_AppMain_PollError(void)
+{
+    /*
+     * A hard error from the wait must not be retried in a tight loop; the app
+     * reports it and leaves through the normal run loop exit.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetWait), 1, OS_ERROR);
+
+    CI_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RunLoop, 2);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 0);
+    UtAssert_BOOL_TRUE(UT_EventWasSent(CI_LAB_POLLSET_ERR_EID));
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_ERROR);
+}
+
+void Test_CI_LAB_AppMain_PipeReady(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_CmdBuffer;
+
+    /*
+     * A command is waiting on the pipe: it is dispatched, and the socket is
+     * still polled afterwards.
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+
+    CI_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CI_LAB_TaskPipe, 1);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 0);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_CI_LAB_AppMain_SocketReady(void)
+{
+    /*
+     * A datagram is waiting on the socket: it is ingested and forwarded on
+     * the bus, and the drain stops once the socket is empty.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_SocketRecvFrom), 1, 16);
+
+    CI_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CI_LAB_TaskPipe, 0);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 2);
+    UtAssert_STUB_COUNT(CI_LAB_DecodeInputMessage, 1);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitBuffer, 1);
+    UtAssert_UINT32_EQ(CI_LAB_Global.HkTlm.Payload.IngestPackets, 1);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_CI_LAB_AppMain_NoPollSet(void)
+{
+    /*
+     * Without a poll set the loop falls back to a timed wait on the pipe
+     * followed by a socket poll.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetCreate), 1, OS_ERROR);
+
+    CI_LAB_AppMain();
+
+    UtAssert_BOOL_FALSE(CI_LAB_Global.EventDriven);
+    UtAssert_STUB_COUNT(OS_PollSetWait, 0);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(OS_SocketRecvFrom, 1);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+/*
+ * Setup function prior to every test
+ */
+void CI_LAB_UT_Setup(void)
+{
+    UT_ResetState(0);
+
+    memset(UT_EventIds, 0, sizeof(UT_EventIds));
+    UT_ExitStatus = CFE_ES_RunStatus_UNDEFINED;
+
+    /* Run exactly one pass of the main loop */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+
+    /* By default neither the pipe nor the socket has anything waiting */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+    UT_SetDefaultReturnValue(UT_KEY(OS_SocketRecvFrom), 0);
+
+    UT_SetDataBuffer(UT_KEY(CFE_EVS_SendEvent), UT_EventIds, sizeof(UT_EventIds), false);
+    UT_SetHandlerFunction(UT_KEY(CI_LAB_GetInputBuffer), UT_Handler_CI_LAB_GetInputBuffer, NULL);
+    UT_SetHandlerFunction(UT_KEY(CI_LAB_DecodeInputMessage), UT_Handler_CI_LAB_DecodeInputMessage, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_ExitApp), UT_Handler_CFE_ES_ExitApp, NULL);
+}
+
+/*
+ * Teardown function after every test
+ */
+void CI_LAB_UT_TearDown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(CI_LAB_AppMain_Timeout);
+    ADD_TEST(CI_LAB_AppMain_PollError);
+    ADD_TEST(CI_LAB_AppMain_PipeReady);
+    ADD_TEST(CI_LAB_AppMain_SocketReady);
+    ADD_TEST(CI_LAB_AppMain_NoPollSet);
+}
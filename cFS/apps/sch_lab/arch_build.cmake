@@ -13,6 +13,7 @@ set(SCH_LAB_PLATFORM_CONFIG_FILE_LIST
   sch_lab_internal_cfg_values.h
   sch_lab_platform_cfg.h
   sch_lab_perfids.h
+  sch_lab_msgids.h
 )
 
 generate_configfile_set(${SCH_LAB_PLATFORM_CONFIG_FILE_LIST})
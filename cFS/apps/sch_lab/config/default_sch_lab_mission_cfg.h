@@ -47,4 +47,13 @@
 #define SCH_LAB_MISSION_MAX_ARGS_PER_ENTRY         SCH_LAB_MISSION_CFGVAL(MAX_ARGS_PER_ENTRY)
 #define DEFAULT_SCH_LAB_MISSION_MAX_ARGS_PER_ENTRY 32
 
+/**
+ * @brief The maximum number of minor frames (slots) in one major frame
+ *
+ * This limits the schedule table MinorFramesPerMajor value, and sizes
+ * the per-slot statistics reported in housekeeping telemetry.
+ */
+#define SCH_LAB_MISSION_MAX_MINOR_FRAMES         SCH_LAB_MISSION_CFGVAL(MAX_MINOR_FRAMES)
+#define DEFAULT_SCH_LAB_MISSION_MAX_MINOR_FRAMES 100
+
 #endif /* DEFAULT_SCH_LAB_MISSION_CFG_H */
@@ -0,0 +1,56 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the SCH_LAB command and telemetry
+ *   message payload and constant definitions.
+ */
+#ifndef DEFAULT_SCH_LAB_MSGDEFS_H
+#define DEFAULT_SCH_LAB_MSGDEFS_H
+
+#include "common_types.h"
+#include "sch_lab_mission_cfg.h"
+
+/**
+ * Timing statistics for a single minor frame (slot) of the schedule
+ */
+typedef struct
+{
+    uint32 OverrunCount;   /**< Number of times the next tick arrived before this slot was finished */
+    uint32 MaxLatencyUsec; /**< Largest delay from timer tick to start of slot, since the last HK report */
+} SCH_LAB_SlotStats_t;
+
+/*************************************************************************/
+/*
+** Payload definition (SCH_LAB housekeeping)...
+*/
+typedef struct
+{
+    uint32              MinorFrameCount;     /**< Number of minor frames (slots) processed */
+    uint32              MajorFrameCount;     /**< Number of complete major frames */
+    uint32              OverrunCount;        /**< Total overruns, across all slots */
+    uint32              MaxLatencyUsec;      /**< Largest latency of any slot, since the last HK report */
+    uint16              TableUpdateCount;    /**< Number of schedule tables put into use */
+    uint16              MinorFramesPerMajor; /**< Number of slots in the active schedule */
+    uint16              ActivityCount;       /**< Number of message sends in one major frame */
+    uint16              Spare;
+    SCH_LAB_SlotStats_t Slot[SCH_LAB_MISSION_MAX_MINOR_FRAMES];
+} SCH_LAB_HkTlm_Payload_t;
+
+#endif
@@ -0,0 +1,32 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   SCH_LAB Application Message IDs
+ */
+#ifndef DEFAULT_SCH_LAB_MSGIDS_H
+#define DEFAULT_SCH_LAB_MSGIDS_H
+
+#include "cfe_core_api_base_msgids.h"
+#include "sch_lab_topicids.h"
+
+#define SCH_LAB_SEND_HK_MID CFE_PLATFORM_CMD_TOPICID_TO_MIDV(SCH_LAB_MISSION_SEND_HK_TOPICID)
+#define SCH_LAB_HK_TLM_MID  CFE_PLATFORM_TLM_TOPICID_TO_MIDV(SCH_LAB_MISSION_HK_TLM_TOPICID)
+
+#endif
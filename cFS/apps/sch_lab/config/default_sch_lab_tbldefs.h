@@ -53,6 +53,7 @@ typedef struct
     CFE_MSG_FcnCode_t FcnCode;                                           /* Command/Function code to set */
     uint16            PayloadLength;                                     /* Length of additional command args */
     uint16            MessageBuffer[SCH_LAB_MISSION_MAX_ARGS_PER_ENTRY]; /* Command args in 16 bit words */
+    uint32            Offset;                                            /* Phase: first tick to send in, < Rate */
 } SCH_LAB_ScheduleTableEntry_t;
 
 #endif
@@ -34,7 +34,8 @@
 
 typedef struct
 {
-    uint32                       TickRate; /* Ticks per second to configure for timer (0=default) */
+    uint32                       TickRate;            /* Ticks per second to configure for timer (0=default) */
+    uint32                       MinorFramesPerMajor; /* Ticks (slots) per major frame (0=one second) */
     SCH_LAB_ScheduleTableEntry_t Config[SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES];
 } SCH_LAB_ScheduleTable_t;
 
@@ -41,4 +41,10 @@
 #define SCH_LAB_PLATFORM_TBL_DEFAULT_FILE         SCH_LAB_PLATFORM_CFGVAL(TBL_DEFAULT_FILE)
 #define DEFAULT_SCH_LAB_PLATFORM_TBL_DEFAULT_FILE "/cf/sch_lab_table.tbl"
 
+/**
+ * @brief Error code returned by the table validation function for an invalid schedule
+ */
+#define SCH_LAB_PLATFORM_TABLE_INVALID_ERR_CODE         SCH_LAB_PLATFORM_CFGVAL(TABLE_INVALID_ERR_CODE)
+#define DEFAULT_SCH_LAB_PLATFORM_TABLE_INVALID_ERR_CODE -1
+
 #endif /* SCH_LAB_INTERFACE_CFG_H */
@@ -29,11 +29,14 @@
 #include "cfe.h"
 #include "cfe_msgids.h"
 #include "cfe_config.h"
+#include "cfe_msg_inline.h"
 
 #include "sch_lab_perfids.h"
 #include "sch_lab_version.h"
 #include "sch_lab_mission_cfg.h"
 #include "sch_lab_platform_cfg.h"
+#include "sch_lab_msg.h"
+#include "sch_lab_msgids.h"
 #include "sch_lab_tbl.h"
 
 /*
@@ -44,17 +47,37 @@ typedef struct
     CFE_MSG_CommandHeader_t CommandHeader;
     uint16                  MessageBuffer[SCH_LAB_MISSION_MAX_ARGS_PER_ENTRY];
     uint16                  PayloadLength;
-    uint32                  PacketRate;
-    uint32                  Counter;
+    uint32                  SlotInterval;      /* Send in every Nth slot of the major frame */
+    uint32                  SlotOffset;        /* First slot of the major frame to send in */
+    uint32                  MajorFrameDivisor; /* Send only in every Nth major frame (1=every one) */
+    uint32                  MajorFramePhase;   /* Major frame to send in, when the divisor is more than 1 */
 } SCH_LAB_StateEntry_t;
 
 typedef struct
 {
     SCH_LAB_StateEntry_t State[SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES];
-    osal_id_t            TimerId;
-    osal_id_t            TimingSem;
-    CFE_TBL_Handle_t     TblHandle;
-    CFE_SB_PipeId_t      CmdPipe;
+
+    /*
+     * Activity lists, built whenever a schedule table is put into use.
+     * The entries to send in slot N are Activity[SlotStart[N]] up to
+     * (but not including) Activity[SlotStart[N+1]], so each tick only
+     * visits the entries that are actually due in that slot.
+     */
+    uint16 SlotStart[SCH_LAB_MISSION_MAX_MINOR_FRAMES + 1];
+    uint16 Activity[SCH_LAB_MISSION_MAX_MINOR_FRAMES * SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES];
+
+    uint32    MinorFramesPerMajor;
+    uint32    TimerPeriod;
+    uint32    CurrentSlot;
+    bool      LastSlotOverrun;
+    OS_time_t TickTime; /* Time of the most recent timer tick, for latency statistics only */
+
+    SCH_LAB_HkTlm_t HkTlm;
+
+    osal_id_t        TimerId;
+    osal_id_t        TimingSem;
+    CFE_TBL_Handle_t TblHandle;
+    CFE_SB_PipeId_t  CmdPipe;
 } SCH_LAB_GlobalData_t;
 
 /*
@@ -66,19 +89,23 @@ SCH_LAB_GlobalData_t SCH_LAB_Global;
 ** Local Function Prototypes
 */
 CFE_Status_t SCH_LAB_AppInit(void);
+CFE_Status_t SCH_LAB_TblValidationFunc(void *TblData);
+CFE_Status_t SCH_LAB_ManageTable(void);
+void         SCH_LAB_ProcessSlot(void);
+void         SCH_LAB_SendHkCmd(void);
 
 /*
 ** AppMain
 */
 void SCH_LAB_AppMain(void)
 {
-    int                   i;
-    uint32                SCH_OneHzPktsRcvd = 0;
-    int32                 OsStatus;
-    CFE_Status_t          Status;
-    uint32                RunStatus = CFE_ES_RunStatus_APP_RUN;
-    SCH_LAB_StateEntry_t *LocalStateEntry;
-    CFE_SB_Buffer_t *     SBBufPtr;
+    uint32            SCH_OneHzPktsRcvd = 0;
+    int32             OsStatus;
+    CFE_Status_t      Status;
+    uint32            RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_SB_MsgId_t    MsgId;
+    CFE_MSG_Size_t    MsgSize;
+    CFE_SB_Buffer_t * SBBufPtr;
 
     CFE_ES_PerfLogEntry(SCH_LAB_MAIN_TASK_PERF_ID);
 
@@ -96,42 +123,30 @@ void SCH_LAB_AppMain(void)
 
         /* Pend on timing sem */
         OsStatus = OS_CountSemTake(SCH_LAB_Global.TimingSem);
-        if (OsStatus == OS_SUCCESS)
-        {
-            /* check for arrival of the 1Hz - this should sync counts (TBD) */
-            Status = CFE_SB_ReceiveBuffer(&SBBufPtr, SCH_LAB_Global.CmdPipe, CFE_SB_POLL);
-        }
-        else
-        {
-            Status = CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
-        }
 
         CFE_ES_PerfLogEntry(SCH_LAB_MAIN_TASK_PERF_ID);
 
-        if (Status == CFE_SUCCESS)
-        {
-            SCH_OneHzPktsRcvd++;
-        }
-
-        if (OsStatus == OS_SUCCESS && SCH_OneHzPktsRcvd > 0)
+        if (OsStatus == OS_SUCCESS)
         {
-            /*
-            ** Process table every tick, sending packets that are ready
-            */
-            LocalStateEntry = SCH_LAB_Global.State;
-
-            for (i = 0; i < SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES; i++)
+            /* check for arrival of the 1Hz - this should sync counts (TBD) - and HK requests */
+            while (CFE_SB_ReceiveBuffer(&SBBufPtr, SCH_LAB_Global.CmdPipe, CFE_SB_POLL) == CFE_SUCCESS)
             {
-                if (LocalStateEntry->PacketRate != 0)
+                MsgId   = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
+                MsgSize = CFE_MSG_InlineGetSize(&SBBufPtr->Msg);
+
+                if (CFE_SB_MsgIdToValue(MsgId) == CFE_TIME_ONEHZ_CMD_MID)
+                {
+                    SCH_OneHzPktsRcvd++;
+                }
+                else if (CFE_SB_MsgIdToValue(MsgId) == SCH_LAB_SEND_HK_MID && MsgSize == sizeof(SCH_LAB_SendHkCmd_t))
                 {
-                    ++LocalStateEntry->Counter;
-                    if (LocalStateEntry->Counter >= LocalStateEntry->PacketRate)
-                    {
-                        LocalStateEntry->Counter = 0;
-                        CFE_SB_TransmitMsg(CFE_MSG_PTR(LocalStateEntry->CommandHeader), true);
-                    }
+                    SCH_LAB_SendHkCmd();
                 }
-                ++LocalStateEntry;
+            }
+
+            if (SCH_OneHzPktsRcvd > 0)
+            {
+                SCH_LAB_ProcessSlot();
             }
         }
 
@@ -142,95 +157,186 @@ void SCH_LAB_AppMain(void)
 
 void SCH_LAB_LocalTimerCallback(osal_id_t object_id, void *arg)
 {
+    OS_GetLocalTime(&SCH_LAB_Global.TickTime);
     OS_CountSemGive(SCH_LAB_Global.TimingSem);
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Initialization                                                  */
+/* Process one minor frame (slot) of the schedule                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-CFE_Status_t SCH_LAB_AppInit(void)
+void SCH_LAB_ProcessSlot(void)
 {
-    int                           i, x;
-    CFE_Status_t                  Status;
-    int32                         OsStatus;
-    uint32                        TimerPeriod;
-    osal_id_t                     TimeBaseId = OS_OBJECT_ID_UNDEFINED;
-    SCH_LAB_ScheduleTable_t *     ConfigTable;
-    SCH_LAB_ScheduleTableEntry_t *ConfigEntry;
-    SCH_LAB_StateEntry_t *        LocalStateEntry;
-    void *                        TableAddr;
-    char                          VersionString[SCH_LAB_CFG_MAX_VERSION_STR_LEN];
+    uint32                Slot;
+    uint32                Idx;
+    uint32                LatencyUsec;
+    OS_time_t             Now;
+    OS_count_sem_prop_t   SemProp;
+    SCH_LAB_StateEntry_t *LocalStateEntry;
+    SCH_LAB_SlotStats_t * SlotStats;
 
-    memset(&SCH_LAB_Global, 0, sizeof(SCH_LAB_Global));
+    Slot      = SCH_LAB_Global.CurrentSlot;
+    SlotStats = &SCH_LAB_Global.HkTlm.Payload.Slot[Slot];
 
-    OsStatus = OS_CountSemCreate(&SCH_LAB_Global.TimingSem, "SCH_LAB", 0, 0);
-    if (OsStatus != OS_SUCCESS)
+    /*
+     * The latency is only meaningful if this slot was started by the most
+     * recent tick, i.e. the previous slot finished before this tick arrived.
+     */
+    if (!SCH_LAB_Global.LastSlotOverrun)
     {
-        CFE_ES_WriteToSysLog("%s: OS_CountSemCreate failed:RC=%ld\n", __func__, (long)OsStatus);
-        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        OS_GetLocalTime(&Now);
+        LatencyUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, SCH_LAB_Global.TickTime));
+
+        if (LatencyUsec > SlotStats->MaxLatencyUsec)
+        {
+            SlotStats->MaxLatencyUsec = LatencyUsec;
+        }
+        if (LatencyUsec > SCH_LAB_Global.HkTlm.Payload.MaxLatencyUsec)
+        {
+            SCH_LAB_Global.HkTlm.Payload.MaxLatencyUsec = LatencyUsec;
+        }
     }
 
-    /* The underlying timebase object should have been created by the PSP */
-    OsStatus = OS_TimeBaseGetIdByName(&TimeBaseId, "cFS-Master");
-    if (OsStatus != OS_SUCCESS)
+    /*
+    ** Send the packets that are due in this slot
+    */
+    for (Idx = SCH_LAB_Global.SlotStart[Slot]; Idx < SCH_LAB_Global.SlotStart[Slot + 1]; ++Idx)
     {
-        CFE_ES_WriteToSysLog("%s: OS_TimeBaseGetIdByName failed:RC=%ld\n", __func__, (long)OsStatus);
-        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        LocalStateEntry = &SCH_LAB_Global.State[SCH_LAB_Global.Activity[Idx]];
+
+        if (LocalStateEntry->MajorFrameDivisor <= 1 ||
+            (SCH_LAB_Global.HkTlm.Payload.MajorFrameCount % LocalStateEntry->MajorFrameDivisor) ==
+                LocalStateEntry->MajorFramePhase)
+        {
+            CFE_SB_TransmitMsg(CFE_MSG_PTR(LocalStateEntry->CommandHeader), true);
+        }
     }
 
-    /* Create the timer callback (but not set yet, as that requires the config table) */
-    OsStatus = OS_TimerAdd(&SCH_LAB_Global.TimerId, "SCH_LAB", TimeBaseId, SCH_LAB_LocalTimerCallback, NULL);
-    if (OsStatus != OS_SUCCESS)
+    /* If the next tick is already pending, this slot took too long */
+    SCH_LAB_Global.LastSlotOverrun = (OS_CountSemGetInfo(SCH_LAB_Global.TimingSem, &SemProp) == OS_SUCCESS &&
+                                      SemProp.value > 0);
+    if (SCH_LAB_Global.LastSlotOverrun)
     {
-        CFE_ES_WriteToSysLog("%s: OS_TimerAdd failed:RC=%ld\n", __func__, (long)OsStatus);
-        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        ++SlotStats->OverrunCount;
+        ++SCH_LAB_Global.HkTlm.Payload.OverrunCount;
     }
 
-    /*
-    ** Register tables with cFE and load default data
-    */
-    Status = CFE_TBL_Register(&SCH_LAB_Global.TblHandle, "Schedule", sizeof(SCH_LAB_ScheduleTable_t),
-                              CFE_TBL_OPT_DEFAULT, NULL);
+    ++SCH_LAB_Global.HkTlm.Payload.MinorFrameCount;
+    ++SCH_LAB_Global.CurrentSlot;
+    if (SCH_LAB_Global.CurrentSlot >= SCH_LAB_Global.MinorFramesPerMajor)
+    {
+        SCH_LAB_Global.CurrentSlot = 0;
+        ++SCH_LAB_Global.HkTlm.Payload.MajorFrameCount;
 
-    if (Status != CFE_SUCCESS)
+        /* A new schedule table is only put into use at a major frame boundary */
+        SCH_LAB_ManageTable();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send housekeeping telemetry                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void SCH_LAB_SendHkCmd(void)
+{
+    uint32 i;
+
+    SCH_LAB_Global.HkTlm.Payload.MinorFramesPerMajor = SCH_LAB_Global.MinorFramesPerMajor;
+    SCH_LAB_Global.HkTlm.Payload.ActivityCount       = SCH_LAB_Global.SlotStart[SCH_LAB_Global.MinorFramesPerMajor];
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(SCH_LAB_Global.HkTlm.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(SCH_LAB_Global.HkTlm.TelemetryHeader), true);
+
+    /* The latency figures are the worst case since the previous report */
+    SCH_LAB_Global.HkTlm.Payload.MaxLatencyUsec = 0;
+    for (i = 0; i < SCH_LAB_MISSION_MAX_MINOR_FRAMES; ++i)
     {
-        CFE_ES_WriteToSysLog("SCH_LAB: Error Registering ScheduleTable, RC = 0x%08lX\n", (unsigned long)Status);
+        SCH_LAB_Global.HkTlm.Payload.Slot[i].MaxLatencyUsec = 0;
+    }
+}
 
-        return Status;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Schedule table helpers                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+static uint32 SCH_LAB_GetMinorFramesPerMajor(const SCH_LAB_ScheduleTable_t *ConfigTable)
+{
+    if (ConfigTable->MinorFramesPerMajor != 0)
+    {
+        return ConfigTable->MinorFramesPerMajor;
     }
-    else
+
+    /* default is one second worth of ticks */
+    if (ConfigTable->TickRate != 0)
     {
-        /*
-        ** Loading Table
-        */
-        Status = CFE_TBL_Load(SCH_LAB_Global.TblHandle, CFE_TBL_SRC_FILE, SCH_LAB_PLATFORM_TBL_DEFAULT_FILE);
-        if (Status != CFE_SUCCESS)
-        {
-            CFE_ES_WriteToSysLog("SCH_LAB: Error Loading Table ScheduleTable, RC = 0x%08lX\n", (unsigned long)Status);
-            CFE_TBL_ReleaseAddress(SCH_LAB_Global.TblHandle);
+        return ConfigTable->TickRate;
+    }
 
-            return Status;
-        }
+    return 1;
+}
+
+CFE_Status_t SCH_LAB_TblValidationFunc(void *TblData)
+{
+    int                                 i;
+    uint32                              MinorFrames;
+    const SCH_LAB_ScheduleTable_t *     ConfigTable = TblData;
+    const SCH_LAB_ScheduleTableEntry_t *ConfigEntry;
+
+    MinorFrames = SCH_LAB_GetMinorFramesPerMajor(ConfigTable);
+    if (ConfigTable->TickRate > 1000000 || MinorFrames > SCH_LAB_MISSION_MAX_MINOR_FRAMES)
+    {
+        CFE_ES_WriteToSysLog("%s: Invalid tick rate %lu or minor frames per major %lu\n", __func__,
+                             (unsigned long)ConfigTable->TickRate, (unsigned long)MinorFrames);
+        return SCH_LAB_PLATFORM_TABLE_INVALID_ERR_CODE;
     }
 
-    /*
-    ** Get Table Address
-    */
-    Status = CFE_TBL_GetAddress(&TableAddr, SCH_LAB_Global.TblHandle);
-    if (Status != CFE_SUCCESS && Status != CFE_TBL_INFO_UPDATED)
+    ConfigEntry = ConfigTable->Config;
+    for (i = 0; i < SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES; i++)
     {
-        CFE_ES_WriteToSysLog("SCH_LAB: Error Getting Table's Address ScheduleTable, RC = 0x%08lX\n",
-                             (unsigned long)Status);
+        if (ConfigEntry->PacketRate != 0)
+        {
+            /* Every entry must hit the same slot(s) in every major frame it is sent in */
+            if ((MinorFrames % ConfigEntry->PacketRate) != 0 && (ConfigEntry->PacketRate % MinorFrames) != 0)
+            {
+                CFE_ES_WriteToSysLog("%s: Entry %d rate %lu does not fit major frame of %lu\n", __func__, i,
+                                     (unsigned long)ConfigEntry->PacketRate, (unsigned long)MinorFrames);
+                return SCH_LAB_PLATFORM_TABLE_INVALID_ERR_CODE;
+            }
 
-        return Status;
+            if (ConfigEntry->Offset >= ConfigEntry->PacketRate ||
+                ConfigEntry->PayloadLength > sizeof(ConfigEntry->MessageBuffer))
+            {
+                CFE_ES_WriteToSysLog("%s: Entry %d has invalid offset or payload length\n", __func__, i);
+                return SCH_LAB_PLATFORM_TABLE_INVALID_ERR_CODE;
+            }
+        }
+        ++ConfigEntry;
     }
 
-    /*
-    ** Initialize the command headers
-    */
-    ConfigTable     = TableAddr;
+    return CFE_SUCCESS;
+}
+
+/*
+ * Put a (validated) schedule table into use.  This initializes the command
+ * headers and builds the per-slot activity lists.
+ */
+static void SCH_LAB_ApplyTable(const SCH_LAB_ScheduleTable_t *ConfigTable)
+{
+    int                                 i, x;
+    uint32                              Slot;
+    uint16                              ActivityCount;
+    const SCH_LAB_ScheduleTableEntry_t *ConfigEntry;
+    SCH_LAB_StateEntry_t *              LocalStateEntry;
+
+    memset(SCH_LAB_Global.State, 0, sizeof(SCH_LAB_Global.State));
+    memset(SCH_LAB_Global.HkTlm.Payload.Slot, 0, sizeof(SCH_LAB_Global.HkTlm.Payload.Slot));
+
+    SCH_LAB_Global.MinorFramesPerMajor = SCH_LAB_GetMinorFramesPerMajor(ConfigTable);
+    SCH_LAB_Global.CurrentSlot         = 0;
+
     ConfigEntry     = ConfigTable->Config;
     LocalStateEntry = SCH_LAB_Global.State;
 
@@ -244,34 +350,113 @@ CFE_Status_t SCH_LAB_AppInit(void)
                          sizeof(LocalStateEntry->CommandHeader) + ConfigEntry->PayloadLength);
             CFE_MSG_SetFcnCode(CFE_MSG_PTR(LocalStateEntry->CommandHeader), ConfigEntry->FcnCode);
 
-            LocalStateEntry->PacketRate    = ConfigEntry->PacketRate;
             LocalStateEntry->PayloadLength = ConfigEntry->PayloadLength;
 
             for (x = 0; x < SCH_LAB_MISSION_MAX_ARGS_PER_ENTRY; x++)
             {
                 LocalStateEntry->MessageBuffer[x] = ConfigEntry->MessageBuffer[x];
             }
+
+            if (ConfigEntry->PacketRate > SCH_LAB_Global.MinorFramesPerMajor)
+            {
+                /* Slower than the major frame: once per major frame, but only in some of them */
+                LocalStateEntry->SlotInterval      = SCH_LAB_Global.MinorFramesPerMajor;
+                LocalStateEntry->SlotOffset        = ConfigEntry->Offset % SCH_LAB_Global.MinorFramesPerMajor;
+                LocalStateEntry->MajorFrameDivisor = ConfigEntry->PacketRate / SCH_LAB_Global.MinorFramesPerMajor;
+                LocalStateEntry->MajorFramePhase   = ConfigEntry->Offset / SCH_LAB_Global.MinorFramesPerMajor;
+            }
+            else
+            {
+                LocalStateEntry->SlotInterval      = ConfigEntry->PacketRate;
+                LocalStateEntry->SlotOffset        = ConfigEntry->Offset;
+                LocalStateEntry->MajorFrameDivisor = 1;
+                LocalStateEntry->MajorFramePhase   = 0;
+            }
         }
         ++ConfigEntry;
         ++LocalStateEntry;
     }
 
+    /* Build the activity list for each slot, in table order */
+    ActivityCount = 0;
+    for (Slot = 0; Slot < SCH_LAB_Global.MinorFramesPerMajor; ++Slot)
+    {
+        SCH_LAB_Global.SlotStart[Slot] = ActivityCount;
+
+        LocalStateEntry = SCH_LAB_Global.State;
+        for (i = 0; i < SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES; i++)
+        {
+            if (LocalStateEntry->SlotInterval != 0 &&
+                (Slot % LocalStateEntry->SlotInterval) == LocalStateEntry->SlotOffset)
+            {
+                SCH_LAB_Global.Activity[ActivityCount] = i;
+                ++ActivityCount;
+            }
+            ++LocalStateEntry;
+        }
+    }
+    SCH_LAB_Global.SlotStart[Slot] = ActivityCount;
+
     if (ConfigTable->TickRate == 0)
     {
         /* use default of 1 second */
         CFE_ES_WriteToSysLog("%s: Using default tick rate of 1 second\n", __func__);
-        TimerPeriod = 1000000;
+        SCH_LAB_Global.TimerPeriod = 1000000;
     }
     else
     {
-        TimerPeriod = 1000000 / ConfigTable->TickRate;
-        if ((TimerPeriod * ConfigTable->TickRate) != 1000000)
+        SCH_LAB_Global.TimerPeriod = 1000000 / ConfigTable->TickRate;
+        if ((SCH_LAB_Global.TimerPeriod * ConfigTable->TickRate) != 1000000)
         {
             CFE_ES_WriteToSysLog("%s: WARNING: tick rate of %lu is not an integer number of microseconds\n", __func__,
                                  (unsigned long)ConfigTable->TickRate);
         }
     }
 
+    ++SCH_LAB_Global.HkTlm.Payload.TableUpdateCount;
+}
+
+/*
+ * Check for a new schedule table, and put it into use if there is one
+ */
+CFE_Status_t SCH_LAB_ManageTable(void)
+{
+    CFE_Status_t Status;
+    int32        OsStatus;
+    uint32       PrevTimerPeriod;
+    void *       TableAddr;
+
+    PrevTimerPeriod = SCH_LAB_Global.TimerPeriod;
+
+    CFE_TBL_Manage(SCH_LAB_Global.TblHandle);
+
+    /*
+    ** Get Table Address
+    */
+    Status = CFE_TBL_GetAddress(&TableAddr, SCH_LAB_Global.TblHandle);
+    if (Status != CFE_SUCCESS && Status != CFE_TBL_INFO_UPDATED)
+    {
+        CFE_ES_WriteToSysLog("SCH_LAB: Error Getting Table's Address ScheduleTable, RC = 0x%08lX\n",
+                             (unsigned long)Status);
+
+        return Status;
+    }
+
+    if (Status == CFE_TBL_INFO_UPDATED)
+    {
+        SCH_LAB_ApplyTable(TableAddr);
+
+        /* The timer is only running after the first table has been applied */
+        if (PrevTimerPeriod != 0 && PrevTimerPeriod != SCH_LAB_Global.TimerPeriod)
+        {
+            OsStatus = OS_TimerSet(SCH_LAB_Global.TimerId, SCH_LAB_Global.TimerPeriod, SCH_LAB_Global.TimerPeriod);
+            if (OsStatus != OS_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: OS_TimerSet failed:RC=%ld\n", __func__, (long)OsStatus);
+            }
+        }
+    }
+
     /*
     ** Release the table
     */
@@ -281,6 +466,85 @@ CFE_Status_t SCH_LAB_AppInit(void)
         CFE_ES_WriteToSysLog("SCH_LAB: Error Releasing Table ScheduleTable, RC = 0x%08lX\n", (unsigned long)Status);
     }
 
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialization                                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t SCH_LAB_AppInit(void)
+{
+    CFE_Status_t Status;
+    int32        OsStatus;
+    osal_id_t    TimeBaseId = OS_OBJECT_ID_UNDEFINED;
+    char         VersionString[SCH_LAB_CFG_MAX_VERSION_STR_LEN];
+
+    memset(&SCH_LAB_Global, 0, sizeof(SCH_LAB_Global));
+
+    CFE_MSG_Init(CFE_MSG_PTR(SCH_LAB_Global.HkTlm.TelemetryHeader), CFE_SB_ValueToMsgId(SCH_LAB_HK_TLM_MID),
+                 sizeof(SCH_LAB_Global.HkTlm));
+
+    OsStatus = OS_CountSemCreate(&SCH_LAB_Global.TimingSem, "SCH_LAB", 0, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: OS_CountSemCreate failed:RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* The underlying timebase object should have been created by the PSP */
+    OsStatus = OS_TimeBaseGetIdByName(&TimeBaseId, "cFS-Master");
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: OS_TimeBaseGetIdByName failed:RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* Create the timer callback (but not set yet, as that requires the config table) */
+    OsStatus = OS_TimerAdd(&SCH_LAB_Global.TimerId, "SCH_LAB", TimeBaseId, SCH_LAB_LocalTimerCallback, NULL);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: OS_TimerAdd failed:RC=%ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /*
+    ** Register tables with cFE and load default data
+    */
+    Status = CFE_TBL_Register(&SCH_LAB_Global.TblHandle, "Schedule", sizeof(SCH_LAB_ScheduleTable_t),
+                              CFE_TBL_OPT_DEFAULT, SCH_LAB_TblValidationFunc);
+
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("SCH_LAB: Error Registering ScheduleTable, RC = 0x%08lX\n", (unsigned long)Status);
+
+        return Status;
+    }
+    else
+    {
+        /*
+        ** Loading Table
+        */
+        Status = CFE_TBL_Load(SCH_LAB_Global.TblHandle, CFE_TBL_SRC_FILE, SCH_LAB_PLATFORM_TBL_DEFAULT_FILE);
+        if (Status != CFE_SUCCESS)
+        {
+            CFE_ES_WriteToSysLog("SCH_LAB: Error Loading Table ScheduleTable, RC = 0x%08lX\n", (unsigned long)Status);
+            CFE_TBL_ReleaseAddress(SCH_LAB_Global.TblHandle);
+
+            return Status;
+        }
+    }
+
+    /*
+    ** Initialize the command headers and activity lists
+    */
+    Status = SCH_LAB_ManageTable();
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
     /* Create pipe and subscribe to the 1Hz pkt */
     Status = CFE_SB_CreatePipe(&SCH_LAB_Global.CmdPipe, 8, "SCH_LAB_CMD_PIPE");
     if (Status != CFE_SUCCESS)
@@ -294,8 +558,14 @@ CFE_Status_t SCH_LAB_AppInit(void)
         OS_printf("SCH Error subscribing to 1hz!\n");
     }
 
+    Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(SCH_LAB_SEND_HK_MID), SCH_LAB_Global.CmdPipe);
+    if (Status != CFE_SUCCESS)
+    {
+        OS_printf("SCH Error subscribing to HK request!\n");
+    }
+
     /* Set timer period */
-    OsStatus = OS_TimerSet(SCH_LAB_Global.TimerId, 1000000, TimerPeriod);
+    OsStatus = OS_TimerSet(SCH_LAB_Global.TimerId, 1000000, SCH_LAB_Global.TimerPeriod);
     if (OsStatus != OS_SUCCESS)
     {
         CFE_ES_WriteToSysLog("%s: OS_TimerSet failed:RC=%ld\n", __func__, (long)OsStatus);
@@ -22,19 +22,26 @@
 
 /* This is for the standard set of CFE core app MsgID values */
 #include "cfe_msgids.h"
+#include "sch_lab_msgids.h"
 
 /*
 ** SCH Lab schedule table
 ** When populating this table:
-**  1. The entire table is processed (SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES) but entries with a
-**     packet rate of 0 are skipped
-**  2. You can have commented out entries or entries with a packet rate of 0
-**  3. If the table grows too big, increase SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES
+**  1. The timer ticks TickRate times per second, each tick is one minor frame (slot)
+**  2. MinorFramesPerMajor slots make up one major frame, 0 means one second worth of slots
+**  3. Entries with a packet rate of 0 are skipped, you can have commented out entries
+**     or entries with a packet rate of 0
+**  4. An entry is sent every PacketRate slots, starting in the slot given by Offset.
+**     The PacketRate must either divide the major frame, or be a multiple of it,
+**     and Offset must be less than PacketRate.  Use different offsets to spread
+**     out entries with the same rate, rather than sending them all in one slot.
+**  5. If the table grows too big, increase SCH_LAB_MISSION_MAX_SCHEDULE_ENTRIES
 */
 
 SCH_LAB_ScheduleTable_t Schedule = {
-    .TickRate = 100,
-    .Config   = {
+    .TickRate            = 100,
+    .MinorFramesPerMajor = 100,
+    .Config              = {
         /*
         ** This is an empty default table.
         ** Projects should override this default table with their own configurations.
@@ -43,11 +50,12 @@ SCH_LAB_ScheduleTable_t Schedule = {
         {CFE_SB_MSGID_RESERVED, 0, 0},
         /*
         ** Example of a cFE HK packet requests
-        {CFE_SB_MSGID_WRAP_VALUE(CFE_ES_SEND_HK_MID), 100, 0},
-        {CFE_SB_MSGID_WRAP_VALUE(CFE_TBL_SEND_HK_MID), 50, 0},
-        {CFE_SB_MSGID_WRAP_VALUE(CFE_TIME_SEND_HK_MID), 98, 0},
-        {CFE_SB_MSGID_WRAP_VALUE(CFE_SB_SEND_HK_MID), 97, 0},
-        {CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_SEND_HK_MID), 96, 0},
+        {CFE_SB_MSGID_WRAP_VALUE(CFE_ES_SEND_HK_MID), 100, 0, .Offset = 0},
+        {CFE_SB_MSGID_WRAP_VALUE(CFE_TBL_SEND_HK_MID), 50, 0, .Offset = 10},
+        {CFE_SB_MSGID_WRAP_VALUE(CFE_TIME_SEND_HK_MID), 100, 0, .Offset = 20},
+        {CFE_SB_MSGID_WRAP_VALUE(CFE_SB_SEND_HK_MID), 100, 0, .Offset = 30},
+        {CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_SEND_HK_MID), 100, 0, .Offset = 40},
+        {CFE_SB_MSGID_WRAP_VALUE(SCH_LAB_SEND_HK_MID), 500, 0, .Offset = 50},
         */
     }
 };
@@ -13,9 +13,13 @@ set(SCH_LAB_MISSION_CONFIG_FILE_LIST
   sch_lab_interface_cfg_values.h
   sch_lab_mission_cfg.h
   sch_lab_perfids.h
+  sch_lab_msg.h
+  sch_lab_msgdefs.h
+  sch_lab_msgstruct.h
   sch_lab_tbl.h
   sch_lab_tbldefs.h
   sch_lab_tblstruct.h
+  sch_lab_topicid_values.h
 )
 
 generate_configfile_set(${SCH_LAB_MISSION_CONFIG_FILE_LIST})
@@ -45,8 +45,11 @@ TO_LAB_GlobalData_t TO_LAB_Global;
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void TO_LAB_AppMain(void)
 {
-    uint32       RunStatus = CFE_ES_RunStatus_APP_RUN;
-    CFE_Status_t status;
+    uint32            RunStatus = CFE_ES_RunStatus_APP_RUN;
+    CFE_Status_t      status;
+    int32             OsStatus;
+    OS_PollSetEvent_t Events[2];
+    uint32            EventCount;
 
     CFE_ES_PerfLogEntry(TO_LAB_MAIN_TASK_PERF_ID);
 
@@ -67,7 +70,27 @@ void TO_LAB_AppMain(void)
     {
         CFE_ES_PerfLogExit(TO_LAB_MAIN_TASK_PERF_ID);
 
-        OS_TaskDelay(TO_LAB_PLATFORM_TASK_MSEC);
+        if (TO_LAB_Global.EventDriven)
+        {
+            /*
+             * Wake as soon as telemetry or a command arrives, rather than at a fixed
+             * rate.  Both pipes are drained below regardless of which one was ready.
+             */
+            OsStatus = OS_PollSetWait(TO_LAB_Global.PollSetID, Events, sizeof(Events) / sizeof(Events[0]),
+                                      &EventCount, TO_LAB_PLATFORM_TASK_MSEC);
+            if (OsStatus != OS_SUCCESS && OsStatus != OS_ERROR_TIMEOUT)
+            {
+                /* Errors here do not clear by themselves, so do not spin on them */
+                CFE_EVS_SendEvent(TO_LAB_POLLSET_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "TO: wait on poll set failed, RC = %d", (int)OsStatus);
+                RunStatus = CFE_ES_RunStatus_APP_ERROR;
+                continue;
+            }
+        }
+        else
+        {
+            OS_TaskDelay(TO_LAB_PLATFORM_TASK_MSEC);
+        }
 
         CFE_ES_PerfLogEntry(TO_LAB_MAIN_TASK_PERF_ID);
 
@@ -225,6 +248,8 @@ CFE_Status_t TO_LAB_init(void)
 
         CFE_EVS_SendEvent(TO_LAB_INIT_INF_EID, CFE_EVS_EventType_INFORMATION,
                           "TO Lab Initialized.%s, Awaiting enable command.", VersionString);
+
+        TO_LAB_PollSetInit();
     }
 
     /*
@@ -235,6 +260,53 @@ CFE_Status_t TO_LAB_init(void)
     return status;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* TO_LAB_PollSetInit() -- Set up waiting on both pipes            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void TO_LAB_PollSetInit(void)
+{
+    int32     status;
+    osal_id_t PipeWaitId;
+
+    /*
+     * If the OS cannot poll the pipes, the main loop stays on the
+     * fixed TO_LAB_PLATFORM_TASK_MSEC delay.
+     */
+    status = OS_PollSetCreate(&TO_LAB_Global.PollSetID, "TO_LAB_POLLSET", 0);
+    if (status != OS_SUCCESS)
+    {
+        return;
+    }
+
+    status = CFE_SB_GetPipeWaitId(TO_LAB_Global.Tlm_pipe, &PipeWaitId);
+    if (status == CFE_SUCCESS)
+    {
+        status = OS_PollSetAdd(TO_LAB_Global.PollSetID, PipeWaitId, OS_STREAM_STATE_READABLE);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        status = CFE_SB_GetPipeWaitId(TO_LAB_Global.Cmd_pipe, &PipeWaitId);
+    }
+
+    if (status == CFE_SUCCESS)
+    {
+        status = OS_PollSetAdd(TO_LAB_Global.PollSetID, PipeWaitId, OS_STREAM_STATE_READABLE);
+    }
+
+    if (status == OS_SUCCESS)
+    {
+        TO_LAB_Global.EventDriven = true;
+    }
+    else
+    {
+        CFE_ES_WriteToSysLog("TO_LAB: Event driven output not available, RC = %d\n", (int)status);
+        OS_PollSetDelete(TO_LAB_Global.PollSetID);
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* TO_LAB_process_commands() -- Process command pipe message       */
@@ -47,6 +47,8 @@ typedef struct
     CFE_SB_PipeId_t Tlm_pipe;
     CFE_SB_PipeId_t Cmd_pipe;
     osal_id_t       TLMsockid;
+    osal_id_t       PollSetID;
+    bool            EventDriven;
     bool            downlink_on;
     char            tlm_dest_IP[17];
     bool            suppress_sendto;
@@ -67,6 +69,7 @@ typedef struct
 void  TO_LAB_AppMain(void);
 void  TO_LAB_openTLM(void);
 int32 TO_LAB_init(void);
+void  TO_LAB_PollSetInit(void);
 void  TO_LAB_process_commands(void);
 void  TO_LAB_forward_telemetry(void);
 
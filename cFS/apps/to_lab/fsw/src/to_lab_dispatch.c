@@ -22,6 +22,7 @@
  */
 
 #include "cfe.h"
+#include "cfe_msg_inline.h"
 
 #include "to_lab_app.h"
 #include "to_lab_dispatch.h"
@@ -30,6 +31,30 @@
 #include "to_lab_eventids.h"
 #include "to_lab_msgids.h"
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_NoopCmd_t, TO_LAB_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_ResetCountersCmd_t, TO_LAB_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_SendDataTypesCmd_t, TO_LAB_SendDataTypesCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_AddPacketCmd_t, TO_LAB_AddPacketCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_RemovePacketCmd_t, TO_LAB_RemovePacketCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_RemoveAllCmd_t, TO_LAB_RemoveAllCmd)
+CFE_SB_CMD_DISPATCH_FUNC(TO_LAB_EnableOutputCmd_t, TO_LAB_EnableOutputCmd)
+
+/*
+ * Dispatch table for TO ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t TO_LAB_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_NOOP_CC, TO_LAB_NoopCmd_t, TO_LAB_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_RESET_STATUS_CC, TO_LAB_ResetCountersCmd_t, TO_LAB_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_SEND_DATA_TYPES_CC, TO_LAB_SendDataTypesCmd_t, TO_LAB_SendDataTypesCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_ADD_PKT_CC, TO_LAB_AddPacketCmd_t, TO_LAB_AddPacketCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_REMOVE_PKT_CC, TO_LAB_RemovePacketCmd_t, TO_LAB_RemovePacketCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_REMOVE_ALL_PKT_CC, TO_LAB_RemoveAllCmd_t, TO_LAB_RemoveAllCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(TO_LAB_OUTPUT_ENABLE_CC, TO_LAB_EnableOutputCmd_t, TO_LAB_EnableOutputCmd),
+};
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /*  TO_LAB_ProcessGroundCommand() -- Process local message           */
@@ -37,47 +62,33 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void TO_LAB_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t FcnCode = 0;
+    CFE_MSG_FcnCode_t                FcnCode      = 0;
+    CFE_MSG_Size_t                   ActualLength = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
+    FcnCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
-    switch (FcnCode)
+    Entry = CFE_SB_GetCmdDispatchEntry(TO_LAB_CMD_DISPATCH_TABLE,
+                                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(TO_LAB_CMD_DISPATCH_TABLE), FcnCode);
+    if (Entry == NULL)
     {
-        case TO_LAB_NOOP_CC:
-            TO_LAB_NoopCmd((const TO_LAB_NoopCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_RESET_STATUS_CC:
-            TO_LAB_ResetCountersCmd((const TO_LAB_ResetCountersCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_SEND_DATA_TYPES_CC:
-            TO_LAB_SendDataTypesCmd((const TO_LAB_SendDataTypesCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_ADD_PKT_CC:
-            TO_LAB_AddPacketCmd((const TO_LAB_AddPacketCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_REMOVE_PKT_CC:
-            TO_LAB_RemovePacketCmd((const TO_LAB_RemovePacketCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_REMOVE_ALL_PKT_CC:
-            TO_LAB_RemoveAllCmd((const TO_LAB_RemoveAllCmd_t *)SBBufPtr);
-            break;
-
-        case TO_LAB_OUTPUT_ENABLE_CC:
-            TO_LAB_EnableOutputCmd((const TO_LAB_EnableOutputCmd_t *)SBBufPtr);
-            break;
+        CFE_EVS_SendEvent(TO_LAB_FNCODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO: Invalid Function Code Rcvd In Ground Command 0x%x", __LINE__, (unsigned int)FcnCode);
+        ++TO_LAB_Global.HkTlm.Payload.CommandErrorCounter;
+        return;
+    }
 
-        default:
-            CFE_EVS_SendEvent(TO_LAB_FNCODE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "L%d TO: Invalid Function Code Rcvd In Ground Command 0x%x", __LINE__,
-                              (unsigned int)FcnCode);
-            ++TO_LAB_Global.HkTlm.Payload.CommandErrorCounter;
-            break;
+    ActualLength = CFE_MSG_InlineGetSize(&SBBufPtr->Msg);
+    if (ActualLength != Entry->ExpectedLength)
+    {
+        CFE_EVS_SendEvent(TO_LAB_CMD_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "L%d TO: Invalid Msg Length: CC = %u, Len = %u, Expected = %u", __LINE__,
+                          (unsigned int)FcnCode, (unsigned int)ActualLength, (unsigned int)Entry->ExpectedLength);
+        ++TO_LAB_Global.HkTlm.Payload.CommandErrorCounter;
+        return;
     }
+
+    Entry->Handler(SBBufPtr);
 }
 
 void TO_LAB_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
@@ -94,7 +105,7 @@ void TO_LAB_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
         SEND_HK_MID = CFE_SB_ValueToMsgId(TO_LAB_SEND_HK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MsgId);
+    MsgId = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     /* Process all SB messages */
     if (CFE_SB_MsgId_Equal(MsgId, SEND_HK_MID))
@@ -25,6 +25,7 @@
 #define TO_LAB_DISPATCH_H
 
 #include "common_types.h"
+#include "cfe_sb_api_typedefs.h"
 
 /******************************************************************************/
 
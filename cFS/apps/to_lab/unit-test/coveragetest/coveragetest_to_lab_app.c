@@ -0,0 +1,243 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: coveragetest_to_lab_app.c
+**
+** Purpose:
+** Coverage Unit Test cases for the TO Lab main loop
+**
+** Notes:
+** These cases drive TO_LAB_AppMain() through a single pass of the run loop
+** for each way the poll set wait can complete: timeout, error, a command
+** ready on the command pipe and telemetry ready on the telemetry pipe.
+*/
+
+/*
+ * Includes
+ */
+#include <string.h>
+
+#include "cfe.h"
+#include "to_lab_app.h"
+#include "to_lab_eventids.h"
+#include "to_lab_dispatch.h"
+#include "to_lab_encode.h"
+#include "to_lab_tbl.h"
+
+#include "utassert.h"
+#include "uttest.h"
+#include "utstubs.h"
+
+#define ADD_TEST(test) UtTest_Add((Test_##test), TO_LAB_UT_Setup, TO_LAB_UT_TearDown, #test)
+
+#define TO_LAB_UT_MAX_EVENTS 8
+
+static TO_LAB_Subs_t   UT_SubsTbl;
+static CFE_SB_Buffer_t UT_SBBuffer;
+static uint16          UT_EventIds[TO_LAB_UT_MAX_EVENTS];
+static uint32          UT_ExitStatus;
+
+/*
+ * Record the status the app exits with
+ */
+static void UT_Handler_CFE_ES_ExitApp(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_ExitStatus = UT_Hook_GetArgValueByName(Context, "ExitStatus", uint32);
+}
+
+/*
+ * Turn the downlink on once init is done, as the enable command would
+ */
+static void UT_Handler_OS_PollSetWait(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    uint32 *EventCount = UT_Hook_GetArgValueByName(Context, "EventCount", uint32 *);
+
+    TO_LAB_Global.downlink_on = true;
+    *EventCount               = 1;
+}
+
+/*
+ * Checks whether the given event was sent at any point during the test
+ */
+static bool UT_EventWasSent(uint16 EventId)
+{
+    size_t Count = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    size_t i;
+
+    if (Count > TO_LAB_UT_MAX_EVENTS)
+    {
+        Count = TO_LAB_UT_MAX_EVENTS;
+    }
+
+    for (i = 0; i < Count; ++i)
+    {
+        if (UT_EventIds[i] == EventId)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+**********************************************************************************
+**          TEST CASE FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_TO_LAB_AppMain_Timeout(void)
+{
+    /*
+     * Nothing became ready before the timeout: both pipes are checked once
+     * without anything to forward or dispatch, and the app keeps running.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetWait), 1, OS_ERROR_TIMEOUT);
+
+    TO_LAB_AppMain();
+
+    UtAssert_BOOL_TRUE(TO_LAB_Global.EventDriven);
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(TO_LAB_TaskPipe, 0);
+    UtAssert_STUB_COUNT(OS_SocketSendTo, 0);
+    UtAssert_BOOL_FALSE(UT_EventWasSent(TO_LAB_POLLSET_ERR_EID));
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_TO_LAB_AppMain_PollError(void)
+{
+    /*
+     * A hard error from the wait must not be retried in a tight loop; the app
+     * reports it and leaves through the normal run loop exit.
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetWait), 1, OS_ERROR);
+
+    TO_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RunLoop, 2);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+    UtAssert_BOOL_TRUE(UT_EventWasSent(TO_LAB_POLLSET_ERR_EID));
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_ERROR);
+}
+
+void Test_TO_LAB_AppMain_CmdReady(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_SBBuffer;
+
+    /*
+     * A command is waiting: the telemetry pipe comes up empty, then the
+     * command is dispatched and the command pipe drained.
+     */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+
+    TO_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(TO_LAB_TaskPipe, 1);
+    UtAssert_STUB_COUNT(OS_SocketSendTo, 0);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_TO_LAB_AppMain_TlmReady(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_SBBuffer;
+
+    /*
+     * Telemetry is waiting: it is encoded and sent, the telemetry pipe is
+     * drained, and the command pipe is still checked.
+     */
+    UT_SetHandlerFunction(UT_KEY(OS_PollSetWait), UT_Handler_OS_PollSetWait, NULL);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 1, CFE_SUCCESS);
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+
+    TO_LAB_AppMain();
+
+    UtAssert_STUB_COUNT(OS_PollSetWait, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 3);
+    UtAssert_STUB_COUNT(TO_LAB_EncodeOutputMessage, 1);
+    UtAssert_STUB_COUNT(OS_SocketSendTo, 1);
+    UtAssert_STUB_COUNT(TO_LAB_TaskPipe, 0);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+void Test_TO_LAB_AppMain_NoPollSet(void)
+{
+    /*
+     * Without a poll set the loop falls back to the fixed delay
+     */
+    UT_SetDeferredRetcode(UT_KEY(OS_PollSetCreate), 1, OS_ERROR);
+
+    TO_LAB_AppMain();
+
+    UtAssert_BOOL_FALSE(TO_LAB_Global.EventDriven);
+    UtAssert_STUB_COUNT(OS_PollSetWait, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_UINT32_EQ(UT_ExitStatus, CFE_ES_RunStatus_APP_RUN);
+}
+
+/*
+ * Setup function prior to every test
+ */
+void TO_LAB_UT_Setup(void)
+{
+    static void *SubsTblPtr;
+
+    UT_ResetState(0);
+
+    memset(&UT_SubsTbl, 0, sizeof(UT_SubsTbl));
+    memset(UT_EventIds, 0, sizeof(UT_EventIds));
+    UT_ExitStatus = CFE_ES_RunStatus_UNDEFINED;
+
+    /* An empty subscription table, so init subscribes to nothing */
+    SubsTblPtr = &UT_SubsTbl;
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &SubsTblPtr, sizeof(SubsTblPtr), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_IsValidMsgId), false);
+
+    /* Run exactly one pass of the main loop */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_RunLoop), 1, true);
+
+    /* By default neither pipe has anything waiting */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    UT_SetDataBuffer(UT_KEY(CFE_EVS_SendEvent), UT_EventIds, sizeof(UT_EventIds), false);
+    UT_SetHandlerFunction(UT_KEY(CFE_ES_ExitApp), UT_Handler_CFE_ES_ExitApp, NULL);
+}
+
+/*
+ * Teardown function after every test
+ */
+void TO_LAB_UT_TearDown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(TO_LAB_AppMain_Timeout);
+    ADD_TEST(TO_LAB_AppMain_PollError);
+    ADD_TEST(TO_LAB_AppMain_CmdReady);
+    ADD_TEST(TO_LAB_AppMain_TlmReady);
+    ADD_TEST(TO_LAB_AppMain_NoPollSet);
+}
@@ -421,6 +421,7 @@ function(add_cfe_coverage_test MODULE_NAME)
 
     # Add it to the set of tests to run as part of "make test"
     add_test(${TEST_NAME} ${RUNNER_TARGET})
+    set_tests_properties(${TEST_NAME} PROPERTIES ENVIRONMENT "UTASSERT_JOBS=${UT_COVERAGE_TEST_JOBS}")
     foreach(TGT ${INSTALL_TARGET_LIST})
         install(TARGETS ${RUNNER_TARGET} DESTINATION ${TGT})
     endforeach()
@@ -35,6 +35,13 @@ if (ENABLE_ASAN)
   add_link_options(-fsanitize=address)
 endif(ENABLE_ASAN)
 
+# Inline message header accessors.  When enabled, the command dispatchers in the
+# core services and lab apps read the MsgId, function code and size straight from
+# the message header (see cfe_msg_inline.h) instead of calling the CFE_MSG API.
+# This is only valid with the default header definitions from the msg module, so
+# leave it off if the mission supplies its own cfe_msg_hdr.h.
+set(MISSION_MSG_INLINE_ACCESSORS $ENV{MISSION_MSG_INLINE_ACCESSORS} CACHE BOOL "Inline CFE_MSG header accessors")
+
 # The stringop/format truncation and overflow warnings tend to produce lots of false positives
 # CFE code is designed to handle/tolerate string truncation so it is generally not a real issue
 if ("${CMAKE_C_COMPILER_ID}" STREQUAL "GNU" AND CMAKE_C_COMPILER_VERSION VERSION_GREATER_EQUAL 8.0.0)
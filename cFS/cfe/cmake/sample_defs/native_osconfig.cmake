@@ -56,3 +56,20 @@ set(OSAL_CONFIG_DEBUG_PERMISSIVE_MODE TRUE)
 # However for a flight deployment this may cause undesired delays.
 #
 set(OSAL_CONFIG_UTILITYTASK_PRIORITY 10)
+
+
+#
+# OSAL_CONFIG_MAX_NUM_OPEN_FILES
+# ------------------------------
+#
+# Allow several hundred concurrently open streams in the native build
+#
+# The OSAL pollset-test benchmark opens as many sockets as the stream
+# table allows, up to 256, to compare OS_PollSetWait() against
+# OS_SelectMultiple() on the large socket sets that poll sets are meant
+# for.  The default of 50 keeps that comparison to a few dozen sockets.
+#
+# The limit stays below the FD_SETSIZE of the host C library, so that the
+# select() based APIs can still handle every stream.
+#
+set(OSAL_CONFIG_MAX_NUM_OPEN_FILES 300)
@@ -27,6 +27,7 @@
 
 #include "cfe_test.h"
 #include "cfe_test_msgids.h"
+#include "cfe_msg_inline.h"
 #include <string.h>
 
 void TestMsgApiBasic(void)
@@ -290,9 +291,114 @@ void TestMsgHeaderSecondaryApi(void)
     }
 }
 
+/*
+ * Buffer for checksum timing, large enough for the biggest CCSDS packet tested
+ */
+static union
+{
+    CFE_MSG_CommandHeader_t CmdHdr;
+    uint8                   Bytes[65536];
+} UT_ChecksumPerfBuf;
+
+void TestMsgChecksumPerf(void)
+{
+    CFE_MSG_Message_t *msgptr = CFE_MSG_PTR(UT_ChecksumPerfBuf.CmdHdr);
+    CFE_MSG_Size_t     size;
+    uint32             i;
+    uint32             iterations;
+    bool               isValid;
+    OS_time_t          StartTime;
+    OS_time_t          ElapsedTime;
+
+    UtPrintf("Testing: CFE_MSG_GenerateChecksum timing");
+
+    for (size = 64; size <= sizeof(UT_ChecksumPerfBuf.Bytes); size *= 4)
+    {
+        UtAssert_INT32_EQ(CFE_MSG_Init(msgptr, CFE_SB_ValueToMsgId(CFE_TEST_CMD_MID), size), CFE_SUCCESS);
+        for (i = sizeof(UT_ChecksumPerfBuf.CmdHdr); i < size; ++i)
+        {
+            UT_ChecksumPerfBuf.Bytes[i] = (uint8)i;
+        }
+
+        /* keep the total number of bytes processed roughly constant */
+        iterations = (16 * 1024 * 1024) / size;
+
+        CFE_PSP_GetTime(&StartTime);
+        for (i = 0; i < iterations; ++i)
+        {
+            CFE_MSG_GenerateChecksum(msgptr);
+        }
+        CFE_PSP_GetTime(&ElapsedTime);
+        ElapsedTime = OS_TimeSubtract(ElapsedTime, StartTime);
+
+        UtAssert_MIR("Checksum of %lu byte message, %lu iterations: %lu usec", (unsigned long)size,
+                     (unsigned long)iterations, (unsigned long)OS_TimeGetTotalMicroseconds(ElapsedTime));
+
+        UtAssert_INT32_EQ(CFE_MSG_ValidateChecksum(msgptr, &isValid), CFE_SUCCESS);
+        UtAssert_BOOL_TRUE(isValid);
+    }
+}
+
+void TestMsgAccessorPerf(void)
+{
+    CFE_MSG_CommandHeader_t cmd;
+    CFE_MSG_Message_t *     msgptr = CFE_MSG_PTR(cmd);
+    CFE_MSG_Size_t          size;
+    CFE_SB_MsgId_t          msgId;
+    CFE_MSG_FcnCode_t       fcncode;
+    uint32                  i;
+    uint32                  sum;
+    OS_time_t               StartTime;
+    OS_time_t               ApiTime;
+    OS_time_t               InlineTime;
+
+    UtPrintf("Testing: CFE_MSG_GetSize, CFE_MSG_GetMsgId, CFE_MSG_GetFcnCode vs. inline accessors");
+
+    memset(&cmd, 0, sizeof(cmd));
+    UtAssert_INT32_EQ(CFE_MSG_Init(msgptr, CFE_SB_ValueToMsgId(CFE_TEST_CMD_MID), sizeof(cmd)), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_MSG_SetFcnCode(msgptr, 3), CFE_SUCCESS);
+
+    /* Both must agree, whether or not the inline option is enabled */
+    CFE_MSG_GetSize(msgptr, &size);
+    CFE_MSG_GetMsgId(msgptr, &msgId);
+    CFE_MSG_GetFcnCode(msgptr, &fcncode);
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetSize(msgptr), size);
+    CFE_Assert_MSGID_EQ(CFE_MSG_InlineGetMsgId(msgptr), msgId);
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetFcnCode(msgptr), fcncode);
+
+    sum = 0;
+    CFE_PSP_GetTime(&StartTime);
+    for (i = 0; i < 1000000; ++i)
+    {
+        CFE_MSG_GetSize(msgptr, &size);
+        CFE_MSG_GetMsgId(msgptr, &msgId);
+        CFE_MSG_GetFcnCode(msgptr, &fcncode);
+        sum += size + CFE_SB_MsgIdToValue(msgId) + fcncode;
+    }
+    CFE_PSP_GetTime(&ApiTime);
+    ApiTime = OS_TimeSubtract(ApiTime, StartTime);
+
+    CFE_PSP_GetTime(&StartTime);
+    for (i = 0; i < 1000000; ++i)
+    {
+        sum -= CFE_MSG_InlineGetSize(msgptr) + CFE_SB_MsgIdToValue(CFE_MSG_InlineGetMsgId(msgptr)) +
+               CFE_MSG_InlineGetFcnCode(msgptr);
+    }
+    CFE_PSP_GetTime(&InlineTime);
+    InlineTime = OS_TimeSubtract(InlineTime, StartTime);
+
+    UtAssert_UINT32_EQ(sum, 0);
+    UtAssert_MIR("Header access via API, 1000000 iterations: %lu usec",
+                 (unsigned long)OS_TimeGetTotalMicroseconds(ApiTime));
+    UtAssert_MIR("Header access via inline accessors, 1000000 iterations: %lu usec",
+                 (unsigned long)OS_TimeGetTotalMicroseconds(InlineTime));
+}
+
 void MsgApiTestSetup(void)
 {
     UtTest_Add(TestMsgApiBasic, NULL, NULL, "Test basic message header apis");
     UtTest_Add(TestMsgApiAdvanced, NULL, NULL, "Test advanced message header apis");
     UtTest_Add(TestMsgHeaderSecondaryApi, NULL, NULL, "Test message secondary header apis");
+    UtTest_Add(TestMsgChecksumPerf, NULL, NULL, "Test message checksum performance");
+    UtTest_Add(TestMsgAccessorPerf, NULL, NULL, "Test message header accessor performance");
 }
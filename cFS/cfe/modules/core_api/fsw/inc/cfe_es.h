@@ -1352,6 +1352,55 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
                                                uint16 NumBlockSizes, const size_t *BlockSizes, bool UseMutex,
                                                size_t Alignment);
 
+/*****************************************************************************/
+/**
+** \brief Initializes a memory pool which allocates blocks from fixed size slabs
+**
+** \par Description
+**        This routine initializes a pool of memory supplied by the calling application, in the
+**        same way as #CFE_ES_PoolCreateEx.  The pool memory is divided into slabs of \c SlabSize
+**        bytes, and each slab holds blocks of a single block size.  Once all blocks of a slab are
+**        returned, the slab goes back to a reserve shared by all block sizes.  This avoids running
+**        out of memory for one block size while blocks of other sizes are no longer in use, as
+**        can happen with pools created by #CFE_ES_PoolCreateEx.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# Block sizes for which a slab does not hold at least two blocks are allocated directly
+**           from the pool, as with #CFE_ES_PoolCreateEx.
+**        -# The per block size statistics reported by #CFE_ES_GetMemPoolStats count the blocks
+**           of the slabs currently in use for that block size.
+**
+** \param[out]  PoolID         A pointer to the variable the caller wishes to have the memory pool handle kept in
+**                             @nonnull.
+**
+** \param[in]   MemPtr         A Pointer to the pool of memory created by the calling application @nonnull.
+**
+** \param[in]   Size           The size of the pool of memory @nonzero.
+**
+** \param[in]   NumBlockSizes  The number of different block sizes specified in the \c BlockSizes array,
+**                             see #CFE_ES_PoolCreateEx.
+**
+** \param[in]   BlockSizes     Pointer to an array of sizes to be used instead of the default block sizes,
+**                             see #CFE_ES_PoolCreateEx.
+**
+** \param[in]   UseMutex       Flag indicating whether the new memory pool will be processing with mutex handling or
+**                             not. Valid parameter values are #CFE_ES_USE_MUTEX and #CFE_ES_NO_MUTEX
+**
+** \param[in]   SlabSize       The size of each slab.  This must not be larger than the pool.  If set to 0, the
+**                             pool does not use slabs, and this is the same as #CFE_ES_PoolCreateEx.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
+** \retval #CFE_ES_BAD_ARGUMENT               \copybrief CFE_ES_BAD_ARGUMENT
+** \retval #CFE_ES_NO_RESOURCE_IDS_AVAILABLE  \copybrief CFE_ES_NO_RESOURCE_IDS_AVAILABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \covtest \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_ES_PoolCreateEx, #CFE_ES_GetPoolBuf, #CFE_ES_PutPoolBuf, #CFE_ES_GetMemPoolStats
+**
+******************************************************************************/
+CFE_Status_t CFE_ES_PoolCreateSlab(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                   const size_t *BlockSizes, bool UseMutex, size_t SlabSize);
+
 /*****************************************************************************/
 /**
 ** \brief Deletes a memory pool that was previously created
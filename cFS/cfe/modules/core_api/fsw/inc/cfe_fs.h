@@ -57,6 +57,8 @@
 **           the caller has a legitimate File Descriptor.
 **        -# File offset behavior: Agnostic on entry since it will move the offset to the start of the file,
 **           on success the offset will be at the end of the header, undefined offset behavior for error cases.
+**        -# A \c ContentType of #CFE_FS_COMPRESSED_FILE_CONTENT_ID identifies a file whose content
+**           was written in compressed blocks; read such content with #CFE_FS_ReadBlock.
 **
 ** \param[out] Hdr         Pointer to a variable of type #CFE_FS_Header_t @nonnull that will be
 **                         filled with the contents of the Standard cFE File Header. *Hdr is the contents of the
@@ -71,11 +73,43 @@
 **       OSAL error codes to the caller if failure occurs.  In a future version of CFE, the
 **       status codes will be converted to a value in \ref CFEReturnCodes.
 **
-** \sa #CFE_FS_WriteHeader
+** \sa #CFE_FS_WriteHeader, #CFE_FS_ReadBlock
 **
 ******************************************************************************/
 CFE_Status_t CFE_FS_ReadHeader(CFE_FS_Header_t *Hdr, osal_id_t FileDes);
 
+/*****************************************************************************/
+/**
+** \brief Read the next block of data following the Standard cFE File Header
+**
+** \par Description
+**        Reads file content after the header, undoing the compression stage of the
+**        background file writer where it was used.  If the header content type is
+**        #CFE_FS_COMPRESSED_FILE_CONTENT_ID, each call reads one
+**        #CFE_FS_CompressedBlockHeader_t and its block, and outputs the decompressed
+**        block.  For any other content type this is a plain read of up to \c BufSize bytes.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The header has been read with #CFE_FS_ReadHeader, and the file offset
+**           is at the end of the header, of any secondary header, or of the previous block.
+**        -# A compressed block is read into the end of \c Buffer and decoded towards
+**           the start, so the buffer must hold the encoded and decoded block together.
+**           Twice #CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE is always enough.
+**
+** \param[in]  FileDes  File Descriptor obtained from a previous call to #OS_OpenCreate
+** \param[in]  Hdr      Pointer to the header read from the same file @nonnull
+** \param[out] Buffer   Pointer to the buffer for the data @nonnull
+** \param[in]  BufSize  Size of the buffer @nonzero
+**
+** \return Bytes output to the buffer, 0 at end of file, or error status
+** \retval #CFE_FS_BAD_ARGUMENT                \copybrief CFE_FS_BAD_ARGUMENT
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL  \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_FS_ReadHeader, #CFE_FS_WriteBlock, #CFE_FS_DecompressBlock
+**
+******************************************************************************/
+CFE_Status_t CFE_FS_ReadBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, void *Buffer, size_t BufSize);
+
 /*****************************************************************************/
 /**
 ** \brief Initializes the contents of the Standard cFE File Header
@@ -106,7 +140,9 @@ void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 Sub
 **        File Header. This API will automatically populate the following fields
 **        in the specified #CFE_FS_Header_t:
 **
-**      -# \link #CFE_FS_Header_t::ContentType \c ContentType \endlink - Filled with 0x63464531 ('cFE1')
+**      -# \link #CFE_FS_Header_t::ContentType \c ContentType \endlink - Filled with 0x63464531 ('cFE1'), unless
+**                                                                       the caller has set it to
+**                                                                       #CFE_FS_COMPRESSED_FILE_CONTENT_ID
 **      -# \link #CFE_FS_Header_t::Length \c Length \endlink - Filled with the sizeof(CFE_FS_Header_t)
 **      -# \link #CFE_FS_Header_t::SpacecraftID \c SpacecraftID \endlink - Filled with the Spacecraft ID
 **      -# \link #CFE_FS_Header_t::ProcessorID \c ProcessorID \endlink - Filled with the Processor ID
@@ -138,11 +174,44 @@ void CFE_FS_InitHeader(CFE_FS_Header_t *Hdr, const char *Description, uint32 Sub
 **       OSAL error codes to the caller if failure occurs.  In a future version of CFE, the
 **       status codes will be converted to a value in \ref CFEReturnCodes.
 **
-** \sa #CFE_FS_ReadHeader
+** \sa #CFE_FS_ReadHeader, #CFE_FS_WriteBlock
 **
 ******************************************************************************/
 CFE_Status_t CFE_FS_WriteHeader(osal_id_t FileDes, CFE_FS_Header_t *Hdr);
 
+/*****************************************************************************/
+/**
+** \brief Write data following the Standard cFE File Header
+**
+** \par Description
+**        Writes file content after the header, applying the block compression
+**        stage if the header content type is #CFE_FS_COMPRESSED_FILE_CONTENT_ID.
+**        In that case the data is split into blocks of up to 1 KiB, each compressed
+**        with #CFE_FS_CompressBlock and preceded by a #CFE_FS_CompressedBlockHeader_t,
+**        in the same format as the background file writer.  For any other content
+**        type this is a plain write.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# The header has been written with #CFE_FS_WriteHeader, which leaves \c Hdr
+**           in native byte order, and the file offset is at the end of the header,
+**           of any secondary header, or of the previous block.
+**        -# Each call ends its last block, so callers should pass as much data as is
+**           available at once for the best compression.
+**
+** \param[in] FileDes  File Descriptor obtained from a previous call to #OS_OpenCreate
+** \param[in] Hdr      Pointer to the header written to the same file @nonnull
+** \param[in] Buffer   Pointer to the data to write @nonnull
+** \param[in] BufSize  Size of the data to write
+**
+** \return Bytes of the data written, or error status
+** \retval #CFE_FS_BAD_ARGUMENT                \copybrief CFE_FS_BAD_ARGUMENT
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL  \copybrief CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+** \sa #CFE_FS_WriteHeader, #CFE_FS_ReadBlock
+**
+******************************************************************************/
+CFE_Status_t CFE_FS_WriteBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, const void *Buffer, size_t BufSize);
+
 /*****************************************************************************/
 /**
 ** \brief Modifies the Time Stamp field in the Standard cFE File Header for the specified file
@@ -356,6 +425,63 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta);
 ******************************************************************************/
 bool CFE_FS_BackgroundFileDumpIsPending(const CFE_FS_FileWriteMetaData_t *Meta);
 
+/*****************************************************************************/
+/**
+** \brief Compress a block of data
+**
+** \par Description
+**        Encodes the source data as a single block in the LZ4 block format.  This
+**        is the built-in codec for background file writes, and may be set directly
+**        as the \c Compress member of #CFE_FS_FileWriteMetaData_t.
+**
+** \par Assumptions, External Events, and Notes:
+**        The output is not framed; the size of the source data must be recorded
+**        separately in order to decompress it.  Source blocks larger than 64 KiB
+**        are not compressed.
+**
+** \param[in]  SrcBuf     Pointer to the data to compress @nonnull
+** \param[in]  SrcSize    Size of the data to compress
+** \param[out] DstBuf     Pointer to the buffer for the compressed data @nonnull
+** \param[in]  DstSize    Size of the output buffer
+**
+** \return Size of the compressed data, or 0 if the data could not be compressed
+**         into the output buffer
+**
+** \sa #CFE_FS_DecompressBlock
+**
+******************************************************************************/
+size_t CFE_FS_CompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize);
+
+/*****************************************************************************/
+/**
+** \brief Decompress a block of data
+**
+** \par Description
+**        Decodes a single block in the LZ4 block format, such as one produced by
+**        #CFE_FS_CompressBlock.  Readers of files with the
+**        #CFE_FS_COMPRESSED_FILE_CONTENT_ID content type use this to recover the
+**        data following each #CFE_FS_CompressedBlockHeader_t.
+**
+** \par Assumptions, External Events, and Notes:
+**        The input is fully validated, so a corrupt block will not cause access
+**        outside of the supplied buffers.
+**
+** \param[in]  SrcBuf      Pointer to the compressed data @nonnull
+** \param[in]  SrcSize     Size of the compressed data
+** \param[out] DstBuf      Pointer to the buffer for the decompressed data @nonnull
+** \param[in]  DstSize     Size of the output buffer
+** \param[out] DecodedSize Size of the decompressed data @nonnull
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_FS_BAD_ARGUMENT \copybrief CFE_FS_BAD_ARGUMENT
+**
+** \sa #CFE_FS_CompressBlock
+**
+******************************************************************************/
+CFE_Status_t CFE_FS_DecompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize,
+                                    size_t *DecodedSize);
+
 /**@}*/
 
 #endif /* CFE_FS_H */
@@ -114,6 +114,21 @@ typedef bool (*CFE_FS_FileWriteGetData_t)(void *Meta, uint32 RecordNum, void **B
 typedef void (*CFE_FS_FileWriteOnEvent_t)(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint32 RecordNum,
                                           size_t BlockSize, size_t Position);
 
+/**
+ * Compression routine optionally provided by requester
+ *
+ * Invoked on each block of data collected by the file writer.  CFE_FS_CompressBlock() may
+ * be used directly, or the requester may supply an alternative codec.
+ *
+ * \param[in]  SrcBuf   Pointer to the data to compress
+ * \param[in]  SrcSize  Size of the data to compress
+ * \param[out] DstBuf   Pointer to the buffer for the compressed data
+ * \param[in]  DstSize  Size of the output buffer
+ *
+ * \returns Size of the compressed data, or 0 if the data could not be compressed into the output buffer
+ */
+typedef size_t (*CFE_FS_FileWriteCompress_t)(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize);
+
 /**
  * \brief External Metadata/State object associated with background file writes
  *
@@ -133,6 +148,8 @@ typedef struct CFE_FS_FileWriteMetaData
 
     CFE_FS_FileWriteGetData_t GetData; /**< Application callback to get a data record */
     CFE_FS_FileWriteOnEvent_t OnEvent; /**< Application callback for abstract event processing */
+
+    CFE_FS_FileWriteCompress_t Compress; /**< Optional compression stage, NULL to write the file uncompressed */
 } CFE_FS_FileWriteMetaData_t;
 
 #endif /* CFE_FS_API_TYPEDEFS_H */
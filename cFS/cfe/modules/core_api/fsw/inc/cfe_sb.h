@@ -220,6 +220,35 @@ CFE_Status_t CFE_SB_GetPipeName(char *PipeNameBuf, size_t PipeNameSize, CFE_SB_P
 ** \sa #CFE_SB_CreatePipe #CFE_SB_DeletePipe #CFE_SB_SetPipeOpts #CFE_SB_PIPEOPTS_IGNOREMINE
 **/
 CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *PipeName);
+
+/*****************************************************************************/
+/**
+** \brief Get an OSAL object ID that can be used to wait on a pipe.
+**
+** \par Description
+**          This routine outputs the ID of the OSAL queue underlying a pipe.
+**          The ID can be added to an OSAL poll set (see OS_PollSetAdd()) with
+**          #OS_STREAM_STATE_READABLE, alongside sockets or other file handles.
+**          A single call to OS_PollSetWait() will then wake when either a message
+**          is pending on the pipe or one of the other handles has activity.
+**
+** \par Assumptions, External Events, and Notes:
+**          The ID is only for waiting.  Messages must still be obtained from
+**          the pipe using CFE_SB_ReceiveBuffer(), typically with #CFE_SB_POLL
+**          once the poll set indicates the pipe is readable.  Whether a queue
+**          can be added to a poll set depends on the OSAL implementation.
+**
+** \param[in]  PipeId      The pipe ID of the pipe to wait on.
+**
+** \param[out] WaitIdPtr   The OSAL ID to wait on @nonnull.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**
+** \sa #CFE_SB_CreatePipe #CFE_SB_ReceiveBuffer
+**/
+CFE_Status_t CFE_SB_GetPipeWaitId(CFE_SB_PipeId_t PipeId, osal_id_t *WaitIdPtr);
 /**@}*/
 
 /** @defgroup CFEAPISBSubscription cFE Message Subscription Control APIs
@@ -590,6 +619,85 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IsOrigination);
 
+/*****************************************************************************/
+/**
+** \brief Create a ring of pre-allocated buffers for "zero copy" SB sends.
+**
+** \par Description
+**          This routine pre-allocates a fixed set of software bus buffers for a
+**          message that is published repeatedly, such as housekeeping telemetry.
+**          Each cycle the publisher gets the next idle buffer with
+**          #CFE_SB_GetRingBuffer, fills it in, and sends it with
+**          #CFE_SB_TransmitBuffer.  No buffer is allocated from or returned to the
+**          SB memory pool in steady state, and the message is not copied.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only one ring may exist for a given MsgId, and the ring is owned by the
+**             calling application.  The ring is deleted automatically if the
+**             application exits.
+**          -# A buffer becomes idle again once every recipient has finished with it.
+**             Recipients hold a buffer until their next receive on the same pipe, so the
+**             ring should have at least one more buffer than the deepest subscriber
+**             queue is expected to hold.
+**          -# The buffer content is not cleared when a buffer is reused, it still
+**             contains the message that was last sent from it.
+**
+** \param[in]  MsgId       The message ID that the ring will be used for.
+** \param[in]  MsgSize     The size of each buffer (including the SB message header).
+** \param[in]  NumBuffers  The number of buffers in the ring, no more than
+**                         #CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_CreateBufferRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 NumBuffers);
+
+/*****************************************************************************/
+/**
+** \brief Get the next idle buffer from a buffer ring.
+**
+** \par Description
+**          This routine returns the next buffer of the ring created by
+**          #CFE_SB_CreateBufferRing for the MsgId that is not in use by any
+**          recipient.  The buffer is used exactly like one obtained from
+**          #CFE_SB_AllocateMessageBuffer: it is consumed by a successful call to
+**          #CFE_SB_TransmitBuffer, or may be given back unsent with
+**          #CFE_SB_ReleaseMessageBuffer.  In either case it returns to the ring
+**          rather than to the SB memory pool.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the application that created the ring may get buffers from it.
+**
+** \param[in]  MsgId  The message ID that the ring was created for.
+**
+** \return A pointer to a buffer that message data can be written to for use with
+**         CFE_SB_TransmitBuffer(), or NULL if there is no ring for the MsgId owned
+**         by the caller or all of its buffers are still in use.
+**/
+CFE_SB_Buffer_t *CFE_SB_GetRingBuffer(CFE_SB_MsgId_t MsgId);
+
+/*****************************************************************************/
+/**
+** \brief Delete a buffer ring.
+**
+** \par Description
+**          This routine deletes the ring created by #CFE_SB_CreateBufferRing for the
+**          MsgId.  Idle buffers are returned to the SB memory pool immediately, and
+**          buffers still in use by recipients are returned once they are released.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Only the application that created the ring may delete it.
+**
+** \param[in]  MsgId  The message ID that the ring was created for.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_DeleteBufferRing(CFE_SB_MsgId_t MsgId);
+
 /** @} */
 
 /** @defgroup CFEAPISBMessageCharacteristics cFE Message Characteristics APIs
@@ -854,6 +962,41 @@ static inline CFE_SB_MsgId_t CFE_SB_ValueToMsgId(CFE_SB_MsgId_Atom_t MsgIdValue)
     return Result;
 }
 
+/*****************************************************************************/
+/**
+ * \brief Looks up the entry for a command code in a command dispatch table
+ *
+ * \par Description
+ *    Command dispatch tables are arrays of #CFE_SB_CmdDispatchEntry_t indexed by
+ *    the command code, normally defined at compile time using the
+ *    #CFE_SB_CMD_DISPATCH_ENTRY macro.  This gets the entry for the given command
+ *    code, which is a constant time operation regardless of the number of commands.
+ *
+ * \par Assumptions and Notes:
+ *    This only identifies the handler.  The caller is responsible for verifying the
+ *    length of the command against the ExpectedLength in the entry, and for
+ *    reporting an invalid command code if no entry is found.
+ *
+ * \param[in] Table      The dispatch table to search @nonnull
+ * \param[in] NumEntries The number of entries in the dispatch table
+ * \param[in] FcnCode    The command code to look up
+ *
+ * \return Pointer to the table entry
+ * \retval NULL if the command code is not defined in the table
+ */
+static inline const CFE_SB_CmdDispatchEntry_t *
+CFE_SB_GetCmdDispatchEntry(const CFE_SB_CmdDispatchEntry_t *Table, size_t NumEntries, CFE_MSG_FcnCode_t FcnCode)
+{
+    const CFE_SB_CmdDispatchEntry_t *Entry = NULL;
+
+    if (FcnCode < NumEntries && Table[FcnCode].Handler != NULL)
+    {
+        Entry = &Table[FcnCode];
+    }
+
+    return Entry;
+}
+
 /*****************************************************************************/
 /**
  * \brief Converts a topic ID and instance number combination into a MsgID value integer
@@ -134,6 +134,49 @@
 
 #define CFE_SB_DEFAULT_QOS ((CFE_SB_Qos_t) {0}) /**< \brief Default Qos macro */
 
+/**
+ * \brief Defines the dispatch function for a command handler
+ *
+ * Dispatch tables hold functions of the generic #CFE_SB_CmdHandlerFunc_t type.  This
+ * defines one for \a handlerfunc, named by appending "_Dispatch", that converts the
+ * buffer to \a cmdtype and calls the handler.  The conversion is checked by the
+ * compiler against the parameter of the handler, as a direct call would be.
+ *
+ * This is a complete static function definition, so it is used at file scope
+ * without a trailing semicolon, before the table that refers to it.
+ *
+ * \param cmdtype     The command structure type accepted by the handler
+ * \param handlerfunc The function which handles the command
+ */
+#define CFE_SB_CMD_DISPATCH_FUNC(cmdtype, handlerfunc)                          \
+    static CFE_Status_t handlerfunc##_Dispatch(const CFE_SB_Buffer_t *SBBufPtr) \
+    {                                                                           \
+        return handlerfunc((const cmdtype *)SBBufPtr);                          \
+    }
+
+/**
+ * \brief Defines an entry in a command dispatch table
+ *
+ * For use in the initializer of a #CFE_SB_CmdDispatchEntry_t array.  The array is
+ * indexed by command code, so the resulting table can be searched in constant time
+ * using CFE_SB_GetCmdDispatchEntry().  Command codes which do not have an entry
+ * are implicitly zero-filled, and are treated as undefined.
+ *
+ * The dispatch function must have been defined with #CFE_SB_CMD_DISPATCH_FUNC.  The
+ * expected length also checks at compile time that \a handlerfunc accepts \a cmdtype.
+ *
+ * \param ccode       The command (function) code
+ * \param cmdtype     The command structure type, which determines the expected length
+ * \param handlerfunc The function which handles the command
+ */
+#define CFE_SB_CMD_DISPATCH_ENTRY(ccode, cmdtype, handlerfunc) \
+    [ccode] = {handlerfunc##_Dispatch, sizeof(cmdtype) + (0 * sizeof(handlerfunc((const cmdtype *)NULL)))}
+
+/**
+ * \brief Obtains the number of entries in a command dispatch table
+ */
+#define CFE_SB_CMD_DISPATCH_TABLE_SIZE(table) (sizeof(table) / sizeof((table)[0]))
+
 /*
 ** Type Definitions
 */
@@ -146,4 +189,23 @@ typedef union CFE_SB_Msg
     long double       LongDouble; /**< \brief Align to support Long Double */
 } CFE_SB_Buffer_t;
 
+/**
+ * \brief Generic command handler function, as stored in a command dispatch table
+ *
+ * This is the function defined by #CFE_SB_CMD_DISPATCH_FUNC, which converts the
+ * buffer to the specific command type and calls the actual handler.
+ */
+typedef CFE_Status_t (*CFE_SB_CmdHandlerFunc_t)(const CFE_SB_Buffer_t *SBBufPtr);
+
+/**
+ * \brief An entry in a command dispatch table
+ *
+ * \sa CFE_SB_CMD_DISPATCH_ENTRY(), CFE_SB_GetCmdDispatchEntry()
+ */
+typedef struct CFE_SB_CmdDispatchEntry
+{
+    CFE_SB_CmdHandlerFunc_t Handler;        /**< \brief Handler function, NULL if the command code is undefined */
+    size_t                  ExpectedLength; /**< \brief Expected length of the command, including the header */
+} CFE_SB_CmdDispatchEntry_t;
+
 #endif /* CFE_SB_API_TYPEDEFS_H */
@@ -735,6 +735,29 @@ CFE_Status_t CFE_ES_PoolCreateNoSem(CFE_ES_MemHandle_t *PoolID, void *MemPtr, si
     return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateNoSem, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_ES_PoolCreateSlab()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_ES_PoolCreateSlab(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                   const size_t *BlockSizes, bool UseMutex, size_t SlabSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateSlab, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, CFE_ES_MemHandle_t *, PoolID);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, void *, MemPtr);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, size_t, Size);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, uint16, NumBlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, const size_t *, BlockSizes);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, bool, UseMutex);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateSlab, size_t, SlabSize);
+
+    UT_GenStub_Execute(CFE_ES_PoolCreateSlab, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_ES_PoolCreateSlab, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_ES_PoolDelete()
@@ -126,6 +126,25 @@ void UT_DefaultHandler_CFE_FS_WriteHeader(void *UserObj, UT_EntryKey_t FuncKey,
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_FS_WriteBlock coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_FS_WriteBlock(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    size_t BufSize = UT_Hook_GetArgValueByName(Context, "BufSize", size_t);
+
+    int32 status;
+
+    /* By default, report the whole block as written */
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        status = BufSize;
+        UT_Stub_SetReturnValue(FuncKey, status);
+    }
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_FS_ReadHeader coverage stub function
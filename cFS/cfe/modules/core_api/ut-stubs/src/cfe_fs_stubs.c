@@ -33,6 +33,7 @@ void UT_DefaultHandler_CFE_FS_GetDefaultMountPoint(void *, UT_EntryKey_t, const
 void UT_DefaultHandler_CFE_FS_ParseInputFileName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_FS_ParseInputFileNameEx(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_FS_ReadHeader(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_CFE_FS_WriteBlock(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_FS_WriteHeader(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
@@ -67,6 +68,46 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta)
     return UT_GenStub_GetReturnValue(CFE_FS_BackgroundFileDumpRequest, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_FS_CompressBlock()
+ * ----------------------------------------------------
+ */
+size_t CFE_FS_CompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_FS_CompressBlock, size_t);
+
+    UT_GenStub_AddParam(CFE_FS_CompressBlock, const void *, SrcBuf);
+    UT_GenStub_AddParam(CFE_FS_CompressBlock, size_t, SrcSize);
+    UT_GenStub_AddParam(CFE_FS_CompressBlock, void *, DstBuf);
+    UT_GenStub_AddParam(CFE_FS_CompressBlock, size_t, DstSize);
+
+    UT_GenStub_Execute(CFE_FS_CompressBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_FS_CompressBlock, size_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_FS_DecompressBlock()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_FS_DecompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize,
+                                    size_t *DecodedSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_FS_DecompressBlock, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_FS_DecompressBlock, const void *, SrcBuf);
+    UT_GenStub_AddParam(CFE_FS_DecompressBlock, size_t, SrcSize);
+    UT_GenStub_AddParam(CFE_FS_DecompressBlock, void *, DstBuf);
+    UT_GenStub_AddParam(CFE_FS_DecompressBlock, size_t, DstSize);
+    UT_GenStub_AddParam(CFE_FS_DecompressBlock, size_t *, DecodedSize);
+
+    UT_GenStub_Execute(CFE_FS_DecompressBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_FS_DecompressBlock, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_FS_ExtractFilenameFromPath()
@@ -174,6 +215,25 @@ int32 CFE_FS_ParseInputFileNameEx(char *OutputBuffer, const char *InputBuffer, s
     return UT_GenStub_GetReturnValue(CFE_FS_ParseInputFileNameEx, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_FS_ReadBlock()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_FS_ReadBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, void *Buffer, size_t BufSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_FS_ReadBlock, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_FS_ReadBlock, osal_id_t, FileDes);
+    UT_GenStub_AddParam(CFE_FS_ReadBlock, const CFE_FS_Header_t *, Hdr);
+    UT_GenStub_AddParam(CFE_FS_ReadBlock, void *, Buffer);
+    UT_GenStub_AddParam(CFE_FS_ReadBlock, size_t, BufSize);
+
+    UT_GenStub_Execute(CFE_FS_ReadBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_FS_ReadBlock, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_FS_ReadHeader()
@@ -208,6 +268,25 @@ CFE_Status_t CFE_FS_SetTimestamp(osal_id_t FileDes, CFE_TIME_SysTime_t NewTimest
     return UT_GenStub_GetReturnValue(CFE_FS_SetTimestamp, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_FS_WriteBlock()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_FS_WriteBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, const void *Buffer, size_t BufSize)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_FS_WriteBlock, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_FS_WriteBlock, osal_id_t, FileDes);
+    UT_GenStub_AddParam(CFE_FS_WriteBlock, const CFE_FS_Header_t *, Hdr);
+    UT_GenStub_AddParam(CFE_FS_WriteBlock, const void *, Buffer);
+    UT_GenStub_AddParam(CFE_FS_WriteBlock, size_t, BufSize);
+
+    UT_GenStub_Execute(CFE_FS_WriteBlock, Basic, UT_DefaultHandler_CFE_FS_WriteBlock);
+
+    return UT_GenStub_GetReturnValue(CFE_FS_WriteBlock, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_FS_WriteHeader()
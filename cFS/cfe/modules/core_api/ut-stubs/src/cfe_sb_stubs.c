@@ -80,6 +80,24 @@ CFE_SB_MsgId_Atom_t CFE_SB_CmdTopicIdToMsgId(uint16 TopicId, uint16 InstanceNum)
     return UT_GenStub_GetReturnValue(CFE_SB_CmdTopicIdToMsgId, CFE_SB_MsgId_Atom_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_CreateBufferRing()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_CreateBufferRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 NumBuffers)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_CreateBufferRing, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_CreateBufferRing, CFE_SB_MsgId_t, MsgId);
+    UT_GenStub_AddParam(CFE_SB_CreateBufferRing, size_t, MsgSize);
+    UT_GenStub_AddParam(CFE_SB_CreateBufferRing, uint16, NumBuffers);
+
+    UT_GenStub_Execute(CFE_SB_CreateBufferRing, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_CreateBufferRing, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_CreatePipe()
@@ -98,6 +116,22 @@ CFE_Status_t CFE_SB_CreatePipe(CFE_SB_PipeId_t *PipeIdPtr, uint16 Depth, const c
     return UT_GenStub_GetReturnValue(CFE_SB_CreatePipe, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_DeleteBufferRing()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_DeleteBufferRing(CFE_SB_MsgId_t MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_DeleteBufferRing, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_DeleteBufferRing, CFE_SB_MsgId_t, MsgId);
+
+    UT_GenStub_Execute(CFE_SB_DeleteBufferRing, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_DeleteBufferRing, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_DeletePipe()
@@ -166,6 +200,39 @@ CFE_Status_t CFE_SB_GetPipeOpts(CFE_SB_PipeId_t PipeId, uint8 *OptsPtr)
     return UT_GenStub_GetReturnValue(CFE_SB_GetPipeOpts, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetPipeWaitId()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_GetPipeWaitId(CFE_SB_PipeId_t PipeId, osal_id_t *WaitIdPtr)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetPipeWaitId, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_GetPipeWaitId, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_GetPipeWaitId, osal_id_t *, WaitIdPtr);
+
+    UT_GenStub_Execute(CFE_SB_GetPipeWaitId, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetPipeWaitId, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_GetRingBuffer()
+ * ----------------------------------------------------
+ */
+CFE_SB_Buffer_t *CFE_SB_GetRingBuffer(CFE_SB_MsgId_t MsgId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_GetRingBuffer, CFE_SB_Buffer_t *);
+
+    UT_GenStub_AddParam(CFE_SB_GetRingBuffer, CFE_SB_MsgId_t, MsgId);
+
+    UT_GenStub_Execute(CFE_SB_GetRingBuffer, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_GetRingBuffer, CFE_SB_Buffer_t *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_GetUserData()
@@ -81,6 +81,25 @@ typedef struct
     uint8                   Context[CFE_PLATFORM_ES_ER_LOG_MAX_CONTEXT_SIZE]; /* cpu  context */
 } CFE_ES_ERLog_FileEntry_t;
 
+/*
+** Exception and Reset Log Header Structure
+**
+** This is a compact, fixed-size summary of each log entry, kept in a table
+** separate from the bulk of the entry data.  Searching the log only needs to
+** look at these headers, and not the full entries.
+**
+** The table is kept in ES RAM and is rebuilt from the log entries at startup,
+** so it is not part of the preserved reset data.
+*/
+typedef struct
+{
+    uint32             Sequence;     /**< Order in which the entry was written, 0 if the entry is unused */
+    uint32             LogEntryType; /**< What type of log entry */
+    CFE_ES_AppId_t     AppID;        /**< The application ID */
+    uint32             PspContextId; /**< Reference to context information stored in PSP */
+    CFE_TIME_SysTime_t TimeCode;     /**< Time code, same as in the base info */
+} CFE_ES_ERLog_Header_t;
+
 /*
 ** Exception and Reset Log Metadata Structure
 ** This is stored in ES RAM, not _directly_ written to ER log files.
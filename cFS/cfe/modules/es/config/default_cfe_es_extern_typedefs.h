@@ -499,4 +499,54 @@ typedef struct CFE_ES_MemPoolStats
                                                                           \brief Contains stats on each block size */
 } CFE_ES_MemPoolStats_t;
 
+/**
+ * \brief Performance Marker Statistics
+ *
+ * Structure that is used to provide the on-board aggregated statistics for
+ * a single performance marker.  Used by the Performance Statistics telemetry
+ * message and the performance statistics file.
+ *
+ * All times are in microseconds, measured between the entry and the matching
+ * exit of the marker within the same task.
+ *
+ * \sa #CFE_ES_START_PERF_STATS_CC
+ */
+typedef struct CFE_ES_PerfMarkerStats
+{
+    uint32 CallCount;     /**< \cfetlmmnemonic \ES_PSCALLCNT
+                               \brief Number of completed entry/exit pairs of this marker */
+    uint32 MinTime;       /**< \cfetlmmnemonic \ES_PSMINTIME
+                               \brief Shortest entry to exit time, in microseconds */
+    uint32 MaxTime;       /**< \cfetlmmnemonic \ES_PSMAXTIME
+                               \brief Longest entry to exit time, in microseconds */
+    uint32 MeanTime;      /**< \cfetlmmnemonic \ES_PSMEANTIME
+                               \brief Mean entry to exit time, in microseconds */
+    uint16 MaxDepth;      /**< \cfetlmmnemonic \ES_PSMAXDEPTH
+                               \brief Deepest nesting level at which this marker was entered (1 = outermost) */
+    uint16 UnpairedCount; /**< \cfetlmmnemonic \ES_PSUNPAIREDCNT
+                               \brief Number of exits which did not match a pending entry in the same task */
+} CFE_ES_PerfMarkerStats_t;
+
+/**
+ * \brief Background Job Statistics
+ *
+ * Structure that is used to provide the run time accounting for a single
+ * job executed by the ES background task.  Used by the ES housekeeping
+ * telemetry message.
+ *
+ * All times are in microseconds of processor time spent inside the job
+ * function, as measured by the background task.
+ */
+typedef struct CFE_ES_BackgroundJobStats
+{
+    uint32 RunCount;     /**< \cfetlmmnemonic \ES_BGJOBRUNCNT
+                              \brief Number of times the job function has been invoked */
+    uint32 WakeCount;    /**< \cfetlmmnemonic \ES_BGJOBWAKECNT
+                              \brief Number of invocations caused by an explicit wakeup rather than the job period */
+    uint32 TotalRunTime; /**< \cfetlmmnemonic \ES_BGJOBTOTTIME
+                              \brief Accumulated time spent in the job function, in microseconds */
+    uint32 MaxRunTime;   /**< \cfetlmmnemonic \ES_BGJOBMAXTIME
+                              \brief Longest single invocation of the job function, in microseconds */
+} CFE_ES_BackgroundJobStats_t;
+
 #endif /* CFE_ES_EXTERN_TYPEDEFS_H */
@@ -60,6 +60,9 @@ enum CFE_ES_FunctionCode_
     CFE_ES_FunctionCode_SEND_MEM_POOL_STATS   = 22,
     CFE_ES_FunctionCode_DUMP_CDS_REGISTRY     = 23,
     CFE_ES_FunctionCode_QUERY_ALL_TASKS       = 24,
+    CFE_ES_FunctionCode_START_PERF_STATS      = 25,
+    CFE_ES_FunctionCode_STOP_PERF_STATS       = 26,
+    CFE_ES_FunctionCode_WRITE_PERF_STATS      = 27,
 };
 
 #endif
@@ -61,6 +61,20 @@ typedef struct CFE_ES_FileNameCmd_Payload
                                                  filename of file in which Application data is to be dumped */
 } CFE_ES_FileNameCmd_Payload_t;
 
+/**
+** \brief Write Performance Statistics Command Payload
+**
+** For command details, see #CFE_ES_WRITE_PERF_STATS_CC
+**
+**/
+typedef struct CFE_ES_WritePerfStatsCmd_Payload
+{
+    char  FileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief ASCII text string containing full path and
+                                                  filename of file in which the statistics are to be written */
+    uint8 CompressFlag;                       /**< \brief Nonzero to write the file in compressed blocks */
+    uint8 Spare[3];                           /**< \brief Pad to 32 bit boundary */
+} CFE_ES_WritePerfStatsCmd_Payload_t;
+
 /**
 ** \brief Overwrite/Discard System Log Configuration Command Payload
 **
@@ -178,6 +192,8 @@ typedef struct CFE_ES_StopPerfCmd_Payload
 {
     char DataFileName[CFE_MISSION_MAX_PATH_LEN]; /**< \brief ASCII text string of full path and filename
                                                     of file Performance Analyzer data is to be written */
+    uint8 CompressFlag;                          /**< \brief Nonzero to write the data in compressed blocks */
+    uint8 Spare[3];                              /**< \brief Pad to 32 bit boundary */
 } CFE_ES_StopPerfCmd_Payload_t;
 
 /**
@@ -255,6 +271,20 @@ typedef struct CFE_ES_PoolStatsTlm_Payload
     CFE_ES_MemPoolStats_t PoolStats; /**< \brief For more info, see #CFE_ES_MemPoolStats_t */
 } CFE_ES_PoolStatsTlm_Payload_t;
 
+/**
+**  \cfeestlm Performance Statistics Packet
+**
+**  Per-marker statistics aggregated on board, indexed by performance marker ID.
+**/
+typedef struct CFE_ES_PerfStatsTlm_Payload
+{
+    uint32                   DepthOverflowCount;                  /**< \cfetlmmnemonic \ES_PSDEPTHOVFL
+                                                                       \brief Number of marker entries not timed
+                                                                       because nesting was too deep */
+    CFE_ES_PerfMarkerStats_t Marker[CFE_MISSION_ES_PERF_MAX_IDS]; /**< \brief Statistics for each marker ID,
+                                                                       see #CFE_ES_PerfMarkerStats_t */
+} CFE_ES_PerfStatsTlm_Payload_t;
+
 /*************************************************************************/
 
 /**
@@ -355,6 +385,9 @@ typedef struct CFE_ES_HousekeepingTlm_Payload
                                             \brief Number of free blocks remaining in the OS heap */
     CFE_ES_MemOffset_t HeapMaxBlockSize; /**< \cfetlmmnemonic \ES_HEAPMAXBLK
                                             \brief Number of bytes in the largest free block */
+    CFE_ES_BackgroundJobStats_t
+        BackgroundJob[CFE_MISSION_ES_MAX_BACKGROUND_JOBS]; /**< \brief Run time statistics for each background job,
+                                                                see #CFE_ES_BackgroundJobStats_t */
 } CFE_ES_HousekeepingTlm_Payload_t;
 
 #endif
@@ -34,8 +34,9 @@
 /*
 ** CFE ES Telemetry Message Id's
 */
-#define CFE_ES_HK_TLM_MID       CFE_PLATFORM_ES_TLM_MIDVAL(HK_TLM)
-#define CFE_ES_APP_TLM_MID      CFE_PLATFORM_ES_TLM_MIDVAL(APP_TLM)
-#define CFE_ES_MEMSTATS_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(MEMSTATS_TLM)
+#define CFE_ES_HK_TLM_MID        CFE_PLATFORM_ES_TLM_MIDVAL(HK_TLM)
+#define CFE_ES_APP_TLM_MID       CFE_PLATFORM_ES_TLM_MIDVAL(APP_TLM)
+#define CFE_ES_MEMSTATS_TLM_MID  CFE_PLATFORM_ES_TLM_MIDVAL(MEMSTATS_TLM)
+#define CFE_ES_PERFSTATS_TLM_MID CFE_PLATFORM_ES_TLM_MIDVAL(PERFSTATS_TLM)
 
 #endif
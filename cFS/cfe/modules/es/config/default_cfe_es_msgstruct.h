@@ -73,6 +73,16 @@ typedef struct CFE_ES_SendHkCmd
     CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
 } CFE_ES_SendHkCmd_t;
 
+typedef struct CFE_ES_StartPerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CFE_ES_StartPerfStatsCmd_t;
+
+typedef struct CFE_ES_StopPerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+} CFE_ES_StopPerfStatsCmd_t;
+
 /**
  * \brief Restart cFE Command
  */
@@ -120,6 +130,12 @@ typedef struct CFE_ES_WriteERLogCmd
     CFE_ES_FileNameCmd_Payload_t Payload;       /**< \brief Command payload */
 } CFE_ES_WriteERLogCmd_t;
 
+typedef struct CFE_ES_WritePerfStatsCmd
+{
+    CFE_MSG_CommandHeader_t            CommandHeader; /**< \brief Command header */
+    CFE_ES_WritePerfStatsCmd_Payload_t Payload;       /**< \brief Command payload */
+} CFE_ES_WritePerfStatsCmd_t;
+
 /**
  * \brief Overwrite/Discard System Log Configuration Command Payload
  */
@@ -266,6 +282,15 @@ typedef struct CFE_ES_MemStatsTlm
     CFE_ES_PoolStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
 } CFE_ES_MemStatsTlm_t;
 
+/**
+**  \cfeestlm Performance Statistics Packet
+**/
+typedef struct CFE_ES_PerfStatsTlm
+{
+    CFE_MSG_TelemetryHeader_t     TelemetryHeader; /**< \brief Telemetry header */
+    CFE_ES_PerfStatsTlm_Payload_t Payload;         /**< \brief Telemetry payload */
+} CFE_ES_PerfStatsTlm_t;
+
 /**
 **  \cfeestlm Executive Services Housekeeping Packet
 **/
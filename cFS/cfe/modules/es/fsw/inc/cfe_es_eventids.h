@@ -1057,6 +1057,64 @@
  *  a write already being in progress.
  */
 #define CFE_ES_ERLOG_PENDING_ERR_EID 93
+
+/**
+ * \brief ES Start Performance Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_START_PERF_STATS_CC ES Start Performance Statistics Command \endlink success.
+ */
+#define CFE_ES_PERF_STATS_STARTCMD_EID 94
+
+/**
+ * \brief ES Stop Performance Statistics Command Success Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_STOP_PERF_STATS_CC ES Stop Performance Statistics Command \endlink success.
+ */
+#define CFE_ES_PERF_STATS_STOPCMD_EID 95
+
+/**
+ * \brief ES Write Performance Statistics Complete Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_PERF_STATS_CC ES Write Performance Statistics Command \endlink success,
+ *  the file has been written.
+ */
+#define CFE_ES_PERF_STATS_WRITTEN_EID 96
+
+/**
+ * \brief ES Write Performance Statistics File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_PERF_STATS_CC ES Write Performance Statistics Command \endlink failure
+ *  parsing the file name or creating the file.
+ */
+#define CFE_ES_PERF_STATS_WRITE_ERR_EID 97
+
+/**
+ * \brief ES Write Performance Statistics Command Already In Progress Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  \link #CFE_ES_WRITE_PERF_STATS_CC ES Write Performance Statistics Command \endlink failure due to
+ *  a write already being in progress.
+ */
+#define CFE_ES_PERF_STATS_PENDING_ERR_EID 98
 /**\}*/
 
 #endif /* CFE_ES_EVENTS_H */
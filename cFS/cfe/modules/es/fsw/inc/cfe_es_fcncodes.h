@@ -634,6 +634,8 @@
 **  \par Description
 **       This command stops the Performance Analyzer from collecting any more data,
 **       and writes all previously collected performance data to a log file.
+**       If the command's CompressFlag is set, the data following the file header
+**       is written in compressed blocks and can be read with CFE_FS_ReadBlock().
 **
 **  \cfecmdmnemonic \ES_STOPLADATA
 **
@@ -1033,6 +1035,124 @@
 */
 #define CFE_ES_QUERY_ALL_TASKS_CC CFE_ES_CCVAL(QUERY_ALL_TASKS)
 
+/** \cfeescmd Start Performance Statistics Aggregation
+**
+**  \par Description
+**       This command clears the on-board performance marker statistics and starts
+**       aggregating new ones.  While aggregation is active, every performance marker
+**       entry is paired with the matching exit in the same task, and the call count,
+**       minimum, maximum and mean duration and nesting depth of each marker are
+**       accumulated.  The statistics are reported in the #CFE_ES_PerfStatsTlm_t packet
+**       with each housekeeping request.
+**
+**       Aggregation is independent of the Performance Analyzer trace, which may be
+**       started and stopped while aggregation is active.  Markers disabled via the
+**       filter mask are not aggregated.  Sending this command while aggregation is
+**       already active restarts it with cleared statistics.
+**
+**  \cfecmdmnemonic \ES_STARTPERFSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_StartPerfStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_PERF_STATS_STARTCMD_EID debug event message will be
+**         generated.
+**       - The #CFE_ES_PerfStatsTlm_t packet will be generated with each
+**         housekeeping request.
+**
+**  \par Error Conditions
+**       There are no error conditions for this command.
+**
+**  \par Criticality
+**       This command is not inherently dangerous but may cause a small increase in CPU
+**       utilization as each performance marker is timed.
+**
+**  \sa #CFE_ES_STOP_PERF_STATS_CC, #CFE_ES_WRITE_PERF_STATS_CC, #CFE_ES_SET_PERF_FILTER_MASK_CC
+*/
+#define CFE_ES_START_PERF_STATS_CC CFE_ES_CCVAL(START_PERF_STATS)
+
+/** \cfeescmd Stop Performance Statistics Aggregation
+**
+**  \par Description
+**       This command stops the aggregation of performance marker statistics.  The
+**       statistics collected so far are retained and may still be written to a file
+**       with the #CFE_ES_WRITE_PERF_STATS_CC command.
+**
+**  \cfecmdmnemonic \ES_STOPPERFSTATS
+**
+**  \par Command Structure
+**       #CFE_ES_StopPerfStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_PERF_STATS_STOPCMD_EID debug event message will be
+**         generated.
+**       - The #CFE_ES_PerfStatsTlm_t packet will no longer be generated.
+**
+**  \par Error Conditions
+**       There are no error conditions for this command.
+**
+**  \par Criticality
+**       This command is not dangerous.
+**
+**  \sa #CFE_ES_START_PERF_STATS_CC, #CFE_ES_WRITE_PERF_STATS_CC
+*/
+#define CFE_ES_STOP_PERF_STATS_CC CFE_ES_CCVAL(STOP_PERF_STATS)
+
+/** \cfeescmd Write Performance Statistics to a File
+**
+**  \par Description
+**       This command writes the on-board performance marker statistics to the
+**       specified file, one #CFE_ES_PerfMarkerStats_t record per marker ID.  The
+**       file is written by the background file writer and does not affect
+**       aggregation or the Performance Analyzer trace.  If the command's
+**       CompressFlag is set, the records are written in compressed blocks and
+**       can be read with CFE_FS_ReadBlock().
+**
+**  \cfecmdmnemonic \ES_WRITEPERFSTATS2FILE
+**
+**  \par Command Structure
+**       #CFE_ES_WritePerfStatsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \ES_CMDPC - command execution counter will
+**         increment
+**       - The #CFE_ES_PERF_STATS_WRITTEN_EID debug event message will be
+**         generated when the file has been written.
+**       - The file specified in the command (or the default specified
+**         by the #CFE_PLATFORM_ES_DEFAULT_PERF_STATS_FILENAME configuration parameter) will be
+**         updated with the latest information.
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - The file name specified could not be parsed
+**       - A previous write of the performance statistics is still in progress
+**
+**       Evidence of failure may be found in the following telemetry:
+**       - \b \c \ES_CMDEC - command error counter will increment
+**       - A command specific error event message is issued for all error
+**         cases
+**
+**  \par Criticality
+**       This command is not inherently dangerous.  It will create a new
+**       file in the file system (or overwrite an existing one) and could,
+**       if performed repeatedly without sufficient file management by the
+**       operator, fill the file system.
+**
+**  \sa #CFE_ES_START_PERF_STATS_CC, #CFE_ES_STOP_PERF_STATS_CC
+*/
+#define CFE_ES_WRITE_PERF_STATS_CC CFE_ES_CCVAL(WRITE_PERF_STATS)
+
 /** \} */
 
 #endif
@@ -92,6 +92,24 @@
 #define CFE_MISSION_ES_POOL_MAX_BUCKETS         CFE_MISSION_ES_CFGVAL(POOL_MAX_BUCKETS)
 #define DEFAULT_CFE_MISSION_ES_POOL_MAX_BUCKETS 17
 
+/**
+**  \cfeescfg Maximum number of background jobs reported in telemetry
+**
+**  \par Description:
+**      The upper limit for the number of ES background jobs for which run
+**      time statistics are reported in the ES housekeeping telemetry.  This
+**      definition is used as the array size of the background job statistics,
+**      and therefore should be consistent across all CPUs in a mission, as well
+**      as with the ground station.
+**
+**  \par Limits:
+**       Must be at least the number of jobs in the ES background job table.
+**       Note this affects the size of the housekeeping message, so it must
+**       not cause the message to exceed the max length.
+*/
+#define CFE_MISSION_ES_MAX_BACKGROUND_JOBS         CFE_MISSION_ES_CFGVAL(MAX_BACKGROUND_JOBS)
+#define DEFAULT_CFE_MISSION_ES_MAX_BACKGROUND_JOBS 8
+
 /**
 **  \cfeescfg Maximum Length of CDS Name
 **
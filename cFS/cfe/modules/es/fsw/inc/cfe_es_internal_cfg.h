@@ -475,6 +475,21 @@
 #define CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME         CFE_PLATFORM_ES_CFGVAL(DEFAULT_PERF_DUMP_FILENAME)
 #define DEFAULT_CFE_PLATFORM_ES_DEFAULT_PERF_DUMP_FILENAME "/ram/cfe_es_perf.dat"
 
+/**
+**  \cfeescfg Default Performance Statistics Filename
+**
+**  \par Description:
+**       The value of this constant defines the filename used to store the
+**       aggregated performance marker statistics. This filename is used only when
+**       no filename is specified in the command to write performance statistics.
+**
+**  \par Limits
+**       The length of each string, including the NULL terminator cannot exceed the
+**       #OS_MAX_PATH_LEN value.
+*/
+#define CFE_PLATFORM_ES_DEFAULT_PERF_STATS_FILENAME         CFE_PLATFORM_ES_CFGVAL(DEFAULT_PERF_STATS_FILENAME)
+#define DEFAULT_CFE_PLATFORM_ES_DEFAULT_PERF_STATS_FILENAME "/ram/cfe_es_perfstats.dat"
+
 /**
 **  \cfeescfg Default Critical Data Store Registry Filename
 **
@@ -673,6 +688,21 @@
 #define CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS         CFE_PLATFORM_ES_CFGVAL(PERF_ENTRIES_BTWN_DLYS)
 #define DEFAULT_CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS 50
 
+/**
+**  \cfeescfg Define Maximum Nesting Depth for Performance Statistics
+**
+**  \par Description:
+**       Defines the number of nested performance marker entries that are timed
+**       per task when performance statistics aggregation is active.  Entries nested
+**       deeper than this are not timed, and are counted in the DepthOverflowCount
+**       of the performance statistics telemetry.
+**
+**  \par Limits
+**       Must be at least 1.  Each task reserves this many 12 byte timing records.
+*/
+#define CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH         CFE_PLATFORM_ES_CFGVAL(PERF_STATS_MAX_DEPTH)
+#define DEFAULT_CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH 8
+
 /**
 **  \cfeescfg Define Default Stack Size for an Application
 **
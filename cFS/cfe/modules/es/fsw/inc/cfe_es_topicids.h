@@ -48,11 +48,13 @@
 **  \par Limits
 **      Not Applicable
 */
-#define CFE_MISSION_ES_HK_TLM_TOPICID               CFE_MISSION_ES_TIDVAL(HK_TLM)
-#define DEFAULT_CFE_MISSION_ES_HK_TLM_TOPICID       0
-#define CFE_MISSION_ES_APP_TLM_TOPICID              CFE_MISSION_ES_TIDVAL(APP_TLM)
-#define DEFAULT_CFE_MISSION_ES_APP_TLM_TOPICID      11
-#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(MEMSTATS_TLM)
-#define DEFAULT_CFE_MISSION_ES_MEMSTATS_TLM_TOPICID 16
+#define CFE_MISSION_ES_HK_TLM_TOPICID                CFE_MISSION_ES_TIDVAL(HK_TLM)
+#define DEFAULT_CFE_MISSION_ES_HK_TLM_TOPICID        0
+#define CFE_MISSION_ES_APP_TLM_TOPICID               CFE_MISSION_ES_TIDVAL(APP_TLM)
+#define DEFAULT_CFE_MISSION_ES_APP_TLM_TOPICID       11
+#define CFE_MISSION_ES_MEMSTATS_TLM_TOPICID          CFE_MISSION_ES_TIDVAL(MEMSTATS_TLM)
+#define DEFAULT_CFE_MISSION_ES_MEMSTATS_TLM_TOPICID  16
+#define CFE_MISSION_ES_PERFSTATS_TLM_TOPICID         CFE_MISSION_ES_TIDVAL(PERFSTATS_TLM)
+#define DEFAULT_CFE_MISSION_ES_PERFSTATS_TLM_TOPICID 15
 
 #endif
@@ -2081,8 +2081,8 @@ void CFE_ES_UnlockSharedData(const char *FunctionName, int32 LineNumber)
  *-----------------------------------------------------------------*/
 void CFE_ES_ProcessAsyncEvent(void)
 {
-    /* This just wakes up the background task to log/handle the event. */
-    CFE_ES_BackgroundWakeup();
+    /* This just wakes up the background exception scan to log/handle the event. */
+    CFE_ES_BackgroundWakeupJob(CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN);
 }
 
 /*----------------------------------------------------------------
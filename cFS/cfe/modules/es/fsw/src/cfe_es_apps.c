@@ -1665,6 +1665,9 @@ void CFE_ES_CleanupObjectCallback(osal_id_t ObjectId, void *arg)
         case OS_OBJECT_TYPE_OS_MODULE:
             OsStatus = OS_ModuleUnload(ObjectId);
             break;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            OsStatus = OS_PollSetDelete(ObjectId);
+            break;
         default:
             ObjIsValid = false;
             OsStatus   = OS_ERROR;
@@ -63,59 +63,117 @@ bool CFE_ES_ActiveJob(uint32 ElapsedTime, void *Arg)
 /*
  * List of "background jobs"
  *
- * This is just a list of functions to periodically call from the context of the background task,
- * and can be added/extended as needed.
+ * This is just a list of functions to call from the context of the background task when they are due,
+ * and can be added/extended as needed.  The entries with a CFE_ES_BackgroundJobId_t value must appear
+ * at that index so that CFE_ES_BackgroundWakeupJob() and the housekeeping statistics refer to the right job.
  *
  * Each Job function returns a boolean, and should return "true" if it is active, or "false" if it is idle.
+ * The result selects the period after which the job is called again, unless it is woken sooner by
+ * CFE_ES_BackgroundWakeupJob().  A period of 0 means the job is called on every pass of the background task.
  *
  * This uses "cooperative multitasking" -- the function should do some limited work, then return to the
  * background task.  It will be called again after a delay period to do more work.
  */
 const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
-    {/* ES app table background scan */
-     .RunFunc      = CFE_ES_RunAppTableScan,
-     .JobArg       = &CFE_ES_Global.BackgroundAppScanState,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Performance Log Data Dump to file */
-     .RunFunc      = CFE_ES_RunPerfLogDump,
-     .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
-     .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
-     .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
-    {/* Check for exceptions stored in the PSP */
-     .RunFunc      = CFE_ES_RunExceptionScan,
-     .JobArg       = NULL,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
-    {/* Call FS to handle background file writes */
-     .RunFunc      = CFE_FS_RunBackgroundFileDump,
-     .JobArg       = NULL,
-     .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
-     .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+    [CFE_ES_BACKGROUND_JOB_APP_SCAN] = {/* ES app table background scan */
+                                        .RunFunc      = CFE_ES_RunAppTableScan,
+                                        .JobArg       = &CFE_ES_Global.BackgroundAppScanState,
+                                        .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE / 4,
+                                        .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+    [CFE_ES_BACKGROUND_JOB_PERF_DUMP] = {/* Performance Log Data Dump to file */
+                                         .RunFunc      = CFE_ES_RunPerfLogDump,
+                                         .JobArg       = &CFE_ES_Global.BackgroundPerfDumpState,
+                                         .ActivePeriod = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                                         .IdlePeriod   = CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY * 1000},
+    [CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN] = {/* Check for exceptions stored in the PSP */
+                                              .RunFunc      = CFE_ES_RunExceptionScan,
+                                              .JobArg       = NULL,
+                                              .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                                              .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
+    [CFE_ES_BACKGROUND_JOB_FILE_DUMP] = {/* Call FS to handle background file writes */
+                                         .RunFunc      = CFE_FS_RunBackgroundFileDump,
+                                         .JobArg       = NULL,
+                                         .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE,
+                                         .IdlePeriod   = CFE_PLATFORM_ES_APP_SCAN_RATE},
     {/* Empty Job (for coverage purposes) */
-     /* Setting RunFunc to NULL triggers JobPtr->RunFunc != NULL to be false */
+     /* Setting RunFunc to NULL triggers JobPtr->RunFunc == NULL to be true */
      .RunFunc      = NULL,
      .JobArg       = NULL,
      .ActivePeriod = 0,
      .IdlePeriod   = 0},
     {/* Active Job with 0 active period (for coverage purposes)*/
-     .RunFunc      = CFE_ES_ActiveJob,
-     .JobArg       = NULL,
-     /* Setting ActivePeriod to 0 triggers JobPtr->ActivePeriod != 0 to be
-      * false */
+     .RunFunc = CFE_ES_ActiveJob,
+     .JobArg  = NULL,
+     /* Setting ActivePeriod to 0 makes the job due on every pass, and
+      * triggers StatePtr->Period != 0 to be false */
      .ActivePeriod = 0,
      .IdlePeriod   = 0},
     {/* Active Job with non-zero active period (for coverage purposes)*/
-     .RunFunc      = CFE_ES_ActiveJob,
-     .JobArg       = NULL,
+     .RunFunc = CFE_ES_ActiveJob,
+     .JobArg  = NULL,
      /* We set the ActivePeriod to this so we can trigger set the expression
-      * NextDelay > JobPtr->ActivePeriod to be false, since the previous 
-      * setting for NextDelay was CFE_PLATFORM_ES_APP_SCAN_RATE */
+      * NextDelay > Remaining to be false, since the earlier jobs already
+      * reduced NextDelay below CFE_PLATFORM_ES_APP_SCAN_RATE */
      .ActivePeriod = CFE_PLATFORM_ES_APP_SCAN_RATE - 1,
      .IdlePeriod   = 0}};
 
 #define CFE_ES_BACKGROUND_NUM_JOBS (sizeof(CFE_ES_BACKGROUND_JOB_TABLE) / sizeof(CFE_ES_BACKGROUND_JOB_TABLE[0]))
 
+CompileTimeAssert(CFE_ES_BACKGROUND_NUM_JOBS <= CFE_MISSION_ES_MAX_BACKGROUND_JOBS, BackgroundJobTableTooLarge);
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Calls a single background job and accounts for the time spent in it
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_BackgroundRunJob(const CFE_ES_BackgroundJobEntry_t *JobPtr, CFE_ES_BackgroundJobState_t *StatePtr)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    uint32    RunTime;
+
+    /*
+     * A job that is run before its period expired was run because of a wakeup.
+     * The request flag is cleared before calling the job, so a wakeup that arrives
+     * while the job is running is not lost and causes another call on the next pass.
+     */
+    if (StatePtr->SinceLastRun < StatePtr->Period)
+    {
+        ++StatePtr->Stats.WakeCount;
+    }
+    StatePtr->WakeRequested = false;
+
+    CFE_PSP_GetTime(&StartTime);
+
+    /*
+     * call the background job -
+     * if it returns "true" that means it is active,
+     * if it returns "false" that means it is idle
+     */
+    StatePtr->IsActive = JobPtr->RunFunc(StatePtr->SinceLastRun, JobPtr->JobArg);
+
+    CFE_PSP_GetTime(&EndTime);
+    RunTime = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+
+    ++StatePtr->Stats.RunCount;
+    StatePtr->Stats.TotalRunTime += RunTime;
+    if (StatePtr->Stats.MaxRunTime < RunTime)
+    {
+        StatePtr->Stats.MaxRunTime = RunTime;
+    }
+
+    StatePtr->SinceLastRun = 0;
+    if (StatePtr->IsActive)
+    {
+        StatePtr->Period = JobPtr->ActivePeriod;
+    }
+    else
+    {
+        StatePtr->Period = JobPtr->IdlePeriod;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -125,13 +183,15 @@ const CFE_ES_BackgroundJobEntry_t CFE_ES_BACKGROUND_JOB_TABLE[] = {
 void CFE_ES_BackgroundTask(void)
 {
     int32                              OsStatus;
-    uint32                             JobTotal;
+    uint32                             JobIdx;
     uint32                             NumJobsRunning;
     uint32                             NextDelay;
     uint32                             ElapsedTime;
+    uint32                             Remaining;
     OS_time_t                          CurrTime;
     OS_time_t                          LastTime;
     const CFE_ES_BackgroundJobEntry_t *JobPtr;
+    CFE_ES_BackgroundJobState_t *      StatePtr;
 
     memset(&LastTime, 0, sizeof(LastTime));
     memset(&CurrTime, 0, sizeof(CurrTime));
@@ -148,35 +208,45 @@ void CFE_ES_BackgroundTask(void)
         ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, LastTime));
         LastTime    = CurrTime;
 
-        NextDelay      = CFE_ES_BACKGROUND_MAX_IDLE_DELAY; /* default; will be adjusted based on active jobs */
-        JobPtr         = CFE_ES_BACKGROUND_JOB_TABLE;
-        JobTotal       = CFE_ES_BACKGROUND_NUM_JOBS;
+        NextDelay      = CFE_ES_BACKGROUND_MAX_IDLE_DELAY; /* default; will be adjusted based on job deadlines */
         NumJobsRunning = 0;
 
-        while (JobTotal > 0)
+        /*
+         * Only the jobs which are due, or which have been explicitly woken, are called.
+         * The remaining jobs just accumulate the elapsed time toward their deadline, so
+         * that one busy job does not cause all the others to be polled at its rate.
+         */
+        for (JobIdx = 0; JobIdx < CFE_ES_BACKGROUND_NUM_JOBS; ++JobIdx)
         {
-            /*
-             * call the background job -
-             * if it returns "true" that means it is active,
-             * if it returns "false" that means it is idle
-             */
-            if (JobPtr->RunFunc != NULL && JobPtr->RunFunc(ElapsedTime, JobPtr->JobArg))
+            JobPtr   = &CFE_ES_BACKGROUND_JOB_TABLE[JobIdx];
+            StatePtr = &CFE_ES_Global.BackgroundTask.Jobs[JobIdx];
+
+            if (JobPtr->RunFunc == NULL)
+            {
+                continue;
+            }
+
+            StatePtr->SinceLastRun += ElapsedTime;
+
+            if (StatePtr->WakeRequested || StatePtr->SinceLastRun >= StatePtr->Period)
+            {
+                CFE_ES_BackgroundRunJob(JobPtr, StatePtr);
+            }
+
+            if (StatePtr->IsActive)
             {
                 ++NumJobsRunning;
+            }
 
-                if (JobPtr->ActivePeriod != 0 && NextDelay > JobPtr->ActivePeriod)
+            /* next delay is based on the nearest job deadline */
+            if (StatePtr->Period != 0)
+            {
+                Remaining = StatePtr->Period - StatePtr->SinceLastRun;
+                if (NextDelay > Remaining)
                 {
-                    /* next delay is based on this active job wait time */
-                    NextDelay = JobPtr->ActivePeriod;
+                    NextDelay = Remaining;
                 }
             }
-            else if (JobPtr->IdlePeriod != 0 && NextDelay > JobPtr->IdlePeriod)
-            {
-                /* next delay is based on this idle job wait time */
-                NextDelay = JobPtr->IdlePeriod;
-            }
-            --JobTotal;
-            ++JobPtr;
         }
 
         CFE_ES_Global.BackgroundTask.NumJobsRunning = NumJobsRunning;
@@ -202,6 +272,11 @@ int32 CFE_ES_BackgroundInit(void)
     int32 status;
     int32 OsStatus;
 
+    /*
+     * Every job starts with a period of 0, so all of them are called on the first pass
+     */
+    memset(CFE_ES_Global.BackgroundTask.Jobs, 0, sizeof(CFE_ES_Global.BackgroundTask.Jobs));
+
     OsStatus = OS_BinSemCreate(&CFE_ES_Global.BackgroundTask.WorkSem, CFE_ES_BACKGROUND_SEM_NAME, 0, 0);
     if (OsStatus != OS_SUCCESS)
     {
@@ -247,9 +322,34 @@ void CFE_ES_BackgroundCleanup(void)
  *-----------------------------------------------------------------*/
 void CFE_ES_BackgroundWakeup(void)
 {
+    uint32 JobIdx;
+
+    /* The caller does not identify the job, so all of them are
+     * called on the next pass to check for new work. */
+    for (JobIdx = 0; JobIdx < CFE_ES_BACKGROUND_NUM_JOBS; ++JobIdx)
+    {
+        CFE_ES_Global.BackgroundTask.Jobs[JobIdx].WakeRequested = true;
+    }
+
     /* wake up the background task by giving the sem.
      * This is "informational" and not strictly required,
      * but it will make the task immediately wake up and check for new
      * work if it was idle. */
     OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
 }
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundWakeupJob(CFE_ES_BackgroundJobId_t JobId)
+{
+    if ((uint32)JobId < CFE_ES_BACKGROUND_NUM_JOBS)
+    {
+        CFE_ES_Global.BackgroundTask.Jobs[JobId].WakeRequested = true;
+    }
+
+    OS_BinSemGive(CFE_ES_Global.BackgroundTask.WorkSem);
+}
@@ -52,6 +52,8 @@ int32 CFE_ES_CDS_EarlyInit(void)
 {
     CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
     uint32                 PlatformSize;
+    uint32                 DirectSize;
+    cpuaddr                DirectAddr;
     size_t                 MinRequiredSize;
     int32                  OsStatus;
     int32                  Status;
@@ -83,6 +85,14 @@ int32 CFE_ES_CDS_EarlyInit(void)
     /* Always truncate the size to the nearest 4 byte boundary */
     CDS->TotalSize = PlatformSize & 0xfffffffc;
 
+    /* Use direct access if the PSP maps the whole CDS as ordinary memory */
+    CDS->DirectPtr = NULL;
+    PspStatus      = CFE_PSP_GetCDSArea(&DirectAddr, &DirectSize);
+    if (PspStatus == CFE_PSP_SUCCESS && DirectAddr != 0 && DirectSize >= CDS->TotalSize)
+    {
+        CDS->DirectPtr = (uint8 *)DirectAddr;
+    }
+
     /* Compute the minimum size required for the CDS with the current configuration of the cFE */
     MinRequiredSize = CDS_RESERVED_MIN_SIZE;
     MinRequiredSize += CFE_ES_CDSReqdMinSize(CFE_PLATFORM_ES_CDS_MAX_NUM_ENTRIES); /* Max # of Min Sized Blocks */
@@ -153,11 +153,18 @@ typedef struct
 
     /*
      * Cache of last accessed data block
-     * Because CDS memory is not memory mapped, this serves
+     * Because CDS memory is not necessarily memory mapped, this serves
      * as temporary holding location for data being actively accessed.
      */
     CFE_ES_CDS_AccessCache_t Cache;
 
+    /*
+     * Address of the CDS, if the PSP provides direct access to it.
+     * When set, user data blocks are read and written in place rather
+     * than through the PSP copy routines.  NULL if not available.
+     */
+    uint8 *DirectPtr;
+
     osal_id_t           GenMutex;       /**< \brief Mutex that controls access to CDS and registry */
     size_t              TotalSize;      /**< \brief Total size of the CDS as reported by BSP */
     size_t              DataSize;       /**< \brief Size of actual user data pool */
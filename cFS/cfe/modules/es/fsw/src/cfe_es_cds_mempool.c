@@ -152,14 +152,15 @@ int32 CFE_ES_RebuildCDSPool(size_t CDSPoolSize, size_t StartOffset)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
 {
-    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    char                   LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
-    int32                  Status;
-    int32                  PspStatus;
-    size_t                 BlockSize;
-    size_t                 UserDataSize;
-    size_t                 UserDataOffset;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+    CFE_ES_CDS_Instance_t *   CDS = &CFE_ES_Global.CDSVars;
+    char                      LogMessage[CFE_ES_MAX_SYSLOG_MSG_SIZE];
+    int32                     Status;
+    int32                     PspStatus;
+    size_t                    BlockSize;
+    size_t                    UserDataSize;
+    size_t                    UserDataOffset;
+    CFE_ES_CDS_RegRec_t *     CDSRegRecPtr;
+    CFE_ES_CDS_BlockHeader_t *BlockHeaderPtr;
 
     /* Ensure the log message is an empty string in case it is never written to */
     LogMessage[0] = 0;
@@ -197,29 +198,40 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
             UserDataOffset = CDSRegRecPtr->BlockOffset;
             UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-            CDS->Cache.Data.BlockHeader.Crc =
-                CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
-            CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
-            CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
-
-            /* Write the new block descriptor for the data coming from the Application */
-            Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
-            if (Status != CFE_SUCCESS)
+            if (CDS->DirectPtr != NULL)
             {
-                snprintf(LogMessage, sizeof(LogMessage),
-                         "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
-                         (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                /* Update the block descriptor and data in place */
+                BlockHeaderPtr = (CFE_ES_CDS_BlockHeader_t *)(CDS->DirectPtr + CDSRegRecPtr->BlockOffset);
+                BlockHeaderPtr->Crc = CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                memcpy(CDS->DirectPtr + UserDataOffset, DataToWrite, UserDataSize);
+                Status = CFE_SUCCESS;
             }
             else
             {
-                PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
-                if (PspStatus != CFE_PSP_SUCCESS)
+                CDS->Cache.Data.BlockHeader.Crc =
+                    CFE_ES_CalculateCRC(DataToWrite, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                CDS->Cache.Offset = CDSRegRecPtr->BlockOffset;
+                CDS->Cache.Size   = sizeof(CFE_ES_CDS_BlockHeader_t);
+
+                /* Write the new block descriptor for the data coming from the Application */
+                Status = CFE_ES_CDS_CacheFlush(&CDS->Cache);
+                if (Status != CFE_SUCCESS)
                 {
                     snprintf(LogMessage, sizeof(LogMessage),
-                             "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n", (unsigned int)PspStatus,
-                             (unsigned long)UserDataOffset);
+                             "Err writing header data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                             (unsigned int)CDS->Cache.AccessStatus, (unsigned long)CDSRegRecPtr->BlockOffset);
+                }
+                else
+                {
+                    PspStatus = CFE_PSP_WriteToCDS(DataToWrite, UserDataOffset, UserDataSize);
+                    if (PspStatus != CFE_PSP_SUCCESS)
+                    {
+                        snprintf(LogMessage, sizeof(LogMessage),
+                                 "Err writing user data to CDS (Stat=0x%08x) @Offset=0x%08lx\n",
+                                 (unsigned int)PspStatus, (unsigned long)UserDataOffset);
 
-                    Status = CFE_ES_CDS_ACCESS_ERROR;
+                        Status = CFE_ES_CDS_ACCESS_ERROR;
+                    }
                 }
             }
         }
@@ -248,14 +260,16 @@ int32 CFE_ES_CDSBlockWrite(CFE_ES_CDSHandle_t Handle, const void *DataToWrite)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
 {
-    CFE_ES_CDS_Instance_t *CDS = &CFE_ES_Global.CDSVars;
-    int32                  Status;
-    int32                  PspStatus;
-    uint32                 CrcOfCDSData;
-    size_t                 BlockSize;
-    size_t                 UserDataSize;
-    size_t                 UserDataOffset;
-    CFE_ES_CDS_RegRec_t *  CDSRegRecPtr;
+    CFE_ES_CDS_Instance_t *         CDS = &CFE_ES_Global.CDSVars;
+    int32                           Status;
+    int32                           PspStatus;
+    uint32                          CrcOfCDSData;
+    uint32                          ExpectedCrc;
+    size_t                          BlockSize;
+    size_t                          UserDataSize;
+    size_t                          UserDataOffset;
+    CFE_ES_CDS_RegRec_t *           CDSRegRecPtr;
+    const CFE_ES_CDS_BlockHeader_t *BlockHeaderPtr;
 
     CDSRegRecPtr = CFE_ES_LocateCDSBlockRecordByID(Handle);
 
@@ -286,32 +300,41 @@ int32 CFE_ES_CDSBlockRead(void *DataRead, CFE_ES_CDSHandle_t Handle)
                 UserDataOffset = CDSRegRecPtr->BlockOffset;
                 UserDataOffset += sizeof(CFE_ES_CDS_BlockHeader_t);
 
-                /* Read the header */
-                Status =
-                    CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
-
-                if (Status == CFE_SUCCESS)
+                if (CDS->DirectPtr != NULL)
                 {
-                    /* Read the data block */
-                    PspStatus = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
-                    if (PspStatus == CFE_PSP_SUCCESS)
+                    /* Read the header and data block in place */
+                    BlockHeaderPtr = (const CFE_ES_CDS_BlockHeader_t *)(CDS->DirectPtr + CDSRegRecPtr->BlockOffset);
+                    ExpectedCrc    = BlockHeaderPtr->Crc;
+                    memcpy(DataRead, CDS->DirectPtr + UserDataOffset, UserDataSize);
+                }
+                else
+                {
+                    /* Read the header */
+                    Status =
+                        CFE_ES_CDS_CacheFetch(&CDS->Cache, CDSRegRecPtr->BlockOffset, sizeof(CFE_ES_CDS_BlockHeader_t));
+
+                    if (Status == CFE_SUCCESS)
                     {
-                        /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
-                        CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+                        ExpectedCrc = CDS->Cache.Data.BlockHeader.Crc;
 
-                        /* If the CRCs do not match, report an error */
-                        if (CrcOfCDSData != CDS->Cache.Data.BlockHeader.Crc)
+                        /* Read the data block */
+                        PspStatus = CFE_PSP_ReadFromCDS(DataRead, UserDataOffset, UserDataSize);
+                        if (PspStatus != CFE_PSP_SUCCESS)
                         {
-                            Status = CFE_ES_CDS_BLOCK_CRC_ERR;
-                        }
-                        else
-                        {
-                            Status = CFE_SUCCESS;
+                            Status = CFE_ES_CDS_ACCESS_ERROR;
                         }
                     }
-                    else
+                }
+
+                if (Status == CFE_SUCCESS)
+                {
+                    /* Compute the CRC for the data read from the CDS and determine if the data is still valid */
+                    CrcOfCDSData = CFE_ES_CalculateCRC(DataRead, UserDataSize, 0, CFE_MISSION_ES_DEFAULT_CRC);
+
+                    /* If the CRCs do not match, report an error */
+                    if (CrcOfCDSData != ExpectedCrc)
                     {
-                        Status = CFE_ES_CDS_ACCESS_ERROR;
+                        Status = CFE_ES_CDS_BLOCK_CRC_ERR;
                     }
                 }
             }
@@ -32,7 +32,7 @@
 ** Include Files
 */
 #include "common_types.h"
-#include "cfe_es.h"
+#include "cfe_es_api_typedefs.h"
 
 typedef uint32 (*const CFE_ES_ComputeCRC_Algo_t)(const void *DataPtr, size_t DataLength, uint32 InputCRC);
 
@@ -32,6 +32,7 @@
 #include "cfe_es_verify.h"
 
 #include "cfe_config.h"
+#include "cfe_msg_inline.h"
 
 #include <string.h>
 
@@ -48,15 +49,15 @@ bool CFE_ES_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     CFE_MSG_FcnCode_t FcnCode      = 0;
     CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
 
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    ActualLength = CFE_MSG_InlineGetSize(MsgPtr);
 
     /*
      ** Verify the command packet length
      */
     if (ExpectedLength != ActualLength)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+        MsgId   = CFE_MSG_InlineGetMsgId(MsgPtr);
+        FcnCode = CFE_MSG_InlineGetFcnCode(MsgPtr);
 
         CFE_EVS_SendEvent(CFE_ES_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
@@ -69,6 +70,72 @@ bool CFE_ES_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     return result;
 }
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_NoopCmd_t, CFE_ES_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_ResetCountersCmd_t, CFE_ES_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_RestartCmd_t, CFE_ES_RestartCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StartAppCmd_t, CFE_ES_StartAppCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StopAppCmd_t, CFE_ES_StopAppCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_RestartAppCmd_t, CFE_ES_RestartAppCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_ReloadAppCmd_t, CFE_ES_ReloadAppCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_QueryOneCmd_t, CFE_ES_QueryOneCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_QueryAllCmd_t, CFE_ES_QueryAllCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_QueryAllTasksCmd_t, CFE_ES_QueryAllTasksCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_ClearSysLogCmd_t, CFE_ES_ClearSysLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_WriteSysLogCmd_t, CFE_ES_WriteSysLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_OverWriteSysLogCmd_t, CFE_ES_OverWriteSysLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_ClearERLogCmd_t, CFE_ES_ClearERLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_WriteERLogCmd_t, CFE_ES_WriteERLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StartPerfDataCmd_t, CFE_ES_StartPerfDataCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StopPerfDataCmd_t, CFE_ES_StopPerfDataCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_SetPerfFilterMaskCmd_t, CFE_ES_SetPerfFilterMaskCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_SetPerfTriggerMaskCmd_t, CFE_ES_SetPerfTriggerMaskCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_ResetPRCountCmd_t, CFE_ES_ResetPRCountCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_SetMaxPRCountCmd_t, CFE_ES_SetMaxPRCountCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_DeleteCDSCmd_t, CFE_ES_DeleteCDSCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_SendMemPoolStatsCmd_t, CFE_ES_SendMemPoolStatsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_DumpCDSRegistryCmd_t, CFE_ES_DumpCDSRegistryCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StartPerfStatsCmd_t, CFE_ES_StartPerfStatsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_StopPerfStatsCmd_t, CFE_ES_StopPerfStatsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_ES_WritePerfStatsCmd_t, CFE_ES_WritePerfStatsCmd)
+
+/*
+ * Dispatch table for ES ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_ES_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_NOOP_CC, CFE_ES_NoopCmd_t, CFE_ES_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_RESET_COUNTERS_CC, CFE_ES_ResetCountersCmd_t, CFE_ES_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_RESTART_CC, CFE_ES_RestartCmd_t, CFE_ES_RestartCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_START_APP_CC, CFE_ES_StartAppCmd_t, CFE_ES_StartAppCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_STOP_APP_CC, CFE_ES_StopAppCmd_t, CFE_ES_StopAppCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_RESTART_APP_CC, CFE_ES_RestartAppCmd_t, CFE_ES_RestartAppCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_RELOAD_APP_CC, CFE_ES_ReloadAppCmd_t, CFE_ES_ReloadAppCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_QUERY_ONE_CC, CFE_ES_QueryOneCmd_t, CFE_ES_QueryOneCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_QUERY_ALL_CC, CFE_ES_QueryAllCmd_t, CFE_ES_QueryAllCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_QUERY_ALL_TASKS_CC, CFE_ES_QueryAllTasksCmd_t, CFE_ES_QueryAllTasksCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_CLEAR_SYS_LOG_CC, CFE_ES_ClearSysLogCmd_t, CFE_ES_ClearSysLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_WRITE_SYS_LOG_CC, CFE_ES_WriteSysLogCmd_t, CFE_ES_WriteSysLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_OVER_WRITE_SYS_LOG_CC, CFE_ES_OverWriteSysLogCmd_t, CFE_ES_OverWriteSysLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_CLEAR_ER_LOG_CC, CFE_ES_ClearERLogCmd_t, CFE_ES_ClearERLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_WRITE_ER_LOG_CC, CFE_ES_WriteERLogCmd_t, CFE_ES_WriteERLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_START_PERF_DATA_CC, CFE_ES_StartPerfDataCmd_t, CFE_ES_StartPerfDataCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_STOP_PERF_DATA_CC, CFE_ES_StopPerfDataCmd_t, CFE_ES_StopPerfDataCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_SET_PERF_FILTER_MASK_CC, CFE_ES_SetPerfFilterMaskCmd_t,
+                              CFE_ES_SetPerfFilterMaskCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_SET_PERF_TRIGGER_MASK_CC, CFE_ES_SetPerfTriggerMaskCmd_t,
+                              CFE_ES_SetPerfTriggerMaskCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_RESET_PR_COUNT_CC, CFE_ES_ResetPRCountCmd_t, CFE_ES_ResetPRCountCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_SET_MAX_PR_COUNT_CC, CFE_ES_SetMaxPRCountCmd_t, CFE_ES_SetMaxPRCountCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_DELETE_CDS_CC, CFE_ES_DeleteCDSCmd_t, CFE_ES_DeleteCDSCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_SEND_MEM_POOL_STATS_CC, CFE_ES_SendMemPoolStatsCmd_t, CFE_ES_SendMemPoolStatsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_DUMP_CDS_REGISTRY_CC, CFE_ES_DumpCDSRegistryCmd_t, CFE_ES_DumpCDSRegistryCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_START_PERF_STATS_CC, CFE_ES_StartPerfStatsCmd_t, CFE_ES_StartPerfStatsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_STOP_PERF_STATS_CC, CFE_ES_StopPerfStatsCmd_t, CFE_ES_StopPerfStatsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_ES_WRITE_PERF_STATS_CC, CFE_ES_WritePerfStatsCmd_t, CFE_ES_WritePerfStatsCmd),
+};
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -76,185 +143,22 @@ bool CFE_ES_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
  *-----------------------------------------------------------------*/
 void CFE_ES_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
-    switch (CommandCode)
-    {
-        case CFE_ES_NOOP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_NoopCmd_t)))
-            {
-                CFE_ES_NoopCmd((const CFE_ES_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESET_COUNTERS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetCountersCmd_t)))
-            {
-                CFE_ES_ResetCountersCmd((const CFE_ES_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESTART_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_RestartCmd_t)))
-            {
-                CFE_ES_RestartCmd((const CFE_ES_RestartCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_START_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartAppCmd_t)))
-            {
-                CFE_ES_StartAppCmd((const CFE_ES_StartAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_STOP_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StopAppCmd_t)))
-            {
-                CFE_ES_StopAppCmd((const CFE_ES_StopAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESTART_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_RestartAppCmd_t)))
-            {
-                CFE_ES_RestartAppCmd((const CFE_ES_RestartAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RELOAD_APP_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ReloadAppCmd_t)))
-            {
-                CFE_ES_ReloadAppCmd((const CFE_ES_ReloadAppCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_QUERY_ONE_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryOneCmd_t)))
-            {
-                CFE_ES_QueryOneCmd((const CFE_ES_QueryOneCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_QUERY_ALL_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryAllCmd_t)))
-            {
-                CFE_ES_QueryAllCmd((const CFE_ES_QueryAllCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_QUERY_ALL_TASKS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_QueryAllTasksCmd_t)))
-            {
-                CFE_ES_QueryAllTasksCmd((const CFE_ES_QueryAllTasksCmd_t *)SBBufPtr);
-            }
-            break;
+    CFE_MSG_FcnCode_t                CommandCode = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-        case CFE_ES_CLEAR_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ClearSysLogCmd_t)))
-            {
-                CFE_ES_ClearSysLogCmd((const CFE_ES_ClearSysLogCmd_t *)SBBufPtr);
-            }
-            break;
+    CommandCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
-        case CFE_ES_WRITE_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteSysLogCmd_t)))
-            {
-                CFE_ES_WriteSysLogCmd((const CFE_ES_WriteSysLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_OVER_WRITE_SYS_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_OverWriteSysLogCmd_t)))
-            {
-                CFE_ES_OverWriteSysLogCmd((const CFE_ES_OverWriteSysLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_CLEAR_ER_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ClearERLogCmd_t)))
-            {
-                CFE_ES_ClearERLogCmd((const CFE_ES_ClearERLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_WRITE_ER_LOG_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_WriteERLogCmd_t)))
-            {
-                CFE_ES_WriteERLogCmd((const CFE_ES_WriteERLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_START_PERF_DATA_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StartPerfDataCmd_t)))
-            {
-                CFE_ES_StartPerfDataCmd((const CFE_ES_StartPerfDataCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_STOP_PERF_DATA_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_StopPerfDataCmd_t)))
-            {
-                CFE_ES_StopPerfDataCmd((const CFE_ES_StopPerfDataCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_PERF_FILTER_MASK_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetPerfFilterMaskCmd_t)))
-            {
-                CFE_ES_SetPerfFilterMaskCmd((const CFE_ES_SetPerfFilterMaskCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_PERF_TRIGGER_MASK_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetPerfTriggerMaskCmd_t)))
-            {
-                CFE_ES_SetPerfTriggerMaskCmd((const CFE_ES_SetPerfTriggerMaskCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_RESET_PR_COUNT_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_ResetPRCountCmd_t)))
-            {
-                CFE_ES_ResetPRCountCmd((const CFE_ES_ResetPRCountCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SET_MAX_PR_COUNT_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SetMaxPRCountCmd_t)))
-            {
-                CFE_ES_SetMaxPRCountCmd((const CFE_ES_SetMaxPRCountCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_DELETE_CDS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_DeleteCDSCmd_t)))
-            {
-                CFE_ES_DeleteCDSCmd((const CFE_ES_DeleteCDSCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_SEND_MEM_POOL_STATS_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_SendMemPoolStatsCmd_t)))
-            {
-                CFE_ES_SendMemPoolStatsCmd((const CFE_ES_SendMemPoolStatsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_ES_DUMP_CDS_REGISTRY_CC:
-            if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_ES_DumpCDSRegistryCmd_t)))
-            {
-                CFE_ES_DumpCDSRegistryCmd((const CFE_ES_DumpCDSRegistryCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid ground command code: ID = 0x%X, CC = %d", (unsigned int)CFE_ES_CMD_MID,
-                              (int)CommandCode);
-            CFE_ES_Global.TaskData.CommandErrorCounter++;
-            break;
+    Entry = CFE_SB_GetCmdDispatchEntry(CFE_ES_CMD_DISPATCH_TABLE,
+                                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_ES_CMD_DISPATCH_TABLE), CommandCode);
+    if (Entry == NULL)
+    {
+        CFE_EVS_SendEvent(CFE_ES_CC1_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid ground command code: ID = 0x%X, CC = %d",
+                          (unsigned int)CFE_ES_CMD_MID, (int)CommandCode);
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else if (CFE_ES_VerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
+    {
+        Entry->Handler(SBBufPtr);
     }
 }
 
@@ -278,7 +182,7 @@ void CFE_ES_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
         SEND_HK_MID = CFE_SB_ValueToMsgId(CFE_ES_SEND_HK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    MessageID = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
     {
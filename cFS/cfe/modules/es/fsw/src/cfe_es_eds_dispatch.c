@@ -62,6 +62,9 @@ static const EdsDispatchTable_EdsComponent_CFE_ES_Application_CFE_SB_Telecommand
         .DeleteCDSCmd_indication          = CFE_ES_DeleteCDSCmd,
         .SendMemPoolStatsCmd_indication   = CFE_ES_SendMemPoolStatsCmd,
         .DumpCDSRegistryCmd_indication    = CFE_ES_DumpCDSRegistryCmd,
+        .StartPerfStatsCmd_indication     = CFE_ES_StartPerfStatsCmd,
+        .StopPerfStatsCmd_indication      = CFE_ES_StopPerfStatsCmd,
+        .WritePerfStatsCmd_indication     = CFE_ES_WritePerfStatsCmd,
     },
     .SEND_HK =
     {
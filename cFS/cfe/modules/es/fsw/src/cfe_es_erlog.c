@@ -52,6 +52,7 @@ int32 CFE_ES_WriteToERLogWithContext(CFE_ES_LogEntryType_Enum_t EntryType, uint3
                                      const char *Description, CFE_ES_AppId_t AppId, uint32 PspContextId)
 {
     uint32                   LogIdx;
+    CFE_ES_ERLog_Header_t *  HeaderPtr;
     CFE_ES_ERLog_MetaData_t *EntryPtr;
     CFE_TIME_SysTime_t       PendingTime;
 
@@ -135,6 +136,17 @@ int32 CFE_ES_WriteToERLogWithContext(CFE_ES_LogEntryType_Enum_t EntryType, uint3
     */
     CFE_ES_Global.ResetDataPtr->ERLogEntries++;
 
+    /*
+     * Update the index entry for the slot
+     */
+    HeaderPtr = &CFE_ES_Global.ERLogHeaders[LogIdx];
+
+    HeaderPtr->Sequence     = CFE_ES_Global.ResetDataPtr->ERLogEntries;
+    HeaderPtr->LogEntryType = EntryType;
+    HeaderPtr->AppID        = AppId;
+    HeaderPtr->PspContextId = PspContextId;
+    HeaderPtr->TimeCode     = PendingTime;
+
     /*
      * Shared data update is complete
      */
@@ -168,6 +180,7 @@ bool CFE_ES_BackgroundERLogFileDataGetter(void *Meta, uint32 RecordNum, void **B
     CFE_ES_BackgroundLogDumpGlobal_t *BgFilePtr;
     CFE_ES_ERLog_FileEntry_t *        FileBufferPtr;
     CFE_ES_ERLog_MetaData_t *         EntryPtr;
+    CFE_ES_ERLog_Header_t *           HeaderPtr;
     int32                             PspStatus;
 
     BgFilePtr     = (CFE_ES_BackgroundLogDumpGlobal_t *)Meta;
@@ -175,7 +188,8 @@ bool CFE_ES_BackgroundERLogFileDataGetter(void *Meta, uint32 RecordNum, void **B
 
     if (RecordNum < CFE_PLATFORM_ES_ER_LOG_ENTRIES)
     {
-        EntryPtr = &CFE_ES_Global.ResetDataPtr->ERLog[RecordNum];
+        EntryPtr  = &CFE_ES_Global.ResetDataPtr->ERLog[RecordNum];
+        HeaderPtr = &CFE_ES_Global.ERLogHeaders[RecordNum];
 
         /* First wipe the buffer before re-use */
         memset(FileBufferPtr, 0, sizeof(*FileBufferPtr));
@@ -188,9 +202,18 @@ bool CFE_ES_BackgroundERLogFileDataGetter(void *Meta, uint32 RecordNum, void **B
         /*
          * The context info, if available, comes from the PSP.
          * This returns the actual size of the context info, or <0 on error.
+         * Unused entries and entries without context are not looked up.
          */
-        PspStatus = CFE_PSP_Exception_CopyContext(EntryPtr->PspContextId, &FileBufferPtr->Context,
-                                                  sizeof(FileBufferPtr->Context));
+        if (HeaderPtr->Sequence != 0 && HeaderPtr->PspContextId != CFE_ES_ERLOG_NO_CONTEXT)
+        {
+            PspStatus = CFE_PSP_Exception_CopyContext(HeaderPtr->PspContextId, &FileBufferPtr->Context,
+                                                      sizeof(FileBufferPtr->Context));
+        }
+        else
+        {
+            PspStatus = CFE_PSP_NO_EXCEPTION_DATA;
+        }
+
         if (PspStatus > 0)
         {
             FileBufferPtr->ContextSize = PspStatus;
@@ -261,6 +284,223 @@ void CFE_ES_BackgroundERLogFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t
     }
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Checks if time A is before time B.  This is a plain comparison,
+ * it does not account for rollover of the seconds field.
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_ES_ERLogTimeBefore(const CFE_TIME_SysTime_t *TimeA, const CFE_TIME_SysTime_t *TimeB)
+{
+    return (TimeA->Seconds < TimeB->Seconds ||
+            (TimeA->Seconds == TimeB->Seconds && TimeA->Subseconds < TimeB->Subseconds));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Gets the position of the first entry that is not before the given time,
+ * or the number of stored entries if there is no such entry.
+ *
+ * If Inclusive is false, this gets the first entry that is after the given time.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_ERLogLowerBound(const CFE_TIME_SysTime_t *TimeRef, bool Inclusive)
+{
+    const CFE_ES_ERLog_Header_t *HeaderPtr;
+    uint32                       Low;
+    uint32                       High;
+    uint32                       Mid;
+    bool                         IsBelow;
+
+    Low  = 0;
+    High = CFE_ES_ERLogGetNumStored();
+    while (Low < High)
+    {
+        Mid       = Low + ((High - Low) / 2);
+        HeaderPtr = &CFE_ES_Global.ERLogHeaders[CFE_ES_ERLogPositionToIndex(Mid)];
+
+        if (Inclusive)
+        {
+            IsBelow = CFE_ES_ERLogTimeBefore(&HeaderPtr->TimeCode, TimeRef);
+        }
+        else
+        {
+            IsBelow = !CFE_ES_ERLogTimeBefore(TimeRef, &HeaderPtr->TimeCode);
+        }
+
+        if (IsBelow)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    return Low;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_ERLogGetNumStored(void)
+{
+    uint32 NumStored;
+
+    NumStored = CFE_ES_Global.ResetDataPtr->ERLogEntries;
+    if (NumStored > CFE_PLATFORM_ES_ER_LOG_ENTRIES)
+    {
+        NumStored = CFE_PLATFORM_ES_ER_LOG_ENTRIES;
+    }
+
+    return NumStored;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_ERLogPositionToIndex(uint32 Position)
+{
+    uint32 NextIdx;
+
+    /* The next index to write is where the oldest entry is, once the log has wrapped */
+    NextIdx = CFE_ES_Global.ResetDataPtr->ERLogIndex;
+    if (NextIdx >= CFE_PLATFORM_ES_ER_LOG_ENTRIES)
+    {
+        NextIdx = 0;
+    }
+
+    return (NextIdx + CFE_PLATFORM_ES_ER_LOG_ENTRIES - CFE_ES_ERLogGetNumStored() + Position) %
+           CFE_PLATFORM_ES_ER_LOG_ENTRIES;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_ERLogFindTimeRange(CFE_TIME_SysTime_t StartTime, CFE_TIME_SysTime_t EndTime, uint32 *FirstPosition)
+{
+    uint32 EndPosition;
+
+    *FirstPosition = CFE_ES_ERLogLowerBound(&StartTime, true);
+    EndPosition    = CFE_ES_ERLogLowerBound(&EndTime, false);
+
+    if (EndPosition <= *FirstPosition)
+    {
+        return 0;
+    }
+
+    return EndPosition - *FirstPosition;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_ERLogFindNextByApp(CFE_ES_AppId_t AppId, uint32 *Position)
+{
+    const CFE_ES_ERLog_Header_t *HeaderPtr;
+    uint32                       NumStored;
+
+    NumStored = CFE_ES_ERLogGetNumStored();
+    while (*Position < NumStored)
+    {
+        HeaderPtr = &CFE_ES_Global.ERLogHeaders[CFE_ES_ERLogPositionToIndex(*Position)];
+        if (CFE_RESOURCEID_TEST_EQUAL(HeaderPtr->AppID, AppId))
+        {
+            return true;
+        }
+        ++(*Position);
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_ERLogRebuildIndex(void)
+{
+    const CFE_ES_ERLog_MetaData_t *EntryPtr;
+    CFE_ES_ERLog_Header_t *        HeaderPtr;
+    uint32                         NumStored;
+    uint32                         Position;
+    uint32                         LogIdx;
+
+    memset(CFE_ES_Global.ERLogHeaders, 0, sizeof(CFE_ES_Global.ERLogHeaders));
+
+    /* Entries are numbered in the order they were written, the newest being ERLogEntries */
+    NumStored = CFE_ES_ERLogGetNumStored();
+    for (Position = 0; Position < NumStored; ++Position)
+    {
+        LogIdx    = CFE_ES_ERLogPositionToIndex(Position);
+        EntryPtr  = &CFE_ES_Global.ResetDataPtr->ERLog[LogIdx];
+        HeaderPtr = &CFE_ES_Global.ERLogHeaders[LogIdx];
+
+        HeaderPtr->Sequence     = CFE_ES_Global.ResetDataPtr->ERLogEntries - NumStored + Position + 1;
+        HeaderPtr->LogEntryType = EntryPtr->BaseInfo.LogEntryType;
+        HeaderPtr->AppID        = EntryPtr->AppID;
+        HeaderPtr->PspContextId = EntryPtr->PspContextId;
+        HeaderPtr->TimeCode     = EntryPtr->BaseInfo.TimeCode;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Counts the entries of an application in the ER log which were written
+ * within CFE_ES_ERLOG_RECENT_EXCEPTION_PERIOD before the given time.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_ERLogCountRecent(CFE_ES_AppId_t AppId, CFE_TIME_SysTime_t EndTime)
+{
+    CFE_TIME_SysTime_t StartTime;
+    uint32             Position;
+    uint32             EndPosition;
+    uint32             Count;
+
+    StartTime = EndTime;
+    if (StartTime.Seconds > CFE_ES_ERLOG_RECENT_EXCEPTION_PERIOD)
+    {
+        StartTime.Seconds -= CFE_ES_ERLOG_RECENT_EXCEPTION_PERIOD;
+    }
+    else
+    {
+        StartTime.Seconds    = 0;
+        StartTime.Subseconds = 0;
+    }
+
+    Count       = 0;
+    EndPosition = CFE_ES_ERLogFindTimeRange(StartTime, EndTime, &Position);
+    EndPosition += Position;
+    while (CFE_ES_ERLogFindNextByApp(AppId, &Position) && Position < EndPosition)
+    {
+        ++Count;
+        ++Position;
+    }
+
+    return Count;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -278,6 +518,8 @@ bool CFE_ES_RunExceptionScan(uint32 ElapsedTime, void *Arg)
     uint32                     ResetType;
     CFE_ES_LogEntryType_Enum_t LogType;
     CFE_ES_AppRecord_t *       AppRecPtr;
+    CFE_TIME_SysTime_t         ScanTime;
+    uint32                     RecentCount;
 
     if (CFE_PSP_Exception_GetCount() == 0)
     {
@@ -335,6 +577,9 @@ bool CFE_ES_RunExceptionScan(uint32 ElapsedTime, void *Arg)
          */
         if (Status == CFE_SUCCESS)
         {
+            /* Snapshot the time before locking (different subsystem) */
+            ScanTime = CFE_TIME_GetTime();
+
             AppRecPtr = CFE_ES_LocateAppRecordByID(EsTaskInfo.AppId);
             CFE_ES_LockSharedData(__func__, __LINE__);
             if (CFE_ES_AppRecordIsMatch(AppRecPtr, EsTaskInfo.AppId) &&
@@ -345,7 +590,21 @@ bool CFE_ES_RunExceptionScan(uint32 ElapsedTime, void *Arg)
                  */
                 ResetType = CFE_ES_APP_RESTART;
             }
+
+            /*
+             * Only exceptions are logged with an AppID, so this is the number of
+             * earlier exceptions of the same app.  This is a search on the ER log
+             * index, which is cheap enough to do on every exception.
+             */
+            RecentCount = CFE_ES_ERLogCountRecent(EsTaskInfo.AppId, ScanTime);
             CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+            if (RecentCount != 0)
+            {
+                CFE_ES_WriteToSysLog("%s: %lu earlier exception(s) of AppID %lu in the last %d seconds\n", __func__,
+                                     (unsigned long)RecentCount, CFE_RESOURCEID_TO_ULONG(EsTaskInfo.AppId),
+                                     CFE_ES_ERLOG_RECENT_EXCEPTION_PERIOD);
+            }
         }
     }
 
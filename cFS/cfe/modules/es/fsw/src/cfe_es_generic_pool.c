@@ -53,14 +53,29 @@
 uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
 {
     uint16 Index;
+    size_t SizeClass;
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    if (PoolRecPtr->NumBuckets == 0 || ReqSize > PoolRecPtr->Buckets[PoolRecPtr->NumBuckets - 1].BlockSize)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
-        {
-            /* it fits - stop here */
-            break;
-        }
+        /* does not fit in any bucket */
+        return 0;
+    }
+
+    /*
+     * The size class table gives the first bucket that could fit a request
+     * of this size class.  Where a size class spans more than one block size
+     * the search continues from there, but this will only be a few steps.
+     */
+    SizeClass = 0;
+    if (ReqSize > 0)
+    {
+        SizeClass = (ReqSize - 1) >> PoolRecPtr->SizeClassShift;
+    }
+
+    Index = PoolRecPtr->SizeClassMap[SizeClass];
+    while (ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
+    {
+        ++Index;
     }
 
     /*
@@ -225,6 +240,619 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Read the state of a slab from the descriptors at its start
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolReadSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t SlabOffset, CFE_ES_GenPoolSlab_t *SlabPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32               Status;
+
+    if (SlabOffset >= PoolRecPtr->TailPosition || SlabOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, SlabOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_SLAB_PATTERN)
+        {
+            /* This does not appear to be a valid slab */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            if (BdPtr->Allocated == CFE_ES_SLAB_RESERVED)
+            {
+                SlabPtr->BucketId = 0;
+            }
+            else
+            {
+                SlabPtr->BucketId = BdPtr->Allocated - CFE_ES_SLAB_ASSIGNED;
+            }
+            SlabPtr->InUseCount = BdPtr->ActualSize;
+            SlabPtr->NextOffset = BdPtr->NextOffset;
+
+            Status = PoolRecPtr->Retrieve(PoolRecPtr, SlabOffset, &BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_SLAB_PATTERN)
+        {
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            SlabPtr->PrevOffset = BdPtr->ActualSize;
+            SlabPtr->FreeOffset = BdPtr->NextOffset;
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Write the state of a slab to the descriptors at its start
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolWriteSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t SlabOffset,
+                              const CFE_ES_GenPoolSlab_t *SlabPtr)
+{
+    CFE_ES_GenPoolBD_t *BdPtr;
+    size_t              DescOffset;
+    uint16              Allocated;
+    int32               Status;
+
+    if (SlabPtr->BucketId == 0)
+    {
+        Allocated = CFE_ES_SLAB_RESERVED;
+    }
+    else
+    {
+        Allocated = CFE_ES_SLAB_ASSIGNED + SlabPtr->BucketId;
+    }
+
+    DescOffset = SlabOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    Status     = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_SLAB_PATTERN;
+        BdPtr->Allocated  = Allocated;
+        BdPtr->ActualSize = SlabPtr->InUseCount;
+        BdPtr->NextOffset = SlabPtr->NextOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, SlabOffset, &BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->CheckBits  = CFE_ES_SLAB_PATTERN;
+        BdPtr->Allocated  = Allocated;
+        BdPtr->ActualSize = SlabPtr->PrevOffset;
+        BdPtr->NextOffset = SlabPtr->FreeOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, SlabOffset, BdPtr);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Remove a slab from the list of slabs with free blocks of a bucket
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolUnlinkSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                               CFE_ES_GenPoolSlab_t *SlabPtr)
+{
+    CFE_ES_GenPoolSlab_t Neighbor;
+    int32                Status;
+
+    Status = CFE_SUCCESS;
+
+    if (SlabPtr->PrevOffset == 0)
+    {
+        BucketPtr->SlabOffset = SlabPtr->NextOffset;
+    }
+    else
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabPtr->PrevOffset, &Neighbor);
+        if (Status == CFE_SUCCESS)
+        {
+            Neighbor.NextOffset = SlabPtr->NextOffset;
+            Status              = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabPtr->PrevOffset, &Neighbor);
+        }
+    }
+
+    if (Status == CFE_SUCCESS && SlabPtr->NextOffset != 0)
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabPtr->NextOffset, &Neighbor);
+        if (Status == CFE_SUCCESS)
+        {
+            Neighbor.PrevOffset = SlabPtr->PrevOffset;
+            Status              = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabPtr->NextOffset, &Neighbor);
+        }
+    }
+
+    SlabPtr->PrevOffset = 0;
+    SlabPtr->NextOffset = 0;
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Return an unused slab to the reserve.  The slab must already
+ * be removed from the list of its bucket.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolReleaseSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                                size_t SlabOffset, CFE_ES_GenPoolSlab_t *SlabPtr)
+{
+    int32 Status;
+
+    SlabPtr->BucketId   = 0;
+    SlabPtr->InUseCount = 0;
+    SlabPtr->FreeOffset = 0;
+    SlabPtr->PrevOffset = 0;
+    SlabPtr->NextOffset = PoolRecPtr->ReserveOffset;
+
+    Status = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabOffset, SlabPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        PoolRecPtr->ReserveOffset = SlabOffset;
+        ++PoolRecPtr->ReserveSlabCount;
+
+        /* the blocks of the slab no longer exist */
+        --BucketPtr->SlabCount;
+        PoolRecPtr->SlabBlockCount -= BucketPtr->BlocksPerSlab;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Add a slab to the front of the list of slabs with free blocks of a bucket
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolPushSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_GenPoolBucket_t *BucketPtr,
+                             size_t SlabOffset, CFE_ES_GenPoolSlab_t *SlabPtr)
+{
+    CFE_ES_GenPoolSlab_t Head;
+    size_t               HeadOffset;
+    int32                Status;
+
+    Status = CFE_SUCCESS;
+
+    /*
+     * An unused slab is only kept in the list while it is the only one with free blocks,
+     * to avoid handing it back and forth to the reserve.  It is not needed anymore now.
+     */
+    HeadOffset = BucketPtr->SlabOffset;
+    if (HeadOffset != 0)
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, HeadOffset, &Head);
+        if (Status == CFE_SUCCESS && Head.InUseCount == 0)
+        {
+            Status = CFE_ES_GenPoolUnlinkSlab(PoolRecPtr, BucketPtr, &Head);
+            if (Status == CFE_SUCCESS)
+            {
+                Status = CFE_ES_GenPoolReleaseSlab(PoolRecPtr, BucketPtr, HeadOffset, &Head);
+            }
+        }
+    }
+
+    HeadOffset = BucketPtr->SlabOffset;
+    if (Status == CFE_SUCCESS && HeadOffset != 0)
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, HeadOffset, &Head);
+        if (Status == CFE_SUCCESS)
+        {
+            Head.PrevOffset = SlabOffset;
+            Status          = CFE_ES_GenPoolWriteSlab(PoolRecPtr, HeadOffset, &Head);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        SlabPtr->PrevOffset   = 0;
+        SlabPtr->NextOffset   = HeadOffset;
+        BucketPtr->SlabOffset = SlabOffset;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Carve a new slab from the end of the pool and put it in the reserve
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolCreateSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_GenPoolSlab_t Slab;
+    size_t               SlabStart;
+    size_t               NextTailPosition;
+    int32                Status;
+
+    SlabStart = PoolRecPtr->TailPosition + PoolRecPtr->AlignMask;
+    SlabStart &= ~PoolRecPtr->AlignMask;
+
+    NextTailPosition = SlabStart + PoolRecPtr->SlabSize;
+    if (NextTailPosition > PoolRecPtr->PoolMaxOffset)
+    {
+        /* can't fit in remaining mem */
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    memset(&Slab, 0, sizeof(Slab));
+    Slab.NextOffset = PoolRecPtr->ReserveOffset;
+
+    Status = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabStart + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &Slab);
+    if (Status == CFE_SUCCESS)
+    {
+        /* only extend the pool once the slab is fully formatted */
+        PoolRecPtr->TailPosition  = NextTailPosition;
+        PoolRecPtr->ReserveOffset = SlabStart + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        ++PoolRecPtr->SlabCount;
+        ++PoolRecPtr->ReserveSlabCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Find a bucket which is holding on to an unused slab, and
+ * return that slab to the reserve.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolReclaimSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolSlab_t    Slab;
+    size_t                  SlabOffset;
+    uint16                  Index;
+    int32                   Status;
+
+    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    {
+        BucketPtr  = &PoolRecPtr->Buckets[Index];
+        SlabOffset = BucketPtr->SlabOffset;
+        if (BucketPtr->BlocksPerSlab != 0 && SlabOffset != 0)
+        {
+            Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabOffset, &Slab);
+            if (Status == CFE_SUCCESS && Slab.InUseCount == 0)
+            {
+                Status = CFE_ES_GenPoolUnlinkSlab(PoolRecPtr, BucketPtr, &Slab);
+                if (Status == CFE_SUCCESS)
+                {
+                    Status = CFE_ES_GenPoolReleaseSlab(PoolRecPtr, BucketPtr, SlabOffset, &Slab);
+                }
+
+                return Status;
+            }
+        }
+    }
+
+    /* no unused slabs anywhere */
+    return CFE_ES_ERR_MEM_BLOCK_SIZE;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Take a slab from the reserve and assign it to a bucket.  All
+ * blocks of the slab are created at once, and put on its free list.
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolAssignSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, CFE_ES_GenPoolBucket_t *BucketPtr)
+{
+    CFE_ES_GenPoolSlab_t Slab;
+    CFE_ES_GenPoolBD_t * BdPtr;
+    size_t               SlabOffset;
+    size_t               DescOffset;
+    size_t               BlockOffset;
+    size_t               BlockStride;
+    uint32               i;
+    int32                Status;
+
+    Status = CFE_SUCCESS;
+
+    if (PoolRecPtr->ReserveOffset == 0)
+    {
+        /* first try to make a new slab, and only if that is not possible take one from another bucket */
+        Status = CFE_ES_GenPoolCreateSlab(PoolRecPtr);
+        if (Status == CFE_ES_ERR_MEM_BLOCK_SIZE)
+        {
+            Status = CFE_ES_GenPoolReclaimSlab(PoolRecPtr);
+        }
+    }
+
+    SlabOffset = PoolRecPtr->ReserveOffset;
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabOffset, &Slab);
+    }
+
+    if (Status == CFE_SUCCESS && Slab.BucketId != 0)
+    {
+        /* sanity check failed - possible pool corruption? */
+        Status = CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    PoolRecPtr->ReserveOffset = Slab.NextOffset;
+    --PoolRecPtr->ReserveSlabCount;
+
+    /*
+     * Create all the blocks of the slab.  Each block is placed
+     * the same way as CFE_ES_GenPoolCreatePoolBlock() would do.
+     */
+    BlockStride = BucketPtr->BlockSize + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    BlockStride += PoolRecPtr->AlignMask;
+    BlockStride &= ~PoolRecPtr->AlignMask;
+
+    BlockOffset = SlabOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE + PoolRecPtr->SlabDataOffset;
+
+    memset(&Slab, 0, sizeof(Slab));
+    Slab.BucketId   = BucketId;
+    Slab.FreeOffset = BlockOffset;
+
+    for (i = 0; i < BucketPtr->BlocksPerSlab && Status == CFE_SUCCESS; ++i)
+    {
+        DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        BlockOffset += BlockStride;
+
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+        if (Status == CFE_SUCCESS)
+        {
+            BdPtr->CheckBits  = CFE_ES_CHECK_PATTERN;
+            BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+            BdPtr->ActualSize = 0;
+
+            if ((i + 1) < BucketPtr->BlocksPerSlab)
+            {
+                BdPtr->NextOffset = BlockOffset;
+            }
+            else
+            {
+                BdPtr->NextOffset = 0;
+            }
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolPushSlab(PoolRecPtr, BucketPtr, SlabOffset, &Slab);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabOffset, &Slab);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* all blocks of the slab exist now, and all are free */
+        ++BucketPtr->SlabCount;
+        PoolRecPtr->SlabBlockCount += BucketPtr->BlocksPerSlab;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolGetSlabBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                 size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolSlab_t    Slab;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  SlabOffset;
+    size_t                  DescOffset;
+    size_t                  BlockOffset;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL || BucketPtr->BlocksPerSlab == 0)
+    {
+        /* no slabs for this bucket */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Status = CFE_SUCCESS;
+    if (BucketPtr->SlabOffset == 0)
+    {
+        /* all slabs of this bucket are full */
+        Status = CFE_ES_GenPoolAssignSlab(PoolRecPtr, BucketId, BucketPtr);
+    }
+
+    SlabOffset = BucketPtr->SlabOffset;
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabOffset, &Slab);
+    }
+
+    if (Status == CFE_SUCCESS && (Slab.BucketId != BucketId || Slab.FreeOffset == 0))
+    {
+        /* sanity check failed - possible pool corruption? */
+        Status = CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    BlockOffset = 0;
+    DescOffset  = 0;
+    if (Status == CFE_SUCCESS)
+    {
+        BlockOffset = Slab.FreeOffset;
+        DescOffset  = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+        Status      = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BdPtr->Allocated != (CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            /*
+             * Get it off the top on the list.  While allocated, the
+             * descriptor refers back to the slab instead.
+             */
+            Slab.FreeOffset = BdPtr->NextOffset;
+
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+            BdPtr->ActualSize = NewSize;
+            BdPtr->NextOffset = SlabOffset;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        ++Slab.InUseCount;
+        if (Slab.FreeOffset == 0)
+        {
+            /* slab is full now */
+            Status = CFE_ES_GenPoolUnlinkSlab(PoolRecPtr, BucketPtr, &Slab);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        Status = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabOffset, &Slab);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        *BlockOffsetPtr = BlockOffset;
+        ++BucketPtr->SlabInUseCount;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolPutSlabBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset,
+                                 size_t SlabOffset)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolSlab_t    Slab;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    size_t                  DescOffset;
+    bool                    WasFull;
+    int32                   Status;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL || BucketPtr->BlocksPerSlab == 0)
+    {
+        /* no slabs for this bucket */
+        return CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    Status = CFE_ES_GenPoolReadSlab(PoolRecPtr, SlabOffset, &Slab);
+    if (Status == CFE_SUCCESS && (Slab.BucketId != BucketId || Slab.InUseCount == 0))
+    {
+        /* This does not appear to be the slab the block came from */
+        Status = CFE_ES_POOL_BLOCK_INVALID;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    if (Status == CFE_SUCCESS)
+    {
+        Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+        BdPtr->NextOffset = Slab.FreeOffset;
+
+        Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    WasFull         = (Slab.FreeOffset == 0);
+    Slab.FreeOffset = BlockOffset;
+    --Slab.InUseCount;
+    --BucketPtr->SlabInUseCount;
+
+    if (Slab.InUseCount == 0 && (Slab.PrevOffset != 0 || Slab.NextOffset != 0))
+    {
+        /* other slabs of this bucket still have free blocks, so this one can go back to the reserve */
+        Status = CFE_ES_GenPoolUnlinkSlab(PoolRecPtr, BucketPtr, &Slab);
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_GenPoolReleaseSlab(PoolRecPtr, BucketPtr, SlabOffset, &Slab);
+        }
+    }
+    else
+    {
+        if (WasFull)
+        {
+            Status = CFE_ES_GenPoolPushSlab(PoolRecPtr, BucketPtr, SlabOffset, &Slab);
+        }
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_ES_GenPoolWriteSlab(PoolRecPtr, SlabOffset, &Slab);
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -238,6 +866,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    size_t                  MaxBlockSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     if (NumBlockSizes == 0)
@@ -322,6 +951,91 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class table - the shift is chosen such that the
+     * largest block size falls in the last entry of the table.  Each entry
+     * refers to the first bucket which is large enough for the smallest
+     * request in that size class.
+     */
+    MaxBlockSize = PoolRecPtr->Buckets[NumBlockSizes - 1].BlockSize;
+    while (((MaxBlockSize - 1) >> PoolRecPtr->SizeClassShift) >= CFE_ES_GENERIC_POOL_SIZE_CLASSES)
+    {
+        ++PoolRecPtr->SizeClassShift;
+    }
+
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_SIZE_CLASSES; ++i)
+    {
+        while ((j + 1) < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize <= ((size_t)i << PoolRecPtr->SizeClassShift))
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassMap[i] = j;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolInitSlabs(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t SlabSize)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  DataOffset;
+    size_t                  BlockStride;
+    uint32                  BlocksPerSlab;
+    uint16                  i;
+
+    /*
+     * Slabs start aligned, and the first block is placed after the slab
+     * descriptors the same way as a block is placed at the pool tail.
+     */
+    SlabSize += PoolRecPtr->AlignMask;
+    SlabSize &= ~PoolRecPtr->AlignMask;
+
+    DataOffset = CFE_ES_GENERIC_POOL_SLAB_HEADER_SIZE + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+    DataOffset += PoolRecPtr->AlignMask;
+    DataOffset &= ~PoolRecPtr->AlignMask;
+
+    if (SlabSize <= DataOffset || SlabSize > PoolRecPtr->PoolTotalSize)
+    {
+        CFE_ES_WriteToSysLog("%s: invalid slab size for pool: %lu\n", __func__, (unsigned long)SlabSize);
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr->SlabSize       = SlabSize;
+    PoolRecPtr->SlabDataOffset = DataOffset;
+
+    /*
+     * Only use slabs for block sizes where a slab holds at least two blocks,
+     * anything larger is still allocated from the pool tail directly.
+     */
+    BucketPtr = PoolRecPtr->Buckets;
+    for (i = 0; i < PoolRecPtr->NumBuckets; ++i)
+    {
+        BlocksPerSlab = 0;
+        if (BucketPtr->BlockSize <= (SlabSize - DataOffset))
+        {
+            BlockStride = BucketPtr->BlockSize + CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+            BlockStride += PoolRecPtr->AlignMask;
+            BlockStride &= ~PoolRecPtr->AlignMask;
+
+            BlocksPerSlab = 1 + ((SlabSize - DataOffset - BucketPtr->BlockSize) / BlockStride);
+        }
+
+        if (BlocksPerSlab < 2)
+        {
+            BlocksPerSlab = 0;
+        }
+
+        BucketPtr->BlocksPerSlab = BlocksPerSlab;
+        ++BucketPtr;
+    }
+
     return CFE_SUCCESS;
 }
 
@@ -363,8 +1077,9 @@ size_t CFE_ES_GenPoolCalcMinSize(uint16 NumBlockSizes, const size_t *BlockSizeLi
  *-----------------------------------------------------------------*/
 int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize)
 {
-    int32  Status;
-    uint16 BucketId;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    int32                   Status;
+    uint16                  BucketId;
 
     /* Find the bucket which can accommodate the requested size. */
     BucketId = CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize);
@@ -375,12 +1090,21 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOf
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
-    /* first attempt to recycle any buffers from the same bucket that were freed */
-    Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
-    if (Status != CFE_SUCCESS)
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr->BlocksPerSlab != 0)
+    {
+        /* this block size is allocated from slabs */
+        Status = CFE_ES_GenPoolGetSlabBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+    }
+    else
     {
-        /* recycling not available - try making a new one instead */
-        Status = CFE_ES_GenPoolCreatePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        /* first attempt to recycle any buffers from the same bucket that were freed */
+        Status = CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        if (Status != CFE_SUCCESS)
+        {
+            /* recycling not available - try making a new one instead */
+            Status = CFE_ES_GenPoolCreatePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+        }
     }
 
     return Status;
@@ -464,6 +1188,17 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             ++PoolRecPtr->ValidationErrorCount;
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+        else if (BucketPtr->BlocksPerSlab != 0)
+        {
+            /* blocks allocated from a slab refer to it via the NextOffset */
+            *BlockSizePtr = BdPtr->ActualSize;
+
+            Status = CFE_ES_GenPoolPutSlabBlock(PoolRecPtr, BucketId, BlockOffset, BdPtr->NextOffset);
+            if (Status == CFE_ES_POOL_BLOCK_INVALID)
+            {
+                ++PoolRecPtr->ValidationErrorCount;
+            }
+        }
         else
         {
             BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -619,7 +1354,9 @@ void CFE_ES_GenPoolGetUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset
     }
     if (FreeSizeBuf != NULL)
     {
-        *FreeSizeBuf = CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition);
+        /* unused slabs in the reserve can be used for any block size, so are counted as free */
+        *FreeSizeBuf = CFE_ES_MEMOFFSET_C(PoolRecPtr->PoolMaxOffset - PoolRecPtr->TailPosition +
+                                          (PoolRecPtr->ReserveSlabCount * PoolRecPtr->SlabSize));
     }
 }
 
@@ -638,7 +1375,7 @@ void CFE_ES_GenPoolGetCounts(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *NumBuck
     }
     if (AllocCountBuf != NULL)
     {
-        *AllocCountBuf = PoolRecPtr->AllocationCount;
+        *AllocCountBuf = PoolRecPtr->AllocationCount + PoolRecPtr->SlabBlockCount;
     }
     if (ValidationErrorCountBuf != NULL)
     {
@@ -657,6 +1394,8 @@ void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Buc
 {
     const CFE_ES_GenPoolBucket_t *      BucketPtr;
     static const CFE_ES_GenPoolBucket_t ZeroBucket = {0};
+    uint32                              SlabBlocks;
+    uint32                              SlabFree;
 
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
     if (BucketPtr == NULL)
@@ -667,8 +1406,11 @@ void CFE_ES_GenPoolGetBucketUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 Buc
 
     if (BlockStatsBuf != NULL)
     {
-        BlockStatsBuf->NumCreated = BucketPtr->AllocationCount;
+        SlabBlocks = BucketPtr->SlabCount * BucketPtr->BlocksPerSlab;
+        SlabFree   = SlabBlocks - BucketPtr->SlabInUseCount;
+
+        BlockStatsBuf->NumCreated = BucketPtr->AllocationCount + SlabBlocks;
         BlockStatsBuf->BlockSize  = CFE_ES_MEMOFFSET_C(BucketPtr->BlockSize);
-        BlockStatsBuf->NumFree    = BucketPtr->ReleaseCount - BucketPtr->RecycleCount;
+        BlockStatsBuf->NumFree    = BucketPtr->ReleaseCount - BucketPtr->RecycleCount + SlabFree;
     }
 }
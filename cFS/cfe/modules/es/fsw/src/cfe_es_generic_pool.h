@@ -45,10 +45,32 @@
 #define CFE_ES_CHECK_PATTERN      ((uint16)0x5a5a)
 #define CFE_ES_MEMORY_ALLOCATED   ((uint16)0xaaaa)
 #define CFE_ES_MEMORY_DEALLOCATED ((uint16)0xdddd)
+#define CFE_ES_SLAB_PATTERN       ((uint16)0xa5a5)
+#define CFE_ES_SLAB_ASSIGNED      ((uint16)0x5555)
+#define CFE_ES_SLAB_RESERVED      ((uint16)0xeeee)
 
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of entries in the size class lookup table.  Requests are mapped
+ * to a bucket by indexing this table with the request size shifted down
+ * such that the largest block size fits in the table.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASSES 128
+
+/*
+ * A slab starts with two descriptors, which hold the slab state:
+ *
+ *  - The first has the owning bucket in "Allocated", the number of blocks in use
+ *    in "ActualSize" and the next slab in the same list in "NextOffset".
+ *  - The second has the previous slab in the same list in "ActualSize" and the first
+ *    free block of the slab in "NextOffset".
+ *
+ * Like blocks, slabs are referred to by the offset just past their first descriptor.
+ */
+#define CFE_ES_GENERIC_POOL_SLAB_HEADER_SIZE (2 * CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+
 /*
 ** Type Definitions
 */
@@ -68,8 +90,27 @@ typedef struct CFE_ES_GenPoolBucket
     uint32 AllocationCount; /**< Total number of buffers of this block size that exist (initial get) */
     uint32 ReleaseCount;    /**< Total number of buffers that have been released (put back) */
     uint32 RecycleCount;    /**< Total number of buffers that have been recycled (get after put) */
+    uint32 BlocksPerSlab;   /**< Number of blocks carved from each slab, 0 if this bucket does not use slabs */
+    size_t SlabOffset;      /**< First slab in the list of slabs with free blocks */
+    uint32 SlabCount;       /**< Number of slabs currently assigned to this bucket */
+    uint32 SlabInUseCount;  /**< Number of blocks currently allocated from the slabs of this bucket */
 } CFE_ES_GenPoolBucket_t;
 
+/**
+ * \brief Working copy of the state of a slab
+ *
+ * This is the decoded form of the descriptors at the start of the slab,
+ * see CFE_ES_GENERIC_POOL_SLAB_HEADER_SIZE.
+ */
+typedef struct CFE_ES_GenPoolSlab
+{
+    uint16 BucketId;   /**< Bucket which currently owns the slab, 0 if in the reserve */
+    size_t InUseCount; /**< Number of blocks in this slab that are allocated */
+    size_t FreeOffset; /**< First block in the free list of this slab */
+    size_t NextOffset; /**< Next slab in the same list */
+    size_t PrevOffset; /**< Previous slab in the same list */
+} CFE_ES_GenPoolSlab_t;
+
 /*
  * Forward struct typedef so it can be used in retrieve/commit prototype
  */
@@ -114,6 +155,16 @@ struct CFE_ES_GenPoolRecord
 
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    uint8 SizeClassShift;                                 /**< Shift applied to request size for table lookup */
+    uint8 SizeClassMap[CFE_ES_GENERIC_POOL_SIZE_CLASSES]; /**< First bucket index to check for each size class */
+
+    size_t SlabSize;         /**< Size of each slab, 0 if the pool does not use slabs */
+    size_t SlabDataOffset;   /**< Position of the first block relative to the start of a slab */
+    size_t ReserveOffset;    /**< First slab in the reserve of unused slabs */
+    uint32 SlabCount;        /**< Number of slabs carved from the pool */
+    uint32 ReserveSlabCount; /**< Number of slabs currently in the reserve */
+    uint32 SlabBlockCount;   /**< Number of blocks in the slabs currently assigned to buckets */
 };
 
 /*****************************************************************************/
@@ -143,6 +194,26 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Enable slab allocation in a generic pool
+ *
+ * In slab mode the pool is carved into fixed size slabs.  Each slab holds blocks
+ * of a single bucket size, and a slab that no longer holds any allocated blocks is
+ * returned to a reserve common to all buckets, so that the memory can be used for
+ * any other block size later.  Bucket sizes that do not fit at least two blocks
+ * in a slab are still allocated directly from the pool as usual.
+ *
+ * This must be called immediately after CFE_ES_GenPoolInitialize(), before
+ * any blocks are allocated.  Slab mode cannot be combined with CFE_ES_GenPoolRebuild().
+ *
+ * \param[inout] PoolRecPtr    Pointer to pool structure
+ * \param[in]    SlabSize      Size of each slab
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolInitSlabs(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t SlabSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -191,6 +262,70 @@ int32 CFE_ES_GenPoolCreatePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 B
 int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
                                      size_t *BlockOffsetPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Allocate a block from a slab assigned to the given bucket
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[inout] PoolRecPtr      Pointer to pool structure
+ * \param[in]    BucketId        Bucket ID
+ * \param[in]    NewSize         Size of block
+ * \param[out]   BlockOffsetPtr  Location to output new block offset
+ *
+ * \return #CFE_SUCCESS, or error code #CFE_ES_ERR_MEM_BLOCK_SIZE #CFE_ES_POOL_BLOCK_INVALID
+ *         \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolGetSlabBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                 size_t *BlockOffsetPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Return a block to the slab it was allocated from
+ *
+ * If this leaves the slab without any allocated blocks, the slab is
+ * returned to the reserve, unless it is the only slab of the bucket
+ * that has free blocks.
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[inout] PoolRecPtr      Pointer to pool structure
+ * \param[in]    BucketId        Bucket ID
+ * \param[in]    BlockOffset     Offset of data block, already validated as allocated
+ * \param[in]    SlabOffset      Offset of the slab the block was allocated from
+ *
+ * \return #CFE_SUCCESS, or error code #CFE_ES_POOL_BLOCK_INVALID \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolPutSlabBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t BlockOffset,
+                                 size_t SlabOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Read and validate the header of a slab
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[inout] PoolRecPtr      Pointer to pool structure
+ * \param[in]    SlabOffset      Offset of the slab
+ * \param[out]   SlabPtr         Location to output the slab header content
+ *
+ * \return #CFE_SUCCESS, or error code #CFE_ES_POOL_BLOCK_INVALID \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolReadSlab(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t SlabOffset, CFE_ES_GenPoolSlab_t *SlabPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket that serves a given request size
+ *
+ * \note Internal helper routine only, not part of API.
+ *
+ * \param[in]    PoolRecPtr      Pointer to pool structure
+ * \param[in]    ReqSize         Requested block size
+ *
+ * \return Bucket ID, or 0 if the size exceeds the largest block size in the pool
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Returns a block to the pool
@@ -278,6 +413,8 @@ void CFE_ES_GenPoolGetUsage(CFE_ES_GenPoolRecord_t *PoolRecPtr, CFE_ES_MemOffset
  *
  * Obtain pool counters for telemetry/statistics reporting.
  *
+ * The allocation count includes the blocks of all slabs currently assigned to a bucket.
+ *
  * \param[in]  PoolRecPtr     Pointer to pool structure
  * \param[out] NumBucketsBuf  Buffer to store bucket count
  * \param[out] AllocCountBuf  Buffer to store allocation count
@@ -294,6 +431,9 @@ void CFE_ES_GenPoolGetCounts(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *NumBuck
  *
  * If the bucket number is not valid, this sets all output values to zero.
  *
+ * For a bucket that uses slabs, the blocks of all slabs currently assigned to the
+ * bucket are reported as created, and those not allocated are reported as free.
+ *
  * \param[in]  PoolRecPtr     Pointer to pool structure
  * \param[in]  BucketId       Bucket number (non-zero)
  * \param[out] BlockStatsBuf  Buffer to store block stats
@@ -59,14 +59,42 @@ typedef struct
     char               CounterName[OS_MAX_API_NAME]; /* Counter Name */
 } CFE_ES_GenCounterRecord_t;
 
+/*
+ * Identifiers of the jobs in the ES background job table
+ *
+ * These are used to direct a wakeup notification to a specific job,
+ * and as the index of the job statistics in housekeeping telemetry.
+ */
+typedef enum
+{
+    CFE_ES_BACKGROUND_JOB_APP_SCAN,       /**< ES app table background scan */
+    CFE_ES_BACKGROUND_JOB_PERF_DUMP,      /**< Performance log data dump to file */
+    CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN, /**< Check for exceptions stored in the PSP */
+    CFE_ES_BACKGROUND_JOB_FILE_DUMP,      /**< FS background file writes */
+    CFE_ES_BACKGROUND_JOB_MAX
+} CFE_ES_BackgroundJobId_t;
+
+/*
+ * Scheduling state of a single background job
+ */
+typedef struct
+{
+    uint32                      SinceLastRun;  /**< Time since the job function was last invoked, in ms */
+    uint32                      Period;        /**< Current period of the job, based on its last active/idle result */
+    bool                        IsActive;      /**< Result of the last invocation of the job function */
+    volatile bool               WakeRequested; /**< Set by CFE_ES_BackgroundWakeupJob() to run the job immediately */
+    CFE_ES_BackgroundJobStats_t Stats;         /**< Run time statistics, reported in housekeeping telemetry */
+} CFE_ES_BackgroundJobState_t;
+
 /*
  * Encapsulates the state of the ES background task
  */
 typedef struct
 {
-    CFE_ES_TaskId_t TaskID;         /**< ES ID of the background task */
-    osal_id_t       WorkSem;        /**< Semaphore that is given whenever background work is pending */
-    uint32          NumJobsRunning; /**< Current Number of active jobs (updated by background task) */
+    CFE_ES_TaskId_t             TaskID;         /**< ES ID of the background task */
+    osal_id_t                   WorkSem;        /**< Semaphore that is given whenever background work is pending */
+    uint32                      NumJobsRunning; /**< Current Number of active jobs (updated by background task) */
+    CFE_ES_BackgroundJobState_t Jobs[CFE_MISSION_ES_MAX_BACKGROUND_JOBS]; /**< Per-job scheduling state */
 } CFE_ES_BackgroundTaskState_t;
 
 /*
@@ -117,6 +145,11 @@ typedef struct
     */
     CFE_ES_MemStatsTlm_t MemStatsPacket;
 
+    /*
+    ** Performance statistics telemetry
+    */
+    CFE_ES_PerfStatsTlm_t PerfStatsPacket;
+
     /*
     ** ES Task operational data (not reported in housekeeping)
     */
@@ -145,6 +178,11 @@ typedef struct
     */
     osal_id_t PerfDataMutex;
 
+    /*
+    ** Performance Statistics Mutex
+    */
+    osal_id_t PerfStatsMutex;
+
     /*
     ** Startup Sync
     */
@@ -200,11 +238,26 @@ typedef struct
     */
     CFE_ES_BackgroundLogDumpGlobal_t BackgroundERLogDumpState;
 
+    /*
+     * Index of the Exception and Reset log, parallel to the ERLog entries in the reset data
+     */
+    CFE_ES_ERLog_Header_t ERLogHeaders[CFE_PLATFORM_ES_ER_LOG_ENTRIES];
+
     /*
      * Persistent state data associated with performance log data file writes
      */
     CFE_ES_PerfDumpGlobal_t BackgroundPerfDumpState;
 
+    /*
+     * On-board aggregated performance marker statistics
+     */
+    CFE_ES_PerfStatsGlobal_t PerfStats;
+
+    /*
+     * Persistent state data associated with performance statistics file writes
+     */
+    CFE_ES_PerfStatsDumpGlobal_t BackgroundPerfStatsDumpState;
+
     /*
      * Persistent state data associated with background app table scans
      */
@@ -91,6 +91,14 @@
  */
 #define CFE_ES_ERLOG_NO_CONTEXT (0)
 
+/**
+ * \brief Period over which earlier exceptions of an app are reported, in seconds
+ *
+ * When an exception is traced to an application, the number of exceptions of the
+ * same application which were logged within this period is written to the system log.
+ */
+#define CFE_ES_ERLOG_RECENT_EXCEPTION_PERIOD (60)
+
 /*
 ** Type Definitions
 */
@@ -324,4 +332,70 @@ int32 CFE_ES_WriteToERLog(CFE_ES_LogEntryType_Enum_t EntryType, uint32 ResetType
 int32 CFE_ES_WriteToERLogWithContext(CFE_ES_LogEntryType_Enum_t EntryType, uint32 ResetType, uint32 ResetSubtype,
                                      const char *Description, CFE_ES_AppId_t AppId, uint32 PspContextId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the number of entries currently stored in the ES Exception and Reset Log.
+ *
+ * This is at most #CFE_PLATFORM_ES_ER_LOG_ENTRIES, as older entries are overwritten.
+ *
+ * \return Number of stored entries
+ */
+uint32 CFE_ES_ERLogGetNumStored(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the table index of an entry in the ES Exception and Reset Log.
+ *
+ * Entries are identified by position, in the order they were written,
+ * where position 0 is the oldest stored entry.  The returned index applies
+ * to both the ERLog table in the reset area and the ERLogHeaders index.
+ *
+ * \param Position Position of the entry, less than CFE_ES_ERLogGetNumStored()
+ *
+ * \return Index of the entry
+ */
+uint32 CFE_ES_ERLogPositionToIndex(uint32 Position);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the entries in the ES Exception and Reset Log within a time range.
+ *
+ * This is a binary search on the entry headers, which relies on entries being
+ * written in time order.  If the time was set backwards while entries were being
+ * written, the result will only be approximate.
+ *
+ * The caller should hold the ES shared data lock.
+ *
+ * \param[in] StartTime First time of the range, inclusive
+ * \param[in] EndTime Last time of the range, inclusive
+ * \param[out] FirstPosition Position of the first entry in the range
+ *
+ * \return Number of entries in the range, which are at consecutive positions
+ */
+uint32 CFE_ES_ERLogFindTimeRange(CFE_TIME_SysTime_t StartTime, CFE_TIME_SysTime_t EndTime, uint32 *FirstPosition);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the next entry in the ES Exception and Reset Log for an application.
+ *
+ * This checks only the entry headers, starting at the given position.
+ *
+ * The caller should hold the ES shared data lock.
+ *
+ * \param[in] AppId The Application ID to find
+ * \param[inout] Position Position to start from, set to the position of the entry found
+ *
+ * \return true if an entry was found, false if there are no more entries for the application
+ */
+bool CFE_ES_ERLogFindNextByApp(CFE_ES_AppId_t AppId, uint32 *Position);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Rebuild the index of the ES Exception and Reset Log from the log entries.
+ *
+ * The index is not preserved across resets, so this must be called once the
+ * reset data is available, before any entries are written or searched.
+ */
+void CFE_ES_ERLogRebuildIndex(void);
+
 #endif /* CFE_ES_LOG_H */
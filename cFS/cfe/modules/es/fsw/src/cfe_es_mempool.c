@@ -183,6 +183,18 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     return CFE_ES_PoolCreateEx_WithAlignment(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, Alignment);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_PoolCreateSlab(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                   const size_t *BlockSizes, bool UseMutex, size_t SlabSize)
+{
+    size_t Alignment = ALIGN_OF(CFE_ES_PoolAlign_t);
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, Alignment, SlabSize);
+}
 
 /*----------------------------------------------------------------
  *
@@ -192,6 +204,18 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
                                   const size_t *BlockSizes, bool UseMutex, size_t Alignment)
+{
+    return CFE_ES_MemPoolCreate(PoolID, MemPtr, Size, NumBlockSizes, BlockSizes, UseMutex, Alignment, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                  const size_t *BlockSizes, bool UseMutex, size_t Alignment, size_t SlabSize)
 {
     int32                   OsStatus;
     int32                   Status;
@@ -300,6 +324,11 @@ CFE_Status_t CFE_ES_PoolCreateEx_WithAlignment(CFE_ES_MemHandle_t *PoolID, void
     Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
                                       CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
+    if (Status == CFE_SUCCESS && SlabSize != 0)
+    {
+        Status = CFE_ES_GenPoolInitSlabs(&PoolRecPtr->Pool, SlabSize);
+    }
+
     /*
      * If successful, complete the process.
      */
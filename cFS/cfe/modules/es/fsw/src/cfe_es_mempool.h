@@ -241,4 +241,24 @@ static inline bool CFE_ES_MemPoolRecordIsMatch(const CFE_ES_MemPoolRecord_t *Poo
  */
 bool CFE_ES_CheckMemPoolSlotUsed(CFE_ResourceId_t CheckId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Create a memory pool
+ *
+ * Common implementation of the pool creation APIs.
+ *
+ * @param[out]  PoolID         Buffer to store the pool handle
+ * @param[in]   MemPtr         Pointer to the pool memory
+ * @param[in]   Size           Size of the pool memory
+ * @param[in]   NumBlockSizes  Number of entries in BlockSizes
+ * @param[in]   BlockSizes     Block sizes of the pool, or NULL for the default sizes
+ * @param[in]   UseMutex       Whether the pool is protected by a mutex
+ * @param[in]   Alignment      Required alignment of blocks
+ * @param[in]   SlabSize       Size of each slab, or 0 if the pool does not use slabs
+ *
+ * @return Execution status, see @ref CFEReturnCodes
+ */
+CFE_Status_t CFE_ES_MemPoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
+                                  const size_t *BlockSizes, bool UseMutex, size_t Alignment, size_t SlabSize);
+
 #endif /* CFE_ES_MEMPOOL_H */
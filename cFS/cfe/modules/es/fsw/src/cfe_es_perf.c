@@ -228,8 +228,9 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 
         if (Status == CFE_SUCCESS)
         {
+            PerfDumpState->Compress     = (CmdPtr->CompressFlag != 0);
             PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
-            CFE_ES_BackgroundWakeup();
+            CFE_ES_BackgroundWakeupJob(CFE_ES_BACKGROUND_JOB_PERF_DUMP);
 
             CFE_ES_Global.TaskData.CommandCounter++;
 
@@ -267,8 +268,8 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
     CFE_ES_PerfDumpGlobal_t *State = (CFE_ES_PerfDumpGlobal_t *)Arg;
     int32                    OsStatus;
     int32                    Status;
-    CFE_FS_Header_t          FileHdr;
     size_t                   BlockSize;
+    uint32                   NumEntries;
     CFE_ES_PerfData_t *      Perf;
 
     /*
@@ -423,28 +424,52 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
             {
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
                     /* Zero cFE header, then fill in fields */
-                    CFE_FS_InitHeader(&FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
-                    /* predicted total length of final output */
-                    FileHdr.Length =
+                    CFE_FS_InitHeader(&State->FileHdr, CFE_ES_PERF_LOG_DESC, CFE_FS_SubType_ES_PERFDATA);
+                    /* predicted total length of final output, before any compression */
+                    State->FileHdr.Length =
                         sizeof(CFE_ES_PerfMetaData_t) + (Perf->MetaData.DataCount * sizeof(CFE_ES_PerfDataEntry_t));
+                    if (State->Compress)
+                    {
+                        State->FileHdr.ContentType = CFE_FS_COMPRESSED_FILE_CONTENT_ID;
+                    }
                     /* write the cFE header to the file */
-                    Status    = CFE_FS_WriteHeader(State->FileDesc, &FileHdr);
+                    Status    = CFE_FS_WriteHeader(State->FileDesc, &State->FileHdr);
                     BlockSize = sizeof(CFE_FS_Header_t);
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_METADATA:
                     /* write the performance metadata to the file */
                     BlockSize = sizeof(CFE_ES_PerfMetaData_t);
-                    OsStatus  = OS_write(State->FileDesc, &Perf->MetaData, BlockSize);
-                    Status    = (long)OsStatus; /* status type conversion (size) */
+                    Status    = CFE_FS_WriteBlock(State->FileDesc, &State->FileHdr, &Perf->MetaData, BlockSize);
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES:
-                    BlockSize = sizeof(CFE_ES_PerfDataEntry_t);
-                    OsStatus  = OS_write(State->FileDesc, &Perf->DataBuffer[State->DataPos], BlockSize);
-                    Status    = (long)OsStatus; /* status type conversion (size) */
+                    NumEntries = 1;
+                    if (State->Compress)
+                    {
+                        /*
+                         * Entries compress far better as a batch than one at a time.  Take
+                         * as many as the remaining work credit allows, up to the end of the
+                         * buffer, so the throttling stays the same as for single entries.
+                         */
+                        NumEntries = State->StateCounter;
+                        if (NumEntries > (CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos))
+                        {
+                            NumEntries = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - State->DataPos;
+                        }
+                        if (NumEntries > (1 + State->WorkCredit))
+                        {
+                            NumEntries = 1 + State->WorkCredit;
+                        }
+                        State->WorkCredit -= NumEntries - 1;
+                        State->StateCounter -= NumEntries - 1;
+                    }
 
-                    ++State->DataPos;
+                    BlockSize = NumEntries * sizeof(CFE_ES_PerfDataEntry_t);
+                    Status    = CFE_FS_WriteBlock(State->FileDesc, &State->FileHdr, &Perf->DataBuffer[State->DataPos],
+                                                  BlockSize);
+
+                    State->DataPos += NumEntries;
                     if (State->DataPos >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
                     {
                         State->DataPos = 0;
@@ -555,6 +580,351 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartPerfStatsCmd(const CFE_ES_StartPerfStatsCmd_t *data)
+{
+    CFE_ES_PerfStatsGlobal_t *PerfStats = &CFE_ES_Global.PerfStats;
+
+    /*
+     * Reset the accumulated statistics and invalidate any pending entries
+     * held by the tasks, those are from the previous aggregation period.
+     */
+    OS_MutSemTake(CFE_ES_Global.PerfStatsMutex);
+
+    memset(PerfStats->Marker, 0, sizeof(PerfStats->Marker));
+    PerfStats->DepthOverflowCount = 0;
+    ++PerfStats->Generation;
+    PerfStats->Enabled = true;
+
+    OS_MutSemGive(CFE_ES_Global.PerfStatsMutex);
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_PERF_STATS_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
+                      "Start aggregating performance statistics");
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StopPerfStatsCmd(const CFE_ES_StopPerfStatsCmd_t *data)
+{
+    /*
+     * The accumulated statistics are retained, so they can still be
+     * written to a file after the aggregation has been stopped.
+     */
+    CFE_ES_Global.PerfStats.Enabled = false;
+
+    CFE_ES_Global.TaskData.CommandCounter++;
+    CFE_EVS_SendEvent(CFE_ES_PERF_STATS_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
+                      "Stop aggregating performance statistics");
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfStatsAdd(uint32 Marker, uint32 EntryExit, uint32 TimerUpper32, uint32 TimerLower32)
+{
+    CFE_ES_PerfStatsGlobal_t *PerfStats = &CFE_ES_Global.PerfStats;
+    CFE_ES_PerfStatsTask_t *  TaskStats;
+    CFE_ES_PerfStatsFrame_t * Frame;
+    CFE_ES_PerfStatsMarker_t *MarkerStats;
+    osal_id_t                 TaskId;
+    osal_index_t              TaskIndex;
+    uint32                    Rollover;
+    uint32                    Depth;
+    uint64                    Elapsed;
+
+    /*
+     * Markers are paired per task, so a marker logged outside of a task
+     * context (e.g. from an ISR) cannot be aggregated.
+     */
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIndex) != OS_SUCCESS)
+    {
+        return;
+    }
+
+    TaskStats = &PerfStats->Task[TaskIndex];
+    if (!OS_ObjectIdEqual(TaskStats->TaskId, TaskId) || TaskStats->Generation != PerfStats->Generation)
+    {
+        TaskStats->TaskId     = TaskId;
+        TaskStats->Generation = PerfStats->Generation;
+        TaskStats->Depth      = 0;
+    }
+
+    if (EntryExit == 0)
+    {
+        if (TaskStats->Depth < CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH)
+        {
+            Frame               = &TaskStats->Frame[TaskStats->Depth];
+            Frame->Marker       = Marker;
+            Frame->TimerUpper32 = TimerUpper32;
+            Frame->TimerLower32 = TimerLower32;
+        }
+        else
+        {
+            OS_MutSemTake(CFE_ES_Global.PerfStatsMutex);
+            ++PerfStats->DepthOverflowCount;
+            OS_MutSemGive(CFE_ES_Global.PerfStatsMutex);
+        }
+
+        ++TaskStats->Depth;
+        return;
+    }
+
+    /*
+     * The exit of an entry that was too deeply nested to be recorded
+     * only needs to unwind the depth.
+     */
+    if (TaskStats->Depth > CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH)
+    {
+        --TaskStats->Depth;
+        return;
+    }
+
+    /*
+     * Search for the matching entry from the innermost frame outwards.  Any
+     * frames nested inside the match are entries that were never exited,
+     * and they are discarded along with the match.
+     */
+    Depth = TaskStats->Depth;
+    while (Depth > 0 && TaskStats->Frame[Depth - 1].Marker != Marker)
+    {
+        --Depth;
+    }
+
+    MarkerStats = &PerfStats->Marker[Marker];
+
+    if (Depth == 0)
+    {
+        OS_MutSemTake(CFE_ES_Global.PerfStatsMutex);
+        ++MarkerStats->UnpairedCount;
+        OS_MutSemGive(CFE_ES_Global.PerfStatsMutex);
+        return;
+    }
+
+    Frame            = &TaskStats->Frame[Depth - 1];
+    TaskStats->Depth = Depth - 1;
+
+    /*
+     * A rollover value of 0 means the lower 32 bits use their full range
+     */
+    Rollover = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerLow32Rollover;
+    if (Rollover == 0)
+    {
+        Elapsed = (uint64)(TimerUpper32 - Frame->TimerUpper32) << 32;
+    }
+    else
+    {
+        Elapsed = (uint64)(TimerUpper32 - Frame->TimerUpper32) * Rollover;
+    }
+    Elapsed += TimerLower32;
+    Elapsed -= Frame->TimerLower32;
+
+    OS_MutSemTake(CFE_ES_Global.PerfStatsMutex);
+
+    if (MarkerStats->CallCount == 0 || Elapsed < MarkerStats->MinTicks)
+    {
+        MarkerStats->MinTicks = Elapsed;
+    }
+    if (Elapsed > MarkerStats->MaxTicks)
+    {
+        MarkerStats->MaxTicks = Elapsed;
+    }
+    if (Depth > MarkerStats->MaxDepth)
+    {
+        MarkerStats->MaxDepth = Depth;
+    }
+    MarkerStats->TotalTicks += Elapsed;
+    ++MarkerStats->CallCount;
+
+    OS_MutSemGive(CFE_ES_Global.PerfStatsMutex);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Converts a timebase tick count to microseconds, saturating at the uint32 limit
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_ES_PerfTicksToMicrosecs(uint64 Ticks, uint32 TicksPerSecond)
+{
+    uint64 Microsecs;
+
+    /* Without a known tick rate, the raw tick count is reported */
+    if (TicksPerSecond == 0)
+    {
+        Microsecs = Ticks;
+    }
+    else
+    {
+        Microsecs = ((Ticks / TicksPerSecond) * 1000000) + (((Ticks % TicksPerSecond) * 1000000) / TicksPerSecond);
+    }
+
+    if (Microsecs > 0xFFFFFFFF)
+    {
+        Microsecs = 0xFFFFFFFF;
+    }
+
+    return (uint32)Microsecs;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GetPerfMarkerStats(uint32 Marker, CFE_ES_PerfMarkerStats_t *Stats)
+{
+    CFE_ES_PerfStatsMarker_t MarkerStats;
+    uint32                   TicksPerSecond;
+
+    OS_MutSemTake(CFE_ES_Global.PerfStatsMutex);
+    MarkerStats = CFE_ES_Global.PerfStats.Marker[Marker];
+    OS_MutSemGive(CFE_ES_Global.PerfStatsMutex);
+
+    TicksPerSecond = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TimerTicksPerSecond;
+
+    memset(Stats, 0, sizeof(*Stats));
+    Stats->CallCount = MarkerStats.CallCount;
+    if (MarkerStats.CallCount != 0)
+    {
+        Stats->MinTime  = CFE_ES_PerfTicksToMicrosecs(MarkerStats.MinTicks, TicksPerSecond);
+        Stats->MaxTime  = CFE_ES_PerfTicksToMicrosecs(MarkerStats.MaxTicks, TicksPerSecond);
+        Stats->MeanTime = CFE_ES_PerfTicksToMicrosecs(MarkerStats.TotalTicks / MarkerStats.CallCount, TicksPerSecond);
+    }
+
+    if (MarkerStats.MaxDepth > 0xFFFF)
+    {
+        Stats->MaxDepth = 0xFFFF;
+    }
+    else
+    {
+        Stats->MaxDepth = MarkerStats.MaxDepth;
+    }
+
+    if (MarkerStats.UnpairedCount > 0xFFFF)
+    {
+        Stats->UnpairedCount = 0xFFFF;
+    }
+    else
+    {
+        Stats->UnpairedCount = MarkerStats.UnpairedCount;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SendPerfStats(void)
+{
+    CFE_ES_PerfStatsTlm_Payload_t *Payload;
+    uint32                         Marker;
+
+    if (!CFE_ES_Global.PerfStats.Enabled)
+    {
+        return;
+    }
+
+    Payload = &CFE_ES_Global.TaskData.PerfStatsPacket.Payload;
+
+    Payload->DepthOverflowCount = CFE_ES_Global.PerfStats.DepthOverflowCount;
+    for (Marker = 0; Marker < CFE_MISSION_ES_PERF_MAX_IDS; ++Marker)
+    {
+        CFE_ES_GetPerfMarkerStats(Marker, &Payload->Marker[Marker]);
+    }
+
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader), true);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_BackgroundPerfStatsFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize)
+{
+    CFE_ES_PerfStatsDumpGlobal_t *BgFilePtr;
+
+    BgFilePtr = (CFE_ES_PerfStatsDumpGlobal_t *)Meta;
+
+    if (RecordNum < CFE_MISSION_ES_PERF_MAX_IDS)
+    {
+        CFE_ES_GetPerfMarkerStats(RecordNum, &BgFilePtr->EntryBuffer);
+
+        *Buffer  = &BgFilePtr->EntryBuffer;
+        *BufSize = sizeof(BgFilePtr->EntryBuffer);
+    }
+    else
+    {
+        *Buffer  = NULL;
+        *BufSize = 0;
+    }
+
+    /* Check for EOF (last entry)  */
+    return (RecordNum >= (CFE_MISSION_ES_PERF_MAX_IDS - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_BackgroundPerfStatsFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                uint32 RecordNum, size_t BlockSize, size_t Position)
+{
+    CFE_ES_PerfStatsDumpGlobal_t *BgFilePtr;
+
+    BgFilePtr = (CFE_ES_PerfStatsDumpGlobal_t *)Meta;
+
+    /* Note that this runs in the context of ES background task (file writer background job) */
+    switch (Event)
+    {
+        case CFE_FS_FileWriteEvent_COMPLETE:
+            CFE_EVS_SendEvent(CFE_ES_PERF_STATS_WRITTEN_EID, CFE_EVS_EventType_DEBUG, "%s written:Size=%lu",
+                              BgFilePtr->FileWrite.FileName, (unsigned long)Position);
+            break;
+
+        case CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR:
+        case CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_FILEWRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File write,byte cnt err,file %s,request=%u,actual=%u", BgFilePtr->FileWrite.FileName,
+                              (int)BlockSize, (int)Status);
+            break;
+
+        case CFE_FS_FileWriteEvent_CREATE_ERROR:
+            CFE_EVS_SendEvent(CFE_ES_PERF_STATS_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating file %s, RC = %d", BgFilePtr->FileWrite.FileName, (int)Status);
+            break;
+
+        default:
+            /* unhandled event - ignore */
+            break;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -573,9 +943,10 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     Perf = &CFE_ES_Global.ResetDataPtr->Perf;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
+     * If the global state is idle and statistics are not being aggregated,
+     * exit immediately without locking or doing anything
      */
-    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    if (Perf->MetaData.State == CFE_ES_PERF_IDLE && !CFE_ES_Global.PerfStats.Enabled)
     {
         return;
     }
@@ -594,6 +965,22 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
         return;
     }
 
+    /*
+     * Statistics are aggregated for every marker, independent of the trace
+     * filter mask.  This does not take the PerfDataMutex, so it is not
+     * blocked by a trace dump in progress.
+     */
+    if (CFE_ES_Global.PerfStats.Enabled)
+    {
+        CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
+        CFE_ES_PerfStatsAdd(Marker, EntryExit, EntryData.TimerUpper32, EntryData.TimerLower32);
+    }
+
+    if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
+
     /*
      * check if this ID is filtered.
      * This is also done outside the lock -
@@ -35,7 +35,10 @@
 */
 #include "common_types.h"
 #include "osconfig.h"
+#include "cfe_platform_cfg.h" /* Required for CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH */
 #include "cfe_es_api_typedefs.h"
+#include "cfe_es_extern_typedefs.h"
+#include "cfe_fs_api_typedefs.h"
 
 /*
 ** Macro Definitions
@@ -126,14 +129,86 @@ typedef struct
     CFE_ES_PerfDumpState_t CurrentState; /* the current state of the job */
     CFE_ES_PerfDumpState_t PendingState; /* the pending/next state, if transitioning */
 
-    char      DataFileName[OS_MAX_PATH_LEN]; /* output file name from dump command */
-    osal_id_t FileDesc;                      /* file descriptor for writing */
-    uint32    WorkCredit;                    /* accumulator based on the passage of time */
-    uint32    StateCounter;                  /* number of blocks/items left in current state */
-    uint32    DataPos;                       /* last position within the Perf Log */
-    size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
+    char            DataFileName[OS_MAX_PATH_LEN]; /* output file name from dump command */
+    bool            Compress;                      /* whether to write compressed blocks, from dump command */
+    CFE_FS_Header_t FileHdr;                       /* header of the output file, in native byte order */
+    osal_id_t       FileDesc;                      /* file descriptor for writing */
+    uint32          WorkCredit;                    /* accumulator based on the passage of time */
+    uint32          StateCounter;                  /* number of blocks/items left in current state */
+    uint32          DataPos;                       /* last position within the Perf Log */
+    size_t          FileSize;                      /* Total data size before compression, for progress reporting */
 } CFE_ES_PerfDumpGlobal_t;
 
+/**
+ * @brief Pending (entered but not yet exited) marker within a task
+ */
+typedef struct
+{
+    uint32 Marker;       /* the marker that was entered */
+    uint32 TimerUpper32; /* upper 32 bits of the timebase at entry */
+    uint32 TimerLower32; /* lower 32 bits of the timebase at entry */
+} CFE_ES_PerfStatsFrame_t;
+
+/**
+ * @brief Per-task marker nesting state for performance statistics
+ *
+ * Each entry is only ever modified by the task it belongs to, so no locking
+ * is required to push or pop frames.  The entry is implicitly discarded if
+ * the TaskId or Generation do not match, which covers both the reuse of the
+ * task table slot by a new task and a restart of the aggregation.
+ */
+typedef struct
+{
+    osal_id_t               TaskId;     /* OSAL task that this nesting state belongs to */
+    uint32                  Generation; /* value of the global generation when this state was initialized */
+    uint32                  Depth;      /* current nesting depth, may exceed the number of frames stored */
+    CFE_ES_PerfStatsFrame_t Frame[CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH];
+} CFE_ES_PerfStatsTask_t;
+
+/**
+ * @brief Accumulated statistics for a single marker
+ *
+ * Times are kept in timebase ticks, and only converted to microseconds when reported.
+ */
+typedef struct
+{
+    uint32 CallCount;
+    uint32 UnpairedCount;
+    uint32 MaxDepth;
+    uint64 MinTicks;
+    uint64 MaxTicks;
+    uint64 TotalTicks;
+} CFE_ES_PerfStatsMarker_t;
+
+/**
+ * @brief Performance statistics file write state
+ *
+ * The statistics are small and written through the generic background
+ * file writer, one record per marker.
+ */
+typedef struct
+{
+    CFE_FS_FileWriteMetaData_t FileWrite;   /**< FS state data - must be first */
+    CFE_ES_PerfMarkerStats_t   EntryBuffer; /**< Temp holding area for record to write */
+} CFE_ES_PerfStatsDumpGlobal_t;
+
+/**
+ * @brief Performance statistics global state
+ *
+ * This is kept in regular global memory, not in the reset area, so the
+ * statistics do not survive a processor reset.  The marker statistics are
+ * protected by the PerfStatsMutex, which is never held for an extended time,
+ * so the statistics may be aggregated while a trace dump is in progress.
+ */
+typedef struct
+{
+    bool                     Enabled;            /* whether markers are currently being aggregated */
+    uint32                   Generation;         /* incremented each time aggregation is (re)started */
+    uint32                   DepthOverflowCount; /* entries not timed due to nesting deeper than the frame limit */
+    CFE_ES_PerfStatsMarker_t Marker[CFE_MISSION_ES_PERF_MAX_IDS];
+    CFE_ES_PerfStatsTask_t   Task[OS_MAX_TASKS];
+} CFE_ES_PerfStatsGlobal_t;
+
 /**
  * @brief Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -161,6 +236,55 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void);
  */
 bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Aggregate a marker entry or exit into the performance statistics
+ *
+ * Pairs the marker with the pending entries of the calling task, and on
+ * exit updates the statistics of the marker with the elapsed time.
+ * Markers logged by tasks that are not registered with ES are ignored.
+ *
+ * @param[in] Marker       The marker ID, must be less than #CFE_MISSION_ES_PERF_MAX_IDS
+ * @param[in] EntryExit    0 for an entry, 1 for an exit
+ * @param[in] TimerUpper32 Upper 32 bits of the timebase when the marker was logged
+ * @param[in] TimerLower32 Lower 32 bits of the timebase when the marker was logged
+ */
+void CFE_ES_PerfStatsAdd(uint32 Marker, uint32 EntryExit, uint32 TimerUpper32, uint32 TimerLower32);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Copy the statistics of a marker in reporting format
+ *
+ * @param[in]  Marker  The marker ID, must be less than #CFE_MISSION_ES_PERF_MAX_IDS
+ * @param[out] Stats   Buffer to store the statistics
+ */
+void CFE_ES_GetPerfMarkerStats(uint32 Marker, CFE_ES_PerfMarkerStats_t *Stats);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send the performance statistics telemetry packet
+ *
+ * Called with each housekeeping request.  Does nothing if aggregation is not enabled.
+ */
+void CFE_ES_SendPerfStats(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Performance statistics file data getter
+ *
+ * Gets the statistics of each marker in turn, for the background file writer
+ */
+bool CFE_ES_BackgroundPerfStatsFileDataGetter(void *Meta, uint32 RecordNum, void **Buffer, size_t *BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Performance statistics file event handler
+ *
+ * Reports the status of the performance statistics file write
+ */
+void CFE_ES_BackgroundPerfStatsFileEventHandler(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status,
+                                                uint32 RecordNum, size_t BlockSize, size_t Position);
+
 /** @} */
 
 #endif /* CFE_ES_PERF_H */
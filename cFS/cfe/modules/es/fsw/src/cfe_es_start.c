@@ -151,6 +151,32 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+    /*
+    ** Also Create the ES Performance Statistics Mutex
+    ** This protects the aggregated marker statistics, separately from the performance log data
+    */
+    OsStatus = OS_MutSemCreate(&CFE_ES_Global.PerfStatsMutex, "ES_PERFSTAT_MUTEX", 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES Performance Statistics Mutex could not be created. RC=%ld\n",
+                                  __func__, (long)OsStatus);
+
+        /*
+        ** Delay to allow the message to be read
+        */
+        OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+        /*
+        ** cFE Cannot continue to start up.
+        */
+        CFE_PSP_Panic(CFE_PSP_PANIC_STARTUP_SEM);
+
+        /*
+         * Normally CFE_PSP_Panic() will not return but it will under UT
+         */
+        return;
+    }
+
     /*
     ** Announce the startup
     */
@@ -303,6 +329,11 @@ void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 Bo
 
     CFE_ES_Global.ResetDataPtr = (CFE_ES_ResetData_t *)ResetDataAddr;
 
+    /*
+    ** The ER log index is not preserved, so rebuild it from the log entries.
+    */
+    CFE_ES_ERLogRebuildIndex();
+
     /*
     ** Record the BootSource (bank) so it will be valid in the ER log entries.
     */
@@ -169,10 +169,10 @@ void CFE_ES_TaskMain(void)
             CFE_ES_TaskPipe(SBBufPtr);
 
             /*
-             * Wake up the background task, which includes the
-             * scanning of the ES app table for entries that may need cleanup
+             * Wake up the background app table scan, to check
+             * for entries that may need cleanup
              */
-            CFE_ES_BackgroundWakeup();
+            CFE_ES_BackgroundWakeupJob(CFE_ES_BACKGROUND_JOB_APP_SCAN);
         }
         else
         {
@@ -349,6 +349,12 @@ int32 CFE_ES_TaskInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.MemStatsPacket.TelemetryHeader),
                  CFE_SB_ValueToMsgId(CFE_ES_MEMSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.MemStatsPacket));
 
+    /*
+    ** Initialize performance statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(CFE_ES_Global.TaskData.PerfStatsPacket.TelemetryHeader),
+                 CFE_SB_ValueToMsgId(CFE_ES_PERFSTATS_TLM_MID), sizeof(CFE_ES_Global.TaskData.PerfStatsPacket));
+
     /*
     ** Create Software Bus message pipe
     */
@@ -472,6 +478,7 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
     OS_heap_prop_t HeapProp;
     int32          OsStatus;
     uint32         PerfIdx;
+    uint32         JobIdx;
 
     memset(&HeapProp, 0, sizeof(HeapProp));
 
@@ -554,12 +561,22 @@ int32 CFE_ES_SendHkCmd(const CFE_ES_SendHkCmd_t *data)
         CFE_ES_Global.TaskData.HkPacket.Payload.HeapMaxBlockSize = CFE_ES_MEMOFFSET_C(0);
     }
 
+    for (JobIdx = 0; JobIdx < CFE_MISSION_ES_MAX_BACKGROUND_JOBS; ++JobIdx)
+    {
+        CFE_ES_Global.TaskData.HkPacket.Payload.BackgroundJob[JobIdx] = CFE_ES_Global.BackgroundTask.Jobs[JobIdx].Stats;
+    }
+
     /*
     ** Send housekeeping telemetry packet.
     */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(CFE_ES_Global.TaskData.HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Send performance statistics packet, if aggregation is active.
+    */
+    CFE_ES_SendPerfStats();
+
     /*
     ** This command does not affect the command execution counter.
     */
@@ -1386,6 +1403,7 @@ int32 CFE_ES_ClearERLogCmd(const CFE_ES_ClearERLogCmd_t *data)
     ** Clear ER log data buffer
     */
 
+    memset(CFE_ES_Global.ERLogHeaders, 0, sizeof(CFE_ES_Global.ERLogHeaders));
     memset(CFE_ES_Global.ResetDataPtr->ERLog, 0, sizeof(CFE_ES_Global.ResetDataPtr->ERLog));
 
     /*
@@ -1483,6 +1501,86 @@ int32 CFE_ES_WriteERLogCmd(const CFE_ES_WriteERLogCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_WritePerfStatsCmd(const CFE_ES_WritePerfStatsCmd_t *data)
+{
+    const CFE_ES_WritePerfStatsCmd_Payload_t *CmdPtr = &data->Payload;
+    CFE_ES_PerfStatsDumpGlobal_t *            StatePtr;
+    int32                                     Status;
+
+    StatePtr = &CFE_ES_Global.BackgroundPerfStatsDumpState;
+
+    /* check if pending before overwriting fields in the structure */
+    if (CFE_FS_BackgroundFileDumpIsPending(&StatePtr->FileWrite))
+    {
+        Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
+    }
+    else
+    {
+        /* Reset the entire state object (just for good measure, ensure no stale data) */
+        memset(StatePtr, 0, sizeof(*StatePtr));
+
+        /*
+         * Fill out the remainder of meta data.
+         * This data is currently the same for every request
+         */
+        StatePtr->FileWrite.FileSubType = CFE_FS_SubType_ES_PERFSTATS;
+        snprintf(StatePtr->FileWrite.Description, sizeof(StatePtr->FileWrite.Description), CFE_ES_PERF_STATS_DESC);
+
+        StatePtr->FileWrite.GetData = CFE_ES_BackgroundPerfStatsFileDataGetter;
+        StatePtr->FileWrite.OnEvent = CFE_ES_BackgroundPerfStatsFileEventHandler;
+
+        if (CmdPtr->CompressFlag != 0)
+        {
+            StatePtr->FileWrite.Compress = CFE_FS_CompressBlock;
+        }
+
+        /*
+        ** Copy the filename into local buffer with default name/path/extension if not specified
+        */
+        Status = CFE_FS_ParseInputFileNameEx(StatePtr->FileWrite.FileName, CmdPtr->FileName,
+                                             sizeof(StatePtr->FileWrite.FileName), sizeof(CmdPtr->FileName),
+                                             CFE_PLATFORM_ES_DEFAULT_PERF_STATS_FILENAME,
+                                             CFE_FS_GetDefaultMountPoint(CFE_FS_FileCategory_BINARY_DATA_DUMP),
+                                             CFE_FS_GetDefaultExtension(CFE_FS_FileCategory_BINARY_DATA_DUMP));
+
+        if (Status == CFE_SUCCESS)
+        {
+            Status = CFE_FS_BackgroundFileDumpRequest(&StatePtr->FileWrite);
+        }
+    }
+
+    if (Status != CFE_SUCCESS)
+    {
+        if (Status == CFE_STATUS_REQUEST_ALREADY_PENDING)
+        {
+            /* Specific event if already pending */
+            CFE_EVS_SendEvent(CFE_ES_PERF_STATS_PENDING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Performance statistics write already in progress");
+        }
+        else
+        {
+            /* Some other validation issue e.g. bad file name */
+            CFE_EVS_SendEvent(CFE_ES_PERF_STATS_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Error creating file, RC = %d", (int)Status);
+        }
+
+        /* background dump did not start, consider this an error */
+        CFE_ES_Global.TaskData.CommandErrorCounter++;
+    }
+    else
+    {
+        CFE_ES_Global.TaskData.CommandCounter++;
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
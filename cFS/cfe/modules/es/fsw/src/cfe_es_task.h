@@ -54,11 +54,12 @@
 /*
 ** ES File descriptions
 */
-#define CFE_ES_SYS_LOG_DESC  "ES system log data file"
-#define CFE_ES_TASK_LOG_DESC "ES Task Info file"
-#define CFE_ES_APP_LOG_DESC  "ES Application Info file"
-#define CFE_ES_ER_LOG_DESC   "ES ERlog data file"
-#define CFE_ES_PERF_LOG_DESC "ES Performance data file"
+#define CFE_ES_SYS_LOG_DESC    "ES system log data file"
+#define CFE_ES_TASK_LOG_DESC   "ES Task Info file"
+#define CFE_ES_APP_LOG_DESC    "ES Application Info file"
+#define CFE_ES_ER_LOG_DESC     "ES ERlog data file"
+#define CFE_ES_PERF_LOG_DESC   "ES Performance data file"
+#define CFE_ES_PERF_STATS_DESC "ES Performance statistics file"
 
 /*
  * Limit for the total number of entries that may be
@@ -119,6 +120,18 @@ void CFE_ES_BackgroundTask(void);
  */
 void CFE_ES_BackgroundCleanup(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Notify a specific background job that it has work pending
+ *
+ * Marks the given job as due and wakes the background task, so that job is
+ * invoked on the next pass regardless of its current period.  Other jobs are
+ * not invoked until they are due or are themselves woken.
+ *
+ * \param[in] JobId  Identifier of the background job to wake
+ */
+void CFE_ES_BackgroundWakeupJob(CFE_ES_BackgroundJobId_t JobId);
+
 /*
 ** ES Task message dispatch functions
 */
@@ -255,6 +268,24 @@ int32 CFE_ES_SetPerfFilterMaskCmd(const CFE_ES_SetPerfFilterMaskCmd_t *data);
  */
 int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to start aggregating performance marker statistics
+ */
+int32 CFE_ES_StartPerfStatsCmd(const CFE_ES_StartPerfStatsCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to stop aggregating performance marker statistics
+ */
+int32 CFE_ES_StopPerfStatsCmd(const CFE_ES_StopPerfStatsCmd_t *data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief  Command handler to write performance marker statistics to a file
+ */
+int32 CFE_ES_WritePerfStatsCmd(const CFE_ES_WritePerfStatsCmd_t *data);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief  Telemeter Memory Pool Statistics
@@ -149,6 +149,13 @@
 #error CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE cannot be less than 1025 entries!
 #endif
 
+/*
+** Performance statistics nesting depth
+*/
+#if CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH < 1
+#error CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH cannot be less than 1!
+#endif
+
 /*
 ** Maximum number of Registered CDS blocks
 */
@@ -46,10 +46,23 @@ int32 dummy_function(void);
 
 void UtTest_Setup(void)
 {
+    void *TempBuff;
+
     UT_Init("es");
     UtPrintf("cFE ES Unit Test Output File\n\n");
 
-    UT_ADD_TEST(TestInit);
+    /*
+     * Point the persistent reset data at the reset area here, rather than in the
+     * first test that needs it, so every test group can also be run on its own
+     */
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), &TempBuff, NULL, NULL);
+    ES_UT_PersistentResetData = TempBuff;
+
+    /*
+     * TestInit goes through ES_Main, which leaves the global and reset area state
+     * that all of the other tests start from, so it runs as a setup sequence
+     */
+    UtTest_AddSetup(TestInit, "TestInit");
     UT_ADD_TEST(TestStartupErrorPaths);
     UT_ADD_TEST(TestResourceID);
     UT_ADD_TEST(TestApps);
@@ -61,6 +74,7 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
+    UT_ADD_TEST(TestGenericPoolSlabs);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
     UT_ADD_TEST(TestSysLog);
@@ -149,6 +163,14 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
     UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
 
+    /* Perform ES main startup with an ES Perf Stats mutex creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 3, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
+
     /* Perform ES main startup with an ES Shared Data mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
@@ -1486,6 +1508,14 @@ void TestERLog(void)
     void *                           LocalBuffer;
     size_t                           LocalBufSize;
     CFE_ES_BackgroundLogDumpGlobal_t State;
+    CFE_TIME_SysTime_t               LogTimes[CFE_PLATFORM_ES_ER_LOG_ENTRIES + 2];
+    CFE_TIME_SysTime_t               StartTime;
+    CFE_TIME_SysTime_t               EndTime;
+    CFE_ES_AppId_t                   AppIdA;
+    CFE_ES_AppId_t                   AppIdB;
+    CFE_ES_ERLog_Header_t            SavedHeaders[CFE_PLATFORM_ES_ER_LOG_ENTRIES];
+    uint32                           Position;
+    uint32                           i;
 
     UtPrintf("Begin Test Exception and Reset Log");
 
@@ -1523,6 +1553,12 @@ void TestERLog(void)
     UtAssert_UINT32_EQ(CFE_ES_Global.ResetDataPtr->ERLogIndex, 1);
 
     /* Test ER log background write functions */
+    ES_ResetUnitTest();
+    memset(CFE_ES_Global.ERLogHeaders, 0, sizeof(CFE_ES_Global.ERLogHeaders));
+    CFE_ES_Global.ResetDataPtr->ERLogIndex   = 0;
+    CFE_ES_Global.ResetDataPtr->ERLogEntries = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_WriteToERLogWithContext(CFE_ES_LogEntryType_CORE, CFE_PSP_RST_TYPE_POWERON, 1, NULL,
+                                                        CFE_ES_APPID_UNDEFINED, 1));
     memset(&State, 0, sizeof(State));
     LocalBuffer  = NULL;
     LocalBufSize = 0;
@@ -1535,15 +1571,82 @@ void TestERLog(void)
 
     memset(&State.EntryBuffer, 0xEE, sizeof(State.EntryBuffer));
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_Exception_CopyContext), 1, -1);
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundERLogFileDataGetter(&State, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_ZERO(State.EntryBuffer.ContextSize);
+
+    /* Unused entries do not have context, so the PSP is not called */
+    memset(&State.EntryBuffer, 0xEE, sizeof(State.EntryBuffer));
     UtAssert_BOOL_TRUE(
         CFE_ES_BackgroundERLogFileDataGetter(&State, CFE_PLATFORM_ES_ER_LOG_ENTRIES - 1, &LocalBuffer, &LocalBufSize));
     UtAssert_ZERO(State.EntryBuffer.ContextSize);
+    UtAssert_STUB_COUNT(CFE_PSP_Exception_CopyContext, 2);
 
     UtAssert_BOOL_TRUE(
         CFE_ES_BackgroundERLogFileDataGetter(&State, CFE_PLATFORM_ES_ER_LOG_ENTRIES, &LocalBuffer, &LocalBufSize));
     UtAssert_NULL(LocalBuffer);
     UtAssert_ZERO(LocalBufSize);
 
+    /* Test ER log searches, after the log has rolled over */
+    ES_ResetUnitTest();
+    memset(CFE_ES_Global.ERLogHeaders, 0, sizeof(CFE_ES_Global.ERLogHeaders));
+    CFE_ES_Global.ResetDataPtr->ERLogIndex   = 0;
+    CFE_ES_Global.ResetDataPtr->ERLogEntries = 0;
+    AppIdA = CFE_ES_APPID_C(ES_UT_MakeAppIdForIndex(1));
+    AppIdB = CFE_ES_APPID_C(ES_UT_MakeAppIdForIndex(2));
+    memset(LogTimes, 0, sizeof(LogTimes));
+    for (i = 0; i < (CFE_PLATFORM_ES_ER_LOG_ENTRIES + 2); ++i)
+    {
+        LogTimes[i].Seconds = 100 + i;
+    }
+    UT_SetDataBuffer(UT_KEY(CFE_TIME_GetTime), LogTimes, sizeof(LogTimes), false);
+    for (i = 0; i < (CFE_PLATFORM_ES_ER_LOG_ENTRIES + 2); ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_WriteToERLogWithContext(CFE_ES_LogEntryType_APPLICATION,
+                                                            CFE_PSP_RST_TYPE_PROCESSOR, 1, "UT",
+                                                            (i & 1) ? AppIdB : AppIdA, CFE_ES_ERLOG_NO_CONTEXT));
+    }
+    UtAssert_UINT32_EQ(CFE_ES_ERLogGetNumStored(), CFE_PLATFORM_ES_ER_LOG_ENTRIES);
+    UtAssert_UINT32_EQ(CFE_ES_ERLogPositionToIndex(0), 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ERLogHeaders[2].TimeCode.Seconds, 102);
+    UtAssert_UINT32_EQ(CFE_ES_Global.ERLogHeaders[2].Sequence, 3);
+
+    StartTime.Seconds    = 105;
+    StartTime.Subseconds = 0;
+    EndTime.Seconds      = 107;
+    EndTime.Subseconds   = 0;
+    UtAssert_UINT32_EQ(CFE_ES_ERLogFindTimeRange(StartTime, EndTime, &Position), 3);
+    UtAssert_UINT32_EQ(Position, 3);
+
+    /* Range entirely before the oldest entry */
+    EndTime.Seconds = 50;
+    UtAssert_ZERO(CFE_ES_ERLogFindTimeRange(StartTime, EndTime, &Position));
+    StartTime.Seconds = 10;
+    UtAssert_ZERO(CFE_ES_ERLogFindTimeRange(StartTime, EndTime, &Position));
+    UtAssert_ZERO(Position);
+
+    /* Range covering everything */
+    EndTime.Seconds = 1000;
+    UtAssert_UINT32_EQ(CFE_ES_ERLogFindTimeRange(StartTime, EndTime, &Position), CFE_PLATFORM_ES_ER_LOG_ENTRIES);
+    UtAssert_ZERO(Position);
+
+    /* Oldest stored entry was the third one written, by app A */
+    Position = 0;
+    UtAssert_BOOL_TRUE(CFE_ES_ERLogFindNextByApp(AppIdA, &Position));
+    UtAssert_ZERO(Position);
+    Position = 1;
+    UtAssert_BOOL_TRUE(CFE_ES_ERLogFindNextByApp(AppIdA, &Position));
+    UtAssert_UINT32_EQ(Position, 2);
+    Position = CFE_PLATFORM_ES_ER_LOG_ENTRIES - 1;
+    UtAssert_BOOL_TRUE(CFE_ES_ERLogFindNextByApp(AppIdB, &Position));
+    UtAssert_BOOL_FALSE(CFE_ES_ERLogFindNextByApp(AppIdA, &Position));
+    UtAssert_UINT32_EQ(Position, CFE_PLATFORM_ES_ER_LOG_ENTRIES);
+
+    /* The index rebuilt from the preserved log entries must match the one built as they were written */
+    memcpy(SavedHeaders, CFE_ES_Global.ERLogHeaders, sizeof(SavedHeaders));
+    memset(CFE_ES_Global.ERLogHeaders, 0xFF, sizeof(CFE_ES_Global.ERLogHeaders));
+    UtAssert_VOIDCALL(CFE_ES_ERLogRebuildIndex());
+    UtAssert_MemCmp(CFE_ES_Global.ERLogHeaders, SavedHeaders, sizeof(SavedHeaders), "Rebuilt ER log index");
+
     /* Test ER log background write event handling */
     UT_ClearEventHistory();
     CFE_ES_BackgroundERLogFileEventHandler(&State, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0, 100);
@@ -1888,6 +1991,217 @@ void TestGenericPool(void)
                       CFE_ES_BUFFER_NOT_IN_POOL);
 }
 
+void TestGenericPoolSlabs(void)
+{
+    CFE_ES_GenPoolRecord_t Pool1;
+    CFE_ES_GenPoolSlab_t   Slab;
+    size_t                 Offsets[16];
+    size_t                 Offset1 = 0;
+    size_t                 Offset2 = 0;
+    size_t                 OffsetEnd;
+    size_t                 BlockSize = 0;
+    CFE_ES_MemOffset_t     FreeSize;
+    CFE_ES_BlockStats_t    BlockStats;
+    CFE_ES_GenPoolBD_t *   BdPtr;
+    uint32                 NumSmall;
+    uint32                 NumMedium;
+    uint32                 AllocCount;
+    uint32                 i;
+    static const size_t    UT_SLAB_BLOCK_SIZES[] = {16, 100, 8};
+
+    /*
+     * With these sizes, two slabs fit in the pool with too little left over for a
+     * 100 byte block, so that size fails once the slabs are created.  The 8 and 16 byte
+     * sizes fit at least two blocks per slab, the 100 byte size does not.
+     */
+    ES_ResetUnitTest();
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    OffsetEnd = sizeof(UT_MemPoolDirectBuffer.Data);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 8, 3, UT_SLAB_BLOCK_SIZES,
+                                                  ES_UT_PoolDirectRetrieve, ES_UT_PoolDirectCommit));
+
+    /* Slab size must hold the slab descriptors and must not exceed the pool */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitSlabs(&Pool1, CFE_ES_GENERIC_POOL_SLAB_HEADER_SIZE), CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolInitSlabs(&Pool1, OffsetEnd + 8), CFE_ES_BAD_ARGUMENT);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitSlabs(&Pool1, 144));
+    NumSmall  = Pool1.Buckets[0].BlocksPerSlab;
+    NumMedium = Pool1.Buckets[1].BlocksPerSlab;
+    UtAssert_UINT32_GTEQ(NumSmall, 2);
+    UtAssert_UINT32_GTEQ(NumMedium, 2);
+    UtAssert_ZERO(Pool1.Buckets[2].BlocksPerSlab);
+    UtAssert_UINT32_LTEQ(2 * NumMedium, sizeof(Offsets) / sizeof(Offsets[0]));
+
+    /* The size class table should map sizes exactly as the bucket sizes */
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 0), 3);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 8), 3);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 9), 2);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 16), 2);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 17), 1);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 100), 1);
+    UtAssert_UINT16_EQ(CFE_ES_GenPoolFindBucket(&Pool1, 101), 0);
+
+    /* Fill two slabs with 16 byte blocks, which uses all of the pool */
+    for (i = 0; i < (2 * NumMedium); ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offsets[i], 12));
+        UtAssert_True((Offsets[i] & 0x7) == 0, "Offsets[%lu](%lu) 8 byte alignment", (unsigned long)i,
+                      (unsigned long)Offsets[i]);
+    }
+    UtAssert_UINT32_EQ(Pool1.SlabCount, 2);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 16), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 8), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 100), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2 * NumMedium);
+    UtAssert_ZERO(BlockStats.NumFree);
+    CFE_ES_GenPoolGetCounts(&Pool1, NULL, &AllocCount, NULL);
+    UtAssert_UINT32_EQ(AllocCount, 2 * NumMedium);
+
+    /* Slab blocks are kept apart from the counters of blocks allocated from the tail */
+    UtAssert_ZERO(Pool1.AllocationCount);
+    UtAssert_ZERO(Pool1.Buckets[1].AllocationCount);
+    UtAssert_ZERO(Pool1.Buckets[1].ReleaseCount);
+    UtAssert_ZERO(Pool1.Buckets[1].RecycleCount);
+    UtAssert_UINT32_EQ(Pool1.Buckets[1].SlabCount, 2);
+    UtAssert_UINT32_EQ(Pool1.Buckets[1].SlabInUseCount, 2 * NumMedium);
+
+    /* Block size is the actual size requested */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlockSize(&Pool1, &BlockSize, Offsets[0]));
+    UtAssert_EQ(size_t, BlockSize, 12);
+
+    /*
+     * Free the second slab - it remains with the 16 byte size as it is the only slab
+     * of that size with free blocks, but can be taken for the 8 byte size.
+     */
+    for (i = NumMedium; i < (2 * NumMedium); ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[i]));
+        UtAssert_EQ(size_t, BlockSize, 12);
+    }
+    UtAssert_ZERO(Pool1.ReserveSlabCount);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, NumMedium);
+
+    /* Should not be able to free more than once */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[NumMedium]), CFE_ES_POOL_BLOCK_INVALID);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset1, 8));
+    UtAssert_EQ(size_t, Offset1, Offsets[NumMedium]);
+    UtAssert_UINT32_EQ(Pool1.SlabCount, 2);
+
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, NumMedium);
+    UtAssert_ZERO(BlockStats.NumFree);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 3, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, NumSmall);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, NumSmall - 1);
+
+    /* Free the first slab, then fill the 8 byte slab so it takes the first slab too */
+    for (i = 0; i < NumMedium; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[i]));
+    }
+    Offset2    = Offsets[0];
+    Offsets[0] = Offset1;
+    for (i = 1; i <= NumSmall; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offsets[i], 4));
+    }
+    UtAssert_EQ(size_t, Offsets[NumSmall], Offset2);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 2, &BlockStats);
+    UtAssert_ZERO(BlockStats.NumCreated);
+    CFE_ES_GenPoolGetBucketUsage(&Pool1, 3, &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2 * NumSmall);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, NumSmall - 1);
+
+    /* The pool count follows slabs that are moved between buckets */
+    CFE_ES_GenPoolGetCounts(&Pool1, NULL, &AllocCount, NULL);
+    UtAssert_UINT32_EQ(AllocCount, 2 * NumSmall);
+
+    /*
+     * Put a block of the full slab, then the only block of the other slab.  As the
+     * full slab now has free blocks, the other slab goes back to the reserve.
+     */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[0]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[NumSmall]));
+    UtAssert_UINT32_EQ(Pool1.ReserveSlabCount, 1);
+    CFE_ES_GenPoolGetUsage(&Pool1, &FreeSize, NULL);
+    UtAssert_EQ(size_t, CFE_ES_MEMOFFSET_TO_SIZET(FreeSize), Pool1.SlabSize + OffsetEnd - Pool1.TailPosition);
+
+    /*
+     * Fill the partial slab and take one block from the reserve slab, then free that block.
+     * This slab stays with the bucket until the full slab has a free block again.
+     */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offsets[0], 8));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8));
+    UtAssert_ZERO(Pool1.ReserveSlabCount);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offset2));
+    UtAssert_ZERO(Pool1.ReserveSlabCount);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[1]));
+    UtAssert_UINT32_EQ(Pool1.ReserveSlabCount, 1);
+
+    /* Corrupt the reference to the slab from an allocated block */
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offsets[2] - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    Offset1           = BdPtr->NextOffset;
+    BdPtr->NextOffset = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[2]), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->NextOffset = Pool1.ReserveOffset;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[2]), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->NextOffset = Offset1;
+    UtAssert_UINT32_EQ(Pool1.ValidationErrorCount, 3);
+
+    /* Corrupt each of the slab descriptors */
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset1 - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[2]), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->CheckBits = CFE_ES_SLAB_PATTERN;
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offset1, &BdPtr));
+    BdPtr->CheckBits = CFE_ES_CHECK_PATTERN;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[2]), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->CheckBits = CFE_ES_SLAB_PATTERN;
+
+    /* After repair the block can be put, which leaves a free block in the slab */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[2]));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolReadSlab(&Pool1, Offset1, &Slab));
+    UtAssert_UINT16_EQ(Slab.BucketId, 3);
+    UtAssert_EQ(size_t, Slab.FreeOffset, Offsets[2]);
+    UtAssert_EQ(size_t, Slab.InUseCount, NumSmall - 2);
+
+    /* Corrupt the free block */
+    CFE_UtAssert_SETUP(ES_UT_PoolDirectRetrieve(&Pool1, Offsets[2] - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr));
+    BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8), CFE_ES_POOL_BLOCK_INVALID);
+    BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED + 3;
+
+    /* Block sizes without slabs */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetSlabBlock(&Pool1, 1, 100, &Offset2), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutSlabBlock(&Pool1, 1, Offsets[0], Offset1), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* The pool is still consistent after all of the above */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8));
+    UtAssert_EQ(size_t, Offset2, Offsets[2]);
+
+    /* Storage access failures */
+    Pool1.Retrieve = ES_UT_PoolRetrieveFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8), CFE_ES_CDS_ACCESS_ERROR);
+    Pool1.Retrieve = ES_UT_PoolDirectRetrieve;
+    Pool1.Commit   = ES_UT_PoolCommitFail;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool1, &BlockSize, Offsets[0]), CFE_ES_CDS_ACCESS_ERROR);
+
+    /* A slab that cannot be formatted does not use up any of the pool */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool1, 0, OffsetEnd, 8, 3, UT_SLAB_BLOCK_SIZES,
+                                                  ES_UT_PoolDirectRetrieve, ES_UT_PoolCommitFail));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitSlabs(&Pool1, 144));
+    UtAssert_INT32_EQ(CFE_ES_GenPoolGetBlock(&Pool1, &Offset2, 8), CFE_ES_CDS_ACCESS_ERROR);
+    UtAssert_ZERO(Pool1.TailPosition);
+    UtAssert_ZERO(Pool1.SlabCount);
+    UtAssert_ZERO(Pool1.ReserveSlabCount);
+    UtAssert_ZERO(Pool1.ReserveOffset);
+}
+
 void TestTask(void)
 {
     uint32    ResetType;
@@ -2600,6 +2914,13 @@ void TestTask(void)
      * and the call to CFE_PSP_Restart should NOT increment */
     UtAssert_INT32_EQ(UtAppRecPtr->ControlReq.AppControlRequest, CFE_ES_RunStatus_SYS_RESTART);
     UtAssert_STUB_COUNT(CFE_PSP_Restart, 0);
+    UtAssert_NULL(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "earlier exception"));
+
+    /* A repeated exception of the same app reports the earlier one, found through the ER log index */
+    UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_APP_RUN;
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Exception_GetSummary), &UT_ContextTask, sizeof(UT_ContextTask), false);
+    CFE_ES_RunExceptionScan(0, NULL);
+    UtAssert_NOT_NULL(strstr(CFE_ES_Global.ResetDataPtr->SystemLog, "1 earlier exception(s)"));
 
     /* app restart without the restart app exception action should do system restart */
     ES_ResetUnitTest();
@@ -2996,12 +3317,21 @@ void TestPerf(void)
         CFE_ES_StopPerfDataCmd_t       PerfStopCmd;
         CFE_ES_SetPerfFilterMaskCmd_t  PerfSetFilterMaskCmd;
         CFE_ES_SetPerfTriggerMaskCmd_t PerfSetTrigMaskCmd;
+        CFE_ES_StartPerfStatsCmd_t     PerfStatsStartCmd;
+        CFE_ES_StopPerfStatsCmd_t      PerfStatsStopCmd;
+        CFE_ES_WritePerfStatsCmd_t     PerfStatsWriteCmd;
     } CmdBuf;
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *          Perf;
+    CFE_ES_PerfStatsGlobal_t *   PerfStats;
+    CFE_ES_PerfMarkerStats_t     MarkerStats;
+    CFE_ES_PerfStatsDumpGlobal_t StatsDumpState;
+    void *                       TempBuff;
+    void *                       LocalBuffer;
+    size_t                       LocalBufSize;
+    uint32                       i;
 
     /*
     ** Set the pointer to the data area
@@ -3009,7 +3339,8 @@ void TestPerf(void)
     UT_GetDataBuffer(UT_KEY(CFE_PSP_GetResetArea), &TempBuff, NULL, NULL);
     ES_UT_PersistentResetData = TempBuff;
 
-    Perf = &ES_UT_PersistentResetData->Perf;
+    Perf      = &ES_UT_PersistentResetData->Perf;
+    PerfStats = &CFE_ES_Global.PerfStats;
 
     /* Test successful performance mask and value initialization */
     ES_ResetUnitTest();
@@ -3125,6 +3456,17 @@ void TestPerf(void)
     UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
                     UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundPerfDumpState.Compress);
+
+    /* Test successful performance data collection stop with compression selected */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CmdBuf.PerfStopCmd.Payload.CompressFlag = 1;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_DATA_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STOPCMD_EID);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundPerfDumpState.Compress);
+    CmdBuf.PerfStopCmd.Payload.CompressFlag = 0;
 
     /* Test performance data collection stop with a file write in progress */
     ES_ResetUnitTest();
@@ -3335,6 +3677,16 @@ void TestPerf(void)
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
 
+    /* Same with compression selected, which is recorded in the file header */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    CFE_ES_Global.BackgroundPerfDumpState.Compress     = true;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileHdr.ContentType, CFE_FS_COMPRESSED_FILE_CONTENT_ID);
+
     /* Test a failure to open the output file */
     /* This should go immediately back to idle, and generate CFE_ES_PERF_LOG_ERR_EID */
     ES_ResetUnitTest();
@@ -3348,12 +3700,12 @@ void TestPerf(void)
     /* Test a failure to write to the output file */
     ES_ResetUnitTest();
     memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
-    UT_SetDefaultReturnValue(UT_KEY(OS_write), -10);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteBlock), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_INIT;
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_DELAY);
 
-    /* This will trigger the OS_write() failure, which should go through up to the remainder of states, back to IDLE */
+    /* This will trigger the write failure, which should go through up to the remainder of states, back to IDLE */
     CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.CurrentState, CFE_ES_PerfDumpState_IDLE);
     CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
@@ -3374,6 +3726,35 @@ void TestPerf(void)
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, 2);
     /* should have written 4 entries to the log */
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, sizeof(CFE_ES_PerfDataEntry_t) * 4);
+    UtAssert_STUB_COUNT(CFE_FS_WriteBlock, 4);
+
+    /* Same, with compression selected - entries are written in batches, split at the wrap around */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.Compress     = true;
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.DataPos      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 2;
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 4;
+    CFE_ES_RunPerfLogDump(1000, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.FileSize, sizeof(CFE_ES_PerfDataEntry_t) * 4);
+    UtAssert_STUB_COUNT(CFE_FS_WriteBlock, 2);
+
+    /* A batch is limited by the remaining work credit */
+    ES_ResetUnitTest();
+    memset(&CFE_ES_Global.BackgroundPerfDumpState, 0, sizeof(CFE_ES_Global.BackgroundPerfDumpState));
+    OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
+    CFE_ES_Global.BackgroundPerfDumpState.Compress     = true;
+    CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.PendingState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
+    CFE_ES_Global.BackgroundPerfDumpState.StateCounter = CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS + 1;
+    CFE_ES_RunPerfLogDump(CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY, &CFE_ES_Global.BackgroundPerfDumpState);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.DataPos, CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.StateCounter, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundPerfDumpState.WorkCredit, 0);
+    UtAssert_STUB_COUNT(CFE_FS_WriteBlock, 1);
 
     /* Cover close file branch with undefined file descriptor */
     ES_ResetUnitTest();
@@ -3405,6 +3786,234 @@ void TestPerf(void)
     /* in WRITE_PERF_ENTRIES, it should report the StateCounter */
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES;
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 10);
+
+    /* Test start of performance statistics aggregation, which resets any previous statistics */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    PerfStats->Marker[1].CallCount = 5;
+    PerfStats->DepthOverflowCount  = 2;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsStartCmd),
+                    UT_TPID_CFE_ES_CMD_START_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_STARTCMD_EID);
+    UtAssert_BOOL_TRUE(PerfStats->Enabled);
+    UtAssert_UINT32_EQ(PerfStats->Generation, 1);
+    UtAssert_ZERO(PerfStats->Marker[1].CallCount);
+    UtAssert_ZERO(PerfStats->DepthOverflowCount);
+
+    /* Test nested entry/exit pairing with the full 32 bit range in the lower timebase */
+    Perf->MetaData.TimerLow32Rollover = 0;
+    CFE_ES_PerfStatsAdd(1, 0, 0, 0xFFFFFF00);
+    CFE_ES_PerfStatsAdd(2, 0, 1, 0x00000000);
+    CFE_ES_PerfStatsAdd(2, 1, 1, 0x00000100);
+    CFE_ES_PerfStatsAdd(1, 1, 1, 0x00000100);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].CallCount, 1);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].MaxDepth, 1);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].TotalTicks, 0x200);
+    UtAssert_UINT32_EQ(PerfStats->Marker[2].CallCount, 1);
+    UtAssert_UINT32_EQ(PerfStats->Marker[2].MaxDepth, 2);
+    UtAssert_UINT32_EQ(PerfStats->Marker[2].MinTicks, 0x100);
+
+    /* Test pairing with a timebase that rolls over before the 32 bit limit */
+    Perf->MetaData.TimerLow32Rollover = 1000;
+    CFE_ES_PerfStatsAdd(1, 0, 5, 900);
+    CFE_ES_PerfStatsAdd(1, 1, 6, 100);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].CallCount, 2);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].MinTicks, 200);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].MaxTicks, 0x200);
+
+    /* Test an exit without a matching entry */
+    CFE_ES_PerfStatsAdd(3, 1, 0, 0);
+    UtAssert_UINT32_EQ(PerfStats->Marker[3].UnpairedCount, 1);
+    UtAssert_ZERO(PerfStats->Marker[3].CallCount);
+
+    /* Test an exit that unwinds an inner entry which was never exited */
+    CFE_ES_PerfStatsAdd(4, 0, 0, 0);
+    CFE_ES_PerfStatsAdd(5, 0, 0, 0);
+    CFE_ES_PerfStatsAdd(4, 1, 0, 10);
+    UtAssert_UINT32_EQ(PerfStats->Marker[4].CallCount, 1);
+    UtAssert_ZERO(PerfStats->Marker[5].CallCount);
+    UtAssert_ZERO(PerfStats->Task[1].Depth);
+
+    /* Test nesting deeper than the number of frames kept per task */
+    for (i = 0; i <= CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH; ++i)
+    {
+        CFE_ES_PerfStatsAdd(6, 0, 0, i);
+    }
+    UtAssert_UINT32_EQ(PerfStats->DepthOverflowCount, 1);
+    for (i = 0; i <= CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH; ++i)
+    {
+        CFE_ES_PerfStatsAdd(6, 1, 0, 100);
+    }
+    UtAssert_UINT32_EQ(PerfStats->Marker[6].CallCount, CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH);
+    UtAssert_UINT32_EQ(PerfStats->Marker[6].MaxDepth, CFE_PLATFORM_ES_PERF_STATS_MAX_DEPTH);
+    UtAssert_ZERO(PerfStats->Marker[6].UnpairedCount);
+    UtAssert_ZERO(PerfStats->Task[1].Depth);
+
+    /* Test a marker logged outside of a task context, which is ignored */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdToArrayIndex), 1, OS_ERR_INVALID_ID);
+    CFE_ES_PerfStatsAdd(7, 0, 0, 0);
+    CFE_ES_PerfStatsAdd(7, 1, 0, 10);
+    UtAssert_UINT32_EQ(PerfStats->Marker[7].UnpairedCount, 1);
+
+    /* Test that an entry from before a restart of the aggregation is discarded */
+    CFE_ES_PerfStatsAdd(8, 0, 0, 0);
+    ++PerfStats->Generation;
+    CFE_ES_PerfStatsAdd(8, 1, 0, 10);
+    UtAssert_UINT32_EQ(PerfStats->Marker[8].UnpairedCount, 1);
+
+    /* Test aggregation through the public API while the trace is idle */
+    ES_ResetUnitTest();
+    PerfStats->Enabled   = true;
+    Perf->MetaData.State = CFE_ES_PERF_IDLE;
+    CFE_ES_PerfLogAdd(1, 0);
+    CFE_ES_PerfLogAdd(1, 1);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].CallCount, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+
+    /* Test conversion of the statistics to the reporting format */
+    ES_ResetUnitTest();
+    Perf->MetaData.TimerTicksPerSecond = 1000000;
+    PerfStats->Marker[1].CallCount     = 2;
+    PerfStats->Marker[1].MinTicks      = 1500000;
+    PerfStats->Marker[1].MaxTicks      = 0x100000000000;
+    PerfStats->Marker[1].TotalTicks    = 3000000;
+    PerfStats->Marker[1].MaxDepth      = 0x10000;
+    PerfStats->Marker[1].UnpairedCount = 3;
+    CFE_ES_GetPerfMarkerStats(1, &MarkerStats);
+    UtAssert_UINT32_EQ(MarkerStats.CallCount, 2);
+    UtAssert_UINT32_EQ(MarkerStats.MinTime, 1500000);
+    UtAssert_UINT32_EQ(MarkerStats.MaxTime, 0xFFFFFFFF);
+    UtAssert_UINT32_EQ(MarkerStats.MeanTime, 1500000);
+    UtAssert_UINT32_EQ(MarkerStats.MaxDepth, 0xFFFF);
+    UtAssert_UINT32_EQ(MarkerStats.UnpairedCount, 3);
+
+    /* Without a known tick rate the raw ticks are reported */
+    Perf->MetaData.TimerTicksPerSecond = 0;
+    PerfStats->Marker[1].MaxDepth      = 4;
+    PerfStats->Marker[1].UnpairedCount = 0x10000;
+    CFE_ES_GetPerfMarkerStats(1, &MarkerStats);
+    UtAssert_UINT32_EQ(MarkerStats.MinTime, 1500000);
+    UtAssert_UINT32_EQ(MarkerStats.MaxDepth, 4);
+    UtAssert_UINT32_EQ(MarkerStats.UnpairedCount, 0xFFFF);
+
+    /* A marker that was never exited reports zero times */
+    CFE_ES_GetPerfMarkerStats(2, &MarkerStats);
+    UtAssert_ZERO(MarkerStats.CallCount);
+    UtAssert_ZERO(MarkerStats.MinTime);
+
+    /* Test the statistics telemetry, which is only sent while aggregating */
+    ES_ResetUnitTest();
+    CFE_ES_SendPerfStats();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    PerfStats->Enabled = true;
+    CFE_ES_SendPerfStats();
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test stop of performance statistics aggregation, which retains the statistics */
+    ES_ResetUnitTest();
+    PerfStats->Enabled             = true;
+    PerfStats->Marker[1].CallCount = 5;
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsStopCmd),
+                    UT_TPID_CFE_ES_CMD_STOP_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_STOPCMD_EID);
+    UtAssert_BOOL_FALSE(PerfStats->Enabled);
+    UtAssert_UINT32_EQ(PerfStats->Marker[1].CallCount, 5);
+
+    /* Test successful request to write the statistics file */
+    ES_ResetUnitTest();
+    memset(&CmdBuf, 0, sizeof(CmdBuf));
+    strncpy(CmdBuf.PerfStatsWriteCmd.Payload.FileName, "filename",
+            sizeof(CmdBuf.PerfStatsWriteCmd.Payload.FileName) - 1);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsWriteCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_True(CFE_ES_Global.BackgroundPerfStatsDumpState.FileWrite.Compress == NULL,
+                  "Performance statistics file is not compressed");
+
+    /* Same request with compression selected */
+    ES_ResetUnitTest();
+    CmdBuf.PerfStatsWriteCmd.Payload.CompressFlag = 1;
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), false);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsWriteCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 1);
+    UtAssert_True(CFE_ES_Global.BackgroundPerfStatsDumpState.FileWrite.Compress == CFE_FS_CompressBlock,
+                  "Performance statistics file is compressed");
+
+    /* Failure of parsing the file name */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ParseInputFileNameEx), 1, CFE_FS_INVALID_PATH);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsWriteCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_WRITE_ERR_EID);
+
+    /* Failure from CFE_FS_BackgroundFileDumpRequest() should send the pending error event ID */
+    UT_ClearEventHistory();
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_BackgroundFileDumpRequest), 1, CFE_STATUS_REQUEST_ALREADY_PENDING);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsWriteCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_PENDING_ERR_EID);
+
+    /* Same event but pending locally */
+    UT_ClearEventHistory();
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_BackgroundFileDumpIsPending), true);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), sizeof(CmdBuf.PerfStatsWriteCmd),
+                    UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_PENDING_ERR_EID);
+
+    /* Test the statistics file data getter */
+    ES_ResetUnitTest();
+    memset(&StatsDumpState, 0, sizeof(StatsDumpState));
+    PerfStats->Marker[0].CallCount = 3;
+    UtAssert_BOOL_FALSE(CFE_ES_BackgroundPerfStatsFileDataGetter(&StatsDumpState, 0, &LocalBuffer, &LocalBufSize));
+    UtAssert_UINT32_EQ(StatsDumpState.EntryBuffer.CallCount, 3);
+    UtAssert_ADDRESS_EQ(LocalBuffer, &StatsDumpState.EntryBuffer);
+    UtAssert_UINT32_EQ(LocalBufSize, sizeof(StatsDumpState.EntryBuffer));
+
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundPerfStatsFileDataGetter(&StatsDumpState, CFE_MISSION_ES_PERF_MAX_IDS - 1,
+                                                                &LocalBuffer, &LocalBufSize));
+    UtAssert_NOT_NULL(LocalBuffer);
+
+    UtAssert_BOOL_TRUE(CFE_ES_BackgroundPerfStatsFileDataGetter(&StatsDumpState, CFE_MISSION_ES_PERF_MAX_IDS,
+                                                                &LocalBuffer, &LocalBufSize));
+    UtAssert_NULL(LocalBuffer);
+    UtAssert_ZERO(LocalBufSize);
+
+    /* Test statistics file background write event handling */
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPerfStatsFileEventHandler(&StatsDumpState, CFE_FS_FileWriteEvent_COMPLETE, CFE_SUCCESS, 10, 0,
+                                               100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_WRITTEN_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPerfStatsFileEventHandler(&StatsDumpState, CFE_FS_FileWriteEvent_HEADER_WRITE_ERROR, -1, 10, 10,
+                                               100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPerfStatsFileEventHandler(&StatsDumpState, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, -1, 10, 10,
+                                               100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_FILEWRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPerfStatsFileEventHandler(&StatsDumpState, CFE_FS_FileWriteEvent_CREATE_ERROR, -1, 10, 10, 100);
+    CFE_UtAssert_EVENTSENT(CFE_ES_PERF_STATS_WRITE_ERR_EID);
+
+    UT_ClearEventHistory();
+    CFE_ES_BackgroundPerfStatsFileEventHandler(&StatsDumpState, CFE_FS_FileWriteEvent_UNDEFINED, CFE_SUCCESS, 10, 0,
+                                               100);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test the performance statistics commands with an invalid message length */
+    ES_ResetUnitTest();
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_START_PERF_STATS_CC);
+    CFE_UtAssert_EVENTNOTSENT(CFE_ES_PERF_STATS_STARTCMD_EID);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_STOP_PERF_STATS_CC);
+    CFE_UtAssert_EVENTNOTSENT(CFE_ES_PERF_STATS_STOPCMD_EID);
+    UT_CallTaskPipe(CFE_ES_TaskPipe, CFE_MSG_PTR(CmdBuf), 0, UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC);
+    UtAssert_STUB_COUNT(CFE_FS_BackgroundFileDumpRequest, 0);
 }
 
 void TestAPI(void)
@@ -3442,6 +4051,7 @@ void TestAPI(void)
 
     /* Test getting the reset type using a valid pointer and a null pointer */
     ES_ResetUnitTest();
+    CFE_ES_Global.ResetDataPtr->ResetVars.ResetType = CFE_PSP_RST_TYPE_PROCESSOR;
     UtAssert_INT32_EQ(CFE_ES_GetResetType(&ResetType), CFE_PSP_RST_TYPE_PROCESSOR);
     UtAssert_INT32_EQ(CFE_ES_GetResetType(NULL), CFE_PSP_RST_TYPE_PROCESSOR);
 
@@ -3882,6 +4492,10 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_ES_CrcType_CRC_16), 2688);
 
+    /* Test the CRC-16/ARC standard check value, whose length is not a multiple of 4 */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_ES_CrcType_16_ARC), 0xBB3D);
+
     /* Test calculating a CRC on a range of memory using CRC type 32
      * NOTE: This capability is not currently implemented in cFE
      */
@@ -4340,6 +4954,21 @@ void TestCDS(void)
     /* Test successful CDS initialization */
     ES_ResetUnitTest();
     CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    UtAssert_NULL(CFE_ES_Global.CDSVars.DirectPtr);
+
+    /* Test CDS initialization when the PSP provides direct access to the CDS */
+    ES_ResetUnitTest();
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), &CdsPtr, &CdsSize, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetCDSArea), CdsPtr, CdsSize, false);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    UtAssert_ADDRESS_EQ(CFE_ES_Global.CDSVars.DirectPtr, CdsPtr);
+
+    /* Direct access must not be used if the area does not cover the whole CDS */
+    ES_ResetUnitTest();
+    UT_GetDataBuffer(UT_KEY(CFE_PSP_ReadFromCDS), &CdsPtr, &CdsSize, NULL);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetCDSArea), CdsPtr, CdsSize / 2, false);
+    CFE_UtAssert_SUCCESS(CFE_ES_CDS_EarlyInit());
+    UtAssert_NULL(CFE_ES_Global.CDSVars.DirectPtr);
 
     /* Test CDS initialization with a read error */
     ES_ResetUnitTest();
@@ -4520,6 +5149,7 @@ void TestCDSMempool(void)
     size_t               SavedSize;
     size_t               SavedOffset;
     void *               CdsPtr;
+    uint32               WriteCount;
 
     UtPrintf("Begin Test CDS memory pool");
 
@@ -4618,6 +5248,22 @@ void TestCDSMempool(void)
     UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
     *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Fix Bit */
 
+    /* Test CDS block access when the CDS memory is directly addressable */
+    WriteCount                      = UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS));
+    CFE_ES_Global.CDSVars.DirectPtr = CdsPtr;
+    Data                            = 43;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockWrite(BlockHandle, &Data));
+    Data = 0;
+    CFE_UtAssert_SUCCESS(CFE_ES_CDSBlockRead(&Data, BlockHandle));
+    UtAssert_INT32_EQ(Data, 43);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_WriteToCDS)), WriteCount);
+
+    /* Corrupt the data in place as to cause a CRC mismatch */
+    *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Bit flip */
+    UtAssert_INT32_EQ(CFE_ES_CDSBlockRead(&Data, BlockHandle), CFE_ES_CDS_BLOCK_CRC_ERR);
+    *((unsigned char *)CdsPtr + UtCdsRegRecPtr->BlockOffset) ^= 0x02; /* Fix Bit */
+    CFE_ES_Global.CDSVars.DirectPtr = NULL;
+
     /* Set up again with a CDS that is too small to get branch coverage */
     /* Test CDS block access */
     ES_ResetUnitTest();
@@ -5093,6 +5739,9 @@ void TestSysLog(void)
 
 void TestBackground(void)
 {
+    OS_time_t TimeBuf[16];
+    uint32    i;
+
     /* CFE_ES_BackgroundInit() with default setup
      * causes  CFE_ES_CreateChildTask to fail.
      */
@@ -5127,6 +5776,66 @@ void TestBackground(void)
     /* The number of jobs running should be 3: (perf log dump) and the
      * two dummy active jobs invoked by .RunFunc = CFE_ES_ActiveJob */
     UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.NumJobsRunning, 3);
+
+    /* All jobs are due on the first pass, none of them because of a wakeup */
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].Stats.RunCount, 1);
+    UtAssert_ZERO(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].Stats.WakeCount);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_PERF_DUMP].Stats.RunCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_PERF_DUMP].Period,
+                       CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY);
+
+    /* Targeted wakeup only marks the given job */
+    ES_ResetUnitTest();
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWakeupJob(CFE_ES_BACKGROUND_JOB_PERF_DUMP));
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_PERF_DUMP].WakeRequested);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].WakeRequested);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Out of range job ID still gives the semaphore, but marks nothing */
+    ES_ResetUnitTest();
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWakeupJob(CFE_ES_BACKGROUND_JOB_MAX + CFE_MISSION_ES_MAX_BACKGROUND_JOBS));
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_PERF_DUMP].WakeRequested);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Generic wakeup marks all jobs */
+    ES_ResetUnitTest();
+    UtAssert_VOIDCALL(CFE_ES_BackgroundWakeup());
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].WakeRequested);
+    UtAssert_BOOL_TRUE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_FILE_DUMP].WakeRequested);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /*
+     * Jobs which are not yet due are skipped unless woken, and the time
+     * spent in each job that does run is accounted in its statistics.
+     * Each call to CFE_PSP_GetTime() advances the clock by 1ms.
+     */
+    ES_ResetUnitTest();
+    for (i = 0; i < 16; ++i)
+    {
+        TimeBuf[i] = OS_TimeFromTotalMilliseconds(i);
+    }
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_GetTime), TimeBuf, sizeof(TimeBuf), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTimedWait), 1, -4);
+    CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].Period                = 1000;
+    CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Period          = 1000;
+    CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].WakeRequested   = true;
+    CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Stats.MaxRunTime = 500;
+    UtAssert_VOIDCALL(CFE_ES_BackgroundTask());
+    UtAssert_ZERO(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].Stats.RunCount);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_APP_SCAN].SinceLastRun, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Stats.RunCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Stats.WakeCount, 1);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Stats.TotalRunTime,
+                       1000);
+    UtAssert_UINT32_EQ(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].Stats.MaxRunTime, 1000);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.BackgroundTask.Jobs[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN].WakeRequested);
+
+    /* Statistics are reported in housekeeping telemetry */
+    UT_SetDefaultReturnValue(UT_KEY(OS_HeapGetInfo), -1);
+    CFE_UtAssert_SUCCESS(CFE_ES_SendHkCmd(NULL));
+    UtAssert_UINT32_EQ(CFE_ES_Global.TaskData.HkPacket.Payload.BackgroundJob[CFE_ES_BACKGROUND_JOB_EXCEPTION_SCAN]
+                           .RunCount,
+                       1);
 }
 
 /*--------------------------------------------------------------------------------*
@@ -301,6 +301,7 @@ void TestSysLog(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
+void TestGenericPoolSlabs(void);
 void TestLibs(void);
 void TestStatusToString(void);
 
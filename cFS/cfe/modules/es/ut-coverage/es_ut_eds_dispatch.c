@@ -102,6 +102,12 @@ const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_SEND_MEM_POOL_STATS_CC, SendMemPoolStatsCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC =
     { ES_UT_CC_DISPATCH(CMD, CFE_ES_DUMP_CDS_REGISTRY_CC, DumpCDSRegistryCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_START_PERF_STATS_CC, StartPerfStatsCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_STOP_PERF_STATS_CC, StopPerfStatsCmd) };
+const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC =
+    { ES_UT_CC_DISPATCH(CMD, CFE_ES_WRITE_PERF_STATS_CC, WritePerfStatsCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK =
     { ES_UT_MSG_DISPATCH(SEND_HK, SendHkCmd) };
 const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH =
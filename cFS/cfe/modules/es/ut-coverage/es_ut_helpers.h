@@ -111,6 +111,9 @@ extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SET_MAX_PR_COUNT_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DELETE_CDS_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_SEND_MEM_POOL_STATS_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_DUMP_CDS_REGISTRY_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_START_PERF_STATS_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_STOP_PERF_STATS_CC;
+extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_WRITE_PERF_STATS_CC;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_SEND_HK;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_LENGTH;
 extern const UT_TaskPipeDispatchId_t UT_TPID_CFE_ES_CMD_INVALID_CC;
@@ -24,6 +24,7 @@
 
 /* Include Files */
 #include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "cfe_msg_inline.h"
 
 #include <string.h>
 
@@ -53,7 +54,7 @@ void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
         SEND_HK_MID = CFE_SB_ValueToMsgId(CFE_EVS_SEND_HK_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    MessageID = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     /* Process all SB messages */
     if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
@@ -75,6 +76,66 @@ void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
     }
 }
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_NoopCmd_t, CFE_EVS_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_ResetCountersCmd_t, CFE_EVS_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_EnableEventTypeCmd_t, CFE_EVS_EnableEventTypeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_DisableEventTypeCmd_t, CFE_EVS_DisableEventTypeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_SetEventFormatModeCmd_t, CFE_EVS_SetEventFormatModeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_EnableAppEventTypeCmd_t, CFE_EVS_EnableAppEventTypeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_DisableAppEventTypeCmd_t, CFE_EVS_DisableAppEventTypeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_EnableAppEventsCmd_t, CFE_EVS_EnableAppEventsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_DisableAppEventsCmd_t, CFE_EVS_DisableAppEventsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_ResetAppCounterCmd_t, CFE_EVS_ResetAppCounterCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_SetFilterCmd_t, CFE_EVS_SetFilterCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_EnablePortsCmd_t, CFE_EVS_EnablePortsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_DisablePortsCmd_t, CFE_EVS_DisablePortsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_ResetFilterCmd_t, CFE_EVS_ResetFilterCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_ResetAllFiltersCmd_t, CFE_EVS_ResetAllFiltersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_AddEventFilterCmd_t, CFE_EVS_AddEventFilterCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_DeleteEventFilterCmd_t, CFE_EVS_DeleteEventFilterCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_WriteAppDataFileCmd_t, CFE_EVS_WriteAppDataFileCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_SetLogModeCmd_t, CFE_EVS_SetLogModeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_ClearLogCmd_t, CFE_EVS_ClearLogCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_EVS_WriteLogDataFileCmd_t, CFE_EVS_WriteLogDataFileCmd)
+
+/*
+ * Dispatch table for EVS ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_EVS_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_NOOP_CC, CFE_EVS_NoopCmd_t, CFE_EVS_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_RESET_COUNTERS_CC, CFE_EVS_ResetCountersCmd_t, CFE_EVS_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_ENABLE_EVENT_TYPE_CC, CFE_EVS_EnableEventTypeCmd_t, CFE_EVS_EnableEventTypeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_DISABLE_EVENT_TYPE_CC, CFE_EVS_DisableEventTypeCmd_t,
+                              CFE_EVS_DisableEventTypeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_SET_EVENT_FORMAT_MODE_CC, CFE_EVS_SetEventFormatModeCmd_t,
+                              CFE_EVS_SetEventFormatModeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_ENABLE_APP_EVENT_TYPE_CC, CFE_EVS_EnableAppEventTypeCmd_t,
+                              CFE_EVS_EnableAppEventTypeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_DISABLE_APP_EVENT_TYPE_CC, CFE_EVS_DisableAppEventTypeCmd_t,
+                              CFE_EVS_DisableAppEventTypeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_ENABLE_APP_EVENTS_CC, CFE_EVS_EnableAppEventsCmd_t, CFE_EVS_EnableAppEventsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_DISABLE_APP_EVENTS_CC, CFE_EVS_DisableAppEventsCmd_t,
+                              CFE_EVS_DisableAppEventsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_RESET_APP_COUNTER_CC, CFE_EVS_ResetAppCounterCmd_t, CFE_EVS_ResetAppCounterCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_SET_FILTER_CC, CFE_EVS_SetFilterCmd_t, CFE_EVS_SetFilterCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_ENABLE_PORTS_CC, CFE_EVS_EnablePortsCmd_t, CFE_EVS_EnablePortsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_DISABLE_PORTS_CC, CFE_EVS_DisablePortsCmd_t, CFE_EVS_DisablePortsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_RESET_FILTER_CC, CFE_EVS_ResetFilterCmd_t, CFE_EVS_ResetFilterCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_RESET_ALL_FILTERS_CC, CFE_EVS_ResetAllFiltersCmd_t, CFE_EVS_ResetAllFiltersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_ADD_EVENT_FILTER_CC, CFE_EVS_AddEventFilterCmd_t, CFE_EVS_AddEventFilterCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_DELETE_EVENT_FILTER_CC, CFE_EVS_DeleteEventFilterCmd_t,
+                              CFE_EVS_DeleteEventFilterCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_WRITE_APP_DATA_FILE_CC, CFE_EVS_WriteAppDataFileCmd_t,
+                              CFE_EVS_WriteAppDataFileCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_SET_LOG_MODE_CC, CFE_EVS_SetLogModeCmd_t, CFE_EVS_SetLogModeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_CLEAR_LOG_CC, CFE_EVS_ClearLogCmd_t, CFE_EVS_ClearLogCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_EVS_WRITE_LOG_DATA_FILE_CC, CFE_EVS_WriteLogDataFileCmd_t,
+                              CFE_EVS_WriteLogDataFileCmd),
+};
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -86,190 +147,25 @@ void CFE_EVS_ProcessCommandPacket(const CFE_SB_Buffer_t *SBBufPtr)
 void CFE_EVS_ProcessGroundCommand(const CFE_SB_Buffer_t *SBBufPtr, CFE_SB_MsgId_t MsgId)
 {
     /* status will get reset if it passes length check */
-    int32             Status  = CFE_STATUS_WRONG_MSG_LENGTH;
-    CFE_MSG_FcnCode_t FcnCode = 0;
+    int32                            Status  = CFE_STATUS_WRONG_MSG_LENGTH;
+    CFE_MSG_FcnCode_t                FcnCode = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
+    FcnCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
     /* Process "known" EVS task ground commands */
-    switch (FcnCode)
+    Entry = CFE_SB_GetCmdDispatchEntry(CFE_EVS_CMD_DISPATCH_TABLE,
+                                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_EVS_CMD_DISPATCH_TABLE), FcnCode);
+    if (Entry == NULL)
     {
-        case CFE_EVS_NOOP_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_NoopCmd_t)))
-            {
-                Status = CFE_EVS_NoopCmd((const CFE_EVS_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_COUNTERS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetCountersCmd_t)))
-            {
-                Status = CFE_EVS_ResetCountersCmd((const CFE_EVS_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_EnableEventTypeCmd((const CFE_EVS_EnableEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_DisableEventTypeCmd((const CFE_EVS_DisableEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_EVENT_FORMAT_MODE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetEventFormatModeCmd_t)))
-            {
-                Status = CFE_EVS_SetEventFormatModeCmd((const CFE_EVS_SetEventFormatModeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_APP_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableAppEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_EnableAppEventTypeCmd((const CFE_EVS_EnableAppEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_APP_EVENT_TYPE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableAppEventTypeCmd_t)))
-            {
-                Status = CFE_EVS_DisableAppEventTypeCmd((const CFE_EVS_DisableAppEventTypeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_APP_EVENTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnableAppEventsCmd_t)))
-            {
-                Status = CFE_EVS_EnableAppEventsCmd((const CFE_EVS_EnableAppEventsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_APP_EVENTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisableAppEventsCmd_t)))
-            {
-                Status = CFE_EVS_DisableAppEventsCmd((const CFE_EVS_DisableAppEventsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_APP_COUNTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetAppCounterCmd_t)))
-            {
-                Status = CFE_EVS_ResetAppCounterCmd((const CFE_EVS_ResetAppCounterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetFilterCmd_t)))
-            {
-                Status = CFE_EVS_SetFilterCmd((const CFE_EVS_SetFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ENABLE_PORTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_EnablePortsCmd_t)))
-            {
-                Status = CFE_EVS_EnablePortsCmd((const CFE_EVS_EnablePortsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DISABLE_PORTS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DisablePortsCmd_t)))
-            {
-                Status = CFE_EVS_DisablePortsCmd((const CFE_EVS_DisablePortsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetFilterCmd_t)))
-            {
-                Status = CFE_EVS_ResetFilterCmd((const CFE_EVS_ResetFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_RESET_ALL_FILTERS_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ResetAllFiltersCmd_t)))
-            {
-                Status = CFE_EVS_ResetAllFiltersCmd((const CFE_EVS_ResetAllFiltersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_ADD_EVENT_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_AddEventFilterCmd_t)))
-            {
-                Status = CFE_EVS_AddEventFilterCmd((const CFE_EVS_AddEventFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_DELETE_EVENT_FILTER_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_DeleteEventFilterCmd_t)))
-            {
-                Status = CFE_EVS_DeleteEventFilterCmd((const CFE_EVS_DeleteEventFilterCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_WRITE_APP_DATA_FILE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_WriteAppDataFileCmd_t)))
-            {
-                Status = CFE_EVS_WriteAppDataFileCmd((const CFE_EVS_WriteAppDataFileCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_SET_LOG_MODE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_SetLogModeCmd_t)))
-            {
-                Status = CFE_EVS_SetLogModeCmd((const CFE_EVS_SetLogModeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_CLEAR_LOG_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_ClearLogCmd_t)))
-            {
-                Status = CFE_EVS_ClearLogCmd((const CFE_EVS_ClearLogCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_EVS_WRITE_LOG_DATA_FILE_CC:
-
-            if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_EVS_WriteLogDataFileCmd_t)))
-            {
-                Status = CFE_EVS_WriteLogDataFileCmd((const CFE_EVS_WriteLogDataFileCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /* default is a bad command code as it was not found above */
-        default:
-
-            EVS_SendEvent(CFE_EVS_ERR_CC_EID, CFE_EVS_EventType_ERROR, "Invalid command code -- ID = 0x%08x, CC = %u",
-                          (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)FcnCode);
-            Status = CFE_STATUS_BAD_COMMAND_CODE;
-
-            break;
+        /* bad command code as it was not found in the table */
+        EVS_SendEvent(CFE_EVS_ERR_CC_EID, CFE_EVS_EventType_ERROR, "Invalid command code -- ID = 0x%08x, CC = %u",
+                      (unsigned int)CFE_SB_MsgIdToValue(MsgId), (unsigned int)FcnCode);
+        Status = CFE_STATUS_BAD_COMMAND_CODE;
+    }
+    else if (CFE_EVS_VerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
+    {
+        Status = Entry->Handler(SBBufPtr);
     }
 
     if (Status == CFE_SUCCESS)
@@ -297,15 +193,15 @@ bool CFE_EVS_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLen
     CFE_MSG_FcnCode_t FcnCode      = 0;
     CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
 
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    ActualLength = CFE_MSG_InlineGetSize(MsgPtr);
 
     /*
     ** Verify the command packet length
     */
     if (ExpectedLength != ActualLength)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+        MsgId   = CFE_MSG_InlineGetMsgId(MsgPtr);
+        FcnCode = CFE_MSG_InlineGetFcnCode(MsgPtr);
 
         EVS_SendEvent(CFE_EVS_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                       "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
@@ -67,8 +67,11 @@ void UtTest_Setup(void)
     UT_Init("evs");
     UtPrintf("cFE EVS Unit Test Output File\n\n");
 
-    /* Test_Init is a test but also MUST be called first and only once */
-    UT_ADD_TEST(Test_Init);
+    /*
+     * Test_Init registers the EVS app and leaves the log and port settings that
+     * all of the other tests start from, so it runs as a setup sequence
+     */
+    UtTest_AddSetup(Test_Init, "Test_Init");
     UT_ADD_TEST(Test_IllegalAppID);
     UT_ADD_TEST(Test_UnregisteredApp);
     UT_ADD_TEST(Test_FilterRegistration);
@@ -370,9 +373,10 @@ void Test_UnregisteredApp(void)
     UT_InitData_EVS();
     CFE_UtAssert_SUCCESS(CFE_EVS_CleanUpApp(AppID));
 
-    /* Re-register the application for subsequent tests */
+    /* Re-register the application for subsequent tests, with the event types Test_Init enabled */
     UT_InitData_EVS();
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    UT_EVS_EnableAllTypesCurrentContext();
 }
 
 /*
@@ -483,6 +487,11 @@ void Test_FilterRegistration(void)
     AppDataPtr->AppID      = AppID;
     AppDataPtr->ActiveFlag = false;
     CFE_UtAssert_SUCCESS(CFE_EVS_SendTimedEvent(time, CFE_EVS_EventType_INFORMATION, 0, "NULL"));
+
+    /* Return application to original state: re-register application */
+    UT_InitData_EVS();
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    UT_EVS_EnableAllTypesCurrentContext();
 }
 
 /*
@@ -519,6 +528,7 @@ void Test_FilterReset(void)
     /* Return application to original state: re-register application */
     UT_InitData_EVS();
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    UT_EVS_EnableAllTypesCurrentContext();
 }
 
 /*
@@ -1600,6 +1610,8 @@ void Test_InvalidCmd(void)
 
     UtPrintf("Begin Test Invalid Command");
 
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
     /* Test invalid msg id event */
     UT_InitData_EVS();
     UT_EVS_DoDispatchCheckEvents(&cmd, sizeof(cmd), UT_TPID_CFE_EVS_INVALID_MID, &UT_EVS_EventBuf);
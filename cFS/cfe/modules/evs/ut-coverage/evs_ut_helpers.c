@@ -153,6 +153,18 @@ void UT_EVS_ResetSquelchCurrentContext(void)
     }
 }
 
+void UT_EVS_EnableAllTypesCurrentContext(void)
+{
+    EVS_AppData_t *AppDataPtr;
+
+    EVS_GetCurrentContext(&AppDataPtr, NULL);
+    if (AppDataPtr)
+    {
+        EVS_SetTypes(AppDataPtr, CFE_EVS_DEBUG_BIT | CFE_EVS_INFORMATION_BIT | CFE_EVS_ERROR_BIT | CFE_EVS_CRITICAL_BIT,
+                     true);
+    }
+}
+
 void UT_EVS_DisableSquelch(void)
 {
     CFE_EVS_Global.EVS_EventBurstMax = 0;
@@ -69,6 +69,7 @@ CFE_Status_t UT_EVS_SendSquelchedEvent(uint32 EventId);
 CFE_Status_t UT_EVS_SendSquelchedEventWithAppId(uint32 EventId);
 CFE_Status_t UT_EVS_SendSquelchedTimedEvent(uint32 EventId);
 void         UT_EVS_ResetSquelchCurrentContext(void);
+void         UT_EVS_EnableAllTypesCurrentContext(void);
 void         UT_EVS_DisableSquelch(void);
 void         UT_EVS_ResetSquelch(void);
 
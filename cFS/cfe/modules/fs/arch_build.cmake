@@ -0,0 +1,17 @@
+###########################################################
+#
+# FS Core Module platform build setup
+#
+# This file is evaluated as part of the "prepare" stage
+# and can be used to set up prerequisites for the build,
+# such as generating header files
+#
+###########################################################
+
+# The list of header files that control the FS configuration
+set(FS_PLATFORM_CONFIG_FILE_LIST
+  cfe_fs_internal_cfg_values.h
+  cfe_fs_platform_cfg.h
+)
+
+generate_configfile_set(${FS_PLATFORM_CONFIG_FILE_LIST})
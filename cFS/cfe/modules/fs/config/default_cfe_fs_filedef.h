@@ -165,7 +165,17 @@ enum CFE_FS_SubType
      * command.
      *
      */
-    CFE_FS_SubType_ES_QUERYALLTASKS = 23
+    CFE_FS_SubType_ES_QUERYALLTASKS = 23,
+
+    /**
+     * @brief Executive Services Performance Statistics File
+     *
+     * Executive Services Performance Statistics File which is generated in response to a
+     * \link #CFE_ES_WRITE_PERF_STATS_CC \ES_WRITEPERFSTATS2FILE \endlink
+     * command.
+     *
+     */
+    CFE_FS_SubType_ES_PERFSTATS = 24
 };
 
 /**
@@ -195,4 +205,20 @@ typedef struct CFE_FS_Header
     char Description[CFE_FS_HDR_DESC_MAX_LEN]; /**< \brief File description */
 } CFE_FS_Header_t;
 
+/**
+** \brief Compressed data block header
+**
+** In files with #CFE_FS_COMPRESSED_FILE_CONTENT_ID as the content type, each block
+** of data following the standard cFE file header is preceded by this header.  Like
+** the file header, it is stored in big endian byte order.
+**
+** If \c EncodedSize equals \c RawSize the block is stored without compression,
+** otherwise it is encoded as a single LZ4 format block (see CFE_FS_DecompressBlock()).
+*/
+typedef struct CFE_FS_CompressedBlockHeader
+{
+    uint32 RawSize;     /**< \brief Size of the block data after decompression */
+    uint32 EncodedSize; /**< \brief Size of the block data as stored in the file */
+} CFE_FS_CompressedBlockHeader_t;
+
 #endif /* DEFAULT_CFE_FS_FILEHDR_H */
@@ -52,4 +52,13 @@
 #define CFE_FS_FILE_CONTENT_ID         CFE_MISSION_FS_CFGVAL(FILE_CONTENT_ID)
 #define DEFAULT_CFE_FS_FILE_CONTENT_ID 0x63464531
 
+/**
+ * \brief Magic Number for cFE compliant files with compressed content (= 'cFEZ')
+ *
+ * Files with this content type carry a standard cFE file header followed by a
+ * sequence of blocks, each preceded by a #CFE_FS_CompressedBlockHeader_t.
+ */
+#define CFE_FS_COMPRESSED_FILE_CONTENT_ID         CFE_MISSION_FS_CFGVAL(COMPRESSED_FILE_CONTENT_ID)
+#define DEFAULT_CFE_FS_COMPRESSED_FILE_CONTENT_ID 0x6346455A
+
 #endif /* CFE_FS_INTERFACE_CFG_H */
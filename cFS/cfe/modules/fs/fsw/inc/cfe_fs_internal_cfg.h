@@ -0,0 +1,102 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   CFE File Services (CFE_FS) Private Config Definitions
+ *
+ * This provides default values for configurable items that are internal
+ * to this module and do NOT affect the interface(s) of this module.  Changes
+ * to items in this file only affect the local module and will be transparent
+ * to external entities that are using the public interface(s).
+ *
+ * @note This file may be overridden/superceded by mission-provided definitions
+ * either by overriding this header or by generating definitions from a command/data
+ * dictionary tool.
+ */
+#ifndef CFE_FS_INTERNAL_CFG_H
+#define CFE_FS_INTERNAL_CFG_H
+
+#include "cfe_fs_internal_cfg_values.h"
+
+/**
+**  \cfeplatformcfg Maximum Number of Queued Background File Writes
+**
+**  \par Description:
+**       Dictates the number of background file write requests (such as ES
+**       log dumps or SB routing info dumps) that may be queued at the same
+**       time.  Requests beyond this limit are rejected with
+**       #CFE_STATUS_REQUEST_ALREADY_PENDING until an earlier request completes.
+**
+**  \par Limits
+**       This must be a power of two, as the queue position is computed by
+**       masking.  The lower limit is 2.
+*/
+#define CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES         CFE_PLATFORM_FS_CFGVAL(MAX_BACKGROUND_FILE_WRITES)
+#define DEFAULT_CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES 8
+
+/**
+**  \cfeplatformcfg Background File Write Credit Accumulation Rate
+**
+**  \par Description:
+**       The background file writer limits the total bytes written over time.
+**       This controls the amount of "credit" (bytes that can be written) per
+**       second of elapsed time.  The default permits a file writing rate of up
+**       to 10kbytes/sec.
+**
+**  \par Limits
+**       This must be greater than zero.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_CREDIT_PER_SECOND         CFE_PLATFORM_FS_CFGVAL(BACKGROUND_CREDIT_PER_SECOND)
+#define DEFAULT_CFE_PLATFORM_FS_BACKGROUND_CREDIT_PER_SECOND 10000
+
+/**
+**  \cfeplatformcfg Maximum Background File Write Credit
+**
+**  \par Description:
+**       Upper cap on the credit that the background file writer can accumulate
+**       while no writes are in progress.  Without this limit, after a long
+**       period of inactivity a large credit would essentially bypass the rate
+**       limiting for the next file write command(s) once they are issued.
+**
+**  \par Limits
+**       This must be greater than zero.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_MAX_CREDIT         CFE_PLATFORM_FS_CFGVAL(BACKGROUND_MAX_CREDIT)
+#define DEFAULT_CFE_PLATFORM_FS_BACKGROUND_MAX_CREDIT 10000
+
+/**
+**  \cfeplatformcfg Background File Write Staging Buffer Size
+**
+**  \par Description:
+**       Records obtained from the data getter are copied into a staging buffer
+**       of this size and written to the file in a single block when the buffer
+**       fills, when the credit for the current cycle is exhausted, or when the
+**       last record has been obtained.  Records larger than the staging buffer
+**       are written directly.  A larger buffer reduces the number of file
+**       system calls per dump at the cost of static memory.
+**
+**  \par Limits
+**       This must be a multiple of 4, must be at least 64 bytes, and must not
+**       be greater than 65535 bytes, the largest block the compression stage
+**       (CFE_FS_CompressBlock()) accepts.
+*/
+#define CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE         CFE_PLATFORM_FS_CFGVAL(BACKGROUND_STAGING_BUFFER_SIZE)
+#define DEFAULT_CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE 4096
+
+#endif
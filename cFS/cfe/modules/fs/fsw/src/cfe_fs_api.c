@@ -163,6 +163,155 @@ CFE_Status_t CFE_FS_ReadHeader(CFE_FS_Header_t *Hdr, osal_id_t FileDes)
     return Result;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_FS_ReadBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, void *Buffer, size_t BufSize)
+{
+    CFE_FS_CompressedBlockHeader_t BlockHdr;
+    uint8 *                        EncodedPtr;
+    size_t                         DecodedSize;
+    int32                          OsStatus;
+    CFE_Status_t                   Status;
+    int32                          EndianCheck = 0x01020304;
+
+    if (Hdr == NULL || Buffer == NULL || BufSize == 0)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    /* Without the compression stage there is no block structure to undo */
+    if (Hdr->ContentType != CFE_FS_COMPRESSED_FILE_CONTENT_ID)
+    {
+        OsStatus = OS_read(FileDes, Buffer, BufSize);
+        if (OsStatus < OS_SUCCESS)
+        {
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        return OsStatus;
+    }
+
+    OsStatus = OS_read(FileDes, &BlockHdr, sizeof(BlockHdr));
+    if (OsStatus == 0)
+    {
+        /* end of file */
+        return 0;
+    }
+    if (OsStatus != sizeof(BlockHdr))
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* cppcheck-suppress knownConditionTrueFalse */
+    if ((*(char *)(&EndianCheck)) == 0x04)
+    {
+        CFE_FS_ByteSwapUint32(&BlockHdr.RawSize);
+        CFE_FS_ByteSwapUint32(&BlockHdr.EncodedSize);
+    }
+
+    /* The writer never stores a block larger than the raw data */
+    if (BlockHdr.EncodedSize > BlockHdr.RawSize || BlockHdr.RawSize > BufSize)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    if (BlockHdr.EncodedSize == BlockHdr.RawSize)
+    {
+        /* Stored block, read straight into place */
+        EncodedPtr = Buffer;
+    }
+    else if (BlockHdr.RawSize > (BufSize - BlockHdr.EncodedSize))
+    {
+        /* No room to hold the encoded block apart from the decoded one */
+        return CFE_FS_BAD_ARGUMENT;
+    }
+    else
+    {
+        EncodedPtr = (uint8 *)Buffer + (BufSize - BlockHdr.EncodedSize);
+    }
+
+    OsStatus = OS_read(FileDes, EncodedPtr, BlockHdr.EncodedSize);
+    if (OsStatus != BlockHdr.EncodedSize)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    if (EncodedPtr != Buffer)
+    {
+        Status = CFE_FS_DecompressBlock(EncodedPtr, BlockHdr.EncodedSize, Buffer, BlockHdr.RawSize, &DecodedSize);
+        if (Status != CFE_SUCCESS || DecodedSize != BlockHdr.RawSize)
+        {
+            /* corrupt block */
+            return CFE_FS_BAD_ARGUMENT;
+        }
+    }
+
+    return BlockHdr.RawSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_FS_WriteBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, const void *Buffer, size_t BufSize)
+{
+    union
+    {
+        CFE_ES_PoolAlign_t Align;
+        uint8              Bytes[sizeof(CFE_FS_CompressedBlockHeader_t) + CFE_FS_WRITE_BLOCK_MAX_SIZE];
+    } Encoded;
+    const uint8 *DataPtr;
+    size_t       ChunkSize;
+    size_t       EncodedSize;
+    int32        OsStatus;
+
+    if (Hdr == NULL || Buffer == NULL)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    /* Without the compression stage the data is written as-is */
+    if (Hdr->ContentType != CFE_FS_COMPRESSED_FILE_CONTENT_ID)
+    {
+        OsStatus = OS_write(FileDes, Buffer, BufSize);
+        if (OsStatus < OS_SUCCESS)
+        {
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        return OsStatus;
+    }
+
+    DataPtr = Buffer;
+    while (BufSize > 0)
+    {
+        ChunkSize = BufSize;
+        if (ChunkSize > CFE_FS_WRITE_BLOCK_MAX_SIZE)
+        {
+            ChunkSize = CFE_FS_WRITE_BLOCK_MAX_SIZE;
+        }
+
+        EncodedSize = CFE_FS_EncodeBlock(CFE_FS_CompressBlock, DataPtr, ChunkSize, Encoded.Bytes, sizeof(Encoded));
+
+        OsStatus = OS_write(FileDes, Encoded.Bytes, EncodedSize);
+        if (OsStatus != (int32)EncodedSize)
+        {
+            return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+        }
+
+        DataPtr += ChunkSize;
+        BufSize -= ChunkSize;
+    }
+
+    return (CFE_Status_t)(DataPtr - (const uint8 *)Buffer);
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -221,8 +370,14 @@ CFE_Status_t CFE_FS_WriteHeader(osal_id_t FileDes, CFE_FS_Header_t *Hdr)
 
         Hdr->Length = sizeof(CFE_FS_Header_t);
 
-        /* put the header, 'cfe1' in hex, in to the content type */
-        Hdr->ContentType = CFE_FS_FILE_CONTENT_ID;
+        /*
+         * put the header, 'cfe1' in hex, in to the content type
+         * (the caller may have already marked the file as compressed)
+         */
+        if (Hdr->ContentType != CFE_FS_COMPRESSED_FILE_CONTENT_ID)
+        {
+            Hdr->ContentType = CFE_FS_FILE_CONTENT_ID;
+        }
 
         /*
         ** Fill in the timestamp fields...
@@ -667,6 +822,119 @@ CFE_Status_t CFE_FS_ExtractFilenameFromPath(const char *OriginalPath, char *File
     return ReturnCode;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_BackgroundFileWriteBlock(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta,
+                                     const void *Buffer, size_t BufSize)
+{
+    int32 OsStatus;
+
+    OsStatus = OS_write(State->Fd, Buffer, BufSize);
+
+    if (OsStatus != BufSize)
+    {
+        /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
+        OS_close(State->Fd);
+        State->Fd = OS_OBJECT_ID_UNDEFINED;
+
+        /* generate write error event */
+        /* NOTE: This converts the OSAL status directly into a CFE status for logging */
+        Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum, BufSize,
+                      State->FileSize);
+        return false;
+    }
+
+    State->FileSize += BufSize;
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_BackgroundFileFlushStaging(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta)
+{
+    size_t StagedSize;
+    size_t EncodedSize;
+
+    StagedSize        = State->StagedSize;
+    State->StagedSize = 0;
+
+    if (StagedSize == 0)
+    {
+        return true;
+    }
+
+    if (Meta->Compress == NULL)
+    {
+        return CFE_FS_BackgroundFileWriteBlock(State, Meta, State->Staging.Bytes, StagedSize);
+    }
+
+    EncodedSize = CFE_FS_EncodeBlock(Meta->Compress, State->Staging.Bytes, StagedSize, State->Encoded.Bytes,
+                                     sizeof(State->Encoded.Bytes));
+
+    return CFE_FS_BackgroundFileWriteBlock(State, Meta, State->Encoded.Bytes, EncodedSize);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_FS_BackgroundFileStageRecord(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta,
+                                      const void *RecordPtr, size_t RecordSize)
+{
+    const uint8 *DataPtr;
+    size_t       ChunkSize;
+
+    /*
+     * Records are coalesced in the staging buffer and written as a single block.
+     * If this record does not fit in the remaining space, write out what is
+     * staged so far first.
+     */
+    if ((State->StagedSize + RecordSize) > sizeof(State->Staging.Bytes) &&
+        !CFE_FS_BackgroundFileFlushStaging(State, Meta))
+    {
+        return false;
+    }
+
+    /* Too big to stage at all, so write it directly, unless it needs to go through the compressor */
+    if (RecordSize > sizeof(State->Staging.Bytes) && Meta->Compress == NULL)
+    {
+        return CFE_FS_BackgroundFileWriteBlock(State, Meta, RecordPtr, RecordSize);
+    }
+
+    /* Otherwise copy into the staging buffer, splitting across blocks if necessary */
+    DataPtr = RecordPtr;
+    while (RecordSize > 0)
+    {
+        ChunkSize = sizeof(State->Staging.Bytes) - State->StagedSize;
+        if (ChunkSize > RecordSize)
+        {
+            ChunkSize = RecordSize;
+        }
+
+        memcpy(&State->Staging.Bytes[State->StagedSize], DataPtr, ChunkSize);
+        State->StagedSize += ChunkSize;
+        DataPtr += ChunkSize;
+        RecordSize -= ChunkSize;
+
+        if (RecordSize > 0 && !CFE_FS_BackgroundFileFlushStaging(State, Meta))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -733,6 +1001,10 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         else
         {
             CFE_FS_InitHeader(&FileHdr, Meta->Description, Meta->FileSubType);
+            if (Meta->Compress != NULL)
+            {
+                FileHdr.ContentType = CFE_FS_COMPRESSED_FILE_CONTENT_ID;
+            }
 
             /* write the cFE header to the file */
             Status = CFE_FS_WriteHeader(State->Fd, &FileHdr);
@@ -747,7 +1019,8 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
             {
                 State->FileSize = sizeof(CFE_FS_Header_t);
                 State->Credit -= sizeof(CFE_FS_Header_t);
-                State->RecordNum = 0;
+                State->RecordNum  = 0;
+                State->StagedSize = 0;
             }
         }
     }
@@ -768,32 +1041,25 @@ bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
         {
             State->Credit -= RecordSize;
 
-            /*
-             * Now write to file
-             */
-            OsStatus = OS_write(State->Fd, RecordPtr, RecordSize);
-
-            if (OsStatus != RecordSize)
+            if (!CFE_FS_BackgroundFileStageRecord(State, Meta, RecordPtr, RecordSize))
             {
-                /* end the file early (cannot set "IsEOF" as this would cause the complete event to be generated too) */
-                OS_close(State->Fd);
-                State->Fd = OS_OBJECT_ID_UNDEFINED;
-
-                /* generate write error event */
-                /* NOTE: This converts the OSAL status directly into a CFE status for logging */
-                Meta->OnEvent(Meta, CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR, (long)OsStatus, State->RecordNum,
-                              RecordSize, State->FileSize);
                 break;
             }
-            else
-            {
-                State->FileSize += RecordSize;
-            }
         }
 
         ++State->RecordNum;
     }
 
+    /*
+     * Write out anything still staged at the end of this cycle, so the credit
+     * accounting matches what actually went to the file.  If this fails the file
+     * was closed and the error event already sent, so this is no longer a normal EOF.
+     */
+    if (OS_ObjectIdDefined(State->Fd) && !CFE_FS_BackgroundFileFlushStaging(State, Meta))
+    {
+        IsEOF = false;
+    }
+
     /* On normal EOF close the file and generate the complete event */
     if (IsEOF)
     {
@@ -865,8 +1131,13 @@ int32 CFE_FS_BackgroundFileDumpRequest(CFE_FS_FileWriteMetaData_t *Meta)
 
     PendingRequestCount = CFE_FS_Global.FileDump.RequestCount + 1;
 
-    /* Check if queue is full before writing to tail position */
-    if (PendingRequestCount == (CFE_FS_Global.FileDump.CompleteCount + CFE_FS_MAX_BACKGROUND_FILE_WRITES))
+    /*
+     * Check if queue is full before writing to tail position.  The counters are
+     * free-running, so the difference is the number of occupied entries, and
+     * every entry in the queue is usable.
+     */
+    if ((CFE_FS_Global.FileDump.RequestCount - CFE_FS_Global.FileDump.CompleteCount) >=
+        CFE_FS_MAX_BACKGROUND_FILE_WRITES)
     {
         Status = CFE_STATUS_REQUEST_ALREADY_PENDING;
     }
@@ -0,0 +1,390 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_fs_codec.c
+**
+** Purpose:  cFE File Services (FS) block compression codec
+**
+** Notes:
+**
+**   Blocks are encoded in the LZ4 block format, so files produced with this
+**   codec can be decoded on the ground with any standard LZ4 implementation.
+**   The encoder is a simple greedy match finder using a small hash table on
+**   the stack, as it runs in the context of the ES background task.
+**
+*/
+
+/*
+** Required header files...
+*/
+#include "cfe_fs_module_all.h"
+
+#include <string.h>
+
+/*
+ * Number of bits in the match finder hash.  The table is kept small
+ * so it fits comfortably on the stack of the calling task.
+ */
+#define CFE_FS_COMPRESS_HASH_BITS 8
+
+/*
+ * LZ4 block format constants
+ */
+#define CFE_FS_COMPRESS_MIN_MATCH    4      /* Shortest match that can be encoded */
+#define CFE_FS_COMPRESS_LAST_LITERAL 5      /* The final bytes of a block are always literals */
+#define CFE_FS_COMPRESS_MF_LIMIT     12     /* A match must start at least this far from the end */
+#define CFE_FS_COMPRESS_MAX_OFFSET   0xFFFF /* Largest distance back to a match */
+#define CFE_FS_COMPRESS_RUN_MASK     0x0F   /* Length nibble value indicating extra length bytes follow */
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Computes the match finder hash of the 4 bytes at the given position
+ *
+ *-----------------------------------------------------------------*/
+static uint32 CFE_FS_CompressHash(const uint8 *Ptr)
+{
+    uint32 Seq;
+
+    Seq = (uint32)Ptr[0] | ((uint32)Ptr[1] << 8) | ((uint32)Ptr[2] << 16) | ((uint32)Ptr[3] << 24);
+
+    return (Seq * 2654435761U) >> (32 - CFE_FS_COMPRESS_HASH_BITS);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Outputs an LZ4 extended length value, returns the number of bytes used
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_FS_CompressPutLength(uint8 *OutPtr, size_t Length)
+{
+    size_t Count;
+
+    Count = 0;
+    while (Length >= 0xFF)
+    {
+        OutPtr[Count] = 0xFF;
+        ++Count;
+        Length -= 0xFF;
+    }
+    OutPtr[Count] = (uint8)Length;
+
+    return Count + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Outputs one LZ4 sequence, a run of literals optionally followed by a match.
+ * Returns the number of bytes used, or 0 if it does not fit in the output.
+ *
+ *-----------------------------------------------------------------*/
+static size_t CFE_FS_CompressPutSequence(uint8 *OutPtr, size_t OutSpace, const uint8 *Literals, size_t LiteralSize,
+                                         size_t MatchOffset, size_t MatchSize)
+{
+    size_t MaxSize;
+    size_t Pos;
+    uint8  Token;
+
+    /* Worst case size of this sequence: token, literal length, literals, offset, match length */
+    MaxSize = 1 + (LiteralSize / 0xFF) + 1 + LiteralSize + 2 + (MatchSize / 0xFF) + 1;
+    if (MaxSize > OutSpace)
+    {
+        return 0;
+    }
+
+    Pos = 1;
+
+    if (LiteralSize >= CFE_FS_COMPRESS_RUN_MASK)
+    {
+        Token = CFE_FS_COMPRESS_RUN_MASK << 4;
+        Pos += CFE_FS_CompressPutLength(&OutPtr[Pos], LiteralSize - CFE_FS_COMPRESS_RUN_MASK);
+    }
+    else
+    {
+        Token = (uint8)(LiteralSize << 4);
+    }
+
+    memcpy(&OutPtr[Pos], Literals, LiteralSize);
+    Pos += LiteralSize;
+
+    /* The final sequence of a block has no match part */
+    if (MatchSize > 0)
+    {
+        OutPtr[Pos]     = (uint8)(MatchOffset & 0xFF);
+        OutPtr[Pos + 1] = (uint8)(MatchOffset >> 8);
+        Pos += 2;
+
+        MatchSize -= CFE_FS_COMPRESS_MIN_MATCH;
+        if (MatchSize >= CFE_FS_COMPRESS_RUN_MASK)
+        {
+            Token |= CFE_FS_COMPRESS_RUN_MASK;
+            Pos += CFE_FS_CompressPutLength(&OutPtr[Pos], MatchSize - CFE_FS_COMPRESS_RUN_MASK);
+        }
+        else
+        {
+            Token |= (uint8)MatchSize;
+        }
+    }
+
+    OutPtr[0] = Token;
+
+    return Pos;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_FS_CompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize)
+{
+    const uint8 *InPtr;
+    uint8 *      OutPtr;
+    uint16       Table[1 << CFE_FS_COMPRESS_HASH_BITS];
+    size_t       InPos;
+    size_t       Anchor;
+    size_t       OutPos;
+    size_t       Ref;
+    size_t       MatchSize;
+    size_t       MatchLimit;
+    size_t       SeqSize;
+    uint32       Hash;
+
+    if (SrcBuf == NULL || DstBuf == NULL || SrcSize == 0 || SrcSize > CFE_FS_COMPRESS_MAX_OFFSET)
+    {
+        return 0;
+    }
+
+    InPtr  = SrcBuf;
+    OutPtr = DstBuf;
+    InPos  = 0;
+    Anchor = 0;
+    OutPos = 0;
+
+    /*
+     * Table entries hold the position + 1 of the last occurrence of each hash,
+     * so that 0 indicates an empty entry.
+     */
+    memset(Table, 0, sizeof(Table));
+
+    if (SrcSize > CFE_FS_COMPRESS_MF_LIMIT)
+    {
+        MatchLimit = SrcSize - CFE_FS_COMPRESS_LAST_LITERAL;
+
+        while (InPos < (SrcSize - CFE_FS_COMPRESS_MF_LIMIT))
+        {
+            Hash        = CFE_FS_CompressHash(&InPtr[InPos]);
+            Ref         = Table[Hash];
+            Table[Hash] = (uint16)(InPos + 1);
+
+            if (Ref == 0 || memcmp(&InPtr[Ref - 1], &InPtr[InPos], CFE_FS_COMPRESS_MIN_MATCH) != 0)
+            {
+                ++InPos;
+                continue;
+            }
+
+            --Ref;
+            MatchSize = CFE_FS_COMPRESS_MIN_MATCH;
+            while ((InPos + MatchSize) < MatchLimit && InPtr[Ref + MatchSize] == InPtr[InPos + MatchSize])
+            {
+                ++MatchSize;
+            }
+
+            SeqSize = CFE_FS_CompressPutSequence(&OutPtr[OutPos], DstSize - OutPos, &InPtr[Anchor], InPos - Anchor,
+                                                 InPos - Ref, MatchSize);
+            if (SeqSize == 0)
+            {
+                return 0;
+            }
+
+            OutPos += SeqSize;
+            InPos += MatchSize;
+            Anchor = InPos;
+        }
+    }
+
+    /* Remaining bytes are output as the final literal run */
+    SeqSize =
+        CFE_FS_CompressPutSequence(&OutPtr[OutPos], DstSize - OutPos, &InPtr[Anchor], SrcSize - Anchor, 0, 0);
+    if (SeqSize == 0)
+    {
+        return 0;
+    }
+
+    return OutPos + SeqSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_FS_EncodeBlock(CFE_FS_FileWriteCompress_t Compress, const void *SrcBuf, size_t SrcSize, uint8 *DstBuf,
+                          size_t DstSize)
+{
+    CFE_FS_CompressedBlockHeader_t BlockHdr;
+    uint8 *                        EncodedPtr;
+    size_t                         EncodedSize;
+    int32                          EndianCheck = 0x01020304;
+
+    /*
+     * Each block is preceded by its own header, so the reader knows how much to read
+     * and how large the output will be.  Blocks that do not get smaller are stored as-is.
+     */
+    EncodedPtr  = &DstBuf[sizeof(BlockHdr)];
+    EncodedSize = Compress(SrcBuf, SrcSize, EncodedPtr, DstSize - sizeof(BlockHdr));
+    if (EncodedSize == 0 || EncodedSize >= SrcSize)
+    {
+        memcpy(EncodedPtr, SrcBuf, SrcSize);
+        EncodedSize = SrcSize;
+    }
+
+    BlockHdr.RawSize     = SrcSize;
+    BlockHdr.EncodedSize = EncodedSize;
+
+    /* Block headers are stored in big endian, like the file header */
+    /* cppcheck-suppress knownConditionTrueFalse */
+    if ((*(char *)(&EndianCheck)) == 0x04)
+    {
+        CFE_FS_ByteSwapUint32(&BlockHdr.RawSize);
+        CFE_FS_ByteSwapUint32(&BlockHdr.EncodedSize);
+    }
+
+    memcpy(DstBuf, &BlockHdr, sizeof(BlockHdr));
+
+    return sizeof(BlockHdr) + EncodedSize;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Reads an LZ4 extended length value, returns false if the input ends first
+ *
+ *-----------------------------------------------------------------*/
+static bool CFE_FS_DecompressGetLength(const uint8 *InPtr, size_t InSize, size_t *InPos, size_t *Length)
+{
+    uint8 Value;
+
+    do
+    {
+        if (*InPos >= InSize)
+        {
+            return false;
+        }
+
+        Value = InPtr[*InPos];
+        ++(*InPos);
+        *Length += Value;
+    } while (Value == 0xFF);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_FS_DecompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize,
+                                    size_t *DecodedSize)
+{
+    const uint8 *InPtr;
+    uint8 *      OutPtr;
+    size_t       InPos;
+    size_t       OutPos;
+    size_t       Length;
+    size_t       Offset;
+    uint8        Token;
+
+    if (SrcBuf == NULL || DstBuf == NULL || DecodedSize == NULL)
+    {
+        return CFE_FS_BAD_ARGUMENT;
+    }
+
+    InPtr  = SrcBuf;
+    OutPtr = DstBuf;
+    InPos  = 0;
+    OutPos = 0;
+
+    while (InPos < SrcSize)
+    {
+        Token = InPtr[InPos];
+        ++InPos;
+
+        /* Literal run */
+        Length = Token >> 4;
+        if (Length == CFE_FS_COMPRESS_RUN_MASK && !CFE_FS_DecompressGetLength(InPtr, SrcSize, &InPos, &Length))
+        {
+            return CFE_FS_BAD_ARGUMENT;
+        }
+
+        if (Length > (SrcSize - InPos) || Length > (DstSize - OutPos))
+        {
+            return CFE_FS_BAD_ARGUMENT;
+        }
+
+        memcpy(&OutPtr[OutPos], &InPtr[InPos], Length);
+        InPos += Length;
+        OutPos += Length;
+
+        /* The final sequence ends after its literals */
+        if (InPos == SrcSize)
+        {
+            break;
+        }
+
+        /* Match */
+        if ((SrcSize - InPos) < 2)
+        {
+            return CFE_FS_BAD_ARGUMENT;
+        }
+
+        Offset = (size_t)InPtr[InPos] | ((size_t)InPtr[InPos + 1] << 8);
+        InPos += 2;
+
+        Length = Token & CFE_FS_COMPRESS_RUN_MASK;
+        if (Length == CFE_FS_COMPRESS_RUN_MASK && !CFE_FS_DecompressGetLength(InPtr, SrcSize, &InPos, &Length))
+        {
+            return CFE_FS_BAD_ARGUMENT;
+        }
+        Length += CFE_FS_COMPRESS_MIN_MATCH;
+
+        if (Offset == 0 || Offset > OutPos || Length > (DstSize - OutPos))
+        {
+            return CFE_FS_BAD_ARGUMENT;
+        }
+
+        /* Copy byte-wise, as the source and destination may overlap */
+        while (Length > 0)
+        {
+            OutPtr[OutPos] = OutPtr[OutPos - Offset];
+            ++OutPos;
+            --Length;
+        }
+    }
+
+    *DecodedSize = OutPos;
+
+    return CFE_SUCCESS;
+}
@@ -31,6 +31,7 @@
 ** Required header files
 */
 #include "cfe_fs_module_all.h"
+#include "cfe_fs_verify.h"
 
 #include <string.h>
 
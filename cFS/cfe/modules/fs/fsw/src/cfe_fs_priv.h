@@ -36,6 +36,7 @@
 #include "common_types.h"
 #include "cfe_fs_api_typedefs.h"
 #include "cfe_es_api_typedefs.h"
+#include "cfe_fs_internal_cfg.h"
 
 /*
 ** Macro Definitions
@@ -46,7 +47,7 @@
  *
  * This needs to be a power of two to simplify the masking/wraparound (bitwise AND).
  */
-#define CFE_FS_MAX_BACKGROUND_FILE_WRITES 4
+#define CFE_FS_MAX_BACKGROUND_FILE_WRITES CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES
 
 /*
  * Background file credit accumulation rate
@@ -54,10 +55,8 @@
  * The background file writer will limit the total bytes written over time.  This
  * controls the amount of "credit" (bytes that can be written) per second
  * of elapsed time.
- *
- * This permits a file writing rate of up to 10kbytes/sec.
  */
-#define CFE_FS_BACKGROUND_CREDIT_PER_SECOND 10000
+#define CFE_FS_BACKGROUND_CREDIT_PER_SECOND CFE_PLATFORM_FS_BACKGROUND_CREDIT_PER_SECOND
 
 /*
  * Maximum credit that the background write task can accumulate
@@ -70,7 +69,28 @@
  * writes, a large credit would essentially bypass the rate limiting for
  * the next file write command(s) once they are issued.
  */
-#define CFE_FS_BACKGROUND_MAX_CREDIT 10000
+#define CFE_FS_BACKGROUND_MAX_CREDIT CFE_PLATFORM_FS_BACKGROUND_MAX_CREDIT
+
+/*
+ * Size of the staging buffer used to coalesce records
+ *
+ * Records are copied into this buffer and written to the file as a single
+ * block, rather than issuing one write per record.
+ */
+#define CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE
+
+/*
+ * Largest block written by CFE_FS_WriteBlock() to a compressed file
+ *
+ * The block is encoded on the stack of the calling task, so this is kept
+ * small.  It is never larger than the staging buffer, so readers can use the
+ * same buffer size for files from either writer.
+ */
+#if CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE < 1024
+#define CFE_FS_WRITE_BLOCK_MAX_SIZE CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE
+#else
+#define CFE_FS_WRITE_BLOCK_MAX_SIZE 1024
+#endif
 
 /*
 ** Type Definitions
@@ -88,12 +108,39 @@ typedef struct
     CFE_FS_FileWriteMetaData_t *Meta;
 } CFE_FS_BackgroundFileDumpEntry_t;
 
+/*
+ * Staging buffer for coalescing records
+ *
+ * The union with CFE_ES_PoolAlign_t ensures the buffer is suitably aligned
+ * for the underlying file system write, regardless of record layout.
+ */
+typedef union
+{
+    CFE_ES_PoolAlign_t Align;
+    uint8              Bytes[CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE];
+} CFE_FS_BackgroundStagingBuffer_t;
+
+/*
+ * Output buffer for the optional compression stage
+ *
+ * Holds a block header followed by the compressed (or stored) block data.
+ */
+typedef union
+{
+    CFE_ES_PoolAlign_t Align;
+    uint8              Bytes[sizeof(CFE_FS_CompressedBlockHeader_t) + CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE];
+} CFE_FS_BackgroundEncodeBuffer_t;
+
 typedef struct
 {
     osal_id_t Fd;
     int32     Credit;
     uint32    RecordNum;
     size_t    FileSize;
+    size_t    StagedSize; /**< Number of bytes currently held in the staging buffer */
+
+    CFE_FS_BackgroundStagingBuffer_t Staging;
+    CFE_FS_BackgroundEncodeBuffer_t  Encoded; /**< Output of the compression stage, if used */
 } CFE_FS_CurrentFileState_t;
 
 /*---------------------------------------------------------------------------------------*/
@@ -176,4 +223,75 @@ void CFE_FS_ByteSwapCFEHeader(CFE_FS_Header_t *Hdr);
  */
 void CFE_FS_ByteSwapUint32(uint32 *Uint32ToSwapPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a block of data to the file currently being dumped in the background
+ *
+ * On success the file size in the current state is advanced.  On failure the
+ * file is closed and the #CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR event is
+ * sent to the requester.
+ *
+ * @param State   The current background file state
+ * @param Meta    The meta data of the request being processed
+ * @param Buffer  The data to write
+ * @param BufSize The number of bytes to write
+ *
+ * @retval true if the block was written completely
+ * @retval false if the write failed and the file was closed
+ */
+bool CFE_FS_BackgroundFileWriteBlock(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta,
+                                     const void *Buffer, size_t BufSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes out any records held in the background staging buffer
+ *
+ * The staging buffer is always emptied, regardless of the outcome.
+ *
+ * @param State   The current background file state
+ * @param Meta    The meta data of the request being processed
+ *
+ * @retval true if the staging buffer was empty or was written completely
+ * @retval false if the write failed and the file was closed
+ */
+bool CFE_FS_BackgroundFileFlushStaging(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Encodes a block of data for a compressed file
+ *
+ * Outputs a CFE_FS_CompressedBlockHeader_t followed by the compressed block data,
+ * or the data as-is if it does not get smaller.
+ *
+ * @param Compress The compression routine
+ * @param SrcBuf   The data to encode
+ * @param SrcSize  The size of the data
+ * @param DstBuf   The output buffer, at least sizeof(CFE_FS_CompressedBlockHeader_t) + SrcSize bytes
+ * @param DstSize  The size of the output buffer
+ *
+ * @returns The total size of the block header and data
+ */
+size_t CFE_FS_EncodeBlock(CFE_FS_FileWriteCompress_t Compress, const void *SrcBuf, size_t SrcSize, uint8 *DstBuf,
+                          size_t DstSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a record to the file currently being dumped in the background
+ *
+ * The record is copied into the staging buffer, which is written out first if
+ * the record does not fit.  Uncompressed records larger than the staging buffer
+ * are written directly; when a compression stage is used they are split into
+ * staging buffer sized blocks instead.
+ *
+ * @param State      The current background file state
+ * @param Meta       The meta data of the request being processed
+ * @param RecordPtr  The record data
+ * @param RecordSize The size of the record data
+ *
+ * @retval true if the record was staged or written
+ * @retval false if a write failed and the file was closed
+ */
+bool CFE_FS_BackgroundFileStageRecord(CFE_FS_CurrentFileState_t *State, CFE_FS_FileWriteMetaData_t *Meta,
+                                      const void *RecordPtr, size_t RecordSize);
+
 #endif /* CFE_FS_PRIV_H */
@@ -0,0 +1,62 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Purpose:
+ *      This header file performs compile time checking for FS configuration
+ *      parameters.
+ *
+ */
+
+#ifndef CFE_FS_VERIFY_H
+#define CFE_FS_VERIFY_H
+
+#if CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES < 2
+#error CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES cannot be less than 2!
+#endif
+
+#if (CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES & (CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES - 1)) != 0
+#error CFE_PLATFORM_FS_MAX_BACKGROUND_FILE_WRITES must be a power of two!
+#endif
+
+#if CFE_PLATFORM_FS_BACKGROUND_CREDIT_PER_SECOND < 1
+#error CFE_PLATFORM_FS_BACKGROUND_CREDIT_PER_SECOND cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_FS_BACKGROUND_MAX_CREDIT < 1
+#error CFE_PLATFORM_FS_BACKGROUND_MAX_CREDIT cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE < 64
+#error CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE cannot be less than 64!
+#endif
+
+#if (CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE % 4) != 0
+#error CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE must be a multiple of 4!
+#endif
+
+/*
+ * Staged blocks are passed to CFE_FS_CompressBlock(), which does not compress blocks over 64 KiB
+ */
+#if CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE > 65535
+#error CFE_PLATFORM_FS_BACKGROUND_STAGING_BUFFER_SIZE cannot be greater than 65535!
+#endif
+
+#endif /* CFE_FS_VERIFY_H */
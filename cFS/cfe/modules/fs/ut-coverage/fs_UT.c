@@ -61,6 +61,30 @@ void UT_FS_OnEvent(void *Meta, CFE_FS_FileWriteEvent_t Event, int32 Status, uint
     UT_DEFAULT_IMPL(UT_FS_OnEvent);
 }
 
+/* UT helper stub compatible with background file write Compress */
+size_t UT_FS_Compress(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize)
+{
+    return UT_DEFAULT_IMPL(UT_FS_Compress);
+}
+
+/* UT helper to read back big endian values written to file */
+uint32 UT_FS_GetBigEndianUint32(const uint8 *Ptr)
+{
+    return ((uint32)Ptr[0] << 24) | ((uint32)Ptr[1] << 16) | ((uint32)Ptr[2] << 8) | (uint32)Ptr[3];
+}
+
+/* UT helper to compose a compressed block header as it appears in a file */
+void UT_FS_PutBlockHeader(uint8 *Ptr, uint32 RawSize, uint32 EncodedSize)
+{
+    uint32 i;
+
+    for (i = 0; i < 4; ++i)
+    {
+        Ptr[i]     = (uint8)(RawSize >> (24 - (8 * i)));
+        Ptr[4 + i] = (uint8)(EncodedSize >> (24 - (8 * i)));
+    }
+}
+
 /*
 ** Functions
 */
@@ -83,6 +107,12 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_CFE_FS_Private);
 
     UT_ADD_TEST(Test_CFE_FS_BackgroundFileDump);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpStaging);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpCompress);
+    UT_ADD_TEST(Test_CFE_FS_BackgroundFileDumpReadBack);
+    UT_ADD_TEST(Test_CFE_FS_ReadBlock);
+    UT_ADD_TEST(Test_CFE_FS_WriteBlock);
+    UT_ADD_TEST(Test_CFE_FS_CompressBlock);
 }
 
 /*
@@ -635,27 +665,556 @@ void Test_CFE_FS_BackgroundFileDump(void)
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(&State), CFE_STATUS_REQUEST_ALREADY_PENDING);
 
-    for (i = 0; i < (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 2); ++i)
+    for (i = 0; i < (CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1); ++i)
     {
         State.IsPending = false; /* UT hack to fill queue - Force not pending.  Real code should not do this. */
         CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     }
 
+    /* All entries in the queue are usable */
     State.IsPending = false;
     UtAssert_INT32_EQ(CFE_FS_BackgroundFileDumpRequest(&State), CFE_STATUS_REQUEST_ALREADY_PENDING);
     UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.RequestCount,
-                       (CFE_FS_Global.FileDump.CompleteCount + CFE_FS_MAX_BACKGROUND_FILE_WRITES - 1));
+                       (CFE_FS_Global.FileDump.CompleteCount + CFE_FS_MAX_BACKGROUND_FILE_WRITES));
 
     /* Confirm null arg handling in CFE_FS_BackgroundFileDumpIsPending() */
     UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(NULL));
 
     /* this catches the branch where Meta->IsPending is false */
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
-    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    for (i = 0; i < CFE_FS_MAX_BACKGROUND_FILE_WRITES; ++i)
+    {
+        UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(100, NULL));
+    }
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 
     CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
     UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 2, true); /* avoid infinite loop */
     UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100, NULL));
 }
+
+void Test_CFE_FS_BackgroundFileDumpStaging(void)
+{
+    /*
+     * Test routine for record coalescing in:
+     * bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    uint32                     MyBuffer[2];
+    static uint8               LargeBuffer[CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE + 8];
+
+    UT_ResetState(UT_KEY(OS_write));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    State.GetData = UT_FS_DataGetter;
+    State.OnEvent = UT_FS_OnEvent;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+
+    /* Small records within one cycle are written as a single block after the header */
+    CFE_FS_Global.FileDump.Current.Credit = 200;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.StagedSize, 0);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize,
+                       sizeof(CFE_FS_Header_t) + (CFE_FS_Global.FileDump.Current.RecordNum * sizeof(MyBuffer)));
+
+    /* Once credit exceeds the staging buffer size, full buffers are written during the cycle */
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), (CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE / sizeof(MyBuffer)) + 1,
+                          true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(100000, NULL));
+    UtAssert_STUB_COUNT(OS_write, 4);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing a full staging buffer mid-cycle */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing the staged data at EOF must not generate the complete event */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+
+    /* Records larger than the staging buffer are written directly */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize, sizeof(CFE_FS_Header_t) + sizeof(LargeBuffer));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 2);
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing a record larger than the staging buffer */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 3);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+}
+
+void Test_CFE_FS_BackgroundFileDumpCompress(void)
+{
+    /*
+     * Test routine for the compression stage in:
+     * bool CFE_FS_RunBackgroundFileDump(uint32 ElapsedTime, void *Arg)
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    uint32                     MyBuffer[2];
+    uint32                     Expected[40];
+    uint8                      Decoded[sizeof(Expected)];
+    size_t                     DecodedSize;
+    uint32                     RawSize;
+    uint32                     EncodedSize;
+    uint8 *                    BlockPtr;
+    uint32                     i;
+    static uint8               FileImage[sizeof(CFE_FS_Header_t) + (4 * CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE)];
+    static uint8               LargeBuffer[CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE + 8];
+
+    UT_ResetState(UT_KEY(OS_write));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+
+    State.GetData  = UT_FS_DataGetter;
+    State.OnEvent  = UT_FS_OnEvent;
+    State.Compress = CFE_FS_CompressBlock;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+    MyBuffer[0] = 10;
+    MyBuffer[1] = 20;
+    for (i = 0; i < (sizeof(Expected) / sizeof(Expected[0])); ++i)
+    {
+        Expected[i] = MyBuffer[i & 1];
+    }
+
+    /* Nominal: header is marked compressed, and the block decodes to the original records */
+    memset(FileImage, 0, sizeof(FileImage));
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(OS_write), FileImage, sizeof(FileImage), false);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), sizeof(Expected) / sizeof(MyBuffer), true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+
+    BlockPtr    = &FileImage[sizeof(CFE_FS_Header_t)];
+    RawSize     = UT_FS_GetBigEndianUint32(&BlockPtr[offsetof(CFE_FS_CompressedBlockHeader_t, RawSize)]);
+    EncodedSize = UT_FS_GetBigEndianUint32(&BlockPtr[offsetof(CFE_FS_CompressedBlockHeader_t, EncodedSize)]);
+    UtAssert_UINT32_EQ(UT_FS_GetBigEndianUint32(FileImage), CFE_FS_COMPRESSED_FILE_CONTENT_ID);
+    UtAssert_UINT32_EQ(RawSize, sizeof(Expected));
+    UtAssert_UINT32_LT(EncodedSize, sizeof(Expected));
+    UtAssert_UINT32_EQ(CFE_FS_Global.FileDump.Current.FileSize,
+                       sizeof(CFE_FS_Header_t) + sizeof(CFE_FS_CompressedBlockHeader_t) + EncodedSize);
+    CFE_UtAssert_SUCCESS(CFE_FS_DecompressBlock(&BlockPtr[sizeof(CFE_FS_CompressedBlockHeader_t)], EncodedSize,
+                                                Decoded, sizeof(Decoded), &DecodedSize));
+    UtAssert_UINT32_EQ(DecodedSize, sizeof(Expected));
+    UtAssert_MemCmp(Decoded, Expected, sizeof(Expected), "Decoded data");
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+
+    /* A block that does not compress is stored as-is */
+    memset(FileImage, 0, sizeof(FileImage));
+    State.Compress                        = UT_FS_Compress;
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(OS_write), FileImage, sizeof(FileImage), false);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), MyBuffer, sizeof(MyBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_STUB_COUNT(UT_FS_Compress, 1);
+
+    UtAssert_UINT32_EQ(UT_FS_GetBigEndianUint32(&BlockPtr[offsetof(CFE_FS_CompressedBlockHeader_t, RawSize)]),
+                       sizeof(MyBuffer));
+    UtAssert_UINT32_EQ(UT_FS_GetBigEndianUint32(&BlockPtr[offsetof(CFE_FS_CompressedBlockHeader_t, EncodedSize)]),
+                       sizeof(MyBuffer));
+    UtAssert_MemCmp(&BlockPtr[sizeof(CFE_FS_CompressedBlockHeader_t)], MyBuffer, sizeof(MyBuffer), "Stored data");
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    UT_ResetState(UT_KEY(OS_write));
+
+    /* Records larger than the staging buffer are split into blocks */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 3);
+
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+
+    /* Error writing the first block of a split record */
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), LargeBuffer, sizeof(LargeBuffer), false);
+    UtAssert_BOOL_TRUE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_RECORD_WRITE_ERROR], 1);
+    UtAssert_BOOL_FALSE(CFE_FS_BackgroundFileDumpIsPending(&State));
+}
+
+void Test_CFE_FS_BackgroundFileDumpReadBack(void)
+{
+    /*
+     * Round trip through the background writer with compression enabled, then back
+     * through CFE_FS_ReadHeader() and CFE_FS_ReadBlock()
+     */
+    CFE_FS_FileWriteMetaData_t State;
+    CFE_FS_Header_t            Hdr;
+    osal_id_t                  FileDes = OS_OBJECT_ID_UNDEFINED;
+    size_t                     FileSize;
+    size_t                     OutputSize;
+    int32                      Status;
+    uint32                     BlockCount;
+    uint32                     Seed;
+    uint32                     i;
+    static uint32              Source[(3 * CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE) / (2 * sizeof(uint32))];
+    static uint8               Output[sizeof(Source)];
+    static uint8               ReadBuf[2 * CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE];
+    static uint8 FileImage[sizeof(CFE_FS_Header_t) + (4 * sizeof(CFE_FS_CompressedBlockHeader_t)) + sizeof(Source)];
+
+    UT_ResetState(UT_KEY(OS_write));
+    UT_ResetState(UT_KEY(OS_read));
+    UT_ResetState(UT_KEY(UT_FS_DataGetter));
+    memset(UT_FS_FileWriteEventCount, 0, sizeof(UT_FS_FileWriteEventCount));
+    memset(&State, 0, sizeof(State));
+    memset(&CFE_FS_Global.FileDump, 0, sizeof(CFE_FS_Global.FileDump));
+    memset(FileImage, 0, sizeof(FileImage));
+    memset(Output, 0, sizeof(Output));
+
+    /*
+     * The first block is a repeating pattern that compresses well, the
+     * remainder is pseudo-random so it is stored without compression
+     */
+    Seed = 1;
+    for (i = 0; i < (sizeof(Source) / sizeof(Source[0])); ++i)
+    {
+        if (i < (CFE_FS_BACKGROUND_STAGING_BUFFER_SIZE / sizeof(uint32)))
+        {
+            Source[i] = i % 13;
+        }
+        else
+        {
+            Seed      = (Seed * 1103515245) + 12345;
+            Source[i] = Seed;
+        }
+    }
+
+    State.GetData  = UT_FS_DataGetter;
+    State.OnEvent  = UT_FS_OnEvent;
+    State.Compress = CFE_FS_CompressBlock;
+    strncpy(State.FileName, "/ram/UT.bin", sizeof(State.FileName));
+    strncpy(State.Description, "UT", sizeof(State.Description));
+
+    CFE_FS_Global.FileDump.Current.Credit = CFE_FS_BACKGROUND_MAX_CREDIT;
+    CFE_UtAssert_SETUP(CFE_FS_BackgroundFileDumpRequest(&State));
+    UT_SetDataBuffer(UT_KEY(OS_write), FileImage, sizeof(FileImage), false);
+    UT_SetDataBuffer(UT_KEY(UT_FS_DataGetter), Source, sizeof(Source), false);
+    UT_SetDeferredRetcode(UT_KEY(UT_FS_DataGetter), 1, true);
+    UtAssert_BOOL_FALSE(CFE_FS_RunBackgroundFileDump(0, NULL));
+    UtAssert_UINT32_EQ(UT_FS_FileWriteEventCount[CFE_FS_FileWriteEvent_COMPLETE], 1);
+    FileSize = CFE_FS_Global.FileDump.Current.FileSize;
+    UtAssert_UINT32_LT(FileSize, sizeof(FileImage) - sizeof(CFE_FS_CompressedBlockHeader_t));
+
+    /* Read it back from the captured file image */
+    UT_SetDataBuffer(UT_KEY(OS_read), FileImage, FileSize, false);
+    UtAssert_INT32_EQ(CFE_FS_ReadHeader(&Hdr, FileDes), sizeof(Hdr));
+    UtAssert_UINT32_EQ(Hdr.ContentType, CFE_FS_COMPRESSED_FILE_CONTENT_ID);
+
+    OutputSize = 0;
+    BlockCount = 0;
+    while (OutputSize < sizeof(Output) && BlockCount < 4)
+    {
+        Status = CFE_FS_ReadBlock(FileDes, &Hdr, ReadBuf, sizeof(ReadBuf));
+        if (Status <= 0 || (OutputSize + Status) > sizeof(Output))
+        {
+            break;
+        }
+
+        memcpy(&Output[OutputSize], ReadBuf, Status);
+        OutputSize += Status;
+        ++BlockCount;
+    }
+
+    UtAssert_UINT32_EQ(BlockCount, 2);
+    UtAssert_UINT32_EQ(OutputSize, sizeof(Source));
+    UtAssert_MemCmp(Output, Source, sizeof(Source), "Data read back");
+
+    /* Nothing further in the file */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 0);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, ReadBuf, sizeof(ReadBuf)), 0);
+}
+
+void Test_CFE_FS_ReadBlock(void)
+{
+    /*
+     * Test routine for:
+     * CFE_Status_t CFE_FS_ReadBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, void *Buffer, size_t BufSize)
+     */
+    CFE_FS_Header_t Hdr;
+    osal_id_t       FileDes = OS_OBJECT_ID_UNDEFINED;
+    uint8           Image[sizeof(CFE_FS_CompressedBlockHeader_t) + 8];
+    uint8           Buffer[16];
+
+    memset(&Hdr, 0, sizeof(Hdr));
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, NULL, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, NULL, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, 0), CFE_FS_BAD_ARGUMENT);
+
+    /* Uncompressed file is a plain read */
+    UT_InitData();
+    Hdr.ContentType = CFE_FS_FILE_CONTENT_ID;
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), sizeof(Buffer));
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    Hdr.ContentType = CFE_FS_COMPRESSED_FILE_CONTENT_ID;
+
+    /* Truncated block header */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 4);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Encoded size larger than the raw size */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 4, 8);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(Image), false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+
+    /* Raw block larger than the buffer */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, sizeof(Buffer) + 1, sizeof(Buffer) + 1);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(Image), false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+
+    /* No room for the encoded block alongside the decoded block */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 12, 8);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(Image), false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+
+    /* Short read of the block data */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 8, 4);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(Image), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 1);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    /* Corrupt block data */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 8, 2);
+    memcpy(&Image[sizeof(CFE_FS_CompressedBlockHeader_t)], "\x50\x41", 2);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(CFE_FS_CompressedBlockHeader_t) + 2, false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+
+    /* Block decodes to a different size than its header says */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 8, 4);
+    memcpy(&Image[sizeof(CFE_FS_CompressedBlockHeader_t)], "\x10\x41\x01\x00", 4);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(CFE_FS_CompressedBlockHeader_t) + 4, false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), CFE_FS_BAD_ARGUMENT);
+
+    /* Compressed block decodes in place */
+    UT_InitData();
+    UT_FS_PutBlockHeader(Image, 5, 4);
+    memcpy(&Image[sizeof(CFE_FS_CompressedBlockHeader_t)], "\x10\x41\x01\x00", 4);
+    UT_SetDataBuffer(UT_KEY(OS_read), Image, sizeof(CFE_FS_CompressedBlockHeader_t) + 4, false);
+    UtAssert_INT32_EQ(CFE_FS_ReadBlock(FileDes, &Hdr, Buffer, sizeof(Buffer)), 5);
+    UtAssert_MemCmp(Buffer, "AAAAA", 5, "Decoded block");
+}
+
+void Test_CFE_FS_WriteBlock(void)
+{
+    /*
+     * Test routine for:
+     * CFE_Status_t CFE_FS_WriteBlock(osal_id_t FileDes, const CFE_FS_Header_t *Hdr, const void *Buffer, size_t BufSize)
+     */
+    CFE_FS_Header_t Hdr;
+    osal_id_t       FileDes = OS_OBJECT_ID_UNDEFINED;
+    size_t          OutputSize;
+    size_t          FileSize;
+    int32           Status;
+    uint32          BlockCount;
+    uint32          i;
+    static uint8    Source[(5 * CFE_FS_WRITE_BLOCK_MAX_SIZE) / 2];
+    static uint8    Output[sizeof(Source)];
+    static uint8    ReadBuf[2 * CFE_FS_WRITE_BLOCK_MAX_SIZE];
+    static uint8    FileImage[(3 * sizeof(CFE_FS_CompressedBlockHeader_t)) + sizeof(Source)];
+
+    memset(&Hdr, 0, sizeof(Hdr));
+    for (i = 0; i < sizeof(Source); ++i)
+    {
+        Source[i] = i % 7;
+    }
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, NULL, Source, sizeof(Source)), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, NULL, sizeof(Source)), CFE_FS_BAD_ARGUMENT);
+
+    /* Uncompressed file is a plain write */
+    UT_InitData();
+    Hdr.ContentType = CFE_FS_FILE_CONTENT_ID;
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, Source, sizeof(Source)), sizeof(Source));
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, Source, sizeof(Source)), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+
+    Hdr.ContentType = CFE_FS_COMPRESSED_FILE_CONTENT_ID;
+
+    /* Short write of a block */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), 1);
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, Source, sizeof(Source)), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UtAssert_STUB_COUNT(OS_write, 1);
+
+    /* Nothing to write */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, Source, 0), 0);
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    /* Compressed file is split into blocks, and reads back with CFE_FS_ReadBlock() */
+    UT_InitData();
+    memset(FileImage, 0, sizeof(FileImage));
+    UT_SetDataBuffer(UT_KEY(OS_write), FileImage, sizeof(FileImage), false);
+    UtAssert_INT32_EQ(CFE_FS_WriteBlock(FileDes, &Hdr, Source, sizeof(Source)), sizeof(Source));
+    UtAssert_STUB_COUNT(OS_write, 3);
+
+    UT_GetDataBuffer(UT_KEY(OS_write), NULL, NULL, &FileSize);
+    UtAssert_UINT32_LT(FileSize, sizeof(Source));
+
+    UT_SetDataBuffer(UT_KEY(OS_read), FileImage, FileSize, false);
+    OutputSize = 0;
+    BlockCount = 0;
+    while (OutputSize < sizeof(Output) && BlockCount < 4)
+    {
+        Status = CFE_FS_ReadBlock(FileDes, &Hdr, ReadBuf, sizeof(ReadBuf));
+        if (Status <= 0 || (OutputSize + Status) > sizeof(Output))
+        {
+            break;
+        }
+
+        memcpy(&Output[OutputSize], ReadBuf, Status);
+        OutputSize += Status;
+        ++BlockCount;
+    }
+
+    UtAssert_UINT32_EQ(BlockCount, 3);
+    UtAssert_UINT32_EQ(OutputSize, sizeof(Source));
+    UtAssert_MemCmp(Output, Source, sizeof(Source), "Data read back");
+}
+
+void Test_CFE_FS_CompressBlock(void)
+{
+    /*
+     * Test routine for:
+     * size_t CFE_FS_CompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize)
+     * CFE_Status_t CFE_FS_DecompressBlock(const void *SrcBuf, size_t SrcSize, void *DstBuf, size_t DstSize,
+     *                                     size_t *DecodedSize)
+     */
+    static uint8 Source[1024];
+    static uint8 Encoded[sizeof(Source) + 64];
+    static uint8 Decoded[sizeof(Source)];
+    size_t       EncodedSize;
+    size_t       DecodedSize;
+    uint32       Seed;
+    uint32       i;
+
+    /* Short literals, then a long match, ending in a long literal run */
+    Seed = 1;
+    for (i = 0; i < sizeof(Source); ++i)
+    {
+        Seed      = (Seed * 1103515245) + 12345;
+        Source[i] = (i >= 300 && i < 700) ? 0 : (uint8)(Seed >> 16);
+    }
+
+    EncodedSize = CFE_FS_CompressBlock(Source, sizeof(Source), Encoded, sizeof(Encoded));
+    UtAssert_NONZERO(EncodedSize);
+    UtAssert_UINT32_LT(EncodedSize, sizeof(Source));
+    CFE_UtAssert_SUCCESS(CFE_FS_DecompressBlock(Encoded, EncodedSize, Decoded, sizeof(Decoded), &DecodedSize));
+    UtAssert_UINT32_EQ(DecodedSize, sizeof(Source));
+    UtAssert_MemCmp(Decoded, Source, sizeof(Source), "Decoded data");
+
+    /* Decoding into a buffer that is too small, at both the literal and match step */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, EncodedSize, Decoded, 100, &DecodedSize), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, EncodedSize, Decoded, 400, &DecodedSize), CFE_FS_BAD_ARGUMENT);
+
+    /* Output buffer too small, at both the match and final literal step */
+    UtAssert_ZERO(CFE_FS_CompressBlock(Source, sizeof(Source), Encoded, 100));
+    UtAssert_ZERO(CFE_FS_CompressBlock(Source, sizeof(Source), Encoded, EncodedSize - 1));
+
+    /* Very short input is stored as a single literal run */
+    UtAssert_UINT32_EQ(CFE_FS_CompressBlock(Source, 8, Encoded, sizeof(Encoded)), 9);
+    CFE_UtAssert_SUCCESS(CFE_FS_DecompressBlock(Encoded, 9, Decoded, sizeof(Decoded), &DecodedSize));
+    UtAssert_UINT32_EQ(DecodedSize, 8);
+
+    /* Bad arguments */
+    UtAssert_ZERO(CFE_FS_CompressBlock(NULL, sizeof(Source), Encoded, sizeof(Encoded)));
+    UtAssert_ZERO(CFE_FS_CompressBlock(Source, sizeof(Source), NULL, sizeof(Encoded)));
+    UtAssert_ZERO(CFE_FS_CompressBlock(Source, 0, Encoded, sizeof(Encoded)));
+    UtAssert_ZERO(CFE_FS_CompressBlock(Source, 0x10000, Encoded, sizeof(Encoded)));
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(NULL, 1, Decoded, sizeof(Decoded), &DecodedSize), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 1, NULL, sizeof(Decoded), &DecodedSize), CFE_FS_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 1, Decoded, sizeof(Decoded), NULL), CFE_FS_BAD_ARGUMENT);
+
+    /* Malformed input */
+    memcpy(Encoded, "\xF0", 1); /* literal length extension missing */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 1, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+    memcpy(Encoded, "\x50\x41", 2); /* literals beyond end of input */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 2, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+    memcpy(Encoded, "\x10\x41\x01", 3); /* truncated match offset */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 3, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+    memcpy(Encoded, "\x10\x41\x00\x00", 4); /* zero match offset */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 4, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+    memcpy(Encoded, "\x10\x41\x02\x00", 4); /* match offset before start of output */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 4, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+    memcpy(Encoded, "\x1F\x41\x01\x00", 4); /* match length extension missing */
+    UtAssert_INT32_EQ(CFE_FS_DecompressBlock(Encoded, 4, Decoded, sizeof(Decoded), &DecodedSize),
+                      CFE_FS_BAD_ARGUMENT);
+
+    /* Overlapping match, run of 5 bytes from a single literal */
+    memcpy(Encoded, "\x10\x41\x01\x00", 4);
+    CFE_UtAssert_SUCCESS(CFE_FS_DecompressBlock(Encoded, 4, Decoded, sizeof(Decoded), &DecodedSize));
+    UtAssert_UINT32_EQ(DecodedSize, 5);
+    UtAssert_MemCmp(Decoded, "AAAAA", 5, "Decoded run");
+}
@@ -312,4 +312,82 @@ void Test_CFE_FS_GetUncompressedFile(void);
 ******************************************************************************/
 void Test_CFE_FS_BackgroundFileDump(void);
 
+/*****************************************************************************/
+/**
+** \brief Tests for coalescing of records in the FS background file dump
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpStaging(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for the compression stage of the FS background file dump
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpCompress(void);
+
+/*****************************************************************************/
+/**
+** \brief Reads back a compressed background file dump and checks the data
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_BackgroundFileDumpReadBack(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for reading file data following the header
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_ReadBlock(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for writing file data following the header
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_WriteBlock(void);
+
+/*****************************************************************************/
+/**
+** \brief Tests for the FS block compression codec
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+**
+******************************************************************************/
+void Test_CFE_FS_CompressBlock(void);
+
 #endif /* FS_UT_H */
@@ -0,0 +1,275 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Inline message header accessors for trusted internal callers
+ *
+ * These provide the same values as the corresponding CFE_MSG_Get... APIs,
+ * but are header-only so they can be inlined into the hot paths of the
+ * software bus and command dispatchers.  There is no status return: the
+ * message pointer must already have been validated by the caller.
+ *
+ * The direct field access is only enabled when the mission sets
+ * MISSION_MSG_INLINE_ACCESSORS (see the generated cfe_msg_options.h),
+ * which assumes the default header definitions in this module are in use.  Otherwise (and in coverage
+ * tests, so stubs still apply) each accessor calls the regular API.
+ */
+
+#ifndef CFE_MSG_INLINE_H
+#define CFE_MSG_INLINE_H
+
+/*
+ * Includes
+ */
+#include "common_types.h"
+#include "cfe_msg.h"
+#include "cfe_sb.h"
+#include "cfe_msg_options.h"
+
+#if defined(CFE_MSG_INLINE_ACCESSORS) && !defined(_UNIT_TEST_)
+
+#define CFE_MSG_HDR_SIZE_OFFSET    7      /**< \brief CCSDS size offset */
+#define CFE_MSG_HDR_CCSDSVER_SHIFT 13     /**< \brief CCSDS version shift */
+#define CFE_MSG_HDR_TYPE_MASK      0x1000 /**< \brief CCSDS type mask, command when set */
+#define CFE_MSG_HDR_SHDR_MASK      0x0800 /**< \brief CCSDS secondary header mask, exists when set*/
+#define CFE_MSG_HDR_APID_MASK      0x07FF /**< \brief CCSDS ApID mask */
+#define CFE_MSG_HDR_SEQCNT_MASK    0x3FFF /**< \brief CCSDS Sequence count mask */
+#define CFE_MSG_HDR_FC_MASK        0x7F   /**< \brief Function code mask */
+#define CFE_MSG_HDR_SUBSYS_MASK    0x01FF /**< \brief CCSDS Subsystem mask */
+
+/* Same default as the msg module itself */
+#ifndef CFE_MISSION_CCSDSVER
+#define CFE_MISSION_CCSDSVER 0
+#endif
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get a big endian header word (uint8 array[2])
+ */
+static inline uint16 CFE_MSG_InlineGetHeaderWord(const uint8 *Word)
+{
+    return (uint16)((Word[0] << 8) | Word[1]);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetSize()
+ */
+static inline CFE_MSG_Size_t CFE_MSG_InlineGetSize(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Pri.Length) + CFE_MSG_HDR_SIZE_OFFSET;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetHeaderVersion()
+ */
+static inline CFE_MSG_HeaderVersion_t CFE_MSG_InlineGetHeaderVersion(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId) >> CFE_MSG_HDR_CCSDSVER_SHIFT;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetType()
+ */
+static inline CFE_MSG_Type_t CFE_MSG_InlineGetType(const CFE_MSG_Message_t *MsgPtr)
+{
+    if ((MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_HDR_TYPE_MASK >> 8)) != 0)
+    {
+        return CFE_MSG_Type_Cmd;
+    }
+
+    return CFE_MSG_Type_Tlm;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetHasSecondaryHeader()
+ */
+static inline bool CFE_MSG_InlineGetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr)
+{
+    return (MsgPtr->CCSDS.Pri.StreamId[0] & (CFE_MSG_HDR_SHDR_MASK >> 8)) != 0;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetApId()
+ */
+static inline CFE_MSG_ApId_t CFE_MSG_InlineGetApId(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId) & CFE_MSG_HDR_APID_MASK;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetSequenceCount()
+ */
+static inline CFE_MSG_SequenceCount_t CFE_MSG_InlineGetSequenceCount(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Pri.Sequence) & CFE_MSG_HDR_SEQCNT_MASK;
+}
+
+#ifdef CFE_MSG_CCSDSEXT_HEADER
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetSubsystem()
+ */
+static inline CFE_MSG_Subsystem_t CFE_MSG_InlineGetSubsystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Ext.Subsystem) & CFE_MSG_HDR_SUBSYS_MASK;
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetSystem()
+ */
+static inline CFE_MSG_System_t CFE_MSG_InlineGetSystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    return CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Ext.SystemId);
+}
+
+#endif /* CFE_MSG_CCSDSEXT_HEADER */
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetMsgId()
+ */
+static inline CFE_SB_MsgId_t CFE_MSG_InlineGetMsgId(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_SB_MsgId_Atom_t msgidval;
+
+#ifdef CFE_MSG_MSGID_V2
+    /* See cfe_msg_msgid_v2.c for the bit layout */
+    msgidval = MsgPtr->CCSDS.Pri.StreamId[1] & 0x007F;
+    if (CFE_MSG_InlineGetType(MsgPtr) == CFE_MSG_Type_Cmd)
+    {
+        msgidval |= 0x0080;
+    }
+    msgidval |= (MsgPtr->CCSDS.Ext.Subsystem[1] << 8) & 0xFF00;
+#else
+    msgidval = CFE_MSG_InlineGetHeaderWord(MsgPtr->CCSDS.Pri.StreamId);
+#endif
+
+    return CFE_SB_ValueToMsgId(msgidval);
+}
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Inline equivalent of CFE_MSG_GetFcnCode()
+ *
+ * As with the API, this is 0 if the message is not a command with a secondary header.
+ */
+static inline CFE_MSG_FcnCode_t CFE_MSG_InlineGetFcnCode(const CFE_MSG_Message_t *MsgPtr)
+{
+    if (CFE_MSG_InlineGetHeaderVersion(MsgPtr) != CFE_MISSION_CCSDSVER ||
+        CFE_MSG_InlineGetType(MsgPtr) != CFE_MSG_Type_Cmd || !CFE_MSG_InlineGetHasSecondaryHeader(MsgPtr))
+    {
+        return 0;
+    }
+
+    return ((const CFE_MSG_CommandHeader_t *)MsgPtr)->Sec.FunctionCode & CFE_MSG_HDR_FC_MASK;
+}
+
+#else /* not CFE_MSG_INLINE_ACCESSORS */
+
+/*
+ * Without the option, each accessor is a thin wrapper around the API.
+ * The API status is ignored, the pointer is valid by definition here.
+ */
+
+static inline CFE_MSG_Size_t CFE_MSG_InlineGetSize(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Size_t Size = 0;
+    CFE_MSG_GetSize(MsgPtr, &Size);
+    return Size;
+}
+
+static inline CFE_MSG_HeaderVersion_t CFE_MSG_InlineGetHeaderVersion(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_HeaderVersion_t Version = 0;
+    CFE_MSG_GetHeaderVersion(MsgPtr, &Version);
+    return Version;
+}
+
+static inline CFE_MSG_Type_t CFE_MSG_InlineGetType(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Type_t Type = CFE_MSG_Type_Invalid;
+    CFE_MSG_GetType(MsgPtr, &Type);
+    return Type;
+}
+
+static inline bool CFE_MSG_InlineGetHasSecondaryHeader(const CFE_MSG_Message_t *MsgPtr)
+{
+    bool HasSecondary = false;
+    CFE_MSG_GetHasSecondaryHeader(MsgPtr, &HasSecondary);
+    return HasSecondary;
+}
+
+static inline CFE_MSG_ApId_t CFE_MSG_InlineGetApId(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_ApId_t ApId = 0;
+    CFE_MSG_GetApId(MsgPtr, &ApId);
+    return ApId;
+}
+
+static inline CFE_MSG_SequenceCount_t CFE_MSG_InlineGetSequenceCount(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_SequenceCount_t SeqCnt = 0;
+    CFE_MSG_GetSequenceCount(MsgPtr, &SeqCnt);
+    return SeqCnt;
+}
+
+#ifdef CFE_MSG_CCSDSEXT_HEADER
+
+static inline CFE_MSG_Subsystem_t CFE_MSG_InlineGetSubsystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Subsystem_t Subsystem = 0;
+    CFE_MSG_GetSubsystem(MsgPtr, &Subsystem);
+    return Subsystem;
+}
+
+static inline CFE_MSG_System_t CFE_MSG_InlineGetSystem(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_System_t System = 0;
+    CFE_MSG_GetSystem(MsgPtr, &System);
+    return System;
+}
+
+#endif /* CFE_MSG_CCSDSEXT_HEADER */
+
+static inline CFE_SB_MsgId_t CFE_MSG_InlineGetMsgId(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_SB_MsgId_t MsgId = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_GetMsgId(MsgPtr, &MsgId);
+    return MsgId;
+}
+
+static inline CFE_MSG_FcnCode_t CFE_MSG_InlineGetFcnCode(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_FcnCode_t FcnCode = 0;
+    CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+    return FcnCode;
+}
+
+#endif /* CFE_MSG_INLINE_ACCESSORS */
+
+#endif /* CFE_MSG_INLINE_H */
@@ -23,6 +23,14 @@
 #include "cfe_msg_priv.h"
 #include "cfe_msg_defaults.h"
 
+#include <string.h>
+
+/*
+ * Word type used to compute the checksum several bytes at a time.
+ * This should be the natural register size of the processor.
+ */
+typedef cpuaddr CFE_MSG_ChecksumWord_t;
+
 /*----------------------------------------------------------------
  *
  * Internal helper routine only, not part of API.
@@ -31,16 +39,49 @@
  * MsgPtr is Message pointer to checksum
  * Return Value is Calculated checksum
  *
+ * The checksum is the XOR of all bytes in the message, so the bulk of it is
+ * done a full word at a time and the bytes of the word are folded together
+ * at the end.  The result is identical to a byte at a time computation,
+ * regardless of alignment or byte order.
+ *
  *-----------------------------------------------------------------*/
 CFE_MSG_Checksum_t CFE_MSG_ComputeCheckSum(const CFE_MSG_Message_t *MsgPtr)
 {
-    CFE_MSG_Size_t     PktLen  = 0;
-    const uint8 *      BytePtr = (const uint8 *)MsgPtr;
-    CFE_MSG_Checksum_t chksum  = 0xFF;
+    CFE_MSG_Size_t         PktLen  = 0;
+    const uint8 *          BytePtr = (const uint8 *)MsgPtr;
+    CFE_MSG_Checksum_t     chksum  = 0xFF;
+    CFE_MSG_ChecksumWord_t Word;
+    CFE_MSG_ChecksumWord_t WordSum;
+    size_t                 Shift;
 
     /* Message already checked, no error case reachable */
     CFE_MSG_GetSize(MsgPtr, &PktLen);
 
+    /* Leading bytes, up to the first aligned word */
+    while (PktLen > 0 && ((cpuaddr)BytePtr & (sizeof(Word) - 1)) != 0)
+    {
+        chksum ^= *(BytePtr++);
+        --PktLen;
+    }
+
+    /* Aligned words - this loop is also suitable for auto-vectorization */
+    WordSum = 0;
+    while (PktLen >= sizeof(Word))
+    {
+        memcpy(&Word, BytePtr, sizeof(Word));
+        WordSum ^= Word;
+        BytePtr += sizeof(Word);
+        PktLen -= sizeof(Word);
+    }
+
+    /* Fold the bytes of the word sum together */
+    for (Shift = sizeof(WordSum) * 4; Shift >= 8; Shift /= 2)
+    {
+        WordSum ^= WordSum >> Shift;
+    }
+    chksum ^= (uint8)WordSum;
+
+    /* Trailing bytes */
     while (PktLen--)
     {
         chksum ^= *(BytePtr++);
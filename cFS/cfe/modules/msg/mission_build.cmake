@@ -25,3 +25,23 @@ generate_config_includefile(
     FILE_NAME           "cfe_msg_sechdr.h"
     FALLBACK_FILE       "${CMAKE_CURRENT_LIST_DIR}/option_inc/default_cfe_msg_sechdr.h"
 )
+
+# Header and MsgId selection plus the inline accessor option, for cfe_msg_inline.h
+# This is generated rather than set as compile definitions so that every
+# consumer (core modules and apps alike) sees the same selection
+set(MSG_OPTION_DEFS)
+if (MISSION_INCLUDE_CCSDSEXT_HEADER)
+  list(APPEND MSG_OPTION_DEFS "#define CFE_MSG_CCSDSEXT_HEADER\n")
+endif (MISSION_INCLUDE_CCSDSEXT_HEADER)
+if (MISSION_MSGID_V2)
+  list(APPEND MSG_OPTION_DEFS "#define CFE_MSG_MSGID_V2\n")
+endif (MISSION_MSGID_V2)
+if (MISSION_MSG_INLINE_ACCESSORS)
+  message(STATUS "Inline message header accessors enabled")
+  list(APPEND MSG_OPTION_DEFS "#define CFE_MSG_INLINE_ACCESSORS\n")
+endif (MISSION_MSG_INLINE_ACCESSORS)
+
+generate_c_headerfile("${CMAKE_BINARY_DIR}/inc/cfe_msg_options.h"
+  "/* Selected by MISSION_INCLUDE_CCSDSEXT_HEADER, MISSION_MSGID_V2 and MISSION_MSG_INLINE_ACCESSORS */\n"
+  ${MSG_OPTION_DEFS}
+)
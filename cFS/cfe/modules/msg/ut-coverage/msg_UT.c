@@ -34,6 +34,7 @@
 #include "test_cfe_msg_fc.h"
 #include "test_cfe_msg_checksum.h"
 #include "test_cfe_msg_time.h"
+#include "test_cfe_msg_inline.h"
 
 /*
  * Functions
@@ -53,4 +54,5 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_MSG_Checksum);
     UT_ADD_TEST(Test_MSG_FcnCode);
     UT_ADD_TEST(Test_MSG_Time);
+    UT_ADD_TEST(Test_MSG_Inline);
 }
@@ -33,11 +33,31 @@
 #include "cfe_msg_defaults.h"
 #include <string.h>
 
+/*
+ * Reference checksum, one byte at a time
+ */
+static uint8 Test_MSG_RefChecksum(const uint8 *BytePtr, size_t Len)
+{
+    uint8 chksum = 0xFF;
+
+    while (Len--)
+    {
+        chksum ^= *(BytePtr++);
+    }
+
+    return chksum;
+}
+
 void Test_MSG_Checksum(void)
 {
     CFE_MSG_CommandHeader_t cmd;
     CFE_MSG_Message_t *     msgptr = CFE_MSG_PTR(cmd);
     bool                    actual;
+    uint8                   buf[sizeof(cmd) + 256 + sizeof(cpuaddr)];
+    size_t                  offset;
+    size_t                  len;
+    size_t                  i;
+    uint32                  errcount;
 
     UtPrintf("Bad parameter tests, Null pointers");
     memset(&cmd, 0, sizeof(cmd));
@@ -102,4 +122,29 @@ void Test_MSG_Checksum(void)
     UtAssert_BOOL_TRUE(actual);
     /* Still complete packet even though version is incorrect + version in header */
     UtAssert_INT32_EQ(Test_MSG_NotZero(msgptr), MSG_LENGTH_FLAG | MSG_HASSEC_FLAG | MSG_TYPE_FLAG | MSG_HDRVER_FLAG);
+
+    UtPrintf("Checksum matches byte-wise reference for all sizes and alignments");
+    for (i = 0; i < sizeof(buf); ++i)
+    {
+        buf[i] = (uint8)(i * 37 + 11);
+    }
+    errcount = 0;
+    for (offset = 0; offset < sizeof(cpuaddr); ++offset)
+    {
+        msgptr = (CFE_MSG_Message_t *)&buf[offset];
+        for (len = sizeof(cmd); len <= sizeof(cmd) + 256; ++len)
+        {
+            CFE_MSG_SetSize(msgptr, len);
+            CFE_MSG_SetType(msgptr, CFE_MSG_Type_Cmd);
+            CFE_MSG_SetHeaderVersion(msgptr, CFE_MISSION_CCSDSVER);
+            CFE_MSG_SetHasSecondaryHeader(msgptr, true);
+            CFE_MSG_GenerateChecksum(msgptr);
+            CFE_MSG_ValidateChecksum(msgptr, &actual);
+            if (!actual || Test_MSG_RefChecksum(&buf[offset], len) != 0)
+            {
+                ++errcount;
+            }
+        }
+    }
+    UtAssert_UINT32_EQ(errcount, 0);
 }
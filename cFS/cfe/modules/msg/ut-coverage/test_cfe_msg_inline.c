@@ -0,0 +1,122 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Test inline header accessors
+ */
+
+/*
+ * Includes
+ */
+#include "utassert.h"
+#include "ut_support.h"
+#include "cfe_msg.h"
+#include "test_cfe_msg_inline.h"
+#include <string.h>
+
+/*
+ * Build the direct header access path here regardless of the mission setting,
+ * so it is always compiled and checked against the API it stands in for
+ */
+#undef _UNIT_TEST_
+#ifndef CFE_MSG_INLINE_ACCESSORS
+#define CFE_MSG_INLINE_ACCESSORS
+#endif
+#include "cfe_msg_inline.h"
+
+#ifndef CFE_MSG_HDR_SIZE_OFFSET
+#error "cfe_msg_inline.h did not select the direct header access path"
+#endif
+
+/*
+ * Compare every inline accessor with the corresponding API on one message
+ */
+static void Test_MSG_Inline_Compare(const CFE_MSG_Message_t *MsgPtr)
+{
+    CFE_MSG_Size_t          Size         = 0;
+    CFE_MSG_HeaderVersion_t HdrVer       = 0;
+    CFE_MSG_Type_t          Type         = CFE_MSG_Type_Invalid;
+    bool                    HasSecondary = false;
+    CFE_MSG_ApId_t          ApId         = 0;
+    CFE_MSG_SequenceCount_t SeqCnt       = 0;
+    CFE_SB_MsgId_t          MsgId        = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_FcnCode_t       FcnCode      = 0;
+
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSize(MsgPtr, &Size));
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetSize(MsgPtr), Size);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetHeaderVersion(MsgPtr, &HdrVer));
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetHeaderVersion(MsgPtr), HdrVer);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetType(MsgPtr, &Type));
+    UtAssert_INT32_EQ(CFE_MSG_InlineGetType(MsgPtr), Type);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetHasSecondaryHeader(MsgPtr, &HasSecondary));
+    UtAssert_INT32_EQ(CFE_MSG_InlineGetHasSecondaryHeader(MsgPtr), HasSecondary);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetApId(MsgPtr, &ApId));
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetApId(MsgPtr), ApId);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetSequenceCount(MsgPtr, &SeqCnt));
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetSequenceCount(MsgPtr), SeqCnt);
+    CFE_UtAssert_SUCCESS(CFE_MSG_GetMsgId(MsgPtr, &MsgId));
+    UtAssert_UINT32_EQ(CFE_SB_MsgIdToValue(CFE_MSG_InlineGetMsgId(MsgPtr)), CFE_SB_MsgIdToValue(MsgId));
+
+    /* The API reports a status for non-commands, but the value is 0 either way */
+    CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetFcnCode(MsgPtr), FcnCode);
+
+#ifdef CFE_MSG_CCSDSEXT_HEADER
+    {
+        CFE_MSG_Subsystem_t Subsystem    = 0;
+        CFE_MSG_System_t    System       = 0;
+
+        CFE_UtAssert_SUCCESS(CFE_MSG_GetSubsystem(MsgPtr, &Subsystem));
+        UtAssert_UINT32_EQ(CFE_MSG_InlineGetSubsystem(MsgPtr), Subsystem);
+        CFE_UtAssert_SUCCESS(CFE_MSG_GetSystem(MsgPtr, &System));
+        UtAssert_UINT32_EQ(CFE_MSG_InlineGetSystem(MsgPtr), System);
+    }
+#endif
+}
+
+void Test_MSG_Inline(void)
+{
+    CFE_MSG_CommandHeader_t cmd;
+    CFE_MSG_Message_t *     msgptr = CFE_MSG_PTR(cmd);
+
+    UtPrintf("All zero header");
+    memset(&cmd, 0, sizeof(cmd));
+    Test_MSG_Inline_Compare(msgptr);
+
+    UtPrintf("All F's header");
+    memset(&cmd, 0xFF, sizeof(cmd));
+    Test_MSG_Inline_Compare(msgptr);
+
+    UtPrintf("Command with secondary header");
+    memset(&cmd, 0, sizeof(cmd));
+    CFE_UtAssert_SUCCESS(CFE_MSG_Init(msgptr, CFE_SB_ValueToMsgId(0x1800), sizeof(cmd)));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetType(msgptr, CFE_MSG_Type_Cmd));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetHasSecondaryHeader(msgptr, true));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetApId(msgptr, 0x5A5));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetSequenceCount(msgptr, 0x2A5A));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetFcnCode(msgptr, 0x55));
+    Test_MSG_Inline_Compare(msgptr);
+    UtAssert_UINT32_EQ(CFE_MSG_InlineGetFcnCode(msgptr), 0x55);
+
+    UtPrintf("Telemetry without secondary header");
+    memset(&cmd, 0, sizeof(cmd));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetType(msgptr, CFE_MSG_Type_Tlm));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetApId(msgptr, 0x2A));
+    CFE_UtAssert_SUCCESS(CFE_MSG_SetSize(msgptr, sizeof(cmd)));
+    Test_MSG_Inline_Compare(msgptr);
+}
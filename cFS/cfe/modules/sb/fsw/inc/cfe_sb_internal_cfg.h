@@ -106,6 +106,36 @@
 #define CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT         CFE_PLATFORM_SB_CFGVAL(DEFAULT_MSG_LIMIT)
 #define DEFAULT_CFE_PLATFORM_SB_DEFAULT_MSG_LIMIT 4
 
+/**
+**  \cfesbcfg Maximum Number of Buffer Rings
+**
+**  \par Description:
+**       Dictates the maximum number of pre-allocated buffer rings that may be
+**       registered with #CFE_SB_CreateBufferRing at the same time.  Each ring is
+**       associated with a single MsgId.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_BUFFER_RINGS         CFE_PLATFORM_SB_CFGVAL(MAX_BUFFER_RINGS)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_BUFFER_RINGS 16
+
+/**
+**  \cfesbcfg Maximum Number of Buffers in a Buffer Ring
+**
+**  \par Description:
+**       Dictates the maximum number of buffers that may be pre-allocated for a
+**       single buffer ring.  A ring needs enough buffers to cover all the messages
+**       that are still queued to, or held by, the subscribers at any given time.
+**
+**  \par Limits
+**       This parameter has a lower limit of 1 and an upper limit of 65535.
+**
+*/
+#define CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH         CFE_PLATFORM_SB_CFGVAL(MAX_BUFFER_RING_DEPTH)
+#define DEFAULT_CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH 8
+
 /**
 **  \cfesbcfg Size of the SB buffer memory pool
 **
@@ -327,6 +357,26 @@
 #define CFE_PLATFORM_SB_MAX_BLOCK_SIZE            CFE_PLATFORM_SB_CFGVAL(MAX_BLOCK_SIZE)
 #define DEFAULT_CFE_PLATFORM_SB_MAX_BLOCK_SIZE    (CFE_MISSION_SB_MAX_SB_MSG_SIZE + 128)
 
+/**
+**  \cfeescfg Define SB Memory Pool Slab Size
+**
+**  \par Description:
+**       The SB memory pool is divided into slabs of this size, where each slab
+**       holds buffers of a single block size.  Slabs that no longer hold any
+**       buffers are shared between all block sizes, so that the pool does not
+**       run out of memory for one block size while it is held by buffers of another
+**       size that are no longer in use.  Block sizes that do not fit at least
+**       two buffers in a slab are allocated directly from the pool.
+**
+**       If set to 0, the pool does not use slabs, and every buffer that is created
+**       remains reserved for its block size.  This is the default.
+**
+**  \par Limits
+**       Must not be larger than #CFE_PLATFORM_SB_BUF_MEMORY_BYTES.
+*/
+#define CFE_PLATFORM_SB_BUF_MEMORY_SLAB_SIZE         CFE_PLATFORM_SB_CFGVAL(BUF_MEMORY_SLAB_SIZE)
+#define DEFAULT_CFE_PLATFORM_SB_BUF_MEMORY_SLAB_SIZE 0
+
 /**
 **  \cfeescfg Define SB Task Priority
 **
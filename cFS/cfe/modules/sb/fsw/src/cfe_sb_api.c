@@ -830,6 +830,40 @@ CFE_Status_t CFE_SB_GetPipeIdByName(CFE_SB_PipeId_t *PipeIdPtr, const char *Pipe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_GetPipeWaitId(CFE_SB_PipeId_t PipeId, osal_id_t *WaitIdPtr)
+{
+    CFE_Status_t    Status;
+    CFE_SB_PipeD_t *PipeDscPtr;
+
+    if (WaitIdPtr == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        *WaitIdPtr = PipeDscPtr->SysQueueId;
+        Status     = CFE_SUCCESS;
+    }
+    else
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -1430,6 +1464,187 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_CreateBufferRing(CFE_SB_MsgId_t MsgId, size_t MsgSize, uint16 NumBuffers)
+{
+    CFE_ES_AppId_t       AppId;
+    CFE_SB_BufferRing_t *RingPtr;
+    CFE_SB_BufferD_t *   BufDscPtr;
+    CFE_Status_t         Status;
+    uint32               i;
+
+    if (!CFE_SB_IsValidMsgId(MsgId) || MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE || NumBuffers == 0 ||
+        NumBuffers > CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    RingPtr = NULL;
+    if (CFE_SB_LocateBufferRing(MsgId) != NULL)
+    {
+        /* Only one ring may be registered per MsgId */
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        /* Find a free ring entry */
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_BUFFER_RINGS; ++i)
+        {
+            if (!CFE_RESOURCEID_TEST_DEFINED(CFE_SB_Global.BufferRings[i].AppId))
+            {
+                RingPtr = &CFE_SB_Global.BufferRings[i];
+                break;
+            }
+        }
+
+        if (RingPtr == NULL)
+        {
+            Status = CFE_SB_BUF_ALOC_ERR;
+        }
+    }
+
+    if (RingPtr != NULL)
+    {
+        /*
+         * The ring is filled up front - the initial UseCount of 1 from the
+         * pool is the reference held by the ring itself.  The AppId of the
+         * buffers is only set while they are issued to the publisher.
+         */
+        while (RingPtr->NumBuffers < NumBuffers)
+        {
+            BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
+            if (BufDscPtr == NULL)
+            {
+                break;
+            }
+
+            memset(&BufDscPtr->Content, 0, MsgSize);
+            RingPtr->Buffers[RingPtr->NumBuffers] = BufDscPtr;
+            ++RingPtr->NumBuffers;
+        }
+
+        if (RingPtr->NumBuffers < NumBuffers)
+        {
+            /* return any buffers that were obtained, this also frees the entry */
+            CFE_SB_BufferRingRelease(RingPtr);
+            Status = CFE_SB_BUF_ALOC_ERR;
+        }
+        else
+        {
+            RingPtr->MsgId = MsgId;
+            RingPtr->AppId = AppId;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_DeleteBufferRing(CFE_SB_MsgId_t MsgId)
+{
+    CFE_ES_AppId_t       AppId;
+    CFE_SB_BufferRing_t *RingPtr;
+    CFE_Status_t         Status;
+
+    Status = CFE_ES_GetAppID(&AppId);
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    RingPtr = CFE_SB_LocateBufferRing(MsgId);
+    if (RingPtr == NULL || !CFE_RESOURCEID_TEST_EQUAL(RingPtr->AppId, AppId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        CFE_SB_BufferRingRelease(RingPtr);
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_GetRingBuffer(CFE_SB_MsgId_t MsgId)
+{
+    CFE_ES_AppId_t       AppId;
+    CFE_SB_BufferRing_t *RingPtr;
+    CFE_SB_BufferD_t *   BufDscPtr;
+    CFE_SB_Buffer_t *    BufPtr;
+    uint16               i;
+
+    BufPtr = NULL;
+
+    if (CFE_ES_GetAppID(&AppId) != CFE_SUCCESS)
+    {
+        return NULL;
+    }
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    RingPtr = CFE_SB_LocateBufferRing(MsgId);
+    if (RingPtr != NULL && CFE_RESOURCEID_TEST_EQUAL(RingPtr->AppId, AppId))
+    {
+        for (i = 0; i < RingPtr->NumBuffers; ++i)
+        {
+            BufDscPtr = RingPtr->Buffers[RingPtr->NextBuffer];
+
+            ++RingPtr->NextBuffer;
+            if (RingPtr->NextBuffer >= RingPtr->NumBuffers)
+            {
+                RingPtr->NextBuffer = 0;
+            }
+
+            /* A buffer referenced only by the ring is no longer in use by any recipient */
+            if (BufDscPtr->UseCount == 1)
+            {
+                /* Issue the buffer to the publisher, the same way as a zero copy allocation */
+                CFE_SB_TrackingListRemove(&BufDscPtr->Link);
+                BufDscPtr->AppId = AppId;
+                CFE_SB_IncrBufUseCnt(BufDscPtr);
+                CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+
+                BufPtr = &BufDscPtr->Content;
+                break;
+            }
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return BufPtr;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -29,6 +29,7 @@
 /* Include Files */
 
 #include "cfe_sb_module_all.h"
+#include "cfe_msg_inline.h"
 
 #include <string.h>
 
@@ -46,15 +47,15 @@ bool CFE_SB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     CFE_MSG_FcnCode_t FcnCode      = 0;
     CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
 
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    ActualLength = CFE_MSG_InlineGetSize(MsgPtr);
 
     /*
     ** Verify the command packet length
     */
     if (ExpectedLength != ActualLength)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+        MsgId   = CFE_MSG_InlineGetMsgId(MsgPtr);
+        FcnCode = CFE_MSG_InlineGetFcnCode(MsgPtr);
 
         CFE_EVS_SendEvent(CFE_SB_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
@@ -67,45 +68,73 @@ bool CFE_SB_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLeng
     return result;
 }
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_SendPrevSubsCmd_t, CFE_SB_SendPrevSubsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_EnableSubReportingCmd_t, CFE_SB_EnableSubReportingCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_DisableSubReportingCmd_t, CFE_SB_DisableSubReportingCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_NoopCmd_t, CFE_SB_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_ResetCountersCmd_t, CFE_SB_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_SendSbStatsCmd_t, CFE_SB_SendStatsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_WriteRoutingInfoCmd_t, CFE_SB_WriteRoutingInfoCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_EnableRouteCmd_t, CFE_SB_EnableRouteCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_DisableRouteCmd_t, CFE_SB_DisableRouteCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_WritePipeInfoCmd_t, CFE_SB_WritePipeInfoCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_SB_WriteMapInfoCmd_t, CFE_SB_WriteMapInfoCmd)
+
+/*
+ * Dispatch table for SB subscription reporting commands, indexed by command code
+ * Note: Command counter not incremented for these commands
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_SB_SUB_RPT_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_SEND_PREV_SUBS_CC, CFE_SB_SendPrevSubsCmd_t, CFE_SB_SendPrevSubsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_ENABLE_SUB_REPORTING_CC, CFE_SB_EnableSubReportingCmd_t,
+                              CFE_SB_EnableSubReportingCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_DISABLE_SUB_REPORTING_CC, CFE_SB_DisableSubReportingCmd_t,
+                              CFE_SB_DisableSubReportingCmd),
+};
+
+/*
+ * Dispatch table for SB ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_SB_GROUND_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_NOOP_CC, CFE_SB_NoopCmd_t, CFE_SB_NoopCmd),
+    /* Note: Command counter not incremented for this command */
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_RESET_COUNTERS_CC, CFE_SB_ResetCountersCmd_t, CFE_SB_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_SEND_SB_STATS_CC, CFE_SB_SendSbStatsCmd_t, CFE_SB_SendStatsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_WRITE_ROUTING_INFO_CC, CFE_SB_WriteRoutingInfoCmd_t, CFE_SB_WriteRoutingInfoCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_ENABLE_ROUTE_CC, CFE_SB_EnableRouteCmd_t, CFE_SB_EnableRouteCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_DISABLE_ROUTE_CC, CFE_SB_DisableRouteCmd_t, CFE_SB_DisableRouteCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_WRITE_PIPE_INFO_CC, CFE_SB_WritePipeInfoCmd_t, CFE_SB_WritePipeInfoCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_SB_WRITE_MAP_INFO_CC, CFE_SB_WriteMapInfoCmd_t, CFE_SB_WriteMapInfoCmd),
+};
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
  *
+ * Looks up the command code in the given table, verifies the length,
+ * and invokes the handler.  Generates an error event if not successful.
+ *
  *-----------------------------------------------------------------*/
-void CFE_SB_ProcessSubReportCmd(const CFE_SB_Buffer_t *SBBufPtr)
+void CFE_SB_DispatchCmd(const CFE_SB_Buffer_t *SBBufPtr, const CFE_SB_CmdDispatchEntry_t *Table, size_t NumEntries)
 {
-    CFE_MSG_FcnCode_t FcnCode = 0;
+    CFE_MSG_FcnCode_t                FcnCode = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-    /* Note: Command counter not incremented for this command */
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
-    switch (FcnCode)
+    FcnCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
+
+    Entry = CFE_SB_GetCmdDispatchEntry(Table, NumEntries, FcnCode);
+    if (Entry == NULL)
     {
-        case CFE_SB_SEND_PREV_SUBS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendPrevSubsCmd_t)))
-            {
-                CFE_SB_SendPrevSubsCmd((const CFE_SB_SendPrevSubsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_ENABLE_SUB_REPORTING_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_EnableSubReportingCmd_t)))
-            {
-                CFE_SB_EnableSubReportingCmd((const CFE_SB_EnableSubReportingCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_DISABLE_SUB_REPORTING_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_DisableSubReportingCmd_t)))
-            {
-                CFE_SB_DisableSubReportingCmd((const CFE_SB_DisableSubReportingCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid Cmd, Unexpected Command Code %u", (unsigned int)FcnCode);
-            CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
-            break;
+        CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR, "Invalid Cmd, Unexpected Command Code %u",
+                          (unsigned int)FcnCode);
+        CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
+    }
+    else if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
+    {
+        Entry->Handler(SBBufPtr);
     }
 }
 
@@ -114,76 +143,21 @@ void CFE_SB_ProcessSubReportCmd(const CFE_SB_Buffer_t *SBBufPtr)
  * Local Helper function
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
+void CFE_SB_ProcessSubReportCmd(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t FcnCode = 0;
+    CFE_SB_DispatchCmd(SBBufPtr, CFE_SB_SUB_RPT_DISPATCH_TABLE,
+                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_SB_SUB_RPT_DISPATCH_TABLE));
+}
 
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &FcnCode);
-    switch (FcnCode)
-    {
-        case CFE_SB_NOOP_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_NoopCmd_t)))
-            {
-                CFE_SB_NoopCmd((const CFE_SB_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_RESET_COUNTERS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_ResetCountersCmd_t)))
-            {
-                /* Note: Command counter not incremented for this command */
-                CFE_SB_ResetCountersCmd((const CFE_SB_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_SEND_SB_STATS_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_SendSbStatsCmd_t)))
-            {
-                CFE_SB_SendStatsCmd((const CFE_SB_SendSbStatsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_ROUTING_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteRoutingInfoCmd_t)))
-            {
-                CFE_SB_WriteRoutingInfoCmd((const CFE_SB_WriteRoutingInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_ENABLE_ROUTE_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_EnableRouteCmd_t)))
-            {
-                CFE_SB_EnableRouteCmd((const CFE_SB_EnableRouteCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_DISABLE_ROUTE_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_DisableRouteCmd_t)))
-            {
-                CFE_SB_DisableRouteCmd((const CFE_SB_DisableRouteCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_PIPE_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WritePipeInfoCmd_t)))
-            {
-                CFE_SB_WritePipeInfoCmd((const CFE_SB_WritePipeInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_SB_WRITE_MAP_INFO_CC:
-            if (CFE_SB_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_SB_WriteMapInfoCmd_t)))
-            {
-                CFE_SB_WriteMapInfoCmd((const CFE_SB_WriteMapInfoCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-            CFE_EVS_SendEvent(CFE_SB_BAD_CMD_CODE_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid Cmd, Unexpected Command Code %u", FcnCode);
-            CFE_SB_Global.HKTlmMsg.Payload.CommandErrorCounter++;
-            break;
-    }
+/*----------------------------------------------------------------
+ *
+ * Local Helper function
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
+{
+    CFE_SB_DispatchCmd(SBBufPtr, CFE_SB_GROUND_CMD_DISPATCH_TABLE,
+                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_SB_GROUND_CMD_DISPATCH_TABLE));
 }
 
 /*----------------------------------------------------------------
@@ -208,7 +182,7 @@ void CFE_SB_ProcessCmdPipePkt(const CFE_SB_Buffer_t *SBBufPtr)
         SUB_RPT_CTRL_MID = CFE_SB_ValueToMsgId(CFE_SB_SUB_RPT_CTRL_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    MessageID = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     /* Process all SB messages */
     if (CFE_SB_MsgId_Equal(MessageID, SEND_HK_MID))
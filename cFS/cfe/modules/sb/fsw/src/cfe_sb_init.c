@@ -88,14 +88,9 @@ int32 CFE_SB_EarlyInit(void)
  *-----------------------------------------------------------------*/
 int32 CFE_SB_InitBuffers(void)
 {
-    int32                   Stat = 0;
-    CFE_Config_ArrayValue_t MemPoolDefSize;
-
-    MemPoolDefSize = CFE_Config_GetArrayValue(CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_SIZE);
+    int32 Stat = 0;
 
-    Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
-                               CFE_PLATFORM_SB_BUF_MEMORY_BYTES, MemPoolDefSize.NumElements, MemPoolDefSize.ElementPtr,
-                               CFE_ES_NO_MUTEX);
+    Stat = CFE_SB_CreateBufferPool(CFE_PLATFORM_SB_BUF_MEMORY_SLAB_SIZE);
 
     if (Stat != CFE_SUCCESS)
     {
@@ -114,6 +109,35 @@ int32 CFE_SB_InitBuffers(void)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_CreateBufferPool(size_t SlabSize)
+{
+    int32                   Stat = 0;
+    CFE_Config_ArrayValue_t MemPoolDefSize;
+
+    MemPoolDefSize = CFE_Config_GetArrayValue(CFE_CONFIGID_PLATFORM_SB_MEM_BLOCK_SIZE);
+
+    if (SlabSize == 0)
+    {
+        Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
+                                   CFE_PLATFORM_SB_BUF_MEMORY_BYTES, MemPoolDefSize.NumElements,
+                                   MemPoolDefSize.ElementPtr, CFE_ES_NO_MUTEX);
+    }
+    else
+    {
+        Stat = CFE_ES_PoolCreateSlab(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
+                                     CFE_PLATFORM_SB_BUF_MEMORY_BYTES, MemPoolDefSize.NumElements,
+                                     MemPoolDefSize.ElementPtr, CFE_ES_NO_MUTEX, SlabSize);
+    }
+
+    return Stat;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
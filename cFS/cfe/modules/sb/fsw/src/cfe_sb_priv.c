@@ -117,6 +117,9 @@ int32 CFE_SB_CleanUpApp(CFE_ES_AppId_t AppId)
     /* Release any zero copy buffers */
     CFE_SB_ZeroCopyReleaseAppId(AppId);
 
+    /* Release any buffer rings */
+    CFE_SB_BufferRingReleaseAppId(AppId);
+
     return CFE_SUCCESS;
 }
 
@@ -481,6 +484,83 @@ int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_BufferRing_t *CFE_SB_LocateBufferRing(CFE_SB_MsgId_t MsgId)
+{
+    uint32               i;
+    CFE_SB_BufferRing_t *RingPtr;
+
+    RingPtr = CFE_SB_Global.BufferRings;
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_BUFFER_RINGS; ++i)
+    {
+        if (CFE_RESOURCEID_TEST_DEFINED(RingPtr->AppId) && CFE_SB_MsgId_Equal(RingPtr->MsgId, MsgId))
+        {
+            return RingPtr;
+        }
+        ++RingPtr;
+    }
+
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BufferRingRelease(CFE_SB_BufferRing_t *RingPtr)
+{
+    uint16 i;
+
+    /*
+     * Drop the reference held by the ring.  Buffers not in use by anyone
+     * else are freed now, the others when the last recipient releases them.
+     */
+    for (i = 0; i < RingPtr->NumBuffers; ++i)
+    {
+        CFE_SB_DecrBufUseCnt(RingPtr->Buffers[i]);
+    }
+
+    memset(RingPtr, 0, sizeof(*RingPtr));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_BufferRingReleaseAppId(CFE_ES_AppId_t AppId)
+{
+    uint32               i;
+    CFE_SB_BufferRing_t *RingPtr;
+
+    if (CFE_RESOURCEID_TEST_DEFINED(AppId))
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        RingPtr = CFE_SB_Global.BufferRings;
+        for (i = 0; i < CFE_PLATFORM_SB_MAX_BUFFER_RINGS; ++i)
+        {
+            if (CFE_RESOURCEID_TEST_EQUAL(RingPtr->AppId, AppId))
+            {
+                CFE_SB_BufferRingRelease(RingPtr);
+            }
+            ++RingPtr;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Application-scope internal function
@@ -158,6 +158,27 @@ typedef struct CFE_SB_BufferD
     CFE_SB_Buffer_t Content; /* Variably sized content field, Keep last */
 } CFE_SB_BufferD_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_BufferRing_t
+**
+**  Purpose:
+**     This structure defines a ring of buffers pre-allocated by a publisher
+**     for a single MsgId.
+**
+**     The ring holds one reference on each of its buffers for as long as the
+**     ring exists, so the buffers are never returned to the pool while they are
+**     in transit.  A buffer with a UseCount of 1 is referenced only by the ring
+**     and may be issued to the publisher again.
+*/
+typedef struct
+{
+    CFE_ES_AppId_t    AppId;      /**< Publisher that owns the ring, undefined if the entry is free */
+    CFE_SB_MsgId_t    MsgId;      /**< MsgId the ring was registered for */
+    uint16            NumBuffers; /**< Number of buffers in the ring */
+    uint16            NextBuffer; /**< Position at which to start searching for an idle buffer */
+    CFE_SB_BufferD_t *Buffers[CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH];
+} CFE_SB_BufferRing_t;
+
 /******************************************************************************
 **  Typedef:  CFE_SB_PipeD_t
 **
@@ -257,6 +278,9 @@ typedef struct
 
     /* A list of buffers currently issued to apps for zero-copy */
     CFE_SB_BufferLink_t ZeroCopyList;
+
+    /* Pre-allocated buffer rings registered by publishers */
+    CFE_SB_BufferRing_t BufferRings[CFE_PLATFORM_SB_MAX_BUFFER_RINGS];
 } CFE_SB_Global_t;
 
 /******************************************************************************
@@ -359,6 +383,16 @@ int32 CFE_SB_AppInit(void);
  */
 int32 CFE_SB_InitBuffers(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Create the Software Bus Buffer Pool.
+ *
+ * \param[in] SlabSize Size of each slab in the pool, 0 to not use slabs
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_CreateBufferPool(size_t SlabSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * Initialize the Software Bus Pipe Table.
@@ -478,6 +512,43 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  */
 int32 CFE_SB_ZeroCopyReleaseAppId(CFE_ES_AppId_t AppId);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Locate the buffer ring registered for a MsgId
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param MsgId  The MsgId that the ring was registered for
+ *
+ * @returns Pointer to the ring, or NULL if no ring is registered for the MsgId
+ */
+CFE_SB_BufferRing_t *CFE_SB_LocateBufferRing(CFE_SB_MsgId_t MsgId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Release the buffers of a buffer ring and free the ring entry
+ *
+ * Idle buffers are returned to the pool immediately.  Buffers that are still
+ * in transit are returned once all recipients have finished with them.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * @param RingPtr  Pointer to the ring to release
+ */
+void CFE_SB_BufferRingRelease(CFE_SB_BufferRing_t *RingPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Release all buffer rings owned by the given app ID.
+ *
+ * This function is used for cleaning up when an application exits or crashes.
+ *
+ * @param AppId  Application ID to clean up
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_BufferRingReleaseAppId(CFE_ES_AppId_t AppId);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Increment the UseCount of a buffer
@@ -48,6 +48,18 @@
 #error CFE_PLATFORM_SB_MAX_DEST_PER_PKT cannot be less than 1!
 #endif
 
+#if CFE_PLATFORM_SB_MAX_BUFFER_RINGS < 1
+#error CFE_PLATFORM_SB_MAX_BUFFER_RINGS cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH < 1
+#error CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH cannot be less than 1!
+#endif
+
+#if CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH > 0xFFFF
+#error CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH cannot be greater than 65535!
+#endif
+
 #if CFE_PLATFORM_SB_HIGHEST_VALID_MSGID < 1
 #error CFE_PLATFORM_SB_HIGHEST_VALID_MSGID cannot be less than 1!
 #endif
@@ -64,6 +76,10 @@
 #error CFE_PLATFORM_SB_BUF_MEMORY_BYTES cannot be greater than UINT32_MAX (4 Gigabytes)!
 #endif
 
+#if CFE_PLATFORM_SB_BUF_MEMORY_SLAB_SIZE > CFE_PLATFORM_SB_BUF_MEMORY_BYTES
+#error CFE_PLATFORM_SB_BUF_MEMORY_SLAB_SIZE cannot be greater than CFE_PLATFORM_SB_BUF_MEMORY_BYTES!
+#endif
+
 /*
  * Legacy time formats no longer supported in core cFE, this will pass
  * if default is selected or if both defines are removed
@@ -1476,6 +1476,7 @@ void Test_SB_EarlyInit(void)
 {
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SemCreateError);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_PoolCreateError);
+    SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_SlabPool);
     SB_UT_ADD_SUBTEST(Test_SB_EarlyInit_NoErrors);
 }
 
@@ -1497,6 +1498,27 @@ void Test_SB_EarlyInit_PoolCreateError(void)
     UtAssert_INT32_EQ(CFE_SB_EarlyInit(), CFE_ES_BAD_ARGUMENT);
 }
 
+/*
+** Test creation of the buffer pool with slabs
+*/
+void Test_SB_EarlyInit_SlabPool(void)
+{
+    UT_ResetState(UT_KEY(CFE_ES_PoolCreateEx));
+    UT_ResetState(UT_KEY(CFE_ES_PoolCreateSlab));
+
+    CFE_UtAssert_SUCCESS(CFE_SB_CreateBufferPool(4096));
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateSlab, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateEx, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_PoolCreateSlab), 1, CFE_ES_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferPool(4096), CFE_ES_BAD_ARGUMENT);
+
+    /* Without a slab size the pool is created as before */
+    CFE_UtAssert_SUCCESS(CFE_SB_CreateBufferPool(0));
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateEx, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PoolCreateSlab, 2);
+}
+
 /*
 ** Test successful early initialization
 */
@@ -1863,6 +1885,7 @@ void Test_PipeOpts_API(void)
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadID);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts_BadPtr);
     SB_UT_ADD_SUBTEST(Test_GetPipeOpts);
+    SB_UT_ADD_SUBTEST(Test_GetPipeWaitId);
 }
 
 /*
@@ -2020,6 +2043,27 @@ void Test_GetPipeIdByName(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Get the OSAL wait ID for a pipe
+*/
+void Test_GetPipeWaitId(void)
+{
+    CFE_SB_PipeId_t PipeId = SB_UT_PIPEID_0;
+    osal_id_t       WaitId;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "TestPipe1"));
+
+    WaitId = OS_OBJECT_ID_UNDEFINED;
+    CFE_UtAssert_SUCCESS(CFE_SB_GetPipeWaitId(PipeId, &WaitId));
+    UtAssert_True(OS_ObjectIdEqual(WaitId, CFE_SB_LocatePipeDescByID(PipeId)->SysQueueId),
+                  "WaitId matches SysQueueId");
+
+    UtAssert_INT32_EQ(CFE_SB_GetPipeWaitId(PipeId, NULL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_GetPipeWaitId(SB_UT_ALTERNATE_INVALID_PIPEID, &WaitId), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
 /*
 ** Try setting pipe options on an invalid pipe ID
 */
@@ -3412,6 +3456,9 @@ void Test_TransmitMsg_API(void)
 
     SB_UT_ADD_SUBTEST(Test_AllocateMessageBuffer);
     SB_UT_ADD_SUBTEST(Test_ReleaseMessageBuffer);
+    SB_UT_ADD_SUBTEST(Test_CreateBufferRing);
+    SB_UT_ADD_SUBTEST(Test_GetRingBuffer);
+    SB_UT_ADD_SUBTEST(Test_DeleteBufferRing);
 }
 
 /*
@@ -4011,6 +4058,169 @@ void Test_ReleaseMessageBuffer(void)
     CFE_UtAssert_EVENTCOUNT(0);
 }
 
+/*
+** Test creating a ring of pre-allocated buffers
+*/
+void Test_CreateBufferRing(void)
+{
+    CFE_SB_MsgId_t MsgId   = SB_UT_TLM_MID;
+    size_t         MsgSize = sizeof(SB_UT_Test_Tlm_t);
+    uint32         i;
+
+    /* Bad arguments */
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(CFE_SB_INVALID_MSG_ID, MsgSize, 2), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(MsgId, CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1, 2), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(MsgId, MsgSize, 0), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(MsgId, MsgSize, CFE_PLATFORM_SB_MAX_BUFFER_RING_DEPTH + 1),
+                      CFE_SB_BAD_ARGUMENT);
+
+    /* Called from a non-CFE context */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(MsgId, MsgSize, 2), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Nominal, all buffers are allocated up front */
+    CFE_UtAssert_SUCCESS(CFE_SB_CreateBufferRing(MsgId, MsgSize, 2));
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 2);
+    UtAssert_NOT_NULL(CFE_SB_LocateBufferRing(MsgId));
+
+    /* Only one ring per MsgId */
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(MsgId, MsgSize, 2), CFE_SB_BAD_ARGUMENT);
+
+    /* Pool exhausted part way through, the buffers already obtained are returned */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetPoolBuf), 2, CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(SB_UT_TLM_MID1, MsgSize, 2), CFE_SB_BUF_ALOC_ERR);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_NULL(CFE_SB_LocateBufferRing(SB_UT_TLM_MID1));
+
+    /* No free ring entries */
+    for (i = 0; i < CFE_PLATFORM_SB_MAX_BUFFER_RINGS; ++i)
+    {
+        CFE_SB_Global.BufferRings[i].AppId = CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2));
+    }
+    UtAssert_INT32_EQ(CFE_SB_CreateBufferRing(SB_UT_TLM_MID2, MsgSize, 2), CFE_SB_BUF_ALOC_ERR);
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
+/*
+** Test getting buffers from a ring and recycling them once all recipients are done
+*/
+void Test_GetRingBuffer(void)
+{
+    CFE_SB_Buffer_t *SendPtr1   = NULL;
+    CFE_SB_Buffer_t *SendPtr2   = NULL;
+    CFE_SB_Buffer_t *ReceivePtr = NULL;
+    CFE_SB_PipeId_t  PipeId     = CFE_SB_INVALID_PIPE;
+    CFE_SB_MsgId_t   MsgId      = SB_UT_TLM_MID;
+    CFE_MSG_Size_t   Size       = sizeof(SB_UT_Test_Tlm_t);
+    CFE_MSG_Type_t   Type       = CFE_MSG_Type_Tlm;
+    CFE_ES_AppId_t   AppID;
+    uint32           PoolBufCount;
+
+    CFE_ES_GetAppID(&AppID);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 4, "RingTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferRing(MsgId, sizeof(SB_UT_Test_Tlm_t), 2));
+    UT_ClearEventHistory(); /* Clear events generated during test setup */
+    PoolBufCount = UT_GetStubCount(UT_KEY(CFE_ES_GetPoolBuf));
+
+    /* No ring for this MsgId */
+    UtAssert_NULL(CFE_SB_GetRingBuffer(SB_UT_TLM_MID1));
+
+    /* Called from a non-CFE context */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_NULL(CFE_SB_GetRingBuffer(MsgId));
+
+    /* Ring owned by a different app */
+    UT_SetAppID(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_NULL(CFE_SB_GetRingBuffer(MsgId));
+    UT_SetAppID(AppID);
+
+    /* Send from both buffers, these are now queued on the pipe */
+    SendPtr1 = CFE_SB_GetRingBuffer(MsgId);
+    UtAssert_NOT_NULL(SendPtr1);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBuffer(SendPtr1, true));
+    SendPtr2 = CFE_SB_GetRingBuffer(MsgId);
+    UtAssert_NOT_NULL(SendPtr2);
+    UtAssert_True(SendPtr1 != SendPtr2, "Ring buffers are distinct");
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitBuffer(SendPtr2, true));
+
+    /* All buffers are in use */
+    UtAssert_NULL(CFE_SB_GetRingBuffer(MsgId));
+
+    /* The recipient holds the first buffer until it receives the next one */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr1);
+    UtAssert_NULL(CFE_SB_GetRingBuffer(MsgId));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&ReceivePtr, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_ADDRESS_EQ(ReceivePtr, SendPtr2);
+
+    /* The first buffer is reused rather than allocating a new one */
+    UtAssert_ADDRESS_EQ(CFE_SB_GetRingBuffer(MsgId), SendPtr1);
+
+    /* A buffer given back unsent returns to the ring */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr1));
+    UtAssert_ADDRESS_EQ(CFE_SB_GetRingBuffer(MsgId), SendPtr1);
+
+    /* None of this should have used the pool */
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, PoolBufCount);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+}
+
+/*
+** Test deleting a ring of pre-allocated buffers
+*/
+void Test_DeleteBufferRing(void)
+{
+    CFE_SB_Buffer_t *SendPtr = NULL;
+    CFE_SB_MsgId_t   MsgId   = SB_UT_TLM_MID;
+    CFE_ES_AppId_t   AppID;
+
+    CFE_ES_GetAppID(&AppID);
+
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferRing(MsgId, sizeof(SB_UT_Test_Tlm_t), 2));
+    SendPtr = CFE_SB_GetRingBuffer(MsgId);
+    UtAssert_NOT_NULL(SendPtr);
+
+    /* Called from a non-CFE context */
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_GetAppID), 1, CFE_ES_ERR_RESOURCEID_NOT_VALID);
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferRing(MsgId), CFE_ES_ERR_RESOURCEID_NOT_VALID);
+
+    /* Only the owner may delete the ring */
+    UT_SetAppID(CFE_ES_APPID_C(CFE_ResourceId_FromInteger(2)));
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferRing(MsgId), CFE_SB_BAD_ARGUMENT);
+    UT_SetAppID(AppID);
+
+    /* The idle buffer is freed now, the issued one when it is released */
+    CFE_UtAssert_SUCCESS(CFE_SB_DeleteBufferRing(MsgId));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_NULL(CFE_SB_LocateBufferRing(MsgId));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseMessageBuffer(SendPtr));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    /* Ring no longer exists */
+    UtAssert_INT32_EQ(CFE_SB_DeleteBufferRing(MsgId), CFE_SB_BAD_ARGUMENT);
+
+    /* Rings are released when the owning app is cleaned up */
+    CFE_UtAssert_SETUP(CFE_SB_CreateBufferRing(MsgId, sizeof(SB_UT_Test_Tlm_t), 2));
+    CFE_UtAssert_SUCCESS(CFE_SB_BufferRingReleaseAppId(CFE_ES_APPID_UNDEFINED));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+    CFE_UtAssert_SUCCESS(CFE_SB_BufferRingReleaseAppId(AppID));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 4);
+    UtAssert_NULL(CFE_SB_LocateBufferRing(MsgId));
+
+    CFE_UtAssert_EVENTCOUNT(0);
+}
+
 /*
 ** Test send message response with the destination disabled
 */
@@ -673,6 +673,22 @@ void Test_GetPipeIdByName_InvalidName(void);
 ******************************************************************************/
 void Test_GetPipeIdByName(void);
 
+/*****************************************************************************/
+/**
+** \brief Test getting the OSAL wait ID of a pipe
+**
+** \par Description
+**        This function tests getting the wait ID of a valid pipe, and the
+**        responses to a null output pointer and an invalid pipe id.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetPipeWaitId(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send pipe information command default / nominal path
@@ -1108,6 +1124,22 @@ void Test_SB_EarlyInit_SemCreateError(void);
 ******************************************************************************/
 void Test_SB_EarlyInit_PoolCreateError(void);
 
+/*****************************************************************************/
+/**
+** \brief Test creation of the buffer pool with slabs
+**
+** \par Description
+**        This function tests that the buffer pool is created with slabs
+**        when a slab size is given, and the response to a failure.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_SB_EarlyInit_SlabPool(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test successful early initialization
@@ -2045,6 +2077,54 @@ void Test_TransmitBuffer_NoIncrement(void);
 ******************************************************************************/
 void Test_ReleaseMessageBuffer(void);
 
+/*****************************************************************************/
+/**
+** \brief Test creating a ring of pre-allocated buffers
+**
+** \par Description
+**        This function tests creating a buffer ring, including argument
+**        validation and allocation failures.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_CreateBufferRing(void);
+
+/*****************************************************************************/
+/**
+** \brief Test getting buffers from a buffer ring
+**
+** \par Description
+**        This function tests that ring buffers are issued only when idle, and
+**        are reused once all recipients have released them.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_GetRingBuffer(void);
+
+/*****************************************************************************/
+/**
+** \brief Test deleting a buffer ring
+**
+** \par Description
+**        This function tests deleting a buffer ring, directly and as part of
+**        the cleanup of the owning application.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeleteBufferRing(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test send message response with the destination disabled
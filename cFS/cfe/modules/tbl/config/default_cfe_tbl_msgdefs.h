@@ -65,6 +65,9 @@ typedef struct CFE_TBL_DumpCmd_Payload
     char DumpFilename[CFE_MISSION_MAX_PATH_LEN];       /**< \brief Full Filename where data is to be written */
                                                        /**< ASCII string containing full path of filename
                                                             where data is to be dumped */
+    uint8 CompressFlag;                                /**< \brief Nonzero to write the table image in
+                                                            compressed blocks */
+    uint8 Spare;                                       /**< \brief Pad to 32 bit boundary */
 } CFE_TBL_DumpCmd_Payload_t;
 
 /**
@@ -165,6 +165,10 @@
 **  \par Description
 **       This command will cause the Table Services to put the contents
 **       of the specified table buffer into the command specified file.
+**       If the command's CompressFlag is set, the table image following the
+**       file headers is written in compressed blocks, which can be read with
+**       CFE_FS_ReadBlock().  Such a file is for ground analysis only, it cannot
+**       be loaded back with #CFE_TBL_LOAD_CC.
 **
 **  \cfecmdmnemonic \TBL_DUMP
 **
@@ -31,78 +31,57 @@
 ** Required header files
 */
 #include "cfe_tbl_module_all.h"
+#include "cfe_msg_inline.h"
 
 #include <string.h>
 
 /*********************  Macro and Constant Type Definitions   ***************************/
 
-typedef CFE_Status_t (*CFE_TBL_MsgProcFuncPtr_t)(const void *MsgPtr);
-
-CFE_Status_t CFE_TBL_SearchCmdHandlerTbl(uint16 *TableIdxOut, CFE_SB_MsgId_t MessageID, uint16 CommandCode);
-
-/*
-** Table task const data
-*/
-
-typedef enum
-{
-    CFE_TBL_TERM_MSGTYPE = 0, /**< \brief Command Handler Table Terminator Type */
-    CFE_TBL_MSG_MSGTYPE  = 1, /**< \brief Message Type (requires Message ID match) */
-    CFE_TBL_CMD_MSGTYPE  = 2  /**< \brief Command Type (requires Message ID and Command Code match) */
-} CFE_TBL_MsgType_t;
+CFE_Status_t CFE_TBL_GetCmdDispatchEntry(const CFE_SB_CmdDispatchEntry_t **EntryOut, CFE_SB_MsgId_t MessageID,
+                                         CFE_MSG_FcnCode_t CommandCode);
 
 /* local cache of runtime MsgIDs for TBL */
 static CFE_SB_MsgId_t CFE_TBL_SEND_HK_MID_CACHE = CFE_SB_MSGID_RESERVED;
 static CFE_SB_MsgId_t CFE_TBL_CMD_MID_CACHE     = CFE_SB_MSGID_RESERVED;
 
-/**
-** Data structure of a single record in #CFE_TBL_CmdHandlerTbl
-*/
-typedef struct
-{
-    const CFE_SB_MsgId_t *   MsgId;
-    CFE_MSG_FcnCode_t        CmdCode;        /**< \brief Acceptable Command Code (if necessary) */
-    size_t                   ExpectedLength; /**< \brief Expected Message Length (in bytes) including message header */
-    CFE_TBL_MsgProcFuncPtr_t MsgProcFuncPtr; /**< \brief Pointer to function to handle message  */
-    CFE_TBL_MsgType_t        MsgTypes;       /**< \brief Message Type (i.e. - with/without Cmd Code)   */
-} CFE_TBL_CmdHandlerTblRec_t;
+/* Constant Data */
 
 /*
- * Macros to assist in building the CFE_TBL_CmdHandlerTbl -
- *  For command handler entries, which have a command code, payload type, and a handler function
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
  */
-#define CFE_TBL_ENTRY(id, ccode, paramtype, handlerfunc, msgtype)                             \
-    {                                                                                         \
-        &id##_CACHE, ccode, sizeof(paramtype), (CFE_TBL_MsgProcFuncPtr_t)handlerfunc, msgtype \
-    }
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_SendHkCmd_t, CFE_TBL_SendHkCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_NoopCmd_t, CFE_TBL_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_ResetCountersCmd_t, CFE_TBL_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_LoadCmd_t, CFE_TBL_LoadCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_DumpCmd_t, CFE_TBL_DumpCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_ValidateCmd_t, CFE_TBL_ValidateCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_ActivateCmd_t, CFE_TBL_ActivateCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_DumpRegistryCmd_t, CFE_TBL_DumpRegistryCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_SendRegistryCmd_t, CFE_TBL_SendRegistryCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_DeleteCDSCmd_t, CFE_TBL_DeleteCDSCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TBL_AbortLoadCmd_t, CFE_TBL_AbortLoadCmd)
 
-/* Constant Data */
+/*
+ * Entry for the SEND_HK message, which does not have a command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_TBL_SEND_HK_DISPATCH = {CFE_TBL_SendHkCmd_Dispatch,
+                                                                   sizeof(CFE_TBL_SendHkCmd_t)};
 
-const CFE_TBL_CmdHandlerTblRec_t CFE_TBL_CmdHandlerTbl[] = {
-    /* SEND_HK Entry */
-    CFE_TBL_ENTRY(CFE_TBL_SEND_HK_MID, 0, CFE_TBL_SendHkCmd_t, CFE_TBL_SendHkCmd, CFE_TBL_MSG_MSGTYPE),
-
-    /* Everything else */
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_NOOP_CC, CFE_TBL_NoopCmd_t, CFE_TBL_NoopCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_RESET_COUNTERS_CC, CFE_TBL_ResetCountersCmd_t, CFE_TBL_ResetCountersCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_LOAD_CC, CFE_TBL_LoadCmd_t, CFE_TBL_LoadCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_DUMP_CC, CFE_TBL_DumpCmd_t, CFE_TBL_DumpCmd, CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_VALIDATE_CC, CFE_TBL_ValidateCmd_t, CFE_TBL_ValidateCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_ACTIVATE_CC, CFE_TBL_ActivateCmd_t, CFE_TBL_ActivateCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_DUMP_REGISTRY_CC, CFE_TBL_DumpRegistryCmd_t, CFE_TBL_DumpRegistryCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_SEND_REGISTRY_CC, CFE_TBL_SendRegistryCmd_t, CFE_TBL_SendRegistryCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_DELETE_CDS_CC, CFE_TBL_DeleteCDSCmd_t, CFE_TBL_DeleteCDSCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-    CFE_TBL_ENTRY(CFE_TBL_CMD_MID, CFE_TBL_ABORT_LOAD_CC, CFE_TBL_AbortLoadCmd_t, CFE_TBL_AbortLoadCmd,
-                  CFE_TBL_CMD_MSGTYPE),
-
-    /* list terminator (keep last) */
-    {0, 0, 0, NULL, CFE_TBL_TERM_MSGTYPE}};
+/*
+ * Dispatch table for TBL ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_TBL_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_NOOP_CC, CFE_TBL_NoopCmd_t, CFE_TBL_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_RESET_COUNTERS_CC, CFE_TBL_ResetCountersCmd_t, CFE_TBL_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_LOAD_CC, CFE_TBL_LoadCmd_t, CFE_TBL_LoadCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_DUMP_CC, CFE_TBL_DumpCmd_t, CFE_TBL_DumpCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_VALIDATE_CC, CFE_TBL_ValidateCmd_t, CFE_TBL_ValidateCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_ACTIVATE_CC, CFE_TBL_ActivateCmd_t, CFE_TBL_ActivateCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_DUMP_REGISTRY_CC, CFE_TBL_DumpRegistryCmd_t, CFE_TBL_DumpRegistryCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_SEND_REGISTRY_CC, CFE_TBL_SendRegistryCmd_t, CFE_TBL_SendRegistryCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_DELETE_CDS_CC, CFE_TBL_DeleteCDSCmd_t, CFE_TBL_DeleteCDSCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TBL_ABORT_LOAD_CC, CFE_TBL_AbortLoadCmd_t, CFE_TBL_AbortLoadCmd),
+};
 
 /******************************************************************************/
 
@@ -114,34 +93,32 @@ const CFE_TBL_CmdHandlerTblRec_t CFE_TBL_CmdHandlerTbl[] = {
  *-----------------------------------------------------------------*/
 void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_SB_MsgId_t    MessageID;
-    CFE_MSG_FcnCode_t CommandCode;
-    uint16            CmdIndx;
-    CFE_MSG_Size_t    ActualLength;
-    CFE_MSG_Size_t    ExpectedLength;
-    CFE_Status_t      CmdStatus;
+    CFE_SB_MsgId_t                   MessageID;
+    CFE_MSG_FcnCode_t                CommandCode;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
+    CFE_MSG_Size_t                   ActualLength;
+    CFE_Status_t                     CmdStatus;
 
-    MessageID      = CFE_SB_INVALID_MSG_ID;
-    CommandCode    = 0;
-    ActualLength   = 0;
+    MessageID    = CFE_SB_INVALID_MSG_ID;
+    CommandCode  = 0;
+    ActualLength = 0;
+    Entry        = NULL;
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
+    MessageID   = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
+    CommandCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
-    /* Search the Command Handler Table for a matching message */
-    CmdStatus = CFE_TBL_SearchCmdHandlerTbl(&CmdIndx, MessageID, CommandCode);
+    /* Look up the handler for the message */
+    CmdStatus = CFE_TBL_GetCmdDispatchEntry(&Entry, MessageID, CommandCode);
 
     /* Check to see if a matching command was found */
     if (CmdStatus == CFE_SUCCESS)
     {
         /* Verify Message Length before processing */
-        CFE_MSG_GetSize(&SBBufPtr->Msg, &ActualLength);
-        ExpectedLength = CFE_TBL_CmdHandlerTbl[CmdIndx].ExpectedLength;
-
-        if (ActualLength == ExpectedLength)
+        ActualLength = CFE_MSG_InlineGetSize(&SBBufPtr->Msg);
+        if (ActualLength == Entry->ExpectedLength)
         {
             /* All checks have passed, call the appropriate message handler */
-            CmdStatus = (CFE_TBL_CmdHandlerTbl[CmdIndx].MsgProcFuncPtr)(SBBufPtr);
+            CmdStatus = Entry->Handler(SBBufPtr);
         }
         else /* Bad Message Length */
         {
@@ -156,7 +133,7 @@ void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
             CFE_EVS_SendEvent(CFE_TBL_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                               "Invalid msg length -- ID = 0x%X, CC = %u, Len = %u, Expected = %u",
                               (unsigned int)CFE_SB_MsgIdToValue(MessageID), (unsigned int)CommandCode,
-                              (unsigned int)ActualLength, (unsigned int)CFE_TBL_CmdHandlerTbl[CmdIndx].ExpectedLength);
+                              (unsigned int)ActualLength, (unsigned int)Entry->ExpectedLength);
         }
         else if (CmdStatus == CFE_STATUS_BAD_COMMAND_CODE)
         {
@@ -181,15 +158,10 @@ void CFE_TBL_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_Status_t CFE_TBL_SearchCmdHandlerTbl(uint16 *TableIdxOut, CFE_SB_MsgId_t MessageID, uint16 CommandCode)
+CFE_Status_t CFE_TBL_GetCmdDispatchEntry(const CFE_SB_CmdDispatchEntry_t **EntryOut, CFE_SB_MsgId_t MessageID,
+                                         CFE_MSG_FcnCode_t CommandCode)
 {
-    int16        TblIndx;
     CFE_Status_t Status;
-    bool         FoundMsg;
-    bool         FoundMatch;
-
-    FoundMsg   = false;
-    FoundMatch = false;
 
     /* cache the local MID Values here, this avoids repeat lookups */
     if (!CFE_SB_IsValidMsgId(CFE_TBL_CMD_MID_CACHE))
@@ -198,46 +170,26 @@ CFE_Status_t CFE_TBL_SearchCmdHandlerTbl(uint16 *TableIdxOut, CFE_SB_MsgId_t Mes
         CFE_TBL_SEND_HK_MID_CACHE = CFE_SB_ValueToMsgId(CFE_TBL_SEND_HK_MID);
     }
 
-    for (TblIndx = 0; CFE_TBL_CmdHandlerTbl[TblIndx].MsgId != NULL; ++TblIndx)
+    if (CFE_SB_MsgId_Equal(MessageID, CFE_TBL_SEND_HK_MID_CACHE))
     {
-        /* Check to see if we found a matching Message ID */
-        if (CFE_SB_MsgId_Equal(*CFE_TBL_CmdHandlerTbl[TblIndx].MsgId, MessageID))
-        {
-            /* Flag any found message IDs so that if there is an error,        */
-            /* we can determine if it was a bad message ID or bad command code */
-            FoundMsg = true;
-
-            /* If entry in the Command Handler Table is a command entry, */
-            /* then check for a matching command code                    */
-            if (CFE_TBL_CmdHandlerTbl[TblIndx].MsgTypes == CFE_TBL_CMD_MSGTYPE)
-            {
-                if (CFE_TBL_CmdHandlerTbl[TblIndx].CmdCode == CommandCode)
-                {
-                    /* Found matching message ID and Command Code */
-                    FoundMatch = true;
-                    break;
-                }
-            }
-            else /* Message is not a command message with specific command code */
-            {
-                /* Automatically assume a match when legit */
-                /* Message ID is all that is required      */
-                FoundMatch = true;
-                break;
-            }
-        }
+        /* Message ID is all that is required */
+        *EntryOut = &CFE_TBL_SEND_HK_DISPATCH;
+        Status    = CFE_SUCCESS;
     }
-
-    /* If we failed to find a match, return a negative index */
-    if (FoundMatch)
+    else if (CFE_SB_MsgId_Equal(MessageID, CFE_TBL_CMD_MID_CACHE))
     {
-        Status       = CFE_SUCCESS;
-        *TableIdxOut = TblIndx;
-    }
-    else if (FoundMsg)
-    {
-        /* A matching message ID was found, so the command code must be bad */
-        Status = CFE_STATUS_BAD_COMMAND_CODE;
+        /* Command messages also require a matching command code */
+        *EntryOut = CFE_SB_GetCmdDispatchEntry(CFE_TBL_CMD_DISPATCH_TABLE,
+                                               CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_TBL_CMD_DISPATCH_TABLE), CommandCode);
+        if (*EntryOut != NULL)
+        {
+            Status = CFE_SUCCESS;
+        }
+        else
+        {
+            /* A matching message ID was found, so the command code must be bad */
+            Status = CFE_STATUS_BAD_COMMAND_CODE;
+        }
     }
     else /* No matching message ID was found */
     {
@@ -148,6 +148,12 @@ CFE_Status_t CFE_TBL_WriteSnapshotToFile(const CFE_TBL_DumpControl_t *DumpCtlPtr
     FileHeader.Std.TimeSeconds    = DumpCtlPtr->DumpBufferPtr->FileTime.Seconds;
     FileHeader.Std.TimeSubSeconds = DumpCtlPtr->DumpBufferPtr->FileTime.Subseconds;
 
+    /* Only the table image is compressed, the table header stays readable as-is */
+    if (DumpCtlPtr->Compress)
+    {
+        FileHeader.Std.ContentType = CFE_FS_COMPRESSED_FILE_CONTENT_ID;
+    }
+
     /* Initialize the Table Image Header for the Dump File */
     strncpy(FileHeader.Tbl.TableName, DumpCtlPtr->TableName, sizeof(FileHeader.Tbl.TableName) - 1);
     FileHeader.Tbl.NumBytes = DumpDataSize;
@@ -173,13 +179,17 @@ CFE_Status_t CFE_TBL_WriteSnapshotToFile(const CFE_TBL_DumpControl_t *DumpCtlPtr
     {
         /* Output the requested data to the dump file */
         /* Output the active table image data to the dump file */
-        OsStatus = OS_write(FileDescriptor, DumpDataAddr, DumpDataSize);
+        Status = CFE_FS_WriteBlock(FileDescriptor, &FileHeader.Std, DumpDataAddr, DumpDataSize);
 
-        if (OsStatus != DumpDataSize)
+        if (Status != DumpDataSize)
         {
-            CFE_TBL_TxnAddEvent(&Txn, CFE_TBL_WRITE_TBL_IMG_ERR_EID, OsStatus, 0);
+            CFE_TBL_TxnAddEvent(&Txn, CFE_TBL_WRITE_TBL_IMG_ERR_EID, Status, 0);
             Status = CFE_TBL_ERR_ACCESS;
         }
+        else
+        {
+            Status = CFE_SUCCESS;
+        }
 
         /* We are done outputting data to the dump file.  Close it. */
         OS_close(FileDescriptor);
@@ -262,7 +272,7 @@ CFE_Status_t CFE_TBL_ExecuteDumpSnapshot(CFE_TBL_DumpControl_t *DumpCtrlPtr)
  *
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_TBL_PrepareDumpSnapshotBuffer(CFE_TBL_TxnState_t *Txn, CFE_TBL_DumpCtrlId_t DumpCtrlId,
-                                               const char *DumpFilename)
+                                               const char *DumpFilename, bool Compress)
 {
     CFE_Status_t           Status;
     CFE_TBL_LoadBuff_t *   WorkingBufferPtr;
@@ -293,6 +303,7 @@ CFE_Status_t CFE_TBL_PrepareDumpSnapshotBuffer(CFE_TBL_TxnState_t *Txn, CFE_TBL_
         else
         {
             DumpCtrlPtr->DumpBufferPtr = WorkingBufferPtr;
+            DumpCtrlPtr->Compress      = Compress;
 
             if (CFE_TBL_RegRecGetConfig(RegRecPtr)->DumpOnly)
             {
@@ -78,12 +78,13 @@ CFE_Status_t CFE_TBL_WriteHeaders(CFE_TBL_TxnState_t *Txn, osal_id_t FileDescrip
  * \param[inout] Txn            Pointer to transaction object
  * \param[in]    DumpCtrlId     Identifier of dump control block
  * \param[in]    DumpFilename   Pending filename to write to
+ * \param[in]    Compress       Whether to write the table image in compressed blocks
  *
  * \returns CFE Status Code
  * \retval #CFE_SUCCESS                     \copydoc CFE_SUCCESS
  */
 CFE_Status_t CFE_TBL_PrepareDumpSnapshotBuffer(CFE_TBL_TxnState_t *Txn, CFE_TBL_DumpCtrlId_t DumpCtrlId,
-                                               const char *DumpFilename);
+                                               const char *DumpFilename, bool Compress);
 
 /*---------------------------------------------------------------------------------------*/
 /**
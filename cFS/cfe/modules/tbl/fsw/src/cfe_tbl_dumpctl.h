@@ -66,6 +66,7 @@ struct CFE_TBL_DumpControl
     CFE_TBL_DumpState_t  State;         /**< \brief Current state of this block of data */
     CFE_TBL_LoadBuff_t * DumpBufferPtr; /**< \brief Address where dumped data is to be stored temporarily */
     CFE_TBL_LoadBuffId_t SourceBuffId;  /**< \brief Identifier of buffer to dump */
+    bool                 Compress;      /**< \brief Whether to write the image in compressed blocks */
     char                 TableName[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Name of Table being Dumped */
 };
 
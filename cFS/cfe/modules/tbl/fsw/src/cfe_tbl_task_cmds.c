@@ -490,7 +490,7 @@ CFE_Status_t CFE_TBL_DumpCmd(const CFE_TBL_DumpCmd_t *data)
         if (Status == CFE_SUCCESS)
         {
             /* Complete the process */
-            Status = CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, DumpFilename);
+            Status = CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, DumpFilename, CmdPtr->CompressFlag != 0);
         }
 
         CFE_TBL_TxnFinish(&Txn);
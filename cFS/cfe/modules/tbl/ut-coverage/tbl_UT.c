@@ -535,6 +535,20 @@ void Test_CFE_TBL_ActivateCmd(void)
     CFE_UtAssert_COUNTER_INCR(CFE_TBL_Global.CommandErrorCounter);
 }
 
+/*
+** Hook to capture the content type of the file written by CFE_FS_WriteBlock
+*/
+static int32 UT_TBL_WriteBlockHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    const CFE_FS_Header_t *Hdr     = UT_Hook_GetArgValueByName(Context, "Hdr", const CFE_FS_Header_t *);
+    size_t                 BufSize = UT_Hook_GetArgValueByName(Context, "BufSize", size_t);
+
+    *((uint32 *)UserObj) = Hdr->ContentType;
+
+    /* Report the whole block as written */
+    return BufSize;
+}
+
 /*
 ** Test the write table data to a file function
 */
@@ -545,6 +559,7 @@ void Test_CFE_TBL_DumpToFile(void)
 
     CFE_TBL_DumpControl_t *DumpCtlPtr;
     CFE_TBL_LoadBuff_t *   BuffPtr;
+    uint32                 ContentType;
 
     BuffPtr = UT_TBL_SetupLoadBuff(NULL, false, 0);
     UT_TBL_SetupPendingDump(0, BuffPtr, NULL, &DumpCtlPtr);
@@ -578,7 +593,7 @@ void Test_CFE_TBL_DumpToFile(void)
 
     /* Test with an error writing the table to a file */
     UT_InitData_TBL();
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, TblSizeInBytes - 1);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteBlock), 1, TblSizeInBytes - 1);
     UtAssert_INT32_EQ(CFE_TBL_WriteSnapshotToFile(DumpCtlPtr), CFE_TBL_ERR_ACCESS);
 
     /* Test successful file creation and data dumped */
@@ -589,6 +604,15 @@ void Test_CFE_TBL_DumpToFile(void)
     /* Test where file already exists so data is overwritten */
     UT_InitData_TBL();
     UtAssert_INT32_EQ(CFE_TBL_WriteSnapshotToFile(DumpCtlPtr), CFE_SUCCESS);
+
+    /* Test a compressed dump, which is marked in the cFE file header passed to the writer */
+    UT_InitData_TBL();
+    ContentType          = 0;
+    DumpCtlPtr->Compress = true;
+    UT_SetHookFunction(UT_KEY(CFE_FS_WriteBlock), UT_TBL_WriteBlockHook, &ContentType);
+    UtAssert_INT32_EQ(CFE_TBL_WriteSnapshotToFile(DumpCtlPtr), CFE_SUCCESS);
+    UtAssert_UINT32_EQ(ContentType, CFE_FS_COMPRESSED_FILE_CONTENT_ID);
+    DumpCtlPtr->Compress = false;
 }
 
 /*
@@ -1182,6 +1206,7 @@ void Test_CFE_TBL_DumpCmd(void)
      * table due to user defined address
      */
     UT_InitData_TBL();
+    UT_TBL_SetLoadBuffFree(CFE_TBL_LocateLoadBufferByID(UT_CFE_TBL_LOADBUFFID_GLB_0));
     UT_TBL_Status(RegRecPtr)->NextBufferId = UT_CFE_TBL_LOADBUFFID_GLB_0;
     UT_TBL_Config(RegRecPtr)->UserDefAddr  = true;
     UtAssert_INT32_EQ(CFE_TBL_DumpCmd(&DumpCmd), CFE_SUCCESS);
@@ -2007,24 +2032,26 @@ void Test_CFE_TBL_TableDumpCommon(void)
 
     /* Test cases focusing on the following APIs:
      * CFE_Status_t CFE_TBL_PrepareDumpSnapshotBuffer(CFE_TBL_TxnState_t *Txn, CFE_TBL_DumpCtrlId_t DumpCtrlId,
-     *                                          const char *DumpFilename);
+     *                                          const char *DumpFilename, bool Compress);
      */
     UT_SetDeferredRetcode(UT_KEY(CFE_ResourceId_FindNextEx), 1, -1);
-    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename), CFE_TBL_ERR_NO_BUFFER_AVAIL);
+    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename, false),
+                      CFE_TBL_ERR_NO_BUFFER_AVAIL);
     UT_TBL_EVENT_PENDING(&Txn, CFE_TBL_NO_WORK_BUFFERS_ERR_EID);
     UT_ResetState(UT_KEY(CFE_ResourceId_FindNextEx));
 
     /* Forcibly drop the dump ctrl buffer to make a stale ID situation */
     DumpCtrlPtr = CFE_TBL_LocateDumpCtrlByID(DumpCtrlId);
     CFE_TBL_DumpCtrlBlockSetFree(DumpCtrlPtr);
-    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename), CFE_TBL_ERR_INVALID_HANDLE);
+    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename, false),
+                      CFE_TBL_ERR_INVALID_HANDLE);
     CFE_TBL_DumpCtrlBlockSetFree(DumpCtrlPtr);
 
     /* Nominal success case, dump only table - should leave it in the pending state */
     UT_TBL_Config(RegRecPtr)->DumpOnly = true;
     UT_TBL_SetupPendingDump(1, NULL, RegRecPtr, &DumpCtrlPtr);
     RegRecPtr->DumpControlId = CFE_TBL_DumpCtrlBlockGetId(DumpCtrlPtr);
-    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename, false), CFE_SUCCESS);
     UtAssert_UINT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_PENDING);
 
     /* Nominal success case, normal table, should actually do the dump */
@@ -2032,8 +2059,9 @@ void Test_CFE_TBL_TableDumpCommon(void)
     UT_TBL_SetupPendingDump(0, NULL, RegRecPtr, &DumpCtrlPtr);
     DumpCtrlId               = CFE_TBL_DumpCtrlBlockGetId(DumpCtrlPtr);
     RegRecPtr->DumpControlId = DumpCtrlId;
-    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename), CFE_SUCCESS);
+    UtAssert_INT32_EQ(CFE_TBL_PrepareDumpSnapshotBuffer(&Txn, DumpCtrlId, Filename, true), CFE_SUCCESS);
     UtAssert_UINT32_EQ(DumpCtrlPtr->State, CFE_TBL_DUMP_PERFORMED);
+    UtAssert_BOOL_TRUE(DumpCtrlPtr->Compress);
 
     /* Test cases focusing on the following APIs:
      * CFE_Status_t CFE_TBL_ExecuteDumpSnapshot(CFE_TBL_DumpControl_t *DumpCtrlPtr);
@@ -2104,12 +2132,12 @@ void Test_CFE_TBL_TableDumpCommon(void)
     UtAssert_INT32_EQ(CFE_TBL_WriteSnapshotToFile(DumpCtrlPtr), CFE_TBL_ERR_ACCESS);
     UT_ResetState(UT_KEY(CFE_FS_WriteHeader));
 
-    /* Fail to write data (headers are first OS_write call, data is second here) */
-    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, -1);
+    /* Fail to write data (headers are written with OS_write, data with CFE_FS_WriteBlock) */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteBlock), 1, CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     UT_TBL_SetupPendingDump(0, DumpBuffPtr, RegRecPtr, &DumpCtrlPtr);
     UtAssert_INT32_EQ(CFE_TBL_WriteSnapshotToFile(DumpCtrlPtr), CFE_TBL_ERR_ACCESS);
     CFE_UtAssert_EVENTSENT(CFE_TBL_WRITE_TBL_IMG_ERR_EID);
-    UT_ResetState(UT_KEY(OS_write));
+    UT_ResetState(UT_KEY(CFE_FS_WriteBlock));
 
     /* Test cases focusing on the following APIs:
      * bool CFE_TBL_SendDumpEventHelper(const CFE_TBL_TxnEvent_t *Event, void *Arg);
@@ -2223,10 +2251,12 @@ void Test_CFE_TBL_GetAddresses(void)
 
     UtPrintf("Begin Test Get Addresses");
 
-    /* Test setup - register a double buffered table */
+    /* Test setup - register two tables */
     UT_InitData_TBL();
     UT_SetAppID(UT_TBL_APPID_1);
     UT_TBL_SetupSingleReg(&RegRecPtr, &AccDescPtr, CFE_TBL_OPT_DEFAULT);
+    App1TblHandle1 = UT_TBL_AccDescToExtHandle(AccDescPtr);
+    UT_TBL_SetupSingleReg(&RegRecPtr, &AccDescPtr, CFE_TBL_OPT_DEFAULT);
     App1TblHandle2 = UT_TBL_AccDescToExtHandle(AccDescPtr);
     CFE_UtAssert_EVENTCOUNT(0);
 
@@ -367,6 +367,9 @@ void UT_TBL_GlobalDataReset(void)
     UtAssert_VOIDCALL(CFE_TBL_InitData());
 
     CFE_TBL_Global.TableTaskAppId = UT_TBL_APPID_10;
+
+    /* Registrations belong to the calling app, so do not depend on the app ID the previous test left set */
+    UT_SetAppID(UT_TBL_APPID_1);
 }
 
 /* Add custom logic to cFE common UT_InitData */
@@ -26,6 +26,7 @@
 ** Required header files...
 */
 #include "cfe_time_module_all.h"
+#include "cfe_msg_inline.h"
 
 /*----------------------------------------------------------------
  *
@@ -41,15 +42,15 @@ bool CFE_TIME_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLe
     CFE_MSG_FcnCode_t FcnCode      = 0;
     CFE_SB_MsgId_t    MsgId        = CFE_SB_INVALID_MSG_ID;
 
-    CFE_MSG_GetSize(MsgPtr, &ActualLength);
+    ActualLength = CFE_MSG_InlineGetSize(MsgPtr);
 
     /*
     ** Verify the command packet length
     */
     if (ExpectedLength != ActualLength)
     {
-        CFE_MSG_GetMsgId(MsgPtr, &MsgId);
-        CFE_MSG_GetFcnCode(MsgPtr, &FcnCode);
+        MsgId   = CFE_MSG_InlineGetMsgId(MsgPtr);
+        FcnCode = CFE_MSG_InlineGetFcnCode(MsgPtr);
 
         CFE_EVS_SendEvent(CFE_TIME_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
                           "Invalid msg length: ID = 0x%X,  CC = %u, Len = %u, Expected = %u",
@@ -62,6 +63,58 @@ bool CFE_TIME_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLe
     return result;
 }
 
+/*
+ * Dispatch functions for the command handlers, see CFE_SB_CMD_DISPATCH_FUNC()
+ */
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_NoopCmd_t, CFE_TIME_NoopCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_ResetCountersCmd_t, CFE_TIME_ResetCountersCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SendDiagnosticCmd_t, CFE_TIME_SendDiagnosticTlm)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetStateCmd_t, CFE_TIME_SetStateCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetSourceCmd_t, CFE_TIME_SetSourceCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetSignalCmd_t, CFE_TIME_SetSignalCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_AddDelayCmd_t, CFE_TIME_AddDelayCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SubDelayCmd_t, CFE_TIME_SubDelayCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetTimeCmd_t, CFE_TIME_SetTimeCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetMETCmd_t, CFE_TIME_SetMETCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetSTCFCmd_t, CFE_TIME_SetSTCFCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SetLeapSecondsCmd_t, CFE_TIME_SetLeapSecondsCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_AddAdjustCmd_t, CFE_TIME_AddAdjustCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SubAdjustCmd_t, CFE_TIME_SubAdjustCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_AddOneHzAdjustmentCmd_t, CFE_TIME_AddOneHzAdjustmentCmd)
+CFE_SB_CMD_DISPATCH_FUNC(CFE_TIME_SubOneHzAdjustmentCmd_t, CFE_TIME_SubOneHzAdjustmentCmd)
+
+/*
+ * Dispatch table for TIME ground commands, indexed by command code
+ */
+static const CFE_SB_CmdDispatchEntry_t CFE_TIME_CMD_DISPATCH_TABLE[] = {
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_NOOP_CC, CFE_TIME_NoopCmd_t, CFE_TIME_NoopCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_RESET_COUNTERS_CC, CFE_TIME_ResetCountersCmd_t, CFE_TIME_ResetCountersCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SEND_DIAGNOSTIC_CC, CFE_TIME_SendDiagnosticCmd_t, CFE_TIME_SendDiagnosticTlm),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_STATE_CC, CFE_TIME_SetStateCmd_t, CFE_TIME_SetStateCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_SOURCE_CC, CFE_TIME_SetSourceCmd_t, CFE_TIME_SetSourceCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_SIGNAL_CC, CFE_TIME_SetSignalCmd_t, CFE_TIME_SetSignalCmd),
+
+    /*
+    ** Time Clients process "tone delay" commands...
+    */
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_ADD_DELAY_CC, CFE_TIME_AddDelayCmd_t, CFE_TIME_AddDelayCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SUB_DELAY_CC, CFE_TIME_SubDelayCmd_t, CFE_TIME_SubDelayCmd),
+
+    /*
+    ** Time Servers process "set time" commands...
+    */
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_TIME_CC, CFE_TIME_SetTimeCmd_t, CFE_TIME_SetTimeCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_MET_CC, CFE_TIME_SetMETCmd_t, CFE_TIME_SetMETCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_STCF_CC, CFE_TIME_SetSTCFCmd_t, CFE_TIME_SetSTCFCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SET_LEAP_SECONDS_CC, CFE_TIME_SetLeapSecondsCmd_t, CFE_TIME_SetLeapSecondsCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_ADD_ADJUST_CC, CFE_TIME_AddAdjustCmd_t, CFE_TIME_AddAdjustCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SUB_ADJUST_CC, CFE_TIME_SubAdjustCmd_t, CFE_TIME_SubAdjustCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_ADD_ONE_HZ_ADJUSTMENT_CC, CFE_TIME_AddOneHzAdjustmentCmd_t,
+                              CFE_TIME_AddOneHzAdjustmentCmd),
+    CFE_SB_CMD_DISPATCH_ENTRY(CFE_TIME_SUB_ONE_HZ_ADJUSTMENT_CC, CFE_TIME_SubOneHzAdjustmentCmd_t,
+                              CFE_TIME_SubOneHzAdjustmentCmd),
+};
+
 /*----------------------------------------------------------------
  *
  * Local Helper function
@@ -69,137 +122,23 @@ bool CFE_TIME_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLe
  *-----------------------------------------------------------------*/
 void CFE_TIME_ProcessGroundCmd(const CFE_SB_Buffer_t *SBBufPtr)
 {
-    CFE_MSG_FcnCode_t CommandCode = 0;
-
-    CFE_MSG_GetFcnCode(&SBBufPtr->Msg, &CommandCode);
-    switch (CommandCode)
-    {
-        case CFE_TIME_NOOP_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_NoopCmd_t)))
-            {
-                CFE_TIME_NoopCmd((const CFE_TIME_NoopCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_RESET_COUNTERS_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_ResetCountersCmd_t)))
-            {
-                CFE_TIME_ResetCountersCmd((const CFE_TIME_ResetCountersCmd_t *)SBBufPtr);
-            }
-            break;
+    CFE_MSG_FcnCode_t                CommandCode = 0;
+    const CFE_SB_CmdDispatchEntry_t *Entry;
 
-        case CFE_TIME_SEND_DIAGNOSTIC_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SendDiagnosticCmd_t)))
-            {
-                CFE_TIME_SendDiagnosticTlm((const CFE_TIME_SendDiagnosticCmd_t *)SBBufPtr);
-            }
-            break;
+    CommandCode = CFE_MSG_InlineGetFcnCode(&SBBufPtr->Msg);
 
-        case CFE_TIME_SET_STATE_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetStateCmd_t)))
-            {
-                CFE_TIME_SetStateCmd((const CFE_TIME_SetStateCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_SOURCE_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSourceCmd_t)))
-            {
-                CFE_TIME_SetSourceCmd((const CFE_TIME_SetSourceCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_SIGNAL_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSignalCmd_t)))
-            {
-                CFE_TIME_SetSignalCmd((const CFE_TIME_SetSignalCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /*
-        ** Time Clients process "tone delay" commands...
-        */
-        case CFE_TIME_ADD_DELAY_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddDelayCmd_t)))
-            {
-                CFE_TIME_AddDelayCmd((const CFE_TIME_AddDelayCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SUB_DELAY_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubDelayCmd_t)))
-            {
-                CFE_TIME_SubDelayCmd((const CFE_TIME_SubDelayCmd_t *)SBBufPtr);
-            }
-            break;
-
-        /*
-        ** Time Servers process "set time" commands...
-        */
-        case CFE_TIME_SET_TIME_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetTimeCmd_t)))
-            {
-                CFE_TIME_SetTimeCmd((const CFE_TIME_SetTimeCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_MET_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetMETCmd_t)))
-            {
-                CFE_TIME_SetMETCmd((const CFE_TIME_SetMETCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_STCF_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetSTCFCmd_t)))
-            {
-                CFE_TIME_SetSTCFCmd((const CFE_TIME_SetSTCFCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SET_LEAP_SECONDS_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SetLeapSecondsCmd_t)))
-            {
-                CFE_TIME_SetLeapSecondsCmd((const CFE_TIME_SetLeapSecondsCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_ADD_ADJUST_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddAdjustCmd_t)))
-            {
-                CFE_TIME_AddAdjustCmd((const CFE_TIME_AddAdjustCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SUB_ADJUST_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubAdjustCmd_t)))
-            {
-                CFE_TIME_SubAdjustCmd((const CFE_TIME_SubAdjustCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_ADD_ONE_HZ_ADJUSTMENT_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_AddOneHzAdjustmentCmd_t)))
-            {
-                CFE_TIME_AddOneHzAdjustmentCmd((const CFE_TIME_AddOneHzAdjustmentCmd_t *)SBBufPtr);
-            }
-            break;
-
-        case CFE_TIME_SUB_ONE_HZ_ADJUSTMENT_CC:
-            if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, sizeof(CFE_TIME_SubOneHzAdjustmentCmd_t)))
-            {
-                CFE_TIME_SubOneHzAdjustmentCmd((const CFE_TIME_SubOneHzAdjustmentCmd_t *)SBBufPtr);
-            }
-            break;
-
-        default:
-
-            CFE_TIME_Global.CommandErrorCounter++;
-            CFE_EVS_SendEvent(CFE_TIME_CC_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Invalid command code -- ID = 0x%X, CC = %d", (unsigned int)CFE_TIME_CMD_MID,
-                              (int)CommandCode);
-            break;
-    } /* switch (CFE_TIME_CMD_MID -- command code)*/
+    Entry = CFE_SB_GetCmdDispatchEntry(CFE_TIME_CMD_DISPATCH_TABLE,
+                                       CFE_SB_CMD_DISPATCH_TABLE_SIZE(CFE_TIME_CMD_DISPATCH_TABLE), CommandCode);
+    if (Entry == NULL)
+    {
+        CFE_TIME_Global.CommandErrorCounter++;
+        CFE_EVS_SendEvent(CFE_TIME_CC_ERR_EID, CFE_EVS_EventType_ERROR, "Invalid command code -- ID = 0x%X, CC = %d",
+                          (unsigned int)CFE_TIME_CMD_MID, (int)CommandCode);
+    }
+    else if (CFE_TIME_VerifyCmdLength(&SBBufPtr->Msg, Entry->ExpectedLength))
+    {
+        Entry->Handler(SBBufPtr);
+    }
 }
 
 /*----------------------------------------------------------------
@@ -230,7 +169,7 @@ void CFE_TIME_TaskPipe(const CFE_SB_Buffer_t *SBBufPtr)
         SEND_CMD_MID  = CFE_SB_ValueToMsgId(CFE_TIME_SEND_CMD_MID);
     }
 
-    CFE_MSG_GetMsgId(&SBBufPtr->Msg, &MessageID);
+    MessageID = CFE_MSG_InlineGetMsgId(&SBBufPtr->Msg);
 
     /* Process all SB messages */
     if (CFE_SB_MsgId_Equal(MessageID, ONEHZ_CMD_MID))
@@ -65,7 +65,12 @@ void UtTest_Setup(void)
     UtPrintf("cFE TIME Unit Test Output File\n\n");
 
     UT_ADD_TEST(Test_Main);
-    UT_ADD_TEST(Test_Init);
+
+    /*
+     * Test_Init leaves CFE_TIME_Global as CFE_TIME_EarlyInit() sets it up, which
+     * all of the later tests start from, so it runs as a setup sequence
+     */
+    UtTest_AddSetup(Test_Init, "Test_Init");
     UT_ADD_TEST(Test_GetTime);
     UT_ADD_TEST(Test_TimeOp);
     UT_ADD_TEST(Test_ConvertTime);
@@ -149,6 +149,12 @@ void Test_SAMPLE_LIB_Function(void)
     memset(&state, 0, sizeof(state));
     UT_SetVaHookFunction(UT_KEY(OS_printf), UT_printf_hook, &state);
 
+    /*
+     * Set the internal buffer here rather than relying on the
+     * SAMPLE_LIB_Init test having run first in the same process
+     */
+    memcpy(SAMPLE_LIB_Buffer, UT_TESTBUFFER, sizeof(UT_TESTBUFFER));
+
     /*
      * Invoke the actual function
      */
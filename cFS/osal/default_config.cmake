@@ -233,6 +233,30 @@ set(OSAL_CONFIG_RWLOCK                          TRUE
     CACHE BOOL "Controls the inclusion of readers-writer lock objects in the code"
 )
 
+#
+# OSAL_CONFIG_FUTEX_SEMAPHORES
+# ----------------------------------
+#
+# Controls whether binary semaphores on Linux are implemented directly on
+# the futex system call rather than a pthread mutex and condition variable.
+#
+# If set TRUE, giving or taking a semaphore that no other task is waiting on
+# is a single atomic operation, and the kernel is only entered when a task
+# must actually block or be woken.  Timed waits and flush work as before.
+#
+# The default implementation protects its state with a priority inheritance
+# mutex, whereas the futex implementation has no internal lock at all.  This
+# is left FALSE by default to keep the existing behavior.
+#
+# Counting semaphores are not affected, they use the POSIX sem_t which
+# on Linux is already implemented with an atomic fast path on a futex.
+#
+# This option only applies to the POSIX implementation on Linux.
+#
+set(OSAL_CONFIG_FUTEX_SEMAPHORES                FALSE
+    CACHE BOOL "Controls use of futex-based binary semaphores on Linux"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -275,6 +299,11 @@ set(OSAL_CONFIG_MAX_CONDVARS             4
     CACHE STRING "Maximum Number of Condition Variables to support"
 )
 
+# The maximum number of poll sets to support
+set(OSAL_CONFIG_MAX_POLLSETS             4
+    CACHE STRING "Maximum Number of Poll Sets to support"
+)
+
 # The maximum number of loadable modules to support
 # Note that emulating module loading for statically-linked objects also
 # requires a slot in this table, as it still assigns an OSAL ID.
@@ -50,6 +50,7 @@
 #define OS_OBJECT_TYPE_OS_CONSOLE  0x0C /**< @brief Object console type */
 #define OS_OBJECT_TYPE_OS_CONDVAR  0x0D /**< @brief Object condition variable type */
 #define OS_OBJECT_TYPE_OS_RWLOCK   0x0E /**< @brief Object readers-writer lock type */
+#define OS_OBJECT_TYPE_OS_POLLSET  0x0F /**< @brief Object poll set type */
 #define OS_OBJECT_TYPE_USER        0x10 /**< @brief Object user type */
 /**@}*/
 
@@ -0,0 +1,223 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Declarations and prototypes for poll sets
+ */
+
+#ifndef OSAPI_POLLSET_H
+#define OSAPI_POLLSET_H
+
+#include "osconfig.h"
+#include "common_types.h"
+
+#include "osapi-clock.h"  /* required for OS_time_t definition */
+#include "osapi-select.h" /* required for OS_STREAM_STATE_xxx flags */
+
+/**
+ * @brief A single event reported by OS_PollSetWait()
+ *
+ * The StateFlags are a combination of #OS_STREAM_STATE_READABLE and/or
+ * #OS_STREAM_STATE_WRITABLE, indicating the state(s) actually detected
+ * on the handle.
+ */
+typedef struct
+{
+    osal_id_t objid;      /**< @brief The handle which has activity */
+    uint32    StateFlags; /**< @brief The state(s) detected on the handle */
+} OS_PollSetEvent_t;
+
+/** @defgroup OSAPIPollSet OSAL Poll Set APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a poll set resource
+ *
+ * A poll set is a persistent collection of file handles which can be waited on
+ * as a group.  Unlike OS_SelectMultiple(), the set of handles is registered once
+ * with OS_PollSetAdd() rather than on every call, and OS_PollSetWait() only
+ * reports the handles that actually have activity.  The cost of a wait is therefore
+ * proportional to the number of ready handles rather than the number of possible
+ * handles.
+ *
+ * Where supported by the OS this uses the native event notification facility
+ * (e.g. epoll on Linux), which is not subject to the FD_SETSIZE limit of the
+ * select() system call.  Otherwise it falls back to poll(), or to select() on
+ * systems such as VxWorks and RTEMS, where the FD_SETSIZE limit still applies.
+ *
+ * In addition to file handles and sockets, queues may also be added to a poll set
+ * where the OS supports it.  This allows a single task to wait for either a
+ * message on a queue or data on a socket, without polling either one.
+ *
+ * @param[out]  pollset_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   pollset_name the name of the new resource to create @nonnull
+ * @param[in]   options reserved for future use.  Should be passed as 0.
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if pollset_id or pollset_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if there are no more free poll set Ids
+ * @retval #OS_ERR_NAME_TAKEN if there is already a poll set with the same name
+ * @retval #OS_ERR_NOT_IMPLEMENTED if poll sets are not supported on this OS
+ */
+int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name, uint32 options);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes the specified poll set.
+ *
+ * The handles which were members of the set are not affected.
+ *
+ * @param[in] pollset_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poll set
+ */
+int32 OS_PollSetDelete(osal_id_t pollset_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a file handle or queue to a poll set, or changes the states it is polled for
+ *
+ * After this call, OS_PollSetWait() on the set will report the given handle
+ * whenever it is in any of the states given by StateFlags.  If the handle is already
+ * a member of the set, the states are replaced.
+ *
+ * For a queue, #OS_STREAM_STATE_READABLE indicates that a message is waiting
+ * and #OS_STREAM_STATE_WRITABLE indicates that the queue is not full.
+ *
+ * A handle which is closed or deleted is implicitly removed from all poll sets.
+ *
+ * @param[in] pollset_id The poll set to operate on
+ * @param[in] objid      The file handle or queue ID to add to the set
+ * @param[in] StateFlags #OS_STREAM_STATE_READABLE and/or #OS_STREAM_STATE_WRITABLE
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if pollset_id is not a valid poll set or objid is not a valid handle or queue
+ * @retval #OS_ERR_INVALID_ARGUMENT if StateFlags is empty or contains other states
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the handle or queue does not support polling on this OS
+ */
+int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a file handle or queue from a poll set
+ *
+ * @param[in] pollset_id The poll set to operate on
+ * @param[in] objid      The file handle or queue ID to remove from the set
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if pollset_id is not a valid poll set or objid is not a valid handle or queue
+ * @retval #OS_ERR_INCORRECT_OBJ_STATE if the handle is not a member of the set
+ */
+int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for events on the handles in a poll set
+ *
+ * This function will block until at least one handle in the set is in one
+ * of the states it was added with, or the timeout has elapsed.
+ *
+ * Up to MaxEvents ready handles are stored in the Events array and the
+ * number stored is output via EventCount.  If more handles are ready, the
+ * remainder will be reported by the next call.
+ *
+ * This API is identical to OS_PollSetWait() except for the timeout parameter.  In
+ * this call, timeout is expressed as an absolute value of the OS clock, in the same
+ * time domain as obtained via OS_GetLocalTime().
+ *
+ * @param[in]  pollset_id  The poll set to wait on
+ * @param[out] Events      Buffer to store the ready handles @nonnull
+ * @param[in]  MaxEvents   Number of entries in the Events buffer @nonzero
+ * @param[out] EventCount  Set to the number of entries stored in Events @nonnull
+ * @param[in]  abs_timeout The absolute time that the call may block until
+ *
+ * @sa OS_PollSetWait()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS If at least one handle is ready
+ * @retval #OS_ERROR_TIMEOUT If no handles became ready within the timeout
+ * @retval #OS_INVALID_POINTER if Events or EventCount is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MaxEvents is zero
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poll set
+ */
+int32 OS_PollSetWaitAbs(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                        OS_time_t abs_timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for events on the handles in a poll set
+ *
+ * This function will block until at least one handle in the set is in one
+ * of the states it was added with, or the timeout has elapsed.
+ *
+ * Up to MaxEvents ready handles are stored in the Events array and the
+ * number stored is output via EventCount.  If more handles are ready, the
+ * remainder will be reported by the next call.
+ *
+ * The timeout is expressed in milliseconds, relative to the time that the API was
+ * invoked.  Use OS_PollSetWaitAbs() for higher timing precision.
+ *
+ * @param[in]  pollset_id  The poll set to wait on
+ * @param[out] Events      Buffer to store the ready handles @nonnull
+ * @param[in]  MaxEvents   Number of entries in the Events buffer @nonzero
+ * @param[out] EventCount  Set to the number of entries stored in Events @nonnull
+ * @param[in]  msecs       Indicates the timeout. Positive values will wait up to that many milliseconds.
+ *                         Zero will not wait (poll). Negative values will wait forever (pend)
+ *
+ * @sa OS_PollSetWaitAbs()
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS If at least one handle is ready
+ * @retval #OS_ERROR_TIMEOUT If no handles became ready within the timeout
+ * @retval #OS_INVALID_POINTER if Events or EventCount is NULL
+ * @retval #OS_ERR_INVALID_SIZE if MaxEvents is zero
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poll set
+ */
+int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                     int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing poll set ID by name
+ *
+ * This function tries to find a poll set ID given the name of a poll set.
+ * The id is returned through pollset_id
+ *
+ * @param[out] pollset_id will be set to the ID of the existing resource
+ * @param[in]  pollset_name the name of the existing resource to find @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER is pollset_id or pollset_name are NULL pointers
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+ */
+int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name);
+/**@}*/
+
+#endif /* OSAPI_POLLSET_H */
@@ -76,6 +76,7 @@ extern "C" {
 #include "osapi-module.h"
 #include "osapi-mutex.h"
 #include "osapi-network.h"
+#include "osapi-pollset.h"
 #include "osapi-printf.h"
 #include "osapi-queue.h"
 #include "osapi-rwlock.h"
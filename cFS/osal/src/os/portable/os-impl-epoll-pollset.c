@@ -0,0 +1,338 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: This file contains the poll set implementation based on the Linux
+ * epoll facility.  The set of handles is kept by the kernel, so the cost of a
+ * wait depends only on the number of handles that are actually ready.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/epoll.h>
+
+#include "os-impl-pollset.h"
+#include "os-shared-clock.h"
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Maximum number of events retrieved from the kernel by a single wait.
+ * Any additional ready handles are reported by the next wait.
+ */
+#define OS_POLLSET_MAX_WAIT_EVENTS 32
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+typedef struct
+{
+    int epfd;
+} OS_impl_pollset_internal_record_t;
+
+static OS_impl_pollset_internal_record_t OS_impl_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Convert an absolute timeout to the relative number of milliseconds
+ *          expected by epoll_wait(), rounding up.  Returns -1 to wait forever.
+ *-----------------------------------------------------------------*/
+static int OS_PollSet_TimeoutMsec(OS_time_t abs_timeout)
+{
+    OS_time_t curr_time;
+    int64     msecs;
+
+    /* Implementations may pass OS_TIME_MAX to mean wait forever */
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        return -1;
+    }
+
+    curr_time = abs_timeout;
+    if (OS_TimeGetSign(abs_timeout) > 0)
+    {
+        OS_GetLocalTime_Impl(&curr_time);
+        curr_time = OS_TimeSubtract(abs_timeout, curr_time);
+    }
+
+    if (OS_TimeGetSign(curr_time) <= 0)
+    {
+        /* timeout has already passed - this will still poll, but not block */
+        return 0;
+    }
+
+    msecs = (OS_TimeGetTotalMicroseconds(curr_time) + 999) / 1000;
+    if (msecs > INT_MAX)
+    {
+        msecs = INT_MAX;
+    }
+
+    return (int)msecs;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Get the file descriptor underlying a poll set member, or -1 if
+ *          the member cannot be polled.  On Linux the message queue
+ *          descriptor is a regular file descriptor and can be used with epoll.
+ *-----------------------------------------------------------------*/
+static int OS_PollSet_GetFd(const OS_object_token_t *obj_token)
+{
+    OS_impl_file_internal_record_t * stream;
+    OS_impl_queue_internal_record_t *queue;
+    int                              fd;
+
+    fd = -1;
+    switch (obj_token->obj_type)
+    {
+        case OS_OBJECT_TYPE_OS_STREAM:
+            stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *obj_token);
+            if (stream->selectable)
+            {
+                fd = stream->fd;
+            }
+            break;
+        case OS_OBJECT_TYPE_OS_QUEUE:
+            queue = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *obj_token);
+            fd    = queue->id;
+            break;
+        default:
+            break;
+    }
+
+    return fd;
+}
+
+/****************************************************************************************
+                                POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->epfd < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    close(impl->epfd);
+    impl->epfd = -1;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 StateFlags)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    struct epoll_event                 ev;
+    int                                fd;
+    int                                os_status;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    fd   = OS_PollSet_GetFd(obj_token);
+
+    if (fd < 0)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        ev.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        ev.events |= EPOLLOUT;
+    }
+
+    /*
+     * The event data carries both the OSAL ID and the requested states,
+     * so a wait can be translated back without looking anything up.
+     */
+    ev.data.u64 = ((uint64)StateFlags << 32) | OS_ObjectIdToInteger(obj_token->obj_id);
+
+    os_status = epoll_ctl(impl->epfd, EPOLL_CTL_ADD, fd, &ev);
+    if (os_status < 0 && errno == EEXIST)
+    {
+        /* already a member, only the states change */
+        os_status = epoll_ctl(impl->epfd, EPOLL_CTL_MOD, fd, &ev);
+    }
+
+    if (os_status < 0)
+    {
+        if (errno == EPERM)
+        {
+            /* regular files and directories cannot be polled */
+            return OS_ERR_OPERATION_NOT_SUPPORTED;
+        }
+
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    struct epoll_event                 ev;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    /* Kernels before 2.6.9 require a non-NULL event even though it is ignored */
+    memset(&ev, 0, sizeof(ev));
+    if (epoll_ctl(impl->epfd, EPOLL_CTL_DEL, OS_PollSet_GetFd(obj_token), &ev) < 0)
+    {
+        if (errno == ENOENT || errno == EBADF)
+        {
+            return OS_ERR_INCORRECT_OBJ_STATE;
+        }
+
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+                          uint32 *EventCount, OS_time_t abs_timeout)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    struct epoll_event                 evbuf[OS_POLLSET_MAX_WAIT_EVENTS];
+    int                                os_status;
+    int                                i;
+    uint32                             requested;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    if (MaxEvents > OS_POLLSET_MAX_WAIT_EVENTS)
+    {
+        MaxEvents = OS_POLLSET_MAX_WAIT_EVENTS;
+    }
+
+    do
+    {
+        os_status = epoll_wait(impl->epfd, evbuf, MaxEvents, OS_PollSet_TimeoutMsec(abs_timeout));
+    } while (os_status < 0 && errno == EINTR);
+
+    if (os_status < 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    for (i = 0; i < os_status; ++i)
+    {
+        requested = evbuf[i].data.u64 >> 32;
+
+        Events[i].objid      = OS_ObjectIdFromInteger(evbuf[i].data.u64 & 0xFFFFFFFF);
+        Events[i].StateFlags = 0;
+
+        /*
+         * As with select(), error and hangup conditions are reported as all of the
+         * requested states, so the next read or write will see the actual condition.
+         */
+        if (evbuf[i].events & (EPOLLERR | EPOLLHUP))
+        {
+            Events[i].StateFlags = requested;
+        }
+        if (evbuf[i].events & EPOLLIN)
+        {
+            Events[i].StateFlags |= OS_STREAM_STATE_READABLE;
+        }
+        if (evbuf[i].events & EPOLLOUT)
+        {
+            Events[i].StateFlags |= OS_STREAM_STATE_WRITABLE;
+        }
+    }
+
+    *EventCount = os_status;
+
+    return OS_SUCCESS;
+}
@@ -0,0 +1,57 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: All functions return OS_ERR_NOT_IMPLEMENTED.
+ * This is used when the OS does not support poll sets.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <osapi.h>
+#include "os-shared-pollset.h"
+
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 StateFlags)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
+
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+                          uint32 *EventCount, OS_time_t abs_timeout)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+}
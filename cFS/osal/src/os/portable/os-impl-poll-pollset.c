@@ -0,0 +1,342 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: This file contains the poll set implementation based on the
+ * POSIX poll() system call, for systems that do not have epoll.
+ *
+ * The members of each set are kept in a dense list, so a wait only
+ * visits the handles which are actually members of the set.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+
+#include "os-impl-pollset.h"
+#include "os-shared-clock.h"
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+typedef struct
+{
+    uint32    count;
+    osal_id_t objid[OS_MAX_NUM_OPEN_FILES];
+    uint32    flags[OS_MAX_NUM_OPEN_FILES];
+} OS_impl_pollset_internal_record_t;
+
+static OS_impl_pollset_internal_record_t OS_impl_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Convert an absolute timeout to the relative number of milliseconds
+ *          expected by poll(), rounding up.  Returns -1 to wait forever.
+ *-----------------------------------------------------------------*/
+static int OS_PollSet_TimeoutMsec(OS_time_t abs_timeout)
+{
+    OS_time_t curr_time;
+    int64     msecs;
+
+    /* Implementations may pass OS_TIME_MAX to mean wait forever */
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        return -1;
+    }
+
+    curr_time = abs_timeout;
+    if (OS_TimeGetSign(abs_timeout) > 0)
+    {
+        OS_GetLocalTime_Impl(&curr_time);
+        curr_time = OS_TimeSubtract(abs_timeout, curr_time);
+    }
+
+    if (OS_TimeGetSign(curr_time) <= 0)
+    {
+        /* timeout has already passed - this will still poll, but not block */
+        return 0;
+    }
+
+    msecs = (OS_TimeGetTotalMicroseconds(curr_time) + 999) / 1000;
+    if (msecs > INT_MAX)
+    {
+        msecs = INT_MAX;
+    }
+
+    return (int)msecs;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Find the position of a stream in the member list,
+ *          returns the member count if not found
+ *-----------------------------------------------------------------*/
+static uint32 OS_PollSet_FindMember(const OS_impl_pollset_internal_record_t *impl, osal_id_t objid)
+{
+    uint32 i;
+
+    for (i = 0; i < impl->count; ++i)
+    {
+        if (OS_ObjectIdEqual(impl->objid[i], objid))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/****************************************************************************************
+                                POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->count = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->count = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 StateFlags)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_impl_file_internal_record_t *   stream;
+    uint32                             i;
+
+    /*
+     * Message queue descriptors are not guaranteed to be file descriptors
+     * outside of Linux, so only streams can be polled here.
+     */
+    if (obj_token->obj_type != OS_OBJECT_TYPE_OS_STREAM)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *obj_token);
+
+    if (!stream->selectable || stream->fd < 0)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    /*
+     * A stream can only be in the list once, and the list has room for every
+     * stream, so an entry can always be appended if it is not found.
+     */
+    i = OS_PollSet_FindMember(impl, obj_token->obj_id);
+    if (i == impl->count)
+    {
+        impl->objid[i] = obj_token->obj_id;
+        ++impl->count;
+    }
+
+    impl->flags[i] = StateFlags;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    uint32                             i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    i = OS_PollSet_FindMember(impl, obj_token->obj_id);
+    if (i == impl->count)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    /* Order does not matter, so the last entry fills the gap */
+    --impl->count;
+    impl->objid[i] = impl->objid[impl->count];
+    impl->flags[i] = impl->flags[impl->count];
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+                          uint32 *EventCount, OS_time_t abs_timeout)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_object_token_t                  lock_token;
+    struct pollfd                      pfd[OS_MAX_NUM_OPEN_FILES];
+    osal_id_t                          objid[OS_MAX_NUM_OPEN_FILES];
+    uint32                             flags[OS_MAX_NUM_OPEN_FILES];
+    osal_index_t                       stream_idx;
+    nfds_t                             nfds;
+    nfds_t                             i;
+    uint32                             j;
+    int                                os_status;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    /*
+     * Take a snapshot of the members, under the same lock that is
+     * held by the shared layer while adding and removing members.
+     * Streams that have been closed since they were added are dropped.
+     */
+    lock_token           = *token;
+    lock_token.lock_mode = OS_LOCK_MODE_GLOBAL;
+    OS_Lock_Global(&lock_token);
+
+    nfds = 0;
+    j    = 0;
+    while (j < impl->count)
+    {
+        if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, impl->objid[j], &stream_idx) != OS_SUCCESS ||
+            !OS_ObjectIdEqual(OS_global_stream_table[stream_idx].active_id, impl->objid[j]))
+        {
+            --impl->count;
+            impl->objid[j] = impl->objid[impl->count];
+            impl->flags[j] = impl->flags[impl->count];
+            continue;
+        }
+
+        pfd[nfds].fd      = OS_impl_filehandle_table[stream_idx].fd;
+        pfd[nfds].events  = 0;
+        pfd[nfds].revents = 0;
+        if (impl->flags[j] & OS_STREAM_STATE_READABLE)
+        {
+            pfd[nfds].events |= POLLIN;
+        }
+        if (impl->flags[j] & OS_STREAM_STATE_WRITABLE)
+        {
+            pfd[nfds].events |= POLLOUT;
+        }
+        objid[nfds] = impl->objid[j];
+        flags[nfds] = impl->flags[j];
+        ++nfds;
+        ++j;
+    }
+
+    OS_Unlock_Global(&lock_token);
+
+    do
+    {
+        os_status = poll(pfd, nfds, OS_PollSet_TimeoutMsec(abs_timeout));
+    } while (os_status < 0 && (errno == EINTR || errno == EAGAIN));
+
+    if (os_status < 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    j = 0;
+    for (i = 0; i < nfds && j < MaxEvents; ++i)
+    {
+        if (pfd[i].revents == 0)
+        {
+            continue;
+        }
+
+        Events[j].objid      = objid[i];
+        Events[j].StateFlags = 0;
+
+        /*
+         * As with select(), error and hangup conditions are reported as all of the
+         * requested states, so the next read or write will see the actual condition.
+         */
+        if (pfd[i].revents & (POLLERR | POLLHUP | POLLNVAL))
+        {
+            Events[j].StateFlags = flags[i];
+        }
+        if (pfd[i].revents & POLLIN)
+        {
+            Events[j].StateFlags |= OS_STREAM_STATE_READABLE;
+        }
+        if (pfd[i].revents & POLLOUT)
+        {
+            Events[j].StateFlags |= OS_STREAM_STATE_WRITABLE;
+        }
+        ++j;
+    }
+
+    *EventCount = j;
+
+    return OS_SUCCESS;
+}
@@ -0,0 +1,363 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Purpose: This file contains the poll set implementation based on the
+ * BSD select() system call, for systems that have neither epoll nor poll().
+ *
+ * The members of each set are kept in a dense list, so building the
+ * descriptor sets only visits the handles which are members of the set.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+/*
+ * Inclusions Defined by OSAL layer.
+ *
+ * This must include whatever is required to get the prototypes of these functions:
+ *
+ *   FD_SET/FD_ZERO/FD_ISSET macros and fd_set typedef
+ *   select()
+ *   struct timeval - for computing select timeouts
+ */
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "os-impl-select.h"
+#include "os-shared-clock.h"
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
+
+typedef struct
+{
+    uint32    count;
+    osal_id_t objid[OS_MAX_NUM_OPEN_FILES];
+    uint32    flags[OS_MAX_NUM_OPEN_FILES];
+} OS_impl_pollset_internal_record_t;
+
+static OS_impl_pollset_internal_record_t OS_impl_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                LOCAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Find the position of a stream in the member list,
+ *          returns the member count if not found
+ *-----------------------------------------------------------------*/
+static uint32 OS_PollSet_FindMember(const OS_impl_pollset_internal_record_t *impl, osal_id_t objid)
+{
+    uint32 i;
+
+    for (i = 0; i < impl->count; ++i)
+    {
+        if (OS_ObjectIdEqual(impl->objid[i], objid))
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *
+ *          Call select() until it completes or the absolute timeout passes,
+ *          restarting it with the remaining time if it is interrupted.
+ *-----------------------------------------------------------------*/
+static int32 OS_PollSet_DoSelect(int maxfd, fd_set *rd_set, fd_set *wr_set, OS_time_t abs_timeout)
+{
+    int             os_status;
+    struct timeval  tv;
+    struct timeval *tvptr;
+    OS_time_t       curr_time;
+
+    /* Implementations may pass OS_TIME_MAX to mean wait forever */
+    if (OS_TimeEqual(abs_timeout, OS_TIME_MAX))
+    {
+        tvptr = NULL;
+    }
+    else
+    {
+        tvptr = &tv;
+    }
+
+    curr_time = abs_timeout;
+
+    do
+    {
+        if (tvptr != NULL)
+        {
+            if (OS_TimeGetSign(abs_timeout) > 0)
+            {
+                OS_GetLocalTime_Impl(&curr_time);
+                curr_time = OS_TimeSubtract(abs_timeout, curr_time);
+            }
+            if (OS_TimeGetSign(curr_time) <= 0)
+            {
+                /* timeout has already passed - this will still poll, but not block */
+                tv.tv_sec  = 0;
+                tv.tv_usec = 0;
+            }
+            else
+            {
+                tv.tv_sec  = OS_TimeGetTotalSeconds(curr_time);
+                tv.tv_usec = OS_TimeGetMicrosecondsPart(curr_time);
+            }
+        }
+
+        os_status = select(maxfd + 1, rd_set, wr_set, NULL, tvptr);
+
+    } while (os_status < 0 && (errno == EINTR || errno == EAGAIN));
+
+    if (os_status < 0)
+    {
+        return OS_ERROR;
+    }
+
+    if (os_status == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    return OS_SUCCESS;
+}
+
+/****************************************************************************************
+                                POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->count = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->count = 0;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 StateFlags)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_impl_file_internal_record_t *   stream;
+    uint32                             i;
+
+    /* Only streams have file descriptors that select() can wait on */
+    if (obj_token->obj_type != OS_OBJECT_TYPE_OS_STREAM)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *obj_token);
+
+    if (!stream->selectable || stream->fd < 0 || stream->fd >= FD_SETSIZE)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    /*
+     * A stream can only be in the list once, and the list has room for every
+     * stream, so an entry can always be appended if it is not found.
+     */
+    i = OS_PollSet_FindMember(impl, obj_token->obj_id);
+    if (i == impl->count)
+    {
+        impl->objid[i] = obj_token->obj_id;
+        ++impl->count;
+    }
+
+    impl->flags[i] = StateFlags;
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    uint32                             i;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    i = OS_PollSet_FindMember(impl, obj_token->obj_id);
+    if (i == impl->count)
+    {
+        return OS_ERR_INCORRECT_OBJ_STATE;
+    }
+
+    /* Order does not matter, so the last entry fills the gap */
+    --impl->count;
+    impl->objid[i] = impl->objid[impl->count];
+    impl->flags[i] = impl->flags[impl->count];
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+                          uint32 *EventCount, OS_time_t abs_timeout)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_object_token_t                  lock_token;
+    fd_set                             rd_set;
+    fd_set                             wr_set;
+    int                                fd[OS_MAX_NUM_OPEN_FILES];
+    osal_id_t                          objid[OS_MAX_NUM_OPEN_FILES];
+    uint32                             flags[OS_MAX_NUM_OPEN_FILES];
+    osal_index_t                       stream_idx;
+    uint32                             nfds;
+    uint32                             i;
+    uint32                             j;
+    int                                maxfd;
+    int32                              return_code;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    FD_ZERO(&rd_set);
+    FD_ZERO(&wr_set);
+    maxfd = -1;
+
+    /*
+     * Take a snapshot of the members, under the same lock that is
+     * held by the shared layer while adding and removing members.
+     * Streams that have been closed since they were added are dropped.
+     */
+    lock_token           = *token;
+    lock_token.lock_mode = OS_LOCK_MODE_GLOBAL;
+    OS_Lock_Global(&lock_token);
+
+    nfds = 0;
+    j    = 0;
+    while (j < impl->count)
+    {
+        if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, impl->objid[j], &stream_idx) != OS_SUCCESS ||
+            !OS_ObjectIdEqual(OS_global_stream_table[stream_idx].active_id, impl->objid[j]))
+        {
+            --impl->count;
+            impl->objid[j] = impl->objid[impl->count];
+            impl->flags[j] = impl->flags[impl->count];
+            continue;
+        }
+
+        fd[nfds] = OS_impl_filehandle_table[stream_idx].fd;
+        if (impl->flags[j] & OS_STREAM_STATE_READABLE)
+        {
+            FD_SET(fd[nfds], &rd_set);
+        }
+        if (impl->flags[j] & OS_STREAM_STATE_WRITABLE)
+        {
+            FD_SET(fd[nfds], &wr_set);
+        }
+        if (fd[nfds] > maxfd)
+        {
+            maxfd = fd[nfds];
+        }
+        objid[nfds] = impl->objid[j];
+        flags[nfds] = impl->flags[j];
+        ++nfds;
+        ++j;
+    }
+
+    OS_Unlock_Global(&lock_token);
+
+    return_code = OS_PollSet_DoSelect(maxfd, &rd_set, &wr_set, abs_timeout);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    j = 0;
+    for (i = 0; i < nfds && j < MaxEvents; ++i)
+    {
+        Events[j].objid      = objid[i];
+        Events[j].StateFlags = 0;
+
+        if ((flags[i] & OS_STREAM_STATE_READABLE) && FD_ISSET(fd[i], &rd_set))
+        {
+            Events[j].StateFlags |= OS_STREAM_STATE_READABLE;
+        }
+        if ((flags[i] & OS_STREAM_STATE_WRITABLE) && FD_ISSET(fd[i], &wr_set))
+        {
+            Events[j].StateFlags |= OS_STREAM_STATE_WRITABLE;
+        }
+        if (Events[j].StateFlags != 0)
+        {
+            ++j;
+        }
+    }
+
+    *EventCount = j;
+
+    return OS_SUCCESS;
+}
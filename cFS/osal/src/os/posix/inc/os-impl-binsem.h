@@ -30,6 +30,23 @@
 #include <pthread.h>
 #include <signal.h>
 
+#ifdef OSAL_CONFIG_FUTEX_SEMAPHORES
+
+/*
+ * Binary Semaphores, futex implementation
+ *
+ * The state word holds the semaphore value in the low bit and a flush
+ * counter in the remaining bits, so that any give or flush changes the
+ * word that waiters are pending on.
+ */
+typedef struct
+{
+    uint32 state;
+    uint32 waiters;
+} OS_impl_binsem_internal_record_t;
+
+#else
+
 /* Binary Semaphores */
 typedef struct
 {
@@ -39,6 +56,8 @@ typedef struct
     volatile sig_atomic_t current_value;
 } OS_impl_binsem_internal_record_t;
 
+#endif
+
 /* Tables where the OS object information is stored */
 extern OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
 
@@ -0,0 +1,350 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  posix
+ *
+ * Purpose: This file contains the binary semaphore implementation for
+ *    POSIX based directly on the Linux futex system call
+ */
+
+/*
+ * The syscall() prototype is not part of the X/Open profile
+ * this is otherwise compiled with.
+ */
+#define _DEFAULT_SOURCE
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include "os-posix.h"
+#include "os-shared-idmap.h"
+#include "os-shared-binsem.h"
+#include "os-impl-binsem.h"
+
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Layout of the state word.  The low bit is the semaphore value, and
+ * every flush adds OS_BINSEM_FUTEX_FLUSH_INC to the remaining bits.
+ * The flush counter is expected to wrap around.
+ */
+#define OS_BINSEM_FUTEX_VALUE     0x01
+#define OS_BINSEM_FUTEX_FLUSH_INC 0x02
+
+/* Tables where the OS object information is stored */
+OS_impl_binsem_internal_record_t OS_impl_bin_sem_table[OS_MAX_BIN_SEMAPHORES];
+
+/****************************************************************************************
+                               BINARY SEMAPHORE API
+ ***************************************************************************************/
+
+/*
+ * Binary semaphores are implemented as a single 32 bit state word which is
+ * only ever changed using atomic operations, plus a count of the tasks that
+ * are blocked (or about to block) on that word.
+ *
+ * A give or take that does not need to wake or block another task is a single
+ * atomic operation, the kernel is only involved when a task actually needs to
+ * wait or there are waiters to wake up.
+ *
+ * A waiter increments the count before checking the state word in the kernel,
+ * and a giver changes the state word before checking the count, so either the
+ * giver sees the waiter or the kernel sees the new state and does not block.
+ *
+ * As with the pthread implementation, giving the semaphore from a signal
+ * handler is not supported.
+ */
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to block on the futex word, as long as it contains the expected value.
+ * The timeout is absolute and based on CLOCK_REALTIME, like the other POSIX waits.
+ *
+ * The raw system call is not a cancellation point, so asynchronous cancellation is
+ * enabled for the duration of the wait, as the C library does for its own futex waits.
+ * This keeps OS_TaskDelete() working on a task that is pending on the semaphore.
+ *
+ * Returns 0 if woken up, or the errno value otherwise.
+ ----------------------------------------------------------------------------------------*/
+static int OS_Posix_BinSemFutexWait(uint32 *addr, uint32 expected, const struct timespec *timeout)
+{
+    int oldtype;
+    int result;
+
+    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, &oldtype);
+
+    result = syscall(SYS_futex, addr, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, expected, timeout, NULL,
+                     FUTEX_BITSET_MATCH_ANY);
+    if (result < 0)
+    {
+        result = errno;
+    }
+
+    pthread_setcanceltype(oldtype, NULL);
+
+    return result;
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function for removing the waiter in case the thread
+ * executing OS_Posix_BinSemFutexWait() is canceled.
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_BinSemCancelWait(void *waiters)
+{
+    __atomic_fetch_sub((uint32 *)waiters, 1, __ATOMIC_SEQ_CST);
+}
+
+/*---------------------------------------------------------------------------------------
+ * Helper function to wake up to "count" tasks blocked on the futex word
+ ----------------------------------------------------------------------------------------*/
+static void OS_Posix_BinSemFutexWake(uint32 *addr, int count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_Posix_BinSemAPI_Impl_Init
+
+   Purpose: Initialize the Binary Semaphore data structures
+
+ ----------------------------------------------------------------------------------------*/
+int32 OS_Posix_BinSemAPI_Impl_Init(void)
+{
+    memset(OS_impl_bin_sem_table, 0, sizeof(OS_impl_bin_sem_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemCreate_Impl(const OS_object_token_t *token, uint32 initial_value, uint32 options)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * As in the pthread implementation, an initial value greater than 1
+     * silently becomes 1.
+     */
+    sem->waiters = 0;
+    __atomic_store_n(&sem->state, (initial_value != 0) ? OS_BINSEM_FUTEX_VALUE : 0, __ATOMIC_SEQ_CST);
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* As with pthread_cond_destroy(), a sem cannot be deleted while a task is pending on it */
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        return OS_SEM_FAILURE;
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGive_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* Binary semaphores are always set as "1" when given */
+    __atomic_fetch_or(&sem->state, OS_BINSEM_FUTEX_VALUE, __ATOMIC_SEQ_CST);
+
+    /* unblock one thread that is waiting on this sem */
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_BinSemFutexWake(&sem->state, 1);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemFlush_Impl(const OS_object_token_t *token)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* increment the flush counter.  Any other threads that are
+     * currently pending in SemTake() will see the counter change and
+     * return _without_ modifying the semaphore value.
+     */
+    __atomic_fetch_add(&sem->state, OS_BINSEM_FUTEX_FLUSH_INC, __ATOMIC_SEQ_CST);
+
+    /* unblock all threads that are be waiting on this sem */
+    if (__atomic_load_n(&sem->waiters, __ATOMIC_SEQ_CST) != 0)
+    {
+        OS_Posix_BinSemFutexWake(&sem->state, INT_MAX);
+    }
+
+    return OS_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_GenericBinSemTake_Impl
+
+   Purpose: Helper function that takes a binary semaphore with a "timespec" timeout
+            If the value is zero this will block until either the value
+            becomes nonzero (via SemGive) or the semaphore gets flushed.
+
+---------------------------------------------------------------------------------------*/
+static int32 OS_GenericBinSemTake_Impl(const OS_object_token_t *token, const struct timespec *timeout)
+{
+    uint32                            state;
+    uint32                            flush_count;
+    int32                             return_code;
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /*
+     * first take a local snapshot of the flush request counter,
+     * if it changes, we know that someone else called SemFlush.
+     */
+    state       = __atomic_load_n(&sem->state, __ATOMIC_SEQ_CST);
+    flush_count = state & ~OS_BINSEM_FUTEX_VALUE;
+    return_code = OS_SUCCESS;
+
+    while (true)
+    {
+        if ((state & ~OS_BINSEM_FUTEX_VALUE) != flush_count)
+        {
+            /* flushed - return without modifying the value */
+            break;
+        }
+
+        if ((state & OS_BINSEM_FUTEX_VALUE) != 0)
+        {
+            /* Set the value to zero, on failure this reloads the current state */
+            if (__atomic_compare_exchange_n(&sem->state, &state, state & ~OS_BINSEM_FUTEX_VALUE, false,
+                                            __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        /* Must pend until something changes */
+        __atomic_fetch_add(&sem->waiters, 1, __ATOMIC_SEQ_CST);
+        pthread_cleanup_push(OS_Posix_BinSemCancelWait, &sem->waiters);
+
+        if (OS_Posix_BinSemFutexWait(&sem->state, state, timeout) == ETIMEDOUT)
+        {
+            return_code = OS_SEM_TIMEOUT;
+        }
+
+        /*
+         * Pop the cleanup handler.
+         * Passing "true" means it will be executed, which
+         * handles removing the waiter.
+         */
+        pthread_cleanup_pop(true);
+
+        if (return_code != OS_SUCCESS)
+        {
+            break;
+        }
+
+        /* Woken up, interrupted, or the state already changed - check again */
+        state = __atomic_load_n(&sem->state, __ATOMIC_SEQ_CST);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTake_Impl(const OS_object_token_t *token)
+{
+    return (OS_GenericBinSemTake_Impl(token, NULL));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemTimedWait_Impl(const OS_object_token_t *token, uint32 msecs)
+{
+    struct timespec ts;
+
+    /*
+     ** Compute an absolute time for the delay
+     */
+    OS_Posix_CompAbsDelayTime(msecs, &ts);
+
+    return (OS_GenericBinSemTake_Impl(token, &ts));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_BinSemGetInfo_Impl(const OS_object_token_t *token, OS_bin_sem_prop_t *sem_prop)
+{
+    OS_impl_binsem_internal_record_t *sem;
+
+    sem = OS_OBJECT_TABLE_GET(OS_impl_bin_sem_table, *token);
+
+    /* put the info into the structure */
+    sem_prop->value = __atomic_load_n(&sem->state, __ATOMIC_SEQ_CST) & OS_BINSEM_FUTEX_VALUE;
+    return OS_SUCCESS;
+}
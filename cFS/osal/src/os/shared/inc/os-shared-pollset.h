@@ -0,0 +1,99 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ */
+
+#ifndef OS_SHARED_POLLSET_H
+#define OS_SHARED_POLLSET_H
+
+#include "osapi-pollset.h"
+#include "os-shared-globaldefs.h"
+
+typedef struct
+{
+    char obj_name[OS_MAX_API_NAME];
+} OS_pollset_internal_record_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_pollset_internal_record_t OS_pollset_table[OS_MAX_POLLSETS];
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_PollSetAPI_Init
+
+   Purpose: Initialize the OS-independent layer for poll set objects
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_PollSetAPI_Init(void);
+
+/*----------------------------------------------------------------
+
+    Purpose: Prepare/allocate OS resources for a poll set object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options);
+
+/*----------------------------------------------------------------
+
+    Purpose: Free the OS resources associated with a poll set object
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Add a stream or queue to the poll set, or change the states it is polled for
+            The "StateFlags" have already been validated by the shared layer
+            The type of member is indicated by obj_token->obj_type
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the member does not support polling
+ ------------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token, uint32 StateFlags);
+
+/*----------------------------------------------------------------
+
+    Purpose: Remove a stream or queue from the poll set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_INCORRECT_OBJ_STATE if the object is not a member of the set
+ ------------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token);
+
+/*----------------------------------------------------------------
+
+    Purpose: Wait until at least one member of the set is ready, or the timeout
+            Stores up to "MaxEvents" ready members in "Events"
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERROR_TIMEOUT if no member became ready (EventCount is set to zero)
+ ------------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+                          uint32 *EventCount, OS_time_t abs_timeout);
+
+#endif /* OS_SHARED_POLLSET_H */
@@ -49,6 +49,7 @@
 #include "os-shared-module.h"
 #include "os-shared-mutex.h"
 #include "os-shared-network.h"
+#include "os-shared-pollset.h"
 #include "os-shared-printf.h"
 #include "os-shared-queue.h"
 #include "os-shared-sockets.h"
@@ -188,6 +189,9 @@ int32 OS_API_Init(void)
             case OS_OBJECT_TYPE_OS_CONDVAR:
                 return_code = OS_CondVarAPI_Init();
                 break;
+            case OS_OBJECT_TYPE_OS_POLLSET:
+                return_code = OS_PollSetAPI_Init();
+                break;
             default:
                 break;
         }
@@ -342,6 +346,9 @@ void OS_CleanUpObject(osal_id_t object_id, void *arg)
         case OS_OBJECT_TYPE_OS_CONDVAR:
             OS_CondVarDelete(object_id);
             break;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            OS_PollSetDelete(object_id);
+            break;
         default:
             break;
     }
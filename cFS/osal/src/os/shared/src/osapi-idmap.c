@@ -103,6 +103,7 @@ OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
 OS_common_record_t *const OS_global_condvar_table   = &OS_common_table[OS_CONDVAR_BASE];
+OS_common_record_t *const OS_global_pollset_table   = &OS_common_table[OS_POLLSET_BASE];
 
 /*
  *********************************************************************************
@@ -160,6 +161,8 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_CONSOLES;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_MAX_CONDVARS;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            return OS_MAX_POLLSETS;
         default:
             return 0;
     }
@@ -202,6 +205,8 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_CONSOLE_BASE;
         case OS_OBJECT_TYPE_OS_CONDVAR:
             return OS_CONDVAR_BASE;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            return OS_POLLSET_BASE;
         default:
             return 0;
     }
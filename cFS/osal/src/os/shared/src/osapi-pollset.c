@@ -0,0 +1,274 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ *
+ *         This file  contains some of the OS APIs abstraction layer code
+ *         that is shared/common across all OS-specific implementations.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-idmap.h"
+#include "os-shared-pollset.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_POLLSETS) || (OS_MAX_POLLSETS <= 0)
+#error "osconfig.h must define OS_MAX_POLLSETS to a valid value"
+#endif
+
+OS_pollset_internal_record_t OS_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                     POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets a refcount on an object that may be a member of a poll set.
+ *           File/socket streams and queues are supported.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_PollSet_GetMember(osal_id_t objid, OS_object_token_t *obj_token)
+{
+    osal_objtype_t objtype;
+
+    objtype = OS_IdentifyObject(objid);
+    if (objtype != OS_OBJECT_TYPE_OS_STREAM && objtype != OS_OBJECT_TYPE_OS_QUEUE)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    return OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, objtype, objid, obj_token);
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAPI_Init(void)
+{
+    memset(OS_pollset_table, 0, sizeof(OS_pollset_table));
+    return OS_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name, uint32 options)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_pollset_internal_record_t *pollset;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pollset_id);
+    OS_CHECK_APINAME(pollset_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_POLLSET, pollset_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, pollset, obj_name, pollset_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_PollSetCreate_Impl(&token, options);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, pollset_id);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete(osal_id_t pollset_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, OS_OBJECT_TYPE_OS_POLLSET, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags)
+{
+    OS_object_token_t token;
+    OS_object_token_t obj_token;
+    int32             return_code;
+
+    /* Check parameters */
+    if (StateFlags == 0 || (StateFlags & ~(OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) != 0)
+    {
+        return OS_ERR_INVALID_ARGUMENT;
+    }
+
+    /*
+     * Changes to the membership are serialized via the global lock,
+     * the member is kept open while it is being added.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_POLLSET, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSet_GetMember(objid, &obj_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_PollSetAdd_Impl(&token, &obj_token, StateFlags);
+
+            OS_ObjectIdRelease(&obj_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid)
+{
+    OS_object_token_t token;
+    OS_object_token_t obj_token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_POLLSET, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSet_GetMember(objid, &obj_token);
+        if (return_code == OS_SUCCESS)
+        {
+            return_code = OS_PollSetRemove_Impl(&token, &obj_token);
+
+            OS_ObjectIdRelease(&obj_token);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWaitAbs(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                        OS_time_t abs_timeout)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(Events);
+    OS_CHECK_POINTER(EventCount);
+    OS_CHECK_SIZE(MaxEvents);
+
+    *EventCount = 0;
+
+    /*
+     * As with other blocking calls, this does not hold a lock or refcount
+     * on the poll set while waiting.  Deleting a poll set while another task
+     * is waiting on it has undefined results.
+     */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_POLLSET, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetWait_Impl(&token, Events, MaxEvents, EventCount, abs_timeout);
+    }
+
+    return return_code;
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+                     int32 msecs)
+{
+    return OS_PollSetWaitAbs(pollset_id, Events, MaxEvents, EventCount, OS_TimeFromRelativeMilliseconds(msecs));
+}
+
+/*----------------------------------------------------------------
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name)
+{
+    int32 return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pollset_id);
+    OS_CHECK_POINTER(pollset_name);
+
+    return_code = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_POLLSET, pollset_name, pollset_id);
+
+    return return_code;
+}
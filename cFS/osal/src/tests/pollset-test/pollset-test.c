@@ -0,0 +1,447 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * Filename: pollset-test.c
+ *
+ * Purpose: This file contains functional tests for "osapi-pollset"
+ * A number of UDP sockets are bound on the loopback interface and added to a
+ * poll set, and datagrams are sent to individual sockets to check that exactly
+ * those sockets are reported as ready.
+ *
+ * A queue is also added alongside the sockets, to check that a single wait
+ * reports whichever of the two has activity.
+ *
+ * The same sockets are then used to compare the per-wait cost of a poll set
+ * against OS_SelectMultiple() when only one socket out of many has activity.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+/*
+ * Upper limit on the number of sockets used by this test.  The actual number is also
+ * limited by OS_MAX_NUM_OPEN_FILES, and is determined at runtime.
+ */
+#define UT_MAX_SOCKETS 256
+
+/*
+ * Number of stream IDs to leave free for use by the rest of the system
+ * (e.g. console, the sender socket)
+ */
+#define UT_RESERVED_STREAMS 8
+
+/* First UDP port number to bind the test sockets to */
+#define UT_BASE_PORT 9900
+
+/* Number of iterations used for timing each method */
+#define UT_TIMING_ITERATIONS 2000
+
+/*
+ * Timeout for waits that are expected to succeed
+ *
+ * Note that the act of calling any "assert" routine causes console output, which
+ * can easily take tens or even hundreds of milliseconds to execute on platforms
+ * where the console is on a slow serial port.  Therefore this timeout must
+ * not be too short.
+ */
+#define UT_TIMEOUT 500
+
+osal_id_t     sock_ids[UT_MAX_SOCKETS];
+OS_SockAddr_t sock_addrs[UT_MAX_SOCKETS];
+uint32        num_socks;
+osal_id_t     sender_id;
+osal_id_t     pollset_id;
+bool          pollsetImplemented = true;
+bool          networkImplemented = true;
+
+/* *************************************** MAIN ************************************** */
+
+void Setup_Sockets(void)
+{
+    uint32 limit;
+    int32  status;
+
+    num_socks = 0;
+
+    status = OS_SocketOpen(&sender_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        networkImplemented = false;
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    status = OS_PollSetCreate(&pollset_id, "UtPollSet", 0);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        pollsetImplemented = false;
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    limit = OS_MAX_NUM_OPEN_FILES - UT_RESERVED_STREAMS;
+    if (limit > UT_MAX_SOCKETS)
+    {
+        limit = UT_MAX_SOCKETS;
+    }
+
+    while (num_socks < limit)
+    {
+        if (OS_SocketOpen(&sock_ids[num_socks], OS_SocketDomain_INET, OS_SocketType_DATAGRAM) != OS_SUCCESS)
+        {
+            break;
+        }
+
+        UtAssert_INT32_EQ(OS_SocketAddrInit(&sock_addrs[num_socks], OS_SocketDomain_INET), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrSetPort(&sock_addrs[num_socks], UT_BASE_PORT + num_socks), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrFromString(&sock_addrs[num_socks], "127.0.0.1"), OS_SUCCESS);
+
+        if (OS_SocketBind(sock_ids[num_socks], &sock_addrs[num_socks]) != OS_SUCCESS)
+        {
+            OS_close(sock_ids[num_socks]);
+            break;
+        }
+
+        ++num_socks;
+    }
+
+    UtPrintf("Using %lu sockets", (unsigned long)num_socks);
+    UtAssert_True(num_socks > 1, "num_socks (%lu) > 1", (unsigned long)num_socks);
+}
+
+void Teardown_Sockets(void)
+{
+    uint32 i;
+
+    for (i = 0; i < num_socks; ++i)
+    {
+        OS_close(sock_ids[i]);
+    }
+
+    num_socks = 0;
+
+    if (pollsetImplemented)
+    {
+        OS_PollSetDelete(pollset_id);
+    }
+
+    if (networkImplemented)
+    {
+        OS_close(sender_id);
+    }
+}
+
+/*
+ * Send a single byte to the given test socket
+ */
+void Send_To(uint32 idx)
+{
+    uint8 data = (uint8)idx;
+
+    UtAssert_INT32_EQ(OS_SocketSendTo(sender_id, &data, sizeof(data), &sock_addrs[idx]), sizeof(data));
+}
+
+/*
+ * Consume the pending byte on the given test socket
+ */
+void Recv_From(uint32 idx)
+{
+    uint8 data = 0;
+
+    UtAssert_INT32_EQ(OS_SocketRecvFrom(sock_ids[idx], &data, sizeof(data), NULL, UT_TIMEOUT), sizeof(data));
+    UtAssert_UINT8_EQ(data, (uint8)idx);
+}
+
+/*
+ * Send and consume a byte on the given test socket without asserting,
+ * so the timing loops are not dominated by console output
+ */
+bool Quiet_Send(uint32 idx)
+{
+    uint8 data = (uint8)idx;
+
+    return OS_SocketSendTo(sender_id, &data, sizeof(data), &sock_addrs[idx]) == sizeof(data);
+}
+
+bool Quiet_Recv(uint32 idx)
+{
+    uint8 data = 0;
+
+    return OS_SocketRecvFrom(sock_ids[idx], &data, sizeof(data), NULL, UT_TIMEOUT) == sizeof(data) &&
+           data == (uint8)idx;
+}
+
+bool Check_Implemented(void)
+{
+    if (!networkImplemented)
+    {
+        UtAssertEx(false, UTASSERT_CASETYPE_NA, __FILE__, __LINE__, "Network API not implemented");
+        return false;
+    }
+
+    if (!pollsetImplemented)
+    {
+        UtAssertEx(false, UTASSERT_CASETYPE_NA, __FILE__, __LINE__, "Poll set API not implemented");
+        return false;
+    }
+
+    return true;
+}
+
+void TestPollSetApi(void)
+{
+    osal_id_t         objid;
+    OS_PollSetEvent_t Events[4];
+    uint32            EventCount;
+    uint32            i;
+    uint32            idx;
+
+    if (!Check_Implemented())
+    {
+        return;
+    }
+
+    /* Argument checks */
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[0], 0), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[0], OS_STREAM_STATE_BOUND), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_INT32_EQ(OS_PollSetAdd(OS_OBJECT_ID_UNDEFINED, sock_ids[0], OS_STREAM_STATE_READABLE),
+                      OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, OS_OBJECT_ID_UNDEFINED, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, NULL, 4, &EventCount, 0), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 0, &EventCount, 0), OS_ERR_INVALID_SIZE);
+
+    UtAssert_INT32_EQ(OS_PollSetGetIdByName(&objid, "UtPollSet"), OS_SUCCESS);
+    UtAssert_True(OS_ObjectIdEqual(objid, pollset_id), "OS_PollSetGetIdByName() ID matches");
+    UtAssert_INT32_EQ(OS_PollSetGetIdByName(&objid, "NotFound"), OS_ERR_NAME_NOT_FOUND);
+
+    /* An empty set, or a set where nothing is ready, should time out */
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 0), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 0);
+
+    for (i = 0; i < num_socks; ++i)
+    {
+        UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[i], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 10), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 0);
+
+    /* Activity on a single socket in the middle of the set should report only that socket */
+    idx = num_socks / 2;
+    Send_To(idx);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, sock_ids[idx]), "Event objid (%lu) == sock_ids[%lu] (%lu)",
+                  OS_ObjectIdToInteger(Events[0].objid), (unsigned long)idx, OS_ObjectIdToInteger(sock_ids[idx]));
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    Recv_From(idx);
+
+    /* Activity on two sockets should report both, and nothing once consumed */
+    Send_To(0);
+    Send_To(num_socks - 1);
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 2);
+    Recv_From(0);
+    Recv_From(num_socks - 1);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 0), OS_ERROR_TIMEOUT);
+
+    /* A socket which is removed is no longer reported */
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, sock_ids[idx]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, sock_ids[idx]), OS_ERR_INCORRECT_OBJ_STATE);
+    Send_To(idx);
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 0), OS_ERROR_TIMEOUT);
+    Recv_From(idx);
+
+    /* A socket added for writability should be reported immediately */
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[idx], OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_WRITABLE);
+
+    /* Re-adding changes the states, rather than failing */
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[idx], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 0), OS_ERROR_TIMEOUT);
+}
+
+void TestPollSetQueue(void)
+{
+    osal_id_t         queue_id;
+    OS_PollSetEvent_t Events[4];
+    uint32            EventCount;
+    uint32            data;
+    size_t            data_size;
+    int32             status;
+
+    if (!Check_Implemented())
+    {
+        return;
+    }
+
+    UtAssert_INT32_EQ(OS_QueueCreate(&queue_id, "UtPollQueue", 4, sizeof(data), 0), OS_SUCCESS);
+
+    status = OS_PollSetAdd(pollset_id, queue_id, OS_STREAM_STATE_READABLE);
+    if (status == OS_ERR_OPERATION_NOT_SUPPORTED)
+    {
+        UtAssertEx(false, UTASSERT_CASETYPE_NA, __FILE__, __LINE__, "Queues cannot be polled on this OS");
+        OS_QueueDelete(queue_id);
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[0], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, 10), OS_ERROR_TIMEOUT);
+
+    /* A message on the queue wakes the wait, and only the queue is reported */
+    data = 0x5A5A;
+    UtAssert_INT32_EQ(OS_QueuePut(queue_id, &data, sizeof(data), 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, queue_id), "Event objid (%lu) == queue_id (%lu)",
+                  OS_ObjectIdToInteger(Events[0].objid), OS_ObjectIdToInteger(queue_id));
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    UtAssert_INT32_EQ(OS_QueueGet(queue_id, &data, sizeof(data), &data_size, OS_CHECK), OS_SUCCESS);
+
+    /* A datagram on the socket wakes the same wait */
+    Send_To(0);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, sock_ids[0]), "Event objid (%lu) == sock_ids[0] (%lu)",
+                  OS_ObjectIdToInteger(Events[0].objid), OS_ObjectIdToInteger(sock_ids[0]));
+    Recv_From(0);
+
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, queue_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_QueueDelete(queue_id), OS_SUCCESS);
+}
+
+void TestPollSetVsSelect(void)
+{
+    OS_PollSetEvent_t Events[4];
+    OS_FdSet          ReadSet;
+    OS_time_t         start_time;
+    OS_time_t         end_time;
+    int64             select_usec;
+    int64             pollset_usec;
+    uint32            EventCount;
+    uint32            i;
+    uint32            iter;
+    uint32            errors;
+    int32             status;
+
+    if (!Check_Implemented())
+    {
+        return;
+    }
+
+    for (i = 0; i < num_socks; ++i)
+    {
+        UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, sock_ids[i], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    }
+
+    /*
+     * In both cases only the last socket has activity, which is the worst case for
+     * a select() based implementation since the whole set must be translated and scanned.
+     */
+    errors = 0;
+    OS_GetLocalTime(&start_time);
+    for (iter = 0; iter < UT_TIMING_ITERATIONS; ++iter)
+    {
+        if (!Quiet_Send(num_socks - 1))
+        {
+            ++errors;
+        }
+
+        OS_SelectFdZero(&ReadSet);
+        for (i = 0; i < num_socks; ++i)
+        {
+            OS_SelectFdAdd(&ReadSet, sock_ids[i]);
+        }
+
+        status = OS_SelectMultiple(&ReadSet, NULL, UT_TIMEOUT);
+        if (status != OS_SUCCESS || !OS_SelectFdIsSet(&ReadSet, sock_ids[num_socks - 1]))
+        {
+            ++errors;
+        }
+
+        if (!Quiet_Recv(num_socks - 1))
+        {
+            ++errors;
+        }
+    }
+    OS_GetLocalTime(&end_time);
+    select_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    UtAssert_UINT32_EQ(errors, 0);
+
+    errors = 0;
+    OS_GetLocalTime(&start_time);
+    for (iter = 0; iter < UT_TIMING_ITERATIONS; ++iter)
+    {
+        if (!Quiet_Send(num_socks - 1))
+        {
+            ++errors;
+        }
+
+        status = OS_PollSetWait(pollset_id, Events, 4, &EventCount, UT_TIMEOUT);
+        if (status != OS_SUCCESS || EventCount != 1 || !OS_ObjectIdEqual(Events[0].objid, sock_ids[num_socks - 1]))
+        {
+            ++errors;
+        }
+
+        if (!Quiet_Recv(num_socks - 1))
+        {
+            ++errors;
+        }
+    }
+    OS_GetLocalTime(&end_time);
+    pollset_usec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    UtAssert_UINT32_EQ(errors, 0);
+
+    UtAssert_MIR("%lu sockets, %lu iterations: OS_SelectMultiple %ld usec, OS_PollSetWait %ld usec",
+                 (unsigned long)num_socks, (unsigned long)UT_TIMING_ITERATIONS, (long)select_usec,
+                 (long)pollset_usec);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(TestPollSetApi, Setup_Sockets, Teardown_Sockets, "TestPollSetApi");
+    UtTest_Add(TestPollSetQueue, Setup_Sockets, Teardown_Sockets, "TestPollSetQueue");
+    UtTest_Add(TestPollSetVsSelect, Setup_Sockets, Teardown_Sockets, "TestPollSetVsSelect");
+}
@@ -0,0 +1,112 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "os-shared-pollset.h"
+
+void Test_OS_PollSetCreate_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (UT_INDEX_0, 0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollSetDelete_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete_Impl, (UT_INDEX_0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollSetAdd_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token,
+     *                          uint32 StateFlags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (UT_INDEX_0, UT_INDEX_0, OS_STREAM_STATE_READABLE),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollSetRemove_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (UT_INDEX_0, UT_INDEX_0), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_PollSetWait_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+     *                           uint32 *EventCount, OS_time_t abs_timeout)
+     */
+    OS_PollSetEvent_t Events[1];
+    uint32            EventCount;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (UT_INDEX_0, Events, 1, &EventCount, OS_TIME_MAX),
+                           OS_ERR_NOT_IMPLEMENTED);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollSetCreate_Impl);
+    ADD_TEST(OS_PollSetDelete_Impl);
+    ADD_TEST(OS_PollSetAdd_Impl);
+    ADD_TEST(OS_PollSetRemove_Impl);
+    ADD_TEST(OS_PollSetWait_Impl);
+}
@@ -0,0 +1,259 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  portable
+ *
+ */
+
+#include "os-portable-coveragetest.h"
+#include "ut-adaptor-portable-posix-io.h"
+#include "os-shared-clock.h"
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+#include "OCS_sys_select.h"
+#include "OCS_errno.h"
+
+/*
+ * Set up a poll set token and a token for the stream at the given index,
+ * where the stream is open, selectable and uses the given fd
+ */
+static void UT_SelectPollSet_SetupTokens(OS_object_token_t *set_token, OS_object_token_t *obj_token,
+                                         osal_index_t idx, int fd)
+{
+    memset(set_token, 0, sizeof(*set_token));
+    set_token->obj_type = OS_OBJECT_TYPE_OS_POLLSET;
+
+    memset(obj_token, 0, sizeof(*obj_token));
+    obj_token->obj_type = OS_OBJECT_TYPE_OS_STREAM;
+    obj_token->obj_idx  = idx;
+    obj_token->obj_id   = OS_ObjectIdFromInteger(idx);
+
+    OS_global_stream_table[idx].active_id = obj_token->obj_id;
+    UT_PortablePosixIOTest_Set_FD(idx, fd);
+    UT_PortablePosixIOTest_Set_Selectable(idx, true);
+}
+
+void Test_OS_PollSetCreate_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetCreate_Impl(const OS_object_token_t *token, uint32 options)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&token, 0), OS_SUCCESS);
+}
+
+void Test_OS_PollSetDelete_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete_Impl, (&token), OS_SUCCESS);
+}
+
+void Test_OS_PollSetAdd_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token,
+     *                          uint32 StateFlags)
+     */
+    OS_object_token_t set_token;
+    OS_object_token_t obj_token;
+
+    UT_SelectPollSet_SetupTokens(&set_token, &obj_token, UT_INDEX_1, 1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&set_token, 0), OS_SUCCESS);
+
+    /* Only streams can be members */
+    obj_token.obj_type = OS_OBJECT_TYPE_OS_QUEUE;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    obj_token.obj_type = OS_OBJECT_TYPE_OS_STREAM;
+
+    /* Streams which select() cannot handle */
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_1, false);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_1, true);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_1, OCS_FD_SETSIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    /* Nominal, then change the flags of the existing member */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_1, 1);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token, OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+
+    /* The member was only added once */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token), OS_ERR_INCORRECT_OBJ_STATE);
+}
+
+void Test_OS_PollSetRemove_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, const OS_object_token_t *obj_token)
+     */
+    OS_object_token_t set_token;
+    OS_object_token_t obj_token1;
+    OS_object_token_t obj_token2;
+
+    UT_SelectPollSet_SetupTokens(&set_token, &obj_token1, UT_INDEX_1, 1);
+    UT_SelectPollSet_SetupTokens(&set_token, &obj_token2, OSAL_INDEX_C(2), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&set_token, 0), OS_SUCCESS);
+
+    /* Not a member */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token1), OS_ERR_INCORRECT_OBJ_STATE);
+
+    /* Removing the first member moves the last one into its place */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token1), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token2), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token2), OS_ERR_INCORRECT_OBJ_STATE);
+}
+
+void Test_OS_PollSetWait_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *Events, uint32 MaxEvents,
+     *                           uint32 *EventCount, OS_time_t abs_timeout)
+     */
+    OS_object_token_t set_token;
+    OS_object_token_t obj_token1;
+    OS_object_token_t obj_token2;
+    OS_PollSetEvent_t Events[2];
+    uint32            EventCount;
+    OS_time_t         nowtime;
+    OS_time_t         timeout;
+
+    UT_SelectPollSet_SetupTokens(&set_token, &obj_token1, UT_INDEX_1, 1);
+    UT_SelectPollSet_SetupTokens(&set_token, &obj_token2, OSAL_INDEX_C(2), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&set_token, 0), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&set_token, &obj_token1, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl,
+                           (&set_token, &obj_token2, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE),
+                           OS_SUCCESS);
+
+    /* Nothing ready */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_select), 0);
+    EventCount = 99;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, OS_TIME_MIN),
+                           OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 99);
+
+    /* Only the second member is ready, for reading */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_select), 1);
+    UT_SetDeferredRetcode(UT_KEY(OCS_FD_ISSET), 2, true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, OS_TIME_MAX), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, obj_token2.obj_id), "Events[0].objid == obj_token2.obj_id");
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_READABLE);
+
+    /* Both ready for everything, but only room for one event */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_FD_ISSET), true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 1, &EventCount, OS_TIME_MIN), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, obj_token1.obj_id), "Events[0].objid == obj_token1.obj_id");
+    UtAssert_UINT32_EQ(Events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, OS_TIME_MIN), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 2);
+    UtAssert_UINT32_EQ(Events[1].StateFlags, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE);
+
+    /* select() interrupted, then retried with the remaining time */
+    UT_ResetState(UT_KEY(OCS_select));
+    UT_SetDefaultReturnValue(UT_KEY(OCS_select), -1);
+    UT_SetDeferredRetcode(UT_KEY(OCS_select), 2, 0);
+    OCS_errno = OCS_EINTR;
+    nowtime   = OS_TimeFromTotalMilliseconds(1000);
+    timeout   = OS_TimeFromTotalMilliseconds(1200);
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime_Impl), &nowtime, sizeof(nowtime), false);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, timeout), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OCS_select, 2);
+    UtAssert_STUB_COUNT(OS_GetLocalTime_Impl, 2);
+
+    /* A timeout which has already passed, with a failing select() */
+    OCS_errno = OCS_EINVAL;
+    nowtime   = OS_TimeFromTotalMilliseconds(2000);
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime_Impl), &nowtime, sizeof(nowtime), false);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, timeout), OS_ERROR);
+
+    /* A member which has been closed is dropped from the set */
+    UT_SetDefaultReturnValue(UT_KEY(OCS_select), 1);
+    OS_global_stream_table[1].active_id = OS_OBJECT_ID_UNDEFINED;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, OS_TIME_MIN), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 1);
+    UtAssert_True(OS_ObjectIdEqual(Events[0].objid, obj_token2.obj_id), "Events[0].objid == obj_token2.obj_id");
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token1), OS_ERR_INCORRECT_OBJ_STATE);
+
+    /* A member whose ID can no longer be converted is also dropped */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&set_token, Events, 2, &EventCount, OS_TIME_MIN), OS_SUCCESS);
+    UtAssert_UINT32_EQ(EventCount, 0);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&set_token, &obj_token2), OS_ERR_INCORRECT_OBJ_STATE);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollSetCreate_Impl);
+    ADD_TEST(OS_PollSetDelete_Impl);
+    ADD_TEST(OS_PollSetAdd_Impl);
+    ADD_TEST(OS_PollSetRemove_Impl);
+    ADD_TEST(OS_PollSetWait_Impl);
+}
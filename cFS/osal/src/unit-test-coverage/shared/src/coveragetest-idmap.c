@@ -751,8 +751,9 @@ void Test_OS_ObjectIdAllocateNew(void)
     actual = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, NULL, &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate(NULL) (%ld) == OS_SUCCESS", (long)actual);
 
-    OS_global_task_table[0].name_entry = "UT_alloc";
-    expected                           = OS_ERR_NAME_TAKEN;
+    /* Name the record just allocated, wherever the earlier test cases left the next free slot */
+    OS_global_task_table[token.obj_idx].name_entry = "UT_alloc";
+    expected                                       = OS_ERR_NAME_TAKEN;
     actual                             = OS_ObjectIdAllocateNew(OS_OBJECT_TYPE_OS_TASK, "UT_alloc", &token);
     UtAssert_True(actual == expected, "OS_ObjectIdAllocate() (%ld) == OS_ERR_NAME_TAKEN", (long)actual);
 
@@ -1041,7 +1042,7 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObject() TaskCount (%lu) == 1", (unsigned long)Count.TaskCount);
     UtAssert_True(Count.QueueCount == 1, "OS_ForEachObject() QueueCount (%lu) == 1", (unsigned long)Count.QueueCount);
     UtAssert_True(Count.MutexCount == 1, "OS_ForEachObject() MutexCount (%lu) == 1", (unsigned long)Count.MutexCount);
-    UtAssert_True(Count.OtherCount == 11, "OS_ForEachObject() OtherCount (%lu) == 11", (unsigned long)Count.OtherCount);
+    UtAssert_True(Count.OtherCount == 12, "OS_ForEachObject() OtherCount (%lu) == 12", (unsigned long)Count.OtherCount);
 
     OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObjectOfType(), creator %08lx TaskCount (%lu) == 1",
@@ -1162,6 +1163,9 @@ void Test_OS_ObjectIDInteger(void)
 
     memset(&token, 0, sizeof(token));
 
+    /* Start from empty tables, so every record of every type can be allocated */
+    OS_ObjectIdInit();
+
     for (idtype = 0; idtype < OS_OBJECT_TYPE_USER; ++idtype)
     {
         actual = OS_SUCCESS;
@@ -1181,7 +1185,7 @@ void Test_OS_ObjectIDInteger(void)
         }
     }
 
-    UtAssert_True(recordscount < OS_MAX_TOTAL_RECORDS, "All Id types checked");
+    UtAssert_True(recordscount == OS_MAX_TOTAL_RECORDS, "All Id types checked");
 
     for (i = 0; i < recordscount; i++)
     {
@@ -0,0 +1,235 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  shared
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-pollset.h"
+
+#include "OCS_string.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_PollSetAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_PollSetCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name, uint32 options)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT", 0), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(NULL, "UT", 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, NULL, 0), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT", 0), OS_ERROR);
+
+    UT_SetDefaultReturnValue(UT_KEY(OCS_memchr), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT", 0), OS_ERR_NAME_TOO_LONG);
+}
+
+void Test_OS_PollSetDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetDelete(osal_id_t pollset_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(UT_OBJID_1), OS_ERROR);
+}
+
+void Test_OS_PollSetAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags)
+     */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE),
+                           OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, 0), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_BOUND), OS_ERR_INVALID_ARGUMENT);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetAdd_Impl), OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_PollSetAdd_Impl));
+
+    /* queues are also accepted */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    /* other object types are not */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_BINSEM);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+
+    /* failure to get the member */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+
+    /* failure to get the poll set */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid)
+     */
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetRemove_Impl), OS_ERR_INCORRECT_OBJ_STATE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INCORRECT_OBJ_STATE);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_PollSetRemove_Impl));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_QUEUE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_UNDEFINED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_IdentifyObject), OS_OBJECT_TYPE_OS_STREAM);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+     *                      int32 msecs)
+     */
+    OS_PollSetEvent_t Events[2];
+    uint32            EventCount;
+
+    EventCount = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, Events, 2, &EventCount, 0), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, NULL, 2, &EventCount, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, Events, 2, NULL, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, Events, 0, &EventCount, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetWait_Impl), OS_ERROR_TIMEOUT);
+    EventCount = 1;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, Events, 2, &EventCount, 10), OS_ERROR_TIMEOUT);
+    UtAssert_UINT32_EQ(EventCount, 0);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, Events, 2, &EventCount, -1), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetWaitAbs(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetWaitAbs(osal_id_t pollset_id, OS_PollSetEvent_t *Events, uint32 MaxEvents, uint32 *EventCount,
+     *                         OS_time_t abs_timeout)
+     */
+    OS_PollSetEvent_t Events[2];
+    uint32            EventCount;
+    OS_time_t         timeout;
+
+    timeout = OS_TimeAssembleFromMilliseconds(100, 100);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWaitAbs(UT_OBJID_1, Events, 2, &EventCount, timeout), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetWait_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWaitAbs(UT_OBJID_1, Events, 2, &EventCount, timeout), OS_ERROR);
+}
+
+void Test_OS_PollSetGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name)
+     */
+    osal_id_t objid = OS_OBJECT_ID_UNDEFINED;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, "UT"), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, "NF"), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, NULL), OS_INVALID_POINTER);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollSetAPI_Init);
+    ADD_TEST(OS_PollSetCreate);
+    ADD_TEST(OS_PollSetDelete);
+    ADD_TEST(OS_PollSetAdd);
+    ADD_TEST(OS_PollSetRemove);
+    ADD_TEST(OS_PollSetWait);
+    ADD_TEST(OS_PollSetWaitAbs);
+    ADD_TEST(OS_PollSetGetIdByName);
+}
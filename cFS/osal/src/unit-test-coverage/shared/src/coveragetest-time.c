@@ -186,6 +186,13 @@ void Test_OS_TimerDelete(void)
     OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, timebase_id, &timebase_token);
     timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timebase_token);
 
+    /*
+     * Start from an empty callback ring: the stub lookup of the undefined
+     * first_cb would otherwise succeed and link timer 1 to a phantom entry
+     */
+    timebase->first_cb = OS_OBJECT_ID_UNDEFINED;
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+
     /* Add and confirm timebase and cb references */
     OS_TimerAdd(&timer_objid_1, "UT1", timebase_id, UT_TimerArgCallback, NULL);
     UtAssert_True(OS_ObjectIdEqual(timebase->first_cb, timer_objid_1), "1st timer add - First CB at timer 1");
@@ -297,6 +304,9 @@ void Test_OS_TimerGetInfo(void)
 void Osapi_Test_Setup(void)
 {
     UT_ResetState(0);
+
+    /* clear the callback ring links left by earlier test cases */
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
 }
 
 /*
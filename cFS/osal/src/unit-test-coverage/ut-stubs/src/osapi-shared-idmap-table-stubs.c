@@ -42,6 +42,7 @@ OS_common_record_t OS_stub_stream_table[OS_MAX_NUM_OPEN_FILES];
 OS_common_record_t OS_stub_dir_table[OS_MAX_NUM_OPEN_DIRS];
 OS_common_record_t OS_stub_condvar_table[OS_MAX_CONDVARS];
 OS_common_record_t OS_stub_rwlock_table[OS_MAX_RWLOCKS];
+OS_common_record_t OS_stub_pollset_table[OS_MAX_POLLSETS];
 
 OS_common_record_t *const OS_global_task_table      = OS_stub_task_table;
 OS_common_record_t *const OS_global_queue_table     = OS_stub_queue_table;
@@ -57,3 +58,4 @@ OS_common_record_t *const OS_global_filesys_table   = OS_stub_filesys_table;
 OS_common_record_t *const OS_global_console_table   = OS_stub_console_table;
 OS_common_record_t *const OS_global_condvar_table   = OS_stub_condvar_table;
 OS_common_record_t *const OS_global_rwlock_table    = OS_stub_rwlock_table;
+OS_common_record_t *const OS_global_pollset_table   = OS_stub_pollset_table;
@@ -0,0 +1,133 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ *
+ * Stub implementations for the functions defined in the OSAL API
+ *
+ * The stub implementation can be used for unit testing applications built
+ * on top of OSAL.  The stubs do not do any real function, but allow
+ * the return code to be crafted such that error paths in the application
+ * can be executed.
+ */
+
+#include "osapi-pollset.h" /* OSAL public API for this subsystem */
+#include "utstub-helpers.h"
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetCreate' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *pollset_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_POLLSET);
+    }
+    else
+    {
+        *pollset_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetDelete' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetDelete(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t);
+    int32     status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        UT_DeleteStubObjId(OS_OBJECT_TYPE_OS_POLLSET, pollset_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetGetIdByName' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetGetIdByName(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_PollSetGetIdByName), pollset_id, sizeof(*pollset_id)) < sizeof(*pollset_id))
+    {
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_POLLSET, pollset_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Common handler for the 'OS_PollSetWait' and 'OS_PollSetWaitAbs' stubs
+ *
+ * The events are taken from the data buffer of the stub, if any.
+ * -----------------------------------------------------------------
+ */
+static void UT_PollSetWaitCommon(UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_PollSetEvent_t *Events     = UT_Hook_GetArgValueByName(Context, "Events", OS_PollSetEvent_t *);
+    uint32             MaxEvents  = UT_Hook_GetArgValueByName(Context, "MaxEvents", uint32);
+    uint32 *           EventCount = UT_Hook_GetArgValueByName(Context, "EventCount", uint32 *);
+    int32              status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    *EventCount = 0;
+    if (status == OS_SUCCESS)
+    {
+        *EventCount = UT_Stub_CopyToLocal(FuncKey, Events, MaxEvents * sizeof(*Events)) / sizeof(*Events);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetWait' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetWait(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_PollSetWaitCommon(FuncKey, Context);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetWaitAbs' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetWaitAbs(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    UT_PollSetWaitCommon(FuncKey, Context);
+}
@@ -831,6 +831,16 @@ uint32 UtAssert_GetFailCount(void);
  */
 const UtAssert_TestCounter_t *UtAssert_GetCounters(void);
 
+/**
+ * \brief Adds a set of counter values into the UtAssert counters
+ *
+ * This is used to merge the results of tests that were executed elsewhere,
+ * such as in a separate worker process.
+ *
+ * \param TestCounters  Counter values to add
+ */
+void UtAssert_MergeCounters(const UtAssert_TestCounter_t *TestCounters);
+
 /**
  * \brief Begins a test Segment
  *
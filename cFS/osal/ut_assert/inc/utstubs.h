@@ -250,7 +250,7 @@ void UT_ConfigureGenericStubReturnValue(UT_EntryKey_t FuncKey, const void *Value
  * \param FuncKey The stub function to add the data buffer to.
  * \param DataBuffer Pointer to data buffer that should be associated with the stub function
  * \param BufferSize Size of data buffer
- * \param AllocateCopy If true then malloc() will be used to allocate a copy of the buffer
+ * \param AllocateCopy If true then a copy of the buffer will be allocated
  *      and the supplied DataBuffer will be copied into it via memcpy() before returning.  The
  *      buffer will be freed after the test code reads it or the test state is reset.  If this
  *      is false then the DataBuffer pointer is used directly, and must remain valid for the duration
@@ -32,6 +32,8 @@
 
 #include <stdbool.h>
 
+#include "common_types.h"
+
 /*
  * Exported Functions
  */
@@ -102,6 +104,17 @@ void UtTest_AddSubTest(void (*Test)(void), void (*Setup)(void), void (*Teardown)
  */
 void UtTest_EarlyInit(void);
 
+/**
+ * \brief Set the number of worker processes used to execute tests
+ *
+ * If greater than 1, and the platform supports it, UtTest_Run() will distribute
+ * the test groups across this many worker processes and merge the results.
+ * Setup and teardown sequences are executed in every worker.
+ *
+ * \param JobCount Number of worker processes, 0 or 1 executes all tests in the current process
+ */
+void UtTest_SetJobCount(uint32 JobCount);
+
 /**
  * \brief Execute all registered tests
  *
@@ -123,6 +123,18 @@ const UtAssert_TestCounter_t *UtAssert_GetCounters(void)
     return &UT_TotalCounters;
 }
 
+void UtAssert_MergeCounters(const UtAssert_TestCounter_t *TestCounters)
+{
+    uint32 Ct;
+
+    UT_TotalCounters.TestSegmentCount += TestCounters->TestSegmentCount;
+    UT_TotalCounters.TotalTestCases += TestCounters->TotalTestCases;
+    for (Ct = 0; Ct < UTASSERT_CASETYPE_MAX; ++Ct)
+    {
+        UT_TotalCounters.CaseCount[Ct] += TestCounters->CaseCount[Ct];
+    }
+}
+
 void UtAssert_BeginTest(const char *SegmentName)
 {
     uint32 TestSegmentCount;
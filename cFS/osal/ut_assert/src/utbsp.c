@@ -63,9 +63,17 @@ void UT_BSP_Setup(void)
     uint8        UserShift;
     uint32       ArgC;
     char *const *ArgV;
+    const char * EnvValue;
 
     memset(&BSP_UT_Global, 0, sizeof(BSP_UT_Global));
 
+    /* The number of worker processes may be given in the environment, so it can be set for a whole ctest run */
+    EnvValue = getenv("UTASSERT_JOBS");
+    if (EnvValue != NULL)
+    {
+        UtTest_SetJobCount(strtoul(EnvValue, NULL, 0));
+    }
+
     UserShift = UTASSERT_CASETYPE_NONE;
     ArgC      = OS_BSP_GetArgC();
     if (ArgC > 0)
@@ -89,6 +97,12 @@ void UT_BSP_Setup(void)
                 UserShift = strtoul(ArgV[1], NULL, 0);
                 ++ArgV;
             }
+            if (strcmp(ArgV[0], "-j") == 0 && ArgC > 0)
+            {
+                --ArgC;
+                UtTest_SetJobCount(strtoul(ArgV[1], NULL, 0));
+                ++ArgV;
+            }
 
             ++ArgV;
         }
@@ -28,6 +28,8 @@
 /*
  * Includes
  */
+#include <time.h>
+
 #include "osapi.h"
 #include "utassert.h"
 #include "utlist.h"
@@ -50,10 +52,40 @@ typedef struct
     char TestName[OS_MAX_API_NAME * 2];
 } UtTestDataBaseEntry_t;
 
+/*
+ * Execution time is accumulated per test group, which is the part of the
+ * test name before the first '.' (see UtTest_AddSubTest), or the whole name.
+ * Groups beyond this limit are accumulated into the final entry.
+ */
+#define UTASSERT_MAX_TIMING_GROUPS 64
+
+/*
+ * Number of individual tests listed in the slowest tests report
+ */
+#define UTASSERT_MAX_SLOWEST_TESTS 10
+
+typedef struct
+{
+    char    GroupName[OS_MAX_API_NAME];
+    uint32  TestCount;
+    clock_t Elapsed;
+} UtTestGroupTiming_t;
+
+typedef struct
+{
+    char    TestName[OS_MAX_API_NAME * 2];
+    clock_t Elapsed;
+} UtTestCaseTiming_t;
+
 typedef struct
 {
-    UtListHead_t *DataBasePtr;
-    uint32        ExecutedCount;
+    UtListHead_t *      DataBasePtr;
+    uint32              ExecutedCount;
+    uint32              JobCount;
+    uint32              TimingGroupCount;
+    UtTestGroupTiming_t TimingGroups[UTASSERT_MAX_TIMING_GROUPS];
+    uint32              SlowestCount;
+    UtTestCaseTiming_t  SlowestTests[UTASSERT_MAX_SLOWEST_TESTS];
 } UtAssert_Global_t;
 
 /*
@@ -61,4 +93,36 @@ typedef struct
  */
 extern UtAssert_Global_t UtAssert_Global;
 
+/*
+ * Internal functions shared between the test runner implementation files
+ */
+
+/**
+ * Execute a single entry from the test database, including its setup and teardown
+ */
+void UtTest_RunEntry(const UtTestDataBaseEntry_t *UtTestDataBaseEntry);
+
+/**
+ * Get the length of the group part of a test name, i.e. the part before the first '.'
+ */
+size_t UtTest_GetGroupNameLen(const char *TestName);
+
+/**
+ * Add the execution time of one or more tests to the timing report
+ */
+void UtTest_RecordGroupTiming(const char *TestName, uint32 TestCount, clock_t Elapsed);
+
+/**
+ * Add the execution time of a single test to the slowest tests report, if it qualifies
+ */
+void UtTest_RecordTestTiming(const char *TestName, clock_t Elapsed);
+
+/**
+ * Execute the tests in the merged list using UtAssert_Global.JobCount worker processes
+ *
+ * \returns true if the tests were executed, false if this is not possible and
+ *          the tests should be executed in the current process instead.
+ */
+bool UtTest_RunShards(UtListNode_t *UtListMain);
+
 #endif /* UTGLOBAL_H */
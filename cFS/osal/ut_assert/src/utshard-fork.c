@@ -0,0 +1,308 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+ * File: utshard-fork.c
+ *
+ * Purpose: Executes the registered tests in parallel worker processes created with fork().
+ *
+ * Test groups (see UtTest_GetGroupNameLen) are distributed round-robin across the workers,
+ * setup and teardown sequences are executed by every worker.  Stub state is global,
+ * so each worker must be a separate process rather than a thread.
+ *
+ * The console output of each worker is captured to a temporary file and replayed in
+ * worker order once all workers are complete, so the output of a sharded run reads the
+ * same as a sequential run.  Workers terminate via exit() so that any coverage data
+ * gets written out as usual.
+ */
+
+/*
+ * Includes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include "utglobal.h"
+
+/*
+ * Upper limit on the number of worker processes
+ */
+#define UTASSERT_MAX_JOBS 64
+
+/*
+ * Results passed back from a worker process to the parent,
+ * followed by the timing group and slowest test entries
+ */
+typedef struct
+{
+    UtAssert_TestCounter_t Counters;
+    uint32                 TimingGroupCount;
+    uint32                 SlowestCount;
+} UtShardResult_t;
+
+typedef struct
+{
+    pid_t Pid;
+    FILE *LogFile;
+    FILE *ResultFile;
+} UtShard_t;
+
+/*
+ * Executes the part of the test list assigned to the given shard, and writes
+ * the results to the result file.  This is called in the worker process.
+ */
+static void UtShard_RunWorker(UtListNode_t *UtListMain, uint32 ShardNum, uint32 JobCount, FILE *ResultFile)
+{
+    UtListNode_t *                UtListNode;
+    const UtTestDataBaseEntry_t * UtTestDataBaseEntry;
+    const char *                  PrevGroupName;
+    size_t                        PrevGroupLen;
+    size_t                        GroupLen;
+    uint32                        GroupNum;
+    UtAssert_TestCounter_t        InitialCounters;
+    UtShardResult_t               Result;
+    const UtAssert_TestCounter_t *FinalCounters;
+    uint32                        Ct;
+
+    /* Anything counted before the fork (i.e. during UtTest_Setup) is already counted by the parent */
+    memcpy(&InitialCounters, UtAssert_GetCounters(), sizeof(InitialCounters));
+
+    PrevGroupName = NULL;
+    PrevGroupLen  = 0;
+    GroupNum      = 0;
+
+    for (UtListNode = UtList_GetNext(UtListMain); !UtList_IsEnd(UtListMain, UtListNode);
+         UtListNode = UtList_GetNext(UtListNode))
+    {
+        UtTestDataBaseEntry = UtList_GetObject(UtListNode);
+        if (UtTestDataBaseEntry == NULL)
+        {
+            continue;
+        }
+
+        /* Entries without a test function are setup/teardown sequences, which every worker needs */
+        if (UtTestDataBaseEntry->Test != NULL)
+        {
+            GroupLen = UtTest_GetGroupNameLen(UtTestDataBaseEntry->TestName);
+            if (PrevGroupName == NULL || GroupLen != PrevGroupLen ||
+                strncmp(PrevGroupName, UtTestDataBaseEntry->TestName, GroupLen) != 0)
+            {
+                if (PrevGroupName != NULL)
+                {
+                    ++GroupNum;
+                }
+                PrevGroupName = UtTestDataBaseEntry->TestName;
+                PrevGroupLen  = GroupLen;
+            }
+
+            if ((GroupNum % JobCount) != ShardNum)
+            {
+                continue;
+            }
+        }
+
+        UtTest_RunEntry(UtTestDataBaseEntry);
+    }
+
+    memset(&Result, 0, sizeof(Result));
+    FinalCounters                    = UtAssert_GetCounters();
+    Result.Counters.TestSegmentCount = FinalCounters->TestSegmentCount - InitialCounters.TestSegmentCount;
+    Result.Counters.TotalTestCases   = FinalCounters->TotalTestCases - InitialCounters.TotalTestCases;
+    for (Ct = 0; Ct < UTASSERT_CASETYPE_MAX; ++Ct)
+    {
+        Result.Counters.CaseCount[Ct] = FinalCounters->CaseCount[Ct] - InitialCounters.CaseCount[Ct];
+    }
+    Result.TimingGroupCount = UtAssert_Global.TimingGroupCount;
+    Result.SlowestCount     = UtAssert_Global.SlowestCount;
+
+    fwrite(&Result, sizeof(Result), 1, ResultFile);
+    fwrite(UtAssert_Global.TimingGroups, sizeof(UtAssert_Global.TimingGroups[0]), Result.TimingGroupCount,
+           ResultFile);
+    fwrite(UtAssert_Global.SlowestTests, sizeof(UtAssert_Global.SlowestTests[0]), Result.SlowestCount, ResultFile);
+    fflush(ResultFile);
+}
+
+/*
+ * Copies the captured console output of a worker to the console of this process
+ */
+static void UtShard_ReplayLog(FILE *LogFile)
+{
+    char    Buffer[4096];
+    size_t  ReadLen;
+    ssize_t WriteLen;
+    size_t  Offset;
+
+    rewind(LogFile);
+    while ((ReadLen = fread(Buffer, 1, sizeof(Buffer), LogFile)) > 0)
+    {
+        Offset = 0;
+        while (Offset < ReadLen)
+        {
+            WriteLen = write(STDOUT_FILENO, &Buffer[Offset], ReadLen - Offset);
+            if (WriteLen <= 0)
+            {
+                return;
+            }
+            Offset += WriteLen;
+        }
+    }
+}
+
+/*
+ * Reads the results of a worker and merges them into the results of this process
+ *
+ * Returns false if the results are incomplete
+ */
+static bool UtShard_MergeResult(FILE *ResultFile)
+{
+    UtShardResult_t     Result;
+    UtTestGroupTiming_t GroupTiming;
+    UtTestCaseTiming_t  TestTiming;
+    uint32              i;
+
+    rewind(ResultFile);
+    if (fread(&Result, sizeof(Result), 1, ResultFile) != 1 || Result.TimingGroupCount > UTASSERT_MAX_TIMING_GROUPS ||
+        Result.SlowestCount > UTASSERT_MAX_SLOWEST_TESTS)
+    {
+        return false;
+    }
+
+    UtAssert_MergeCounters(&Result.Counters);
+
+    for (i = 0; i < Result.TimingGroupCount; ++i)
+    {
+        if (fread(&GroupTiming, sizeof(GroupTiming), 1, ResultFile) != 1)
+        {
+            return false;
+        }
+        GroupTiming.GroupName[sizeof(GroupTiming.GroupName) - 1] = 0;
+        UtTest_RecordGroupTiming(GroupTiming.GroupName, GroupTiming.TestCount, GroupTiming.Elapsed);
+    }
+
+    for (i = 0; i < Result.SlowestCount; ++i)
+    {
+        if (fread(&TestTiming, sizeof(TestTiming), 1, ResultFile) != 1)
+        {
+            return false;
+        }
+        TestTiming.TestName[sizeof(TestTiming.TestName) - 1] = 0;
+        UtTest_RecordTestTiming(TestTiming.TestName, TestTiming.Elapsed);
+    }
+
+    return true;
+}
+
+bool UtTest_RunShards(UtListNode_t *UtListMain)
+{
+    UtShard_t              Shards[UTASSERT_MAX_JOBS];
+    UtAssert_TestCounter_t FailedCounters;
+    char                   ReportBuffer[128];
+    uint32                 JobCount;
+    uint32                 ShardNum;
+    int                    Status;
+
+    JobCount = UtAssert_Global.JobCount;
+    if (JobCount > UTASSERT_MAX_JOBS)
+    {
+        JobCount = UTASSERT_MAX_JOBS;
+    }
+
+    /* Get all temporary files before starting anything, so it is still possible to fall back */
+    memset(Shards, 0, sizeof(Shards));
+    for (ShardNum = 0; ShardNum < JobCount; ++ShardNum)
+    {
+        Shards[ShardNum].LogFile    = tmpfile();
+        Shards[ShardNum].ResultFile = tmpfile();
+        if (Shards[ShardNum].LogFile == NULL || Shards[ShardNum].ResultFile == NULL)
+        {
+            break;
+        }
+    }
+
+    if (ShardNum < JobCount)
+    {
+        JobCount = ShardNum + 1;
+        for (ShardNum = 0; ShardNum < JobCount; ++ShardNum)
+        {
+            if (Shards[ShardNum].LogFile != NULL)
+            {
+                fclose(Shards[ShardNum].LogFile);
+            }
+            if (Shards[ShardNum].ResultFile != NULL)
+            {
+                fclose(Shards[ShardNum].ResultFile);
+            }
+        }
+
+        UT_BSP_DoText(UTASSERT_CASETYPE_WARN, "Cannot create worker files, running tests sequentially");
+        return false;
+    }
+
+    snprintf(ReportBuffer, sizeof(ReportBuffer), "Running tests in %u worker processes", (unsigned int)JobCount);
+    UT_BSP_DoText(UTASSERT_CASETYPE_INFO, ReportBuffer);
+
+    for (ShardNum = 0; ShardNum < JobCount; ++ShardNum)
+    {
+        /* Anything still buffered would otherwise be output again by the worker */
+        fflush(NULL);
+
+        Shards[ShardNum].Pid = fork();
+        if (Shards[ShardNum].Pid == 0)
+        {
+            dup2(fileno(Shards[ShardNum].LogFile), STDOUT_FILENO);
+            UtShard_RunWorker(UtListMain, ShardNum, JobCount, Shards[ShardNum].ResultFile);
+            fflush(NULL);
+            exit(EXIT_SUCCESS);
+        }
+    }
+
+    memset(&FailedCounters, 0, sizeof(FailedCounters));
+    for (ShardNum = 0; ShardNum < JobCount; ++ShardNum)
+    {
+        Status = -1;
+        if (Shards[ShardNum].Pid > 0 && waitpid(Shards[ShardNum].Pid, &Status, 0) != Shards[ShardNum].Pid)
+        {
+            Status = -1;
+        }
+
+        UtShard_ReplayLog(Shards[ShardNum].LogFile);
+
+        if (!WIFEXITED(Status) || WEXITSTATUS(Status) != EXIT_SUCCESS ||
+            !UtShard_MergeResult(Shards[ShardNum].ResultFile))
+        {
+            snprintf(ReportBuffer, sizeof(ReportBuffer), "Worker %u did not complete, status=0x%x",
+                     (unsigned int)ShardNum, (unsigned int)Status);
+            UT_BSP_DoText(UTASSERT_CASETYPE_FAILURE, ReportBuffer);
+
+            ++FailedCounters.TotalTestCases;
+            ++FailedCounters.CaseCount[UTASSERT_CASETYPE_FAILURE];
+        }
+
+        fclose(Shards[ShardNum].LogFile);
+        fclose(Shards[ShardNum].ResultFile);
+    }
+
+    UtAssert_MergeCounters(&FailedCounters);
+
+    return true;
+}
@@ -46,6 +46,21 @@
 #define UT_APPNAME_MAX_LEN    80
 #define UT_SUBSYS_MAX_LEN     5
 #define UT_MODEFLAG_ALLOC_BUF 0x1U
+#define UT_MODEFLAG_ARENA_BUF 0x2U
+
+/*
+ * Number of hash buckets in the stub index (as a power of 2).
+ * Each bucket holds the entries for all FuncKeys that hash to it, in the order they were added.
+ */
+#define UT_STUB_HASH_BITS    8
+#define UT_STUB_HASH_BUCKETS (1U << UT_STUB_HASH_BITS)
+
+/*
+ * Size of the arena used for stub-owned return value and data buffers.
+ * The arena is reset as a whole by UT_ResetState(0); if it fills up, malloc() is used instead.
+ */
+#define UT_STUB_ARENA_SIZE  65536
+#define UT_STUB_ARENA_ALIGN 16
 
 /*
  * Macro to combine a genre and size into a single integer value that can be
@@ -127,86 +142,201 @@ typedef union
 /*
  * Definition of internal stub table structure
  */
-typedef struct
+typedef struct UT_StubTableEntry
 {
-    UT_EntryType_t EntryType;
-    uint32         ModeFlags;
-    UT_EntryKey_t  FuncKey;
-    UT_EntryData_t Data;
+    UT_EntryType_t            EntryType;
+    uint32                    ModeFlags;
+    UT_EntryKey_t             FuncKey;
+    struct UT_StubTableEntry *Next; /**< Next entry in the same hash bucket, or next entry on the free list */
+    UT_EntryData_t            Data;
 } UT_StubTableEntry_t;
 
-static UT_StubTableEntry_t UT_StubTable[UT_MAX_FUNC_STUBS] = {{0}};
-static uint32              UT_MaxStubSearchLen             = 0;
+typedef struct
+{
+    UT_StubTableEntry_t *Head;
+    UT_StubTableEntry_t *Tail;
+} UT_StubBucket_t;
+
+typedef union
+{
+    uint8       Bytes[UT_STUB_ARENA_SIZE];
+    long double AlignLd;
+    void *      AlignPtr;
+    uint64      AlignInt;
+} UT_StubArena_t;
+
+static UT_StubTableEntry_t  UT_StubTable[UT_MAX_FUNC_STUBS] = {{0}};
+static UT_StubBucket_t      UT_StubIndex[UT_STUB_HASH_BUCKETS];
+static UT_StubTableEntry_t *UT_StubFreeList  = NULL;
+static uint32               UT_StubHighWater = 0; /* Entries below this index have been used since the last reset */
+static UT_StubArena_t       UT_StubArena;
+static size_t               UT_StubArenaUsed = 0;
+
+/**
+ * Helper function to map a FuncKey to its bucket in the stub index.
+ * The keys are typically function addresses, so the low bits are not well distributed on their own.
+ */
+static inline UT_StubBucket_t *UT_GetStubBucket(UT_EntryKey_t FuncKey)
+{
+    uint32 Hash;
+
+    Hash = (uint32)FuncKey ^ (uint32)((uint64)FuncKey >> 32);
+    Hash *= 0x9E3779B1U;
+
+    return &UT_StubIndex[Hash >> (32 - UT_STUB_HASH_BITS)];
+}
+
+/**
+ * Helper function to get a buffer for a stub table entry.
+ * This comes from the arena if there is space, and malloc() otherwise.  The entry
+ * ModeFlags are updated to indicate which, so UT_ClearStubEntry() can release it.
+ */
+static void *UT_AllocStubBuffer(UT_StubTableEntry_t *StubPtr, size_t Size)
+{
+    void * BufPtr;
+    size_t AllocSize;
+
+    AllocSize = (Size + UT_STUB_ARENA_ALIGN - 1) & ~((size_t)UT_STUB_ARENA_ALIGN - 1);
+    if (AllocSize <= (sizeof(UT_StubArena.Bytes) - UT_StubArenaUsed))
+    {
+        BufPtr = &UT_StubArena.Bytes[UT_StubArenaUsed];
+        UT_StubArenaUsed += AllocSize;
+        StubPtr->ModeFlags |= UT_MODEFLAG_ARENA_BUF;
+    }
+    else
+    {
+        BufPtr = malloc(Size);
+        if (BufPtr == NULL)
+        {
+            UtAssert_Abort("Cannot allocate data buffer - malloc() failed!");
+        }
+        else
+        {
+            StubPtr->ModeFlags |= UT_MODEFLAG_ALLOC_BUF;
+        }
+    }
+
+    return BufPtr;
+}
 
 /**
  * Helper function to clear an entry in the stub table.
- * This will call "free()" on any dynamically allocated buffers within the entry,
- * then zero out the entire block so it can be re-used.
+ * This will release any dynamically allocated buffers within the entry,
+ * unlink it from the index, then zero out the entire block so it can be re-used.
  */
 static void UT_ClearStubEntry(UT_StubTableEntry_t *StubPtr)
 {
-    /* Be sure to call free() on any malloc'ed buffers before clearing */
+    UT_StubBucket_t *    Bucket;
+    UT_StubTableEntry_t *PrevPtr;
+    size_t               AllocSize;
+
+    /* Be sure to release any allocated buffers before clearing */
     if ((StubPtr->EntryType == UT_ENTRYTYPE_DATA_BUFFER || StubPtr->EntryType == UT_ENTRYTYPE_RETURN_BUFFER) &&
-        StubPtr->Data.Buff.BasePtr != NULL && (StubPtr->ModeFlags & UT_MODEFLAG_ALLOC_BUF) != 0)
+        StubPtr->Data.Buff.BasePtr != NULL)
+    {
+        if ((StubPtr->ModeFlags & UT_MODEFLAG_ALLOC_BUF) != 0)
+        {
+            free(StubPtr->Data.Buff.BasePtr);
+        }
+        else if ((StubPtr->ModeFlags & UT_MODEFLAG_ARENA_BUF) != 0)
+        {
+            /* Arena space is only given back here if this was the most recent allocation */
+            AllocSize = (StubPtr->Data.Buff.TotalSize + UT_STUB_ARENA_ALIGN - 1) & ~((size_t)UT_STUB_ARENA_ALIGN - 1);
+            if (StubPtr->Data.Buff.BasePtr + AllocSize == &UT_StubArena.Bytes[UT_StubArenaUsed])
+            {
+                UT_StubArenaUsed -= AllocSize;
+            }
+        }
+    }
+
+    Bucket  = UT_GetStubBucket(StubPtr->FuncKey);
+    PrevPtr = NULL;
+    if (Bucket->Head != StubPtr)
+    {
+        PrevPtr = Bucket->Head;
+        while (PrevPtr != NULL && PrevPtr->Next != StubPtr)
+        {
+            PrevPtr = PrevPtr->Next;
+        }
+    }
+
+    if (PrevPtr != NULL)
+    {
+        PrevPtr->Next = StubPtr->Next;
+    }
+    else if (Bucket->Head == StubPtr)
     {
-        free(StubPtr->Data.Buff.BasePtr);
+        Bucket->Head = StubPtr->Next;
     }
+    if (Bucket->Tail == StubPtr)
+    {
+        Bucket->Tail = PrevPtr;
+    }
+
     memset(StubPtr, 0, sizeof(*StubPtr));
+    StubPtr->Next   = UT_StubFreeList;
+    UT_StubFreeList = StubPtr;
 }
 
 /*
 ** Functions
 */
 
+/**
+ * Helper function to find the first (oldest) entry of the given type for the given FuncKey.
+ */
 static UT_StubTableEntry_t *UT_GetStubEntry(UT_EntryKey_t FuncKey, UT_EntryType_t TestMode)
 {
-    UT_StubTableEntry_t *StubPtr   = NULL;
-    uint32               Idx       = FuncKey % (UT_MAX_FUNC_STUBS - 1); /* hash the key to determine the start point */
-    uint32               SearchLen = 0;
-    uint32               SearchLimit;
-    UT_EntryKey_t        SearchKey;
+    UT_StubTableEntry_t *StubPtr;
+
+    StubPtr = UT_GetStubBucket(FuncKey)->Head;
+    while (StubPtr != NULL && (StubPtr->EntryType != TestMode || StubPtr->FuncKey != FuncKey))
+    {
+        StubPtr = StubPtr->Next;
+    }
+
+    return StubPtr;
+}
 
-    /* If searching for an unused entry, look through the entire table.
-     * Otherwise bound the search */
-    if (TestMode == UT_ENTRYTYPE_UNUSED)
+/**
+ * Helper function to claim an unused stub table entry and add it to the index.
+ * Returns NULL if the table is full.
+ */
+static UT_StubTableEntry_t *UT_AllocStubEntry(UT_EntryKey_t FuncKey, UT_EntryType_t EntryType)
+{
+    UT_StubBucket_t *    Bucket;
+    UT_StubTableEntry_t *StubPtr;
+
+    if (UT_StubFreeList != NULL)
+    {
+        StubPtr         = UT_StubFreeList;
+        UT_StubFreeList = StubPtr->Next;
+    }
+    else if (UT_StubHighWater < UT_MAX_FUNC_STUBS)
     {
-        SearchLimit = UT_MAX_FUNC_STUBS;
-        SearchKey   = 0;
+        StubPtr = &UT_StubTable[UT_StubHighWater];
+        ++UT_StubHighWater;
     }
     else
     {
-        SearchLimit = UT_MaxStubSearchLen;
-        SearchKey   = FuncKey;
+        return NULL;
     }
 
-    while (1)
+    StubPtr->EntryType = EntryType;
+    StubPtr->ModeFlags = 0;
+    StubPtr->FuncKey   = FuncKey;
+    StubPtr->Next      = NULL;
+
+    Bucket = UT_GetStubBucket(FuncKey);
+    if (Bucket->Tail != NULL)
     {
-        if (SearchLen >= SearchLimit)
-        {
-            StubPtr = NULL;
-            break;
-        }
-        ++SearchLen;
-        StubPtr = &UT_StubTable[Idx];
-        if (StubPtr->EntryType == TestMode && StubPtr->FuncKey == SearchKey)
-        {
-            break;
-        }
-        ++Idx;
-        if (Idx >= UT_MAX_FUNC_STUBS)
-        {
-            Idx = 0;
-        }
+        Bucket->Tail->Next = StubPtr;
     }
-
-    /*
-     * Keep track of the longest search length since the last reset.
-     * This serves as the upper bound for future searches.
-     */
-    if (SearchLen > UT_MaxStubSearchLen)
+    else
     {
-        UT_MaxStubSearchLen = SearchLen;
+        Bucket->Head = StubPtr;
     }
+    Bucket->Tail = StubPtr;
 
     return StubPtr;
 }
@@ -214,29 +344,46 @@ static UT_StubTableEntry_t *UT_GetStubEntry(UT_EntryKey_t FuncKey, UT_EntryType_
 void UT_ResetState(UT_EntryKey_t FuncKey)
 {
     UT_StubTableEntry_t *StubPtr;
-    int32                i;
+    UT_StubTableEntry_t *NextPtr;
+    uint32               i;
 
-    StubPtr = UT_StubTable;
-    for (i = 0; i < UT_MAX_FUNC_STUBS; ++i)
+    if (FuncKey == 0)
     {
-        if (FuncKey == 0 || StubPtr->FuncKey == FuncKey)
+        /* Only buffers from the malloc() fallback need individual attention, the arena is reset as a whole */
+        StubPtr = UT_StubTable;
+        for (i = 0; i < UT_StubHighWater; ++i)
         {
-            UT_ClearStubEntry(StubPtr);
+            if ((StubPtr->ModeFlags & UT_MODEFLAG_ALLOC_BUF) != 0)
+            {
+                free(StubPtr->Data.Buff.BasePtr);
+            }
+            ++StubPtr;
         }
-        ++StubPtr;
+
+        memset(UT_StubTable, 0, sizeof(UT_StubTable[0]) * UT_StubHighWater);
+        memset(UT_StubIndex, 0, sizeof(UT_StubIndex));
+        UT_StubFreeList  = NULL;
+        UT_StubHighWater = 0;
+        UT_StubArenaUsed = 0;
     }
-    if (FuncKey == 0)
+    else
     {
-        UT_MaxStubSearchLen = 0;
+        StubPtr = UT_GetStubBucket(FuncKey)->Head;
+        while (StubPtr != NULL)
+        {
+            NextPtr = StubPtr->Next;
+            if (StubPtr->FuncKey == FuncKey)
+            {
+                UT_ClearStubEntry(StubPtr);
+            }
+            StubPtr = NextPtr;
+        }
     }
 }
 
 void UT_Stub_CallOnce(void (*Func)(void))
 {
-    UT_StubTableEntry_t *StubPtr;
-    UT_StubTableEntry_t *OnceEnt;
-    UT_EntryKey_t        FuncKey;
-    int32                i;
+    UT_EntryKey_t FuncKey;
 
     if (Func == NULL)
     {
@@ -244,33 +391,17 @@ void UT_Stub_CallOnce(void (*Func)(void))
     }
 
     FuncKey = (UT_EntryKey_t)Func;
-    OnceEnt = NULL;
-    StubPtr = UT_StubTable;
-    for (i = 0; i < UT_MAX_FUNC_STUBS; ++i)
+    if (UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_CALL_ONCE) == NULL)
     {
-        if (StubPtr->EntryType == UT_ENTRYTYPE_UNUSED && OnceEnt == NULL)
+        if (UT_AllocStubEntry(FuncKey, UT_ENTRYTYPE_CALL_ONCE) == NULL)
         {
-            OnceEnt = StubPtr;
+            /* should never happen -- UT_MAX_FUNC_STUBS needs increase if it does */
+            UtAssert_Abort("Cannot do CallOnce - UT_MAX_FUNC_STUBS too low?");
         }
-        else if (StubPtr->EntryType == UT_ENTRYTYPE_CALL_ONCE && StubPtr->FuncKey == FuncKey)
+        else
         {
-            OnceEnt = StubPtr;
-            break;
+            Func();
         }
-        ++StubPtr;
-    }
-
-    if (OnceEnt == NULL)
-    {
-        /* should never happen -- UT_MAX_FUNC_STUBS needs increase if it does */
-        UtAssert_Abort("Cannot do CallOnce - UT_MAX_FUNC_STUBS too low?");
-    }
-    else if (OnceEnt->EntryType == UT_ENTRYTYPE_UNUSED)
-    {
-        OnceEnt->EntryType = UT_ENTRYTYPE_CALL_ONCE;
-        OnceEnt->FuncKey   = FuncKey;
-
-        Func();
     }
 }
 
@@ -357,8 +488,6 @@ void UT_ConfigureGenericStubReturnValue(UT_EntryKey_t FuncKey, const void *Value
     UT_StubTableEntry_t *StubPtr;
     UT_EntryType_t       ReqEntryType;
 
-    StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
-
     /*
      * For deferred retval configs, this always adds a new entry.  But
      * for constant retval configs, it should replace the existing entry if
@@ -377,7 +506,7 @@ void UT_ConfigureGenericStubReturnValue(UT_EntryKey_t FuncKey, const void *Value
 
     if (StubPtr == NULL)
     {
-        StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+        StubPtr = UT_AllocStubEntry(FuncKey, ReqEntryType);
     }
 
     if (StubPtr == NULL)
@@ -386,9 +515,6 @@ void UT_ConfigureGenericStubReturnValue(UT_EntryKey_t FuncKey, const void *Value
     }
     else
     {
-        StubPtr->FuncKey = FuncKey;
-
-        StubPtr->EntryType         = ReqEntryType;
         StubPtr->Data.Rvc.Genre    = ValueGenre;
         StubPtr->Data.Rvc.Counter  = Counter;
         StubPtr->Data.Rvc.ActualSz = ValueSize;
@@ -535,24 +661,17 @@ void UT_Stub_RegisterReturnType(UT_EntryKey_t FuncKey, size_t ReturnSize, const
 
         if (StubPtr == NULL)
         {
-            StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+            StubPtr = UT_AllocStubEntry(FuncKey, UT_ENTRYTYPE_RETURN_BUFFER);
             if (StubPtr == NULL)
             {
                 UtAssert_Abort("Cannot set return buffer - UT_MAX_FUNC_STUBS too low?");
             }
             else
             {
-                StubPtr->FuncKey           = FuncKey;
-                StubPtr->EntryType         = UT_ENTRYTYPE_RETURN_BUFFER;
-                StubPtr->Data.Buff.BasePtr = malloc(ReturnSize);
-                if (StubPtr->Data.Buff.BasePtr == NULL)
-                {
-                    UtAssert_Abort("Cannot allocate data buffer - malloc() failed!");
-                }
-                else
+                StubPtr->Data.Buff.BasePtr = UT_AllocStubBuffer(StubPtr, ReturnSize);
+                if (StubPtr->Data.Buff.BasePtr != NULL)
                 {
                     memset(StubPtr->Data.Buff.BasePtr, 0, ReturnSize);
-                    StubPtr->ModeFlags |= UT_MODEFLAG_ALLOC_BUF;
                 }
 
                 StubPtr->Data.Buff.TotalSize = ReturnSize;
@@ -612,7 +731,7 @@ void UT_SetDataBuffer(UT_EntryKey_t FuncKey, void *DataBuffer, size_t BufferSize
 
     if (DataBuffer != NULL && BufferSize > 0)
     {
-        StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+        StubPtr = UT_AllocStubEntry(FuncKey, UT_ENTRYTYPE_DATA_BUFFER);
 
         if (StubPtr == NULL)
         {
@@ -620,19 +739,12 @@ void UT_SetDataBuffer(UT_EntryKey_t FuncKey, void *DataBuffer, size_t BufferSize
         }
         else
         {
-            StubPtr->FuncKey   = FuncKey;
-            StubPtr->EntryType = UT_ENTRYTYPE_DATA_BUFFER;
             if (AllocateCopy)
             {
-                StubPtr->Data.Buff.BasePtr = malloc(BufferSize);
-                if (StubPtr->Data.Buff.BasePtr == NULL)
-                {
-                    UtAssert_Abort("Cannot allocate data buffer - malloc() failed!");
-                }
-                else
+                StubPtr->Data.Buff.BasePtr = UT_AllocStubBuffer(StubPtr, BufferSize);
+                if (StubPtr->Data.Buff.BasePtr != NULL)
                 {
                     memcpy(StubPtr->Data.Buff.BasePtr, DataBuffer, BufferSize);
-                    StubPtr->ModeFlags |= UT_MODEFLAG_ALLOC_BUF;
                 }
             }
             else
@@ -763,8 +875,8 @@ static void UT_DoSetHookFunction(UT_EntryKey_t FuncKey, UT_EntryType_t EntryType
     StubPtr = UT_GetStubEntry(FuncKey, EntryType);
     if (StubPtr == NULL && Value.Addr != NULL)
     {
-        /* Creating force fail entry - repeat search and grab any unused slot */
-        StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+        /* Creating force fail entry - grab an unused slot */
+        StubPtr = UT_AllocStubEntry(FuncKey, EntryType);
         if (StubPtr == NULL)
         {
             UtAssert_Abort("Cannot set hook function - UT_MAX_FUNC_STUBS too low?");
@@ -779,8 +891,6 @@ static void UT_DoSetHookFunction(UT_EntryKey_t FuncKey, UT_EntryType_t EntryType
     else if (StubPtr != NULL && Value.Addr != NULL)
     {
         /* Caller wants to set the entry */
-        StubPtr->FuncKey             = FuncKey;
-        StubPtr->EntryType           = EntryType;
         StubPtr->Data.Cb.CallbackArg = UserObj;
         StubPtr->Data.Cb.Ptr         = Value;
         StubPtr->Data.Cb.IsVarg      = IsVarg;
@@ -897,8 +1007,8 @@ void UT_Stub_RegisterContextWithMetaData(UT_EntryKey_t FuncKey, const char *Name
     StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_CALLBACK_CONTEXT);
     if (StubPtr == NULL)
     {
-        /* Creating force fail entry - repeat search and grab any unused slot */
-        StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+        /* Creating force fail entry - grab an unused slot */
+        StubPtr = UT_AllocStubEntry(FuncKey, UT_ENTRYTYPE_CALLBACK_CONTEXT);
     }
 
     if (StubPtr == NULL)
@@ -907,8 +1017,6 @@ void UT_Stub_RegisterContextWithMetaData(UT_EntryKey_t FuncKey, const char *Name
     }
     else
     {
-        StubPtr->FuncKey   = FuncKey;
-        StubPtr->EntryType = UT_ENTRYTYPE_CALLBACK_CONTEXT;
         if (StubPtr->Data.Context.ArgCount < UT_STUBCONTEXT_MAXSIZE)
         {
             StubPtr->Data.Context.ArgPtr[StubPtr->Data.Context.ArgCount] = ParamPtr;
@@ -1100,8 +1208,8 @@ int32 UT_DefaultStubImplWithArgs(const char *FunctionName, UT_EntryKey_t FuncKey
     StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_COUNTER);
     if (StubPtr == NULL)
     {
-        /* Creating counter entry - repeat search and grab any unused slot */
-        StubPtr = UT_GetStubEntry(FuncKey, UT_ENTRYTYPE_UNUSED);
+        /* Creating counter entry - grab an unused slot */
+        StubPtr = UT_AllocStubEntry(FuncKey, UT_ENTRYTYPE_COUNTER);
     }
 
     if (StubPtr == NULL)
@@ -1110,9 +1218,7 @@ int32 UT_DefaultStubImplWithArgs(const char *FunctionName, UT_EntryKey_t FuncKey
     }
     else
     {
-        StubPtr->EntryType = UT_ENTRYTYPE_COUNTER;
-        StubPtr->FuncKey   = FuncKey;
-        Counter            = StubPtr->Data.Rc.Count;
+        Counter = StubPtr->Data.Rc.Count;
         ++StubPtr->Data.Rc.Count;
         StubPtr->Data.Rc.Value = LocalContext.Int32StatusCode;
     }
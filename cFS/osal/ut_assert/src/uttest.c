@@ -126,6 +126,151 @@ void UtTest_AddSubTest(void (*Test)(void), void (*Setup)(void), void (*Teardown)
     UtTest_AddCommon(Test, Setup, Teardown, CompleteTestName, UTASSERT_GROUP_TEST);
 }
 
+size_t UtTest_GetGroupNameLen(const char *TestName)
+{
+    return strcspn(TestName, ".");
+}
+
+void UtTest_RecordGroupTiming(const char *TestName, uint32 TestCount, clock_t Elapsed)
+{
+    UtTestGroupTiming_t *GroupPtr;
+    size_t               NameLen;
+    uint32               i;
+
+    NameLen = UtTest_GetGroupNameLen(TestName);
+    if (NameLen >= sizeof(GroupPtr->GroupName))
+    {
+        NameLen = sizeof(GroupPtr->GroupName) - 1;
+    }
+
+    /* Tests of the same group are normally registered together, so search backwards from the most recent */
+    GroupPtr = NULL;
+    i        = UtAssert_Global.TimingGroupCount;
+    while (i > 0)
+    {
+        --i;
+        if (strncmp(UtAssert_Global.TimingGroups[i].GroupName, TestName, NameLen) == 0 &&
+            UtAssert_Global.TimingGroups[i].GroupName[NameLen] == 0)
+        {
+            GroupPtr = &UtAssert_Global.TimingGroups[i];
+            break;
+        }
+    }
+
+    if (GroupPtr == NULL)
+    {
+        if (UtAssert_Global.TimingGroupCount < UTASSERT_MAX_TIMING_GROUPS)
+        {
+            GroupPtr = &UtAssert_Global.TimingGroups[UtAssert_Global.TimingGroupCount];
+            ++UtAssert_Global.TimingGroupCount;
+            memcpy(GroupPtr->GroupName, TestName, NameLen);
+            GroupPtr->GroupName[NameLen] = 0;
+        }
+        else
+        {
+            GroupPtr = &UtAssert_Global.TimingGroups[UTASSERT_MAX_TIMING_GROUPS - 1];
+            strncpy(GroupPtr->GroupName, "(other)", sizeof(GroupPtr->GroupName) - 1);
+        }
+    }
+
+    GroupPtr->TestCount += TestCount;
+    GroupPtr->Elapsed += Elapsed;
+}
+
+void UtTest_RecordTestTiming(const char *TestName, clock_t Elapsed)
+{
+    UtTestCaseTiming_t *TestPtr;
+    uint32              Pos;
+
+    /* The list is kept in descending order, find where this test belongs (if at all) */
+    Pos = UtAssert_Global.SlowestCount;
+    while (Pos > 0 && UtAssert_Global.SlowestTests[Pos - 1].Elapsed < Elapsed)
+    {
+        --Pos;
+    }
+
+    if (Pos < UTASSERT_MAX_SLOWEST_TESTS)
+    {
+        if (UtAssert_Global.SlowestCount < UTASSERT_MAX_SLOWEST_TESTS)
+        {
+            ++UtAssert_Global.SlowestCount;
+        }
+
+        TestPtr = &UtAssert_Global.SlowestTests[Pos];
+        memmove(TestPtr + 1, TestPtr, (UtAssert_Global.SlowestCount - Pos - 1) * sizeof(*TestPtr));
+
+        strncpy(TestPtr->TestName, TestName, sizeof(TestPtr->TestName) - 1);
+        TestPtr->TestName[sizeof(TestPtr->TestName) - 1] = 0;
+        TestPtr->Elapsed                                 = Elapsed;
+    }
+}
+
+/*
+ * Helper function to output the execution time of each test group, and the slowest tests
+ */
+static void UtTest_ReportTiming(void)
+{
+    char          ReportBuffer[144];
+    unsigned long ElapsedUsec;
+    uint32        i;
+
+    for (i = 0; i < UtAssert_Global.TimingGroupCount; ++i)
+    {
+        ElapsedUsec = (unsigned long)(((uint64)UtAssert_Global.TimingGroups[i].Elapsed * 1000000) / CLOCKS_PER_SEC);
+
+        snprintf(ReportBuffer, sizeof(ReportBuffer), "TIMING %-32s TESTS::%-5u  CPU::%lu.%03lu ms",
+                 UtAssert_Global.TimingGroups[i].GroupName, (unsigned int)UtAssert_Global.TimingGroups[i].TestCount,
+                 ElapsedUsec / 1000, ElapsedUsec % 1000);
+        UT_BSP_DoText(UTASSERT_CASETYPE_INFO, ReportBuffer);
+    }
+
+    for (i = 0; i < UtAssert_Global.SlowestCount; ++i)
+    {
+        ElapsedUsec = (unsigned long)(((uint64)UtAssert_Global.SlowestTests[i].Elapsed * 1000000) / CLOCKS_PER_SEC);
+
+        snprintf(ReportBuffer, sizeof(ReportBuffer), "SLOWEST %-50s CPU::%lu.%03lu ms",
+                 UtAssert_Global.SlowestTests[i].TestName, ElapsedUsec / 1000, ElapsedUsec % 1000);
+        UT_BSP_DoText(UTASSERT_CASETYPE_INFO, ReportBuffer);
+    }
+}
+
+void UtTest_RunEntry(const UtTestDataBaseEntry_t *UtTestDataBaseEntry)
+{
+    clock_t StartTime;
+    clock_t Elapsed;
+
+    UtAssert_BeginTest(UtTestDataBaseEntry->TestName);
+    StartTime = clock();
+
+    UtAssert_SetContext(UTASSERT_CASETYPE_TSF);
+    if (UtTestDataBaseEntry->Setup)
+    {
+        UtTestDataBaseEntry->Setup();
+    }
+    UtAssert_SetContext(UTASSERT_CASETYPE_FAILURE);
+    if (UtTestDataBaseEntry->Test)
+    {
+        UtTestDataBaseEntry->Test();
+        UtAssert_Global.ExecutedCount++;
+    }
+    UtAssert_SetContext(UTASSERT_CASETYPE_TTF);
+    if (UtTestDataBaseEntry->Teardown)
+    {
+        UtTestDataBaseEntry->Teardown();
+    }
+
+    Elapsed = clock() - StartTime;
+    UtTest_RecordGroupTiming(UtTestDataBaseEntry->TestName, 1, Elapsed);
+    UtTest_RecordTestTiming(UtTestDataBaseEntry->TestName, Elapsed);
+
+    UtAssert_EndTest();
+}
+
+void UtTest_SetJobCount(uint32 JobCount)
+{
+    UtAssert_Global.JobCount = JobCount;
+}
+
 void UtTest_Run(void)
 {
     UtListNode_t *         UtListMain;
@@ -150,35 +295,20 @@ void UtTest_Run(void)
     UT_BSP_Unlock();
 
     /*
-     * Run through the merged list in order
+     * If configured, let worker processes execute the list.  Otherwise
+     * (or if that is not possible) run through the merged list in order.
      */
-    for (UtListNode = UtList_GetNext(UtListMain); !UtList_IsEnd(UtListMain, UtListNode);
-         UtListNode = UtList_GetNext(UtListNode))
+    if (UtAssert_Global.JobCount <= 1 || !UtTest_RunShards(UtListMain))
     {
-        UtTestDataBaseEntry = UtList_GetObject(UtListNode);
-
-        if (UtTestDataBaseEntry != NULL)
+        for (UtListNode = UtList_GetNext(UtListMain); !UtList_IsEnd(UtListMain, UtListNode);
+             UtListNode = UtList_GetNext(UtListNode))
         {
-            UtAssert_BeginTest(UtTestDataBaseEntry->TestName);
+            UtTestDataBaseEntry = UtList_GetObject(UtListNode);
 
-            UtAssert_SetContext(UTASSERT_CASETYPE_TSF);
-            if (UtTestDataBaseEntry->Setup)
-            {
-                UtTestDataBaseEntry->Setup();
-            }
-            UtAssert_SetContext(UTASSERT_CASETYPE_FAILURE);
-            if (UtTestDataBaseEntry->Test)
-            {
-                UtTestDataBaseEntry->Test();
-                UtAssert_Global.ExecutedCount++;
-            }
-            UtAssert_SetContext(UTASSERT_CASETYPE_TTF);
-            if (UtTestDataBaseEntry->Teardown)
+            if (UtTestDataBaseEntry != NULL)
             {
-                UtTestDataBaseEntry->Teardown();
+                UtTest_RunEntry(UtTestDataBaseEntry);
             }
-
-            UtAssert_EndTest();
         }
     }
 
@@ -186,6 +316,7 @@ void UtTest_Run(void)
     UtList_Destroy(UtAssert_Global.DataBasePtr);
     UT_BSP_Unlock();
 
+    UtTest_ReportTiming();
     UT_BSP_EndTest(UtAssert_GetCounters());
 }
 
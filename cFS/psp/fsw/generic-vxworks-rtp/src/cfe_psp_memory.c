@@ -251,6 +251,30 @@ int32 CFE_PSP_GetCDSSize(uint32 *SizeOfCDS)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS)
+{
+    int32 return_code;
+
+    if (PtrToCDS == NULL || SizeOfCDS == NULL)
+    {
+        return_code = CFE_PSP_ERROR;
+    }
+    else
+    {
+        *PtrToCDS   = (cpuaddr)CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr;
+        *SizeOfCDS  = CFE_PSP_ReservedMemoryMap.CDSMemory.BlockSize;
+        return_code = CFE_PSP_SUCCESS;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -55,6 +55,24 @@
  */
 int32 CFE_PSP_GetCDSSize(uint32 *SizeOfCDS);
 
+/*--------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtains the location and size of the memory-mapped CDS area.
+ *
+ * On platforms where the CDS is ordinary memory, this allows callers to
+ * access it in place rather than copying through CFE_PSP_WriteToCDS() and
+ * CFE_PSP_ReadFromCDS().  Platforms where the CDS is not directly addressable
+ * return CFE_PSP_ERROR_NOT_IMPLEMENTED, and the copy functions must be used.
+ *
+ * @param[out] PtrToCDS  Pointer to the variable that will store the CDS address
+ * @param[out] SizeOfCDS Pointer to the variable that will store the size of the CDS
+ *
+ * @retval CFE_PSP_SUCCESS on success
+ * @retval CFE_PSP_ERROR if either pointer is NULL
+ * @retval CFE_PSP_ERROR_NOT_IMPLEMENTED if the CDS cannot be accessed directly
+ */
+int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS);
+
 /*--------------------------------------------------------------------------------------*/
 /**
  * @brief Writes to the CDS Block.
@@ -83,6 +83,25 @@ int32 CFE_PSP_EepromWrite16(cpuaddr MemoryAddress, uint16 uint16Value);
  */
 int32 CFE_PSP_EepromWrite32(cpuaddr MemoryAddress, uint32 uint32Value);
 
+/*--------------------------------------------------------------------------------------*/
+/**
+ * @brief Write a block of data to EEPROM starting at address MemoryAddress
+ *
+ * This is more efficient than a sequence of individual 8/16/32 bit writes for
+ * larger updates such as an image reload, as implementations may combine the
+ * writes and commit them to the device together.
+ *
+ * @param[out] MemoryAddress Memory address to write to
+ * @param[in]  DataPtr       Pointer to the data to write
+ * @param[in]  Size          Number of bytes to write
+ *
+ * @retval CFE_PSP_SUCCESS on success
+ * @retval CFE_PSP_INVALID_POINTER if DataPtr is NULL
+ * @retval CFE_PSP_ERROR_ADDRESS_MISALIGNED if the address or size is not aligned as required by the device.
+ * @retval CFE_PSP_ERROR_NOT_IMPLEMENTED if not implemented
+ */
+int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size);
+
 /*--------------------------------------------------------------------------------------*/
 /**
  * @brief Enable the EEPROM for write operation
@@ -98,9 +117,14 @@ int32 CFE_PSP_EepromWriteEnable(uint32 Bank);
 /**
  * @brief Disable the EEPROM from write operation
  *
+ * Commits any pending writes to the device.  Implementations may buffer
+ * writes, so they are not guaranteed to be durable until this returns
+ * successfully.
+ *
  * @param[in] Bank The bank of EEPROM to disable
  *
  * @retval CFE_PSP_SUCCESS on success
+ * @retval CFE_PSP_ERROR if pending writes could not be committed
  * @retval CFE_PSP_ERROR_NOT_IMPLEMENTED if not implemented
  */
 int32 CFE_PSP_EepromWriteDisable(uint32 Bank);
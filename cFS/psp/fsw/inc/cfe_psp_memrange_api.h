@@ -211,4 +211,40 @@ int32 CFE_PSP_MemRangeSet(uint32 RangeNum, uint32 MemoryType, cpuaddr StartAddr,
 int32 CFE_PSP_MemRangeGet(uint32 RangeNum, uint32 *MemoryType, cpuaddr *StartAddr, size_t *Size, size_t *WordSize,
                           uint32 *Attributes);
 
+/*--------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads a block of memory after validating the whole range
+ *
+ * The source range is validated once with CFE_PSP_MemValidateRange() using
+ * CFE_PSP_MEM_ANY, and then copied with CFE_PSP_MemCpy() in large chunks.
+ * This avoids validating and reading each address individually.
+ *
+ * @param[in]  SrcAddress  Starting address of the memory to read
+ * @param[out] DestBuffer  Buffer to store the data, must be at least Size bytes
+ * @param[in]  Size        Number of bytes to read
+ *
+ * @retval CFE_PSP_SUCCESS          Memory was read successfully
+ * @retval CFE_PSP_INVALID_POINTER  DestBuffer is NULL
+ * @return Any status returned by CFE_PSP_MemValidateRange() if the range is not valid
+ */
+int32 CFE_PSP_MemReadBlock(cpuaddr SrcAddress, void *DestBuffer, size_t Size);
+
+/*--------------------------------------------------------------------------------------*/
+/**
+ * @brief Writes a block of memory after validating the whole range
+ *
+ * The destination range is validated once with CFE_PSP_MemValidateRange() using
+ * CFE_PSP_MEM_RAM, and then copied with CFE_PSP_MemCpy() in large chunks.
+ * EEPROM must be written through the EEPROM access API instead.
+ *
+ * @param[in] DestAddress Starting address of the memory to write
+ * @param[in] SrcBuffer   Data to write, must be at least Size bytes
+ * @param[in] Size        Number of bytes to write
+ *
+ * @retval CFE_PSP_SUCCESS          Memory was written successfully
+ * @retval CFE_PSP_INVALID_POINTER  SrcBuffer is NULL
+ * @return Any status returned by CFE_PSP_MemValidateRange() if the range is not valid
+ */
+int32 CFE_PSP_MemWriteBlock(cpuaddr DestAddress, const void *SrcBuffer, size_t Size);
+
 #endif
@@ -108,6 +108,37 @@ int32 CFE_PSP_GetCDSSize(uint32 *SizeOfCDS)
     return return_code;
 }
 
+/******************************************************************************
+**
+**  Purpose:
+**    This function returns the location and size of the CDS Block.
+**
+**  Arguments:
+**    PtrToCDS  - Set to the address of the CDS Block
+**    SizeOfCDS - Set to the size of the CDS Block in bytes
+**
+**  Return:
+**    CFE_PSP_SUCCESS - CDS location and size were returned
+**    CFE_PSP_ERROR   - either pointer is NULL
+*/
+int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS)
+{
+    int32 return_code;
+
+    if (PtrToCDS == NULL || SizeOfCDS == NULL)
+    {
+        return_code = CFE_PSP_ERROR;
+    }
+    else
+    {
+        *PtrToCDS   = (cpuaddr)CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr;
+        *SizeOfCDS  = CFE_PSP_ReservedMemoryMap.CDSMemory.BlockSize;
+        return_code = CFE_PSP_SUCCESS;
+    }
+
+    return return_code;
+}
+
 /******************************************************************************
 **
 **  Purpose:
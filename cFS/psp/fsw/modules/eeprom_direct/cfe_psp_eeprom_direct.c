@@ -20,6 +20,7 @@
 ** Include section
 */
 #include <stdio.h>
+#include <string.h>
 
 #include "cfe_psp.h"
 #include "cfe_psp_module.h"
@@ -209,6 +210,58 @@ int32 CFE_PSP_EepromWrite8(cpuaddr MemoryAddress, uint8 ByteValue)
     return CFE_PSP_EepromWrite16(aligned_address, write16);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+{
+    const uint8 *SrcPtr;
+    uint32       write32;
+    int32        ret_value;
+
+    if (DataPtr == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    SrcPtr    = DataPtr;
+    ret_value = CFE_PSP_SUCCESS;
+
+    /*
+    ** Write single bytes up to the first 32 bit boundary, then whole
+    ** words, then any remaining bytes at the end of the block
+    */
+    while (Size > 0 && (MemoryAddress & 0x00000003) != 0 && ret_value == CFE_PSP_SUCCESS)
+    {
+        ret_value = CFE_PSP_EepromWrite8(MemoryAddress, *SrcPtr);
+        ++MemoryAddress;
+        ++SrcPtr;
+        --Size;
+    }
+
+    while (Size >= sizeof(write32) && ret_value == CFE_PSP_SUCCESS)
+    {
+        memcpy(&write32, SrcPtr, sizeof(write32));
+        ret_value = CFE_PSP_EepromWrite32(MemoryAddress, write32);
+        MemoryAddress += sizeof(write32);
+        SrcPtr += sizeof(write32);
+        Size -= sizeof(write32);
+    }
+
+    while (Size > 0 && ret_value == CFE_PSP_SUCCESS)
+    {
+        ret_value = CFE_PSP_EepromWrite8(MemoryAddress, *SrcPtr);
+        ++MemoryAddress;
+        ++SrcPtr;
+        --Size;
+    }
+
+    return ret_value;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
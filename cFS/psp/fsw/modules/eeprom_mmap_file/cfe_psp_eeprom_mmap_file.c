@@ -24,11 +24,21 @@
  *
  * This is an implementation of the PSP EEPROM API calls that operates on a
  * memory-mapped disk file, therefore emulating the persistence of a real eeprom device.
+ *
+ * Writes are done directly to the mapping, and the pages touched are tracked
+ * as a small set of dirty ranges.  Only the dirty ranges are synced to the
+ * file, when CFE_PSP_EepromWriteDisable() is called.  Defining
+ * EEPROM_MMAP_FILE_SYNC_EACH_WRITE additionally syncs each write made
+ * outside of an enable/disable window before it returns.
+ *
+ * EEPROM updates are expected to be serialized by the caller, as is required
+ * with a real device for the enable/write/disable sequence.
  */
 
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <string.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 
@@ -40,8 +50,161 @@
 */
 #define EEPROM_FILE "EEPROM.DAT"
 
+/*
+ * Maximum number of separate dirty ranges tracked.  If more distinct
+ * ranges are written, they are merged into a single covering range.
+ */
+#define EEPROM_MAX_DIRTY_RANGES 8
+
+typedef struct
+{
+    size_t Start; /**< Offset of first dirty byte, page aligned */
+    size_t End;   /**< Offset after the last dirty byte, page aligned or end of mapping */
+} eeprom_mmap_file_DirtyRange_t;
+
+typedef struct
+{
+    cpuaddr BaseAddress;
+    size_t  Size;
+    size_t  PageSize;
+    bool    WriteEnabled;
+    uint32  NumDirty;
+
+    eeprom_mmap_file_DirtyRange_t Dirty[EEPROM_MAX_DIRTY_RANGES];
+} eeprom_mmap_file_State_t;
+
+static eeprom_mmap_file_State_t eeprom_mmap_file_State;
+
 CFE_PSP_MODULE_DECLARE_SIMPLE(eeprom_mmap_file);
 
+/*
+** Record that the given address range has been modified.
+** Writes outside of the mapped file are not tracked.
+*/
+static void eeprom_mmap_file_MarkDirty(cpuaddr MemoryAddress, size_t Size)
+{
+    eeprom_mmap_file_State_t *State = &eeprom_mmap_file_State;
+    size_t                    Start;
+    size_t                    End;
+    uint32                    i;
+
+    if (Size == 0 || MemoryAddress < State->BaseAddress || (MemoryAddress - State->BaseAddress) >= State->Size)
+    {
+        return;
+    }
+
+    Start = MemoryAddress - State->BaseAddress;
+    End   = Start + Size;
+    if (End > State->Size)
+    {
+        End = State->Size;
+    }
+
+    /* msync() works on whole pages, but must not go past the mapping */
+    Start -= Start % State->PageSize;
+    End += State->PageSize - 1;
+    End -= End % State->PageSize;
+    if (End > State->Size)
+    {
+        End = State->Size;
+    }
+
+    /* Absorb any existing ranges that overlap or touch this one */
+    i = 0;
+    while (i < State->NumDirty)
+    {
+        if (Start <= State->Dirty[i].End && End >= State->Dirty[i].Start)
+        {
+            if (State->Dirty[i].Start < Start)
+            {
+                Start = State->Dirty[i].Start;
+            }
+            if (State->Dirty[i].End > End)
+            {
+                End = State->Dirty[i].End;
+            }
+
+            --State->NumDirty;
+            State->Dirty[i] = State->Dirty[State->NumDirty];
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    if (State->NumDirty >= EEPROM_MAX_DIRTY_RANGES)
+    {
+        /* Out of entries, collapse everything into one range */
+        for (i = 0; i < State->NumDirty; ++i)
+        {
+            if (State->Dirty[i].Start < Start)
+            {
+                Start = State->Dirty[i].Start;
+            }
+            if (State->Dirty[i].End > End)
+            {
+                End = State->Dirty[i].End;
+            }
+        }
+
+        State->NumDirty = 0;
+    }
+
+    State->Dirty[State->NumDirty].Start = Start;
+    State->Dirty[State->NumDirty].End   = End;
+    ++State->NumDirty;
+}
+
+/*
+** Sync all dirty ranges to the backing file.
+** Any range that fails to sync remains dirty so it is retried next time.
+*/
+static int32 eeprom_mmap_file_Flush(void)
+{
+    eeprom_mmap_file_State_t *State = &eeprom_mmap_file_State;
+    int32                     ReturnStatus;
+    uint32                    i;
+    uint32                    NumFailed;
+
+    ReturnStatus = CFE_PSP_SUCCESS;
+    NumFailed    = 0;
+
+    for (i = 0; i < State->NumDirty; ++i)
+    {
+        if (msync((void *)(State->BaseAddress + State->Dirty[i].Start), State->Dirty[i].End - State->Dirty[i].Start,
+                  MS_SYNC) < 0)
+        {
+            OS_printf("CFE_PSP: msync of EEPROM File failed: %s\n", strerror(errno));
+            State->Dirty[NumFailed] = State->Dirty[i];
+            ++NumFailed;
+            ReturnStatus = CFE_PSP_ERROR;
+        }
+    }
+
+    State->NumDirty = NumFailed;
+
+    return ReturnStatus;
+}
+
+/*
+** Common completion for all write calls
+*/
+static int32 eeprom_mmap_file_WriteDone(cpuaddr MemoryAddress, size_t Size)
+{
+    eeprom_mmap_file_MarkDirty(MemoryAddress, Size);
+
+#ifdef EEPROM_MMAP_FILE_SYNC_EACH_WRITE
+    if (!eeprom_mmap_file_State.WriteEnabled)
+    {
+        return eeprom_mmap_file_Flush();
+    }
+#endif
+
+    /* Combined with other writes, synced when writing is disabled */
+    return CFE_PSP_SUCCESS;
+}
+
 /*
 ** Simulate EEPROM by mapping in a file
 */
@@ -50,6 +213,16 @@ int32 CFE_PSP_SetupEEPROM(uint32 EEPROMSize, cpuaddr *EEPROMAddress)
     int   FileDescriptor;
     int   ReturnStatus;
     void *DataBuffer;
+    long  PageSize;
+
+    /* Dirty ranges are synced in units of the real page size */
+    PageSize = sysconf(_SC_PAGESIZE);
+    if (PageSize <= 0)
+    {
+        OS_printf("CFE_PSP: Cannot get system page size: %s\n", strerror(errno));
+        *EEPROMAddress = 0;
+        return CFE_PSP_ERROR;
+    }
 
     DataBuffer     = NULL;
     FileDescriptor = open(EEPROM_FILE, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
@@ -91,6 +264,11 @@ int32 CFE_PSP_SetupEEPROM(uint32 EEPROMSize, cpuaddr *EEPROMAddress)
     if (ReturnStatus == CFE_PSP_SUCCESS)
     {
         *EEPROMAddress = (cpuaddr)DataBuffer;
+
+        memset(&eeprom_mmap_file_State, 0, sizeof(eeprom_mmap_file_State));
+        eeprom_mmap_file_State.BaseAddress = (cpuaddr)DataBuffer;
+        eeprom_mmap_file_State.Size        = EEPROMSize;
+        eeprom_mmap_file_State.PageSize    = PageSize;
     }
     else
     {
@@ -107,29 +285,42 @@ int32 CFE_PSP_SetupEEPROM(uint32 EEPROMSize, cpuaddr *EEPROMAddress)
 int32 CFE_PSP_EepromWrite32(cpuaddr MemoryAddress, uint32 uint32Value)
 {
     *((uint32 *)MemoryAddress) = uint32Value;
-    return CFE_PSP_SUCCESS;
+    return eeprom_mmap_file_WriteDone(MemoryAddress, sizeof(uint32Value));
 }
 
 int32 CFE_PSP_EepromWrite16(cpuaddr MemoryAddress, uint16 uint16Value)
 {
     *((uint16 *)MemoryAddress) = uint16Value;
-    return CFE_PSP_SUCCESS;
+    return eeprom_mmap_file_WriteDone(MemoryAddress, sizeof(uint16Value));
 }
 
 int32 CFE_PSP_EepromWrite8(cpuaddr MemoryAddress, uint8 ByteValue)
 {
     *((uint8 *)MemoryAddress) = ByteValue;
-    return CFE_PSP_SUCCESS;
+    return eeprom_mmap_file_WriteDone(MemoryAddress, sizeof(ByteValue));
+}
+
+int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+{
+    if (DataPtr == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    memcpy((void *)MemoryAddress, DataPtr, Size);
+    return eeprom_mmap_file_WriteDone(MemoryAddress, Size);
 }
 
 int32 CFE_PSP_EepromWriteEnable(uint32 Bank)
 {
-    return CFE_PSP_ERROR_NOT_IMPLEMENTED;
+    eeprom_mmap_file_State.WriteEnabled = true;
+    return CFE_PSP_SUCCESS;
 }
 
 int32 CFE_PSP_EepromWriteDisable(uint32 Bank)
 {
-    return CFE_PSP_ERROR_NOT_IMPLEMENTED;
+    eeprom_mmap_file_State.WriteEnabled = false;
+    return eeprom_mmap_file_Flush();
 }
 
 int32 CFE_PSP_EepromPowerUp(uint32 Bank)
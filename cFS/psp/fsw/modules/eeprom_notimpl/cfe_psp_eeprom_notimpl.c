@@ -51,6 +51,11 @@ int32 CFE_PSP_EepromWrite8(cpuaddr MemoryAddress, uint8 ByteValue)
     return CFE_PSP_ERROR_NOT_IMPLEMENTED;
 }
 
+int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+{
+    return CFE_PSP_ERROR_NOT_IMPLEMENTED;
+}
+
 int32 CFE_PSP_EepromWriteEnable(uint32 Bank)
 {
     return CFE_PSP_ERROR_NOT_IMPLEMENTED;
@@ -145,6 +145,49 @@ enum
 
 };
 
+/**
+ * A single request within a batch.
+ *
+ * The caller fills in the location, command code and argument; the Result
+ * is set to the return value of the device command once the request has
+ * been executed.
+ */
+typedef struct
+{
+    CFE_PSP_IODriver_Location_t Location;    /**<  Target device/channel */
+    uint32                      CommandCode; /**<  Request identifier */
+    CFE_PSP_IODriver_Arg_t      Arg;         /**<  Request argument */
+    int32                       Result;      /**<  Output: status of the request, valid once completed */
+} CFE_PSP_IODriver_Request_t;
+
+/**
+ * Completion callback for an asynchronous batch.
+ *
+ * Invoked from the context of the IO driver worker task once every request
+ * in the batch has been executed.  The Requests and NumRequests are those
+ * that were passed to CFE_PSP_IODriver_SubmitBatch().
+ */
+typedef void (*CFE_PSP_IODriver_CompletionFunc_t)(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests,
+                                                  void *UserArg);
+
+/**
+ * Statistics of the asynchronous request queue
+ *
+ * Latency is measured from submission of a batch until its completion
+ * callback is invoked, in microseconds.
+ */
+typedef struct
+{
+    uint32 BatchesSubmitted;  /**<  Number of batches accepted into the queue */
+    uint32 BatchesRejected;   /**<  Number of batches rejected because the queue was full */
+    uint32 BatchesCompleted;  /**<  Number of batches executed by the worker */
+    uint32 RequestsCompleted; /**<  Number of individual requests executed by the worker */
+    uint32 CurrentDepth;      /**<  Number of batches currently waiting or executing */
+    uint32 MaxDepth;          /**<  Highest value of CurrentDepth observed */
+    uint32 LastLatency;       /**<  Latency of the most recently completed batch */
+    uint32 MaxLatency;        /**<  Highest latency of any completed batch */
+} CFE_PSP_IODriver_QueueStats_t;
+
 /* ------------------------------------------------------------- */
 /**
  * @brief Find an IO device module ID by name
@@ -169,4 +212,54 @@ int32 CFE_PSP_IODriver_FindByName(const char *DriverName, uint32 *PspModuleId);
 int32 CFE_PSP_IODriver_Command(const CFE_PSP_IODriver_Location_t *Location, uint32 CommandCode,
                                CFE_PSP_IODriver_Arg_t Arg);
 
+/* ------------------------------------------------------------- */
+/**
+ * @brief Issue a batch of requests to IO device modules
+ *
+ * The requests are executed back-to-back in the order given.  Consecutive
+ * requests which require the same device lock are executed under a single
+ * acquisition of that lock, rather than locking and unlocking per request.
+ *
+ * The status of each request is stored in its Result field.
+ *
+ * @param Requests Array of requests to execute
+ * @param NumRequests Number of entries in the Requests array
+ *
+ * @retval #CFE_PSP_SUCCESS if all requests were successful
+ * @retval #CFE_PSP_ERROR if any request was not successful
+ * @retval #CFE_PSP_INVALID_POINTER if Requests is NULL
+ */
+int32 CFE_PSP_IODriver_CommandBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests);
+
+/* ------------------------------------------------------------- */
+/**
+ * @brief Queue a batch of requests for asynchronous execution
+ *
+ * The batch is executed by the IO driver worker task in the same manner as
+ * CFE_PSP_IODriver_CommandBatch(), after which the CompletionFunc is invoked.
+ * The Requests array must remain valid until the completion callback.
+ *
+ * @param Requests Array of requests to execute
+ * @param NumRequests Number of entries in the Requests array
+ * @param CompletionFunc Function to call when the batch is complete, may be NULL
+ * @param UserArg Opaque argument passed to CompletionFunc
+ *
+ * @retval #CFE_PSP_SUCCESS if the batch was queued
+ * @retval #CFE_PSP_ERROR if the queue is full or the worker could not be started
+ * @retval #CFE_PSP_INVALID_POINTER if Requests is NULL
+ */
+int32 CFE_PSP_IODriver_SubmitBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests,
+                                   CFE_PSP_IODriver_CompletionFunc_t CompletionFunc, void *UserArg);
+
+/* ------------------------------------------------------------- */
+/**
+ * @brief Get the statistics of the asynchronous request queue
+ *
+ * @param Stats Buffer to store the statistics
+ *
+ * @retval #CFE_PSP_SUCCESS if successful
+ * @retval #CFE_PSP_INVALID_POINTER if Stats is NULL
+ */
+int32 CFE_PSP_IODriver_GetQueueStats(CFE_PSP_IODriver_QueueStats_t *Stats);
+
 #endif /* IODRIVER_BASE_H */
@@ -52,4 +52,31 @@ typedef const struct
 osal_id_t CFE_PSP_IODriver_GetMutex(uint32 PspModuleId, int32 DeviceHash);
 int32     CFE_PSP_IODriver_HashMutex(int32 StartHash, int32 Datum);
 
+/**
+ * Execute the batch at the head of the asynchronous queue, if any.
+ *
+ * Returns true if a batch was executed.  The batch remains counted in the
+ * queue depth until its completion callback has returned.
+ */
+bool CFE_PSP_IODriver_ProcessQueue(void);
+
+/**
+ * Start the worker task which executes asynchronous batches
+ *
+ * Does nothing if the worker exists.  A worker which has exited or was
+ * deleted is replaced by a new one.  Must be called with the queue mutex
+ * held, except during module initialization.
+ *
+ * @returns CFE_PSP_SUCCESS if the worker is running, CFE_PSP_ERROR otherwise
+ */
+int32 CFE_PSP_IODriver_StartWorker(void);
+
+/**
+ * Entry point of the worker task which executes asynchronous batches
+ *
+ * Runs until taking the work semaphore fails, then marks the worker as
+ * stopped so the next submission starts a new one.
+ */
+void CFE_PSP_IODriver_WorkerTask(void);
+
 #endif /* IODRIVER_IMPL_H */
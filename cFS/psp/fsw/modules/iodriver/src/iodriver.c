@@ -12,16 +12,55 @@
  * of functions declared in iodriver_base.h
  */
 
+#include <string.h>
+
 #include "cfe_psp_module.h"
 #include "iodriver_base.h"
 #include "iodriver_impl.h"
 
 #define CFE_PSP_IODRIVER_LOCK_TABLE_SIZE 7
 
+#define CFE_PSP_IODRIVER_QUEUE_DEPTH     16
+#define CFE_PSP_IODRIVER_WORKER_NAME     "IODriverWorker"
+#define CFE_PSP_IODRIVER_WORKER_PRIORITY 100
+#define CFE_PSP_IODRIVER_WORKER_STACK    8192
+
 CFE_PSP_MODULE_DECLARE_SIMPLE(iodriver);
 
+/**
+ * A batch of requests waiting in the asynchronous queue
+ */
+typedef struct
+{
+    CFE_PSP_IODriver_Request_t *      Requests;
+    uint32                            NumRequests;
+    CFE_PSP_IODriver_CompletionFunc_t CompletionFunc;
+    void *                            UserArg;
+    OS_time_t                         SubmitTime;
+} CFE_PSP_IODriver_Batch_t;
+
+/**
+ * State of the asynchronous request queue and its worker task
+ *
+ * The worker task is created when the module is initialized, which is not
+ * in the context of any application.  A task created by an application is
+ * deleted along with that application, which would strand the queue.
+ */
+typedef struct
+{
+    osal_id_t                     QueueMutex; /**< Protects all other members */
+    osal_id_t                     WorkSem;    /**< Counts batches waiting for the worker */
+    osal_id_t                     WorkerId;
+    uint32                        ReadIdx;
+    uint32                        WriteIdx;
+    CFE_PSP_IODriver_Batch_t      Batches[CFE_PSP_IODRIVER_QUEUE_DEPTH];
+    CFE_PSP_IODriver_QueueStats_t Stats;
+} CFE_PSP_IODriver_Queue_t;
+
 static osal_id_t CFE_PSP_IODriver_Mutex_Table[CFE_PSP_IODRIVER_LOCK_TABLE_SIZE];
 
+static CFE_PSP_IODriver_Queue_t CFE_PSP_IODriver_Queue;
+
 const CFE_PSP_IODriver_API_t CFE_PSP_IODriver_DEFAULT_API = {.DeviceCommand = NULL, .DeviceMutex = NULL};
 
 void iodriver_Init(uint32 PspModuleId)
@@ -34,6 +73,15 @@ void iodriver_Init(uint32 PspModuleId)
         snprintf(TempName, sizeof(TempName), "DriverMutex-%02u", (unsigned int)(i + 1));
         OS_MutSemCreate(&CFE_PSP_IODriver_Mutex_Table[i], TempName, 0);
     }
+
+    memset(&CFE_PSP_IODriver_Queue, 0, sizeof(CFE_PSP_IODriver_Queue));
+    OS_MutSemCreate(&CFE_PSP_IODriver_Queue.QueueMutex, "DriverQueueMutex", 0);
+    OS_CountSemCreate(&CFE_PSP_IODriver_Queue.WorkSem, "DriverQueueSem", 0, 0);
+
+    if (CFE_PSP_IODriver_StartWorker() != CFE_PSP_SUCCESS)
+    {
+        printf("CFE_PSP: Unable to start IO driver worker, asynchronous requests will retry\n");
+    }
 }
 
 CFE_PSP_IODriver_API_t *CFE_PSP_IODriver_GetAPI(uint32 PspModuleId)
@@ -91,43 +139,274 @@ int32 CFE_PSP_IODriver_HashMutex(int32 StartHash, int32 Datum)
     return ((StartHash + Datum) & 0x7FFFFFFF);
 }
 
-int32 CFE_PSP_IODriver_Command(const CFE_PSP_IODriver_Location_t *Location, uint32 CommandCode,
-                               CFE_PSP_IODriver_Arg_t Arg)
+/**
+ * Execute a set of requests back-to-back.
+ *
+ * The device lock for each request is determined the same way as for a single command,
+ * but it is only released when a subsequent request requires a different lock, so that
+ * consecutive requests to the same board only lock and unlock once.  Requests that do
+ * not require a lock are executed under whatever lock is currently held.
+ */
+static int32 CFE_PSP_IODriver_ExecuteBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests)
 {
-    int32                   Result;
-    osal_id_t               MutexId;
-    CFE_PSP_IODriver_API_t *API;
+    int32                       Status;
+    uint32                      i;
+    uint32                      ApiModuleId;
+    osal_id_t                   MutexId;
+    osal_id_t                   HeldMutexId;
+    CFE_PSP_IODriver_API_t *    API;
+    CFE_PSP_IODriver_Request_t *Req;
 
-    API = CFE_PSP_IODriver_GetAPI(Location->PspModuleId);
-    if (API->DeviceCommand != NULL)
+    Status      = CFE_PSP_SUCCESS;
+    API         = NULL;
+    ApiModuleId = 0;
+    HeldMutexId = OS_OBJECT_ID_UNDEFINED;
+
+    for (i = 0; i < NumRequests; ++i)
     {
-        if (API->DeviceMutex != NULL)
+        Req = &Requests[i];
+
+        /* Batches are typically many channels of the same device, so only look up the API on a change */
+        if (API == NULL || Req->Location.PspModuleId != ApiModuleId)
         {
-            MutexId =
-                CFE_PSP_IODriver_GetMutex(Location->PspModuleId, API->DeviceMutex(CommandCode, Location->SubsystemId,
-                                                                                  Location->SubchannelId, Arg));
+            ApiModuleId = Req->Location.PspModuleId;
+            API         = CFE_PSP_IODriver_GetAPI(ApiModuleId);
         }
-        else
+
+        if (API->DeviceCommand != NULL)
         {
-            MutexId = OS_OBJECT_ID_UNDEFINED;
+            if (API->DeviceMutex != NULL)
+            {
+                MutexId = CFE_PSP_IODriver_GetMutex(
+                    ApiModuleId, API->DeviceMutex(Req->CommandCode, Req->Location.SubsystemId,
+                                                  Req->Location.SubchannelId, Req->Arg));
+            }
+            else
+            {
+                MutexId = OS_OBJECT_ID_UNDEFINED;
+            }
+            if (OS_ObjectIdDefined(MutexId) && !OS_ObjectIdEqual(MutexId, HeldMutexId))
+            {
+                if (OS_ObjectIdDefined(HeldMutexId))
+                {
+                    OS_MutSemGive(HeldMutexId);
+                }
+                HeldMutexId = MutexId;
+                OS_MutSemTake(HeldMutexId);
+            }
+            Req->Result =
+                API->DeviceCommand(Req->CommandCode, Req->Location.SubsystemId, Req->Location.SubchannelId, Req->Arg);
         }
-        if (OS_ObjectIdDefined(MutexId))
+        else
         {
-            OS_MutSemTake(MutexId);
+            /* No command function defined - this is a driver implementation error */
+            Req->Result = CFE_PSP_ERROR_NOT_IMPLEMENTED;
         }
-        Result = API->DeviceCommand(CommandCode, Location->SubsystemId, Location->SubchannelId, Arg);
-        if (OS_ObjectIdDefined(MutexId))
+
+        if (Req->Result < 0)
         {
-            OS_MutSemGive(MutexId);
+            Status = CFE_PSP_ERROR;
         }
     }
+
+    if (OS_ObjectIdDefined(HeldMutexId))
+    {
+        OS_MutSemGive(HeldMutexId);
+    }
+
+    return Status;
+}
+
+int32 CFE_PSP_IODriver_Command(const CFE_PSP_IODriver_Location_t *Location, uint32 CommandCode,
+                               CFE_PSP_IODriver_Arg_t Arg)
+{
+    CFE_PSP_IODriver_Request_t Request;
+
+    Request.Location    = *Location;
+    Request.CommandCode = CommandCode;
+    Request.Arg         = Arg;
+    Request.Result      = CFE_PSP_ERROR;
+
+    CFE_PSP_IODriver_ExecuteBatch(&Request, 1);
+
+    return Request.Result;
+}
+
+int32 CFE_PSP_IODriver_CommandBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests)
+{
+    if (Requests == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    return CFE_PSP_IODriver_ExecuteBatch(Requests, NumRequests);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal function, see prototype in iodriver_impl.h
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_PSP_IODriver_ProcessQueue(void)
+{
+    CFE_PSP_IODriver_Batch_t Batch;
+    OS_time_t                DoneTime;
+    uint32                   Latency;
+    bool                     IsPending;
+
+    memset(&Batch, 0, sizeof(Batch));
+
+    OS_MutSemTake(CFE_PSP_IODriver_Queue.QueueMutex);
+    IsPending = (CFE_PSP_IODriver_Queue.ReadIdx != CFE_PSP_IODriver_Queue.WriteIdx);
+    if (IsPending)
+    {
+        Batch = CFE_PSP_IODriver_Queue.Batches[CFE_PSP_IODriver_Queue.ReadIdx % CFE_PSP_IODRIVER_QUEUE_DEPTH];
+    }
+    OS_MutSemGive(CFE_PSP_IODriver_Queue.QueueMutex);
+
+    if (!IsPending)
+    {
+        return false;
+    }
+
+    CFE_PSP_IODriver_ExecuteBatch(Batch.Requests, Batch.NumRequests);
+    if (Batch.CompletionFunc != NULL)
+    {
+        Batch.CompletionFunc(Batch.Requests, Batch.NumRequests, Batch.UserArg);
+    }
+
+    CFE_PSP_GetTime(&DoneTime);
+    Latency = (uint32)OS_TimeGetTotalMicroseconds(OS_TimeSubtract(DoneTime, Batch.SubmitTime));
+
+    OS_MutSemTake(CFE_PSP_IODriver_Queue.QueueMutex);
+    ++CFE_PSP_IODriver_Queue.ReadIdx;
+    --CFE_PSP_IODriver_Queue.Stats.CurrentDepth;
+    ++CFE_PSP_IODriver_Queue.Stats.BatchesCompleted;
+    CFE_PSP_IODriver_Queue.Stats.RequestsCompleted += Batch.NumRequests;
+    CFE_PSP_IODriver_Queue.Stats.LastLatency = Latency;
+    if (CFE_PSP_IODriver_Queue.Stats.MaxLatency < Latency)
+    {
+        CFE_PSP_IODriver_Queue.Stats.MaxLatency = Latency;
+    }
+    OS_MutSemGive(CFE_PSP_IODriver_Queue.QueueMutex);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal function, see prototype in iodriver_impl.h
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_IODriver_StartWorker(void)
+{
+    OS_task_prop_t TaskProp;
+
+    /* A worker which was deleted (or exited) must be replaced */
+    if (OS_ObjectIdDefined(CFE_PSP_IODriver_Queue.WorkerId) &&
+        OS_TaskGetInfo(CFE_PSP_IODriver_Queue.WorkerId, &TaskProp) == OS_SUCCESS)
+    {
+        return CFE_PSP_SUCCESS;
+    }
+
+    if (OS_TaskCreate(&CFE_PSP_IODriver_Queue.WorkerId, CFE_PSP_IODRIVER_WORKER_NAME, CFE_PSP_IODriver_WorkerTask,
+                      OSAL_TASK_STACK_ALLOCATE, CFE_PSP_IODRIVER_WORKER_STACK,
+                      OSAL_PRIORITY_C(CFE_PSP_IODRIVER_WORKER_PRIORITY), 0) != OS_SUCCESS)
+    {
+        CFE_PSP_IODriver_Queue.WorkerId = OS_OBJECT_ID_UNDEFINED;
+        return CFE_PSP_ERROR;
+    }
+
+    return CFE_PSP_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Internal function, see prototype in iodriver_impl.h
+ *
+ *-----------------------------------------------------------------*/
+void CFE_PSP_IODriver_WorkerTask(void)
+{
+    while (OS_CountSemTake(CFE_PSP_IODriver_Queue.WorkSem) == OS_SUCCESS)
+    {
+        CFE_PSP_IODriver_ProcessQueue();
+    }
+
+    /*
+     * The worker is exiting, so the next submission must start a new one.
+     * Any batches still queued remain counted on the semaphore and will be
+     * picked up by that worker.
+     */
+    OS_MutSemTake(CFE_PSP_IODriver_Queue.QueueMutex);
+    CFE_PSP_IODriver_Queue.WorkerId = OS_OBJECT_ID_UNDEFINED;
+    OS_MutSemGive(CFE_PSP_IODriver_Queue.QueueMutex);
+}
+
+int32 CFE_PSP_IODriver_SubmitBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests,
+                                   CFE_PSP_IODriver_CompletionFunc_t CompletionFunc, void *UserArg)
+{
+    int32                     Status;
+    CFE_PSP_IODriver_Batch_t *Batch;
+
+    if (Requests == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    Status = CFE_PSP_SUCCESS;
+
+    OS_MutSemTake(CFE_PSP_IODriver_Queue.QueueMutex);
+
+    if (CFE_PSP_IODriver_StartWorker() != CFE_PSP_SUCCESS)
+    {
+        Status = CFE_PSP_ERROR;
+    }
+    else if ((CFE_PSP_IODriver_Queue.WriteIdx - CFE_PSP_IODriver_Queue.ReadIdx) >= CFE_PSP_IODRIVER_QUEUE_DEPTH)
+    {
+        ++CFE_PSP_IODriver_Queue.Stats.BatchesRejected;
+        Status = CFE_PSP_ERROR;
+    }
     else
     {
-        /* No command function defined - this is a driver implementation error */
-        Result = CFE_PSP_ERROR_NOT_IMPLEMENTED;
+        Batch = &CFE_PSP_IODriver_Queue.Batches[CFE_PSP_IODriver_Queue.WriteIdx % CFE_PSP_IODRIVER_QUEUE_DEPTH];
+
+        Batch->Requests       = Requests;
+        Batch->NumRequests    = NumRequests;
+        Batch->CompletionFunc = CompletionFunc;
+        Batch->UserArg        = UserArg;
+        CFE_PSP_GetTime(&Batch->SubmitTime);
+
+        ++CFE_PSP_IODriver_Queue.WriteIdx;
+        ++CFE_PSP_IODriver_Queue.Stats.BatchesSubmitted;
+        ++CFE_PSP_IODriver_Queue.Stats.CurrentDepth;
+        if (CFE_PSP_IODriver_Queue.Stats.MaxDepth < CFE_PSP_IODriver_Queue.Stats.CurrentDepth)
+        {
+            CFE_PSP_IODriver_Queue.Stats.MaxDepth = CFE_PSP_IODriver_Queue.Stats.CurrentDepth;
+        }
+    }
+
+    OS_MutSemGive(CFE_PSP_IODriver_Queue.QueueMutex);
+
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        OS_CountSemGive(CFE_PSP_IODriver_Queue.WorkSem);
     }
 
-    return Result;
+    return Status;
+}
+
+int32 CFE_PSP_IODriver_GetQueueStats(CFE_PSP_IODriver_QueueStats_t *Stats)
+{
+    if (Stats == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    OS_MutSemTake(CFE_PSP_IODriver_Queue.QueueMutex);
+    *Stats = CFE_PSP_IODriver_Queue.Stats;
+    OS_MutSemGive(CFE_PSP_IODriver_Queue.QueueMutex);
+
+    return CFE_PSP_SUCCESS;
 }
 
 int32 CFE_PSP_IODriver_FindByName(const char *DriverName, uint32 *PspModuleId)
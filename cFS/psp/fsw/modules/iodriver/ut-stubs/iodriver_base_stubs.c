@@ -33,6 +33,23 @@ int32 CFE_PSP_IODriver_Command(const CFE_PSP_IODriver_Location_t *Location, uint
     return UT_GenStub_GetReturnValue(CFE_PSP_IODriver_Command, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_IODriver_CommandBatch()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_IODriver_CommandBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_IODriver_CommandBatch, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_IODriver_CommandBatch, CFE_PSP_IODriver_Request_t *, Requests);
+    UT_GenStub_AddParam(CFE_PSP_IODriver_CommandBatch, uint32, NumRequests);
+
+    UT_GenStub_Execute(CFE_PSP_IODriver_CommandBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_IODriver_CommandBatch, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_IODriver_FindByName()
@@ -49,3 +66,39 @@ int32 CFE_PSP_IODriver_FindByName(const char *DriverName, uint32 *PspModuleId)
 
     return UT_GenStub_GetReturnValue(CFE_PSP_IODriver_FindByName, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_IODriver_GetQueueStats()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_IODriver_GetQueueStats(CFE_PSP_IODriver_QueueStats_t *Stats)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_IODriver_GetQueueStats, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_IODriver_GetQueueStats, CFE_PSP_IODriver_QueueStats_t *, Stats);
+
+    UT_GenStub_Execute(CFE_PSP_IODriver_GetQueueStats, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_IODriver_GetQueueStats, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_IODriver_SubmitBatch()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_IODriver_SubmitBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests,
+                                   CFE_PSP_IODriver_CompletionFunc_t CompletionFunc, void *UserArg)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_IODriver_SubmitBatch, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_IODriver_SubmitBatch, CFE_PSP_IODriver_Request_t *, Requests);
+    UT_GenStub_AddParam(CFE_PSP_IODriver_SubmitBatch, uint32, NumRequests);
+    UT_GenStub_AddParam(CFE_PSP_IODriver_SubmitBatch, CFE_PSP_IODriver_CompletionFunc_t, CompletionFunc);
+    UT_GenStub_AddParam(CFE_PSP_IODriver_SubmitBatch, void *, UserArg);
+
+    UT_GenStub_Execute(CFE_PSP_IODriver_SubmitBatch, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_IODriver_SubmitBatch, int32);
+}
@@ -18,13 +18,15 @@
  ************************************************************************/
 
 #include <fcntl.h>
-#include <ctype.h>
 #include <unistd.h>
 #include <errno.h>
 #include <string.h>
+#include <stdio.h>
 #include <pthread.h>
 #include <stdint.h>
 #include <poll.h>
+#include <dirent.h>
+#include <sys/types.h>
 
 #include "cfe_psp.h"
 #include "cfe_psp_module.h"
@@ -39,10 +41,30 @@
 
 #define LINUX_SYSMON_AGGREGATE_SUBSYS   0
 #define LINUX_SYSMON_CPULOAD_SUBSYS     1
+#define LINUX_SYSMON_TASKLOAD_SUBSYS    2
 #define LINUX_SYSMON_AGGR_CPULOAD_SUBCH 0
 #define LINUX_SYSMON_MAX_CPUS           128
+#define LINUX_SYSMON_TASK_SLOT_BITS     6
+#define LINUX_SYSMON_MAX_TASKS          (1 << LINUX_SYSMON_TASK_SLOT_BITS)
+#define LINUX_SYSMON_TASK_NAME_LEN      16
 #define LINUX_SYSMON_SAMPLE_DELAY       30
 
+/*
+ * Size of the buffer that /proc/schedstat is read into.  This is normally
+ * large enough to hold the entire file so a sample costs a single pread(),
+ * but larger files are handled by reading in successive chunks.
+ */
+#define LINUX_SYSMON_READ_BUFSIZE 8192
+
+/*
+ * A per-task subchannel from a lookup holds the generation of the slot
+ * above the slot number, so a read can tell if the slot was reassigned
+ * to another thread since.  Generations are nonzero and fit in the rest
+ * of the 16 bit subchannel.
+ */
+#define LINUX_SYSMON_TASK_SLOT_MASK ((1U << LINUX_SYSMON_TASK_SLOT_BITS) - 1)
+#define LINUX_SYSMON_TASK_GEN_LIMIT (0x10000U >> LINUX_SYSMON_TASK_SLOT_BITS)
+
 #ifdef DEBUG_BUILD
 #define LINUX_SYSMON_DEBUG(...) OS_printf(__VA_ARGS__)
 #else
@@ -56,26 +78,55 @@
 typedef struct linux_sysmon_cpuload_core
 {
     CFE_PSP_IODriver_AdcCode_t avg_load;
-    unsigned long              last_run_time;
+    uint64_t                   last_run_time;
 } linux_sysmon_cpuload_core_t;
 
+/*
+ * Per-thread accounting entry, for threads within this process.
+ * A slot is free when tid is zero; otherwise stat_fd remains open on the
+ * schedstat file of that thread until the thread goes away.  The generation
+ * is kept when the slot is released, and changes each time it is assigned.
+ */
+typedef struct linux_sysmon_taskload_entry
+{
+    pid_t                      tid;
+    uint16_t                   generation;
+    int                        stat_fd;
+    bool                       is_present;
+    CFE_PSP_IODriver_AdcCode_t avg_load;
+    uint64_t                   last_run_time;
+    char                       name[LINUX_SYSMON_TASK_NAME_LEN];
+} linux_sysmon_taskload_entry_t;
+
 typedef struct linux_sysmon_cpuload_state
 {
     volatile bool is_running;
     volatile bool should_run;
 
     uint8_t   num_cpus;
+    uint16_t  num_tasks;
     pthread_t task_id;
     int       dev_fd;
+    DIR *     task_dir;
     uint32_t  num_samples;
     uint64_t  last_sample_time;
 
-    linux_sysmon_cpuload_core_t per_core[LINUX_SYSMON_MAX_CPUS];
+    linux_sysmon_cpuload_core_t   per_core[LINUX_SYSMON_MAX_CPUS];
+    linux_sysmon_taskload_entry_t per_task[LINUX_SYSMON_MAX_TASKS];
+
+    char read_buf[LINUX_SYSMON_READ_BUFSIZE];
 } linux_sysmon_cpuload_state_t;
 
 typedef struct linux_sysmon_state
 {
-    uint32_t                     local_module_id;
+    uint32_t local_module_id;
+
+    /*
+     * Serializes access to the per_task table, which the sampler thread
+     * updates while the dispatch functions read it in the caller context.
+     */
+    pthread_mutex_t task_lock;
+
     linux_sysmon_cpuload_state_t cpu_load;
 } linux_sysmon_state_t;
 
@@ -103,7 +154,7 @@ CFE_PSP_MODULE_DECLARE_IODEVICEDRIVER(linux_sysmon);
 
 static linux_sysmon_state_t linux_sysmon_global;
 
-static const char *linux_sysmon_subsystem_names[]  = {"aggregate", "per-cpu", NULL};
+static const char *linux_sysmon_subsystem_names[]  = {"aggregate", "per-cpu", "per-task", NULL};
 static const char *linux_sysmon_subchannel_names[] = {"cpu-load", NULL};
 
 /***********************************************************************
@@ -115,148 +166,360 @@ void linux_sysmon_Init(uint32_t local_module_id)
     memset(&linux_sysmon_global, 0, sizeof(linux_sysmon_global));
 
     linux_sysmon_global.local_module_id = local_module_id;
+    pthread_mutex_init(&linux_sysmon_global.task_lock, NULL);
 }
 
-void linux_sysmon_read_cpuuse_line(const char *line_data, unsigned int *cpu_num, unsigned long *run_time)
+/*
+ * Parses an unsigned decimal value, skipping any leading blanks.
+ * Returns a pointer to the first char after the number, or NULL if
+ * no digits were found before the end of the line or the number does
+ * not fit in 64 bits.
+ */
+const char *linux_sysmon_parse_u64(const char *line_data, const char *line_end, uint64_t *value)
 {
-    unsigned long value;
-    const char *  val_end;
-    int           val_count;
+    uint64_t accum;
+    uint64_t digit;
 
-    /* each "cpu" line contains the cpu number followed by 9 values */
-    for (val_count = 0; val_count < 10 && *line_data != 0; ++val_count)
+    while (line_data < line_end && (*line_data == ' ' || *line_data == '\t'))
+    {
+        ++line_data;
+    }
+
+    if (line_data >= line_end || *line_data < '0' || *line_data > '9')
+    {
+        return NULL;
+    }
+
+    accum = 0;
+    while (line_data < line_end && *line_data >= '0' && *line_data <= '9')
     {
-        while (isspace((unsigned char)*line_data))
+        digit = *line_data - '0';
+        if (accum > ((UINT64_MAX - digit) / 10))
         {
-            ++line_data;
+            /* overflow, not a valid counter */
+            return NULL;
         }
-        value = strtoul(line_data, (char **)&val_end, 10);
-        if (val_end == line_data)
+        accum = (accum * 10) + digit;
+        ++line_data;
+    }
+
+    *value = accum;
+    return line_data;
+}
+
+CFE_PSP_IODriver_AdcCode_t linux_sysmon_calc_load(uint64_t run_time_ns, int elapsed_ms)
+{
+    unsigned int               cpu_time_ms;
+    CFE_PSP_IODriver_AdcCode_t load;
+
+    cpu_time_ms = OS_TimeGetTotalMilliseconds(OS_TimeFromTotalNanoseconds(run_time_ns));
+    if (elapsed_ms <= 0)
+    {
+        load = 0;
+    }
+    else if (cpu_time_ms >= elapsed_ms)
+    {
+        load = 0xFFFFFF; /* max */
+    }
+    else
+    {
+        load = (0x1000 * cpu_time_ms) / elapsed_ms;
+        load |= (load << 12); /* Expand from 12->24 bit */
+    }
+
+    return load;
+}
+
+void linux_sysmon_read_cpuuse_line(linux_sysmon_cpuload_state_t *state, const char *line_data, const char *line_end,
+                                   int elapsed_ms, unsigned int *highest_cpu_num)
+{
+    uint64_t                     value;
+    uint64_t                     cpu_num;
+    uint64_t                     run_time;
+    int                          val_count;
+    linux_sysmon_cpuload_core_t *core_p;
+
+    cpu_num  = -1;
+    run_time = 0;
+
+    /* each "cpu" line contains the cpu number followed by 9 values */
+    for (val_count = 0; val_count < 10; ++val_count)
+    {
+        line_data = linux_sysmon_parse_u64(line_data, line_end, &value);
+        if (line_data == NULL)
         {
             /* not a number, something went wrong */
             break;
         }
 
-        line_data = val_end;
-
-        switch (val_count)
+        if (val_count == 0)
         {
-            case 0: /* this is the cpu number */
-                *cpu_num = value;
-                break;
+            /* this is the cpu number */
+            cpu_num = value;
+        }
+        else if (val_count == 7)
+        {
+            /* this is the number of nanoseconds spent executing instructions on this CPU */
+            run_time = value;
+            break;
+        }
+    }
 
-            case 7: /* this is the number of nanoseconds spent executing instructions on this CPU */
-                *run_time = value;
-                break;
+    if (line_data == NULL || val_count != 7 || cpu_num >= LINUX_SYSMON_MAX_CPUS)
+    {
+        return;
+    }
 
-            default: /* don't care about this one */
-                break;
-        }
+    if (cpu_num > *highest_cpu_num)
+    {
+        *highest_cpu_num = cpu_num;
     }
+
+    core_p                = &state->per_core[cpu_num];
+    core_p->avg_load      = linux_sysmon_calc_load(run_time - core_p->last_run_time, elapsed_ms);
+    core_p->last_run_time = run_time;
+
+    LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): CPU%u load=%06x\n", (unsigned int)cpu_num,
+                       (unsigned int)core_p->avg_load);
 }
 
 void linux_sysmon_update_schedstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms)
 {
-    unsigned int  cpu_time_ms;
-    unsigned int  cpu_num;
-    unsigned int  highest_cpu_num;
-    unsigned long run_time;
-    char          line_data[256];
-    size_t        line_size;
-    ssize_t       line_rdsz;
-    char *        eol_p;
-
-    linux_sysmon_cpuload_core_t *core_p;
+    unsigned int highest_cpu_num;
+    off_t        file_offset;
+    size_t       buf_fill;
+    ssize_t      rdsz;
+    const char * line_p;
+    const char * eol_p;
+    const char * end_p;
 
-    line_size       = 0;
     highest_cpu_num = 0;
+    file_offset     = 0;
+    buf_fill        = 0;
 
-    /* Reset to beginning of file to re-read it */
-    lseek(state->dev_fd, 0, SEEK_SET);
-
+    /*
+     * The file remains open between samples, pread() from offset 0 gets a fresh
+     * copy of the kernel data without needing a separate seek.
+     */
     while (true)
     {
-        line_rdsz = read(state->dev_fd, &line_data[line_size], sizeof(line_data) - line_size);
-        if (line_rdsz <= 0)
+        rdsz = pread(state->dev_fd, &state->read_buf[buf_fill], sizeof(state->read_buf) - buf_fill, file_offset);
+        if (rdsz <= 0)
         {
             /* error (not expected) or EOF, stop reading */
             break;
         }
 
-        /* check for newline char */
-        eol_p = memchr(&line_data[line_size], '\n', line_rdsz);
-        line_size += line_rdsz;
+        file_offset += rdsz;
+        buf_fill += rdsz;
+        line_p = state->read_buf;
+        end_p  = &state->read_buf[buf_fill];
 
-        while (eol_p != NULL)
+        while ((eol_p = memchr(line_p, '\n', end_p - line_p)) != NULL)
         {
-            *eol_p = 0;
-            ++eol_p;
-
-            if (strncmp("cpu", line_data, 3) == 0)
+            if ((eol_p - line_p) > 3 && memcmp(line_p, "cpu", 3) == 0)
             {
-                cpu_num  = -1;
-                run_time = 0;
-                linux_sysmon_read_cpuuse_line(&line_data[3], &cpu_num, &run_time);
+                linux_sysmon_read_cpuuse_line(state, line_p + 3, eol_p, elapsed_ms, &highest_cpu_num);
+            }
+            line_p = eol_p + 1;
+        }
 
-                if (cpu_num < LINUX_SYSMON_MAX_CPUS)
-                {
-                    core_p = &state->per_core[cpu_num];
-                    if (cpu_num > highest_cpu_num)
-                    {
-                        highest_cpu_num = cpu_num;
-                    }
-                }
-                else
-                {
-                    core_p = NULL;
-                }
+        /* keep any partial line for the next chunk */
+        buf_fill = end_p - line_p;
+        if (buf_fill >= sizeof(state->read_buf))
+        {
+            /* not supposed to happen, drop data */
+            OS_printf("CFE_PSP(linux_sysmon): malformed data from /proc/schedstat\n");
+            break;
+        }
 
-                if (core_p != NULL)
-                {
-                    cpu_time_ms =
-                        OS_TimeGetTotalMilliseconds(OS_TimeFromTotalNanoseconds(run_time - core_p->last_run_time));
-                    core_p->last_run_time = run_time;
-                    if (cpu_time_ms >= elapsed_ms)
-                    {
-                        core_p->avg_load = 0xFFFFFF; /* max */
-                    }
-                    else if (elapsed_ms == 0)
-                    {
-                        core_p->avg_load = 0;
-                    }
-                    else
-                    {
-                        core_p->avg_load = (0x1000 * cpu_time_ms) / elapsed_ms;
-                        core_p->avg_load |= (core_p->avg_load << 12); /* Expand from 12->24 bit */
-                    }
-                    LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): CPU%u time_ms=%u ms, load=%06x\n", cpu_num, cpu_time_ms,
-                                       (unsigned int)core_p->avg_load);
-                }
-            }
+        memmove(state->read_buf, line_p, buf_fill);
+    }
 
-            line_rdsz = eol_p - &line_data[0];
-            if (line_rdsz < line_size)
-            {
-                memmove(line_data, eol_p, line_size - line_rdsz);
-                line_size -= line_rdsz;
-            }
-            else
+    state->num_cpus = 1 + highest_cpu_num;
+}
+
+/*
+ * Reads the cumulative on-cpu time of a single thread, in nanoseconds.
+ * This is the first value in /proc/self/task/<tid>/schedstat.
+ */
+int32_t linux_sysmon_read_task_runtime(linux_sysmon_cpuload_state_t *state, linux_sysmon_taskload_entry_t *task_p,
+                                       uint64_t *run_time)
+{
+    ssize_t rdsz;
+
+    rdsz = pread(task_p->stat_fd, state->read_buf, sizeof(state->read_buf), 0);
+    if (rdsz <= 0 || linux_sysmon_parse_u64(state->read_buf, &state->read_buf[rdsz], run_time) == NULL)
+    {
+        return CFE_PSP_ERROR;
+    }
+
+    return CFE_PSP_SUCCESS;
+}
+
+void linux_sysmon_release_task(linux_sysmon_taskload_entry_t *task_p)
+{
+    uint16_t generation;
+
+    generation = task_p->generation;
+    close(task_p->stat_fd);
+    memset(task_p, 0, sizeof(*task_p));
+    task_p->generation = generation;
+}
+
+/*
+ * Assigns a free slot to a newly-seen thread and opens its schedstat file.
+ * The current run time becomes the baseline for the next sample.
+ */
+void linux_sysmon_open_task(linux_sysmon_cpuload_state_t *state, pid_t tid)
+{
+    linux_sysmon_taskload_entry_t *task_p;
+    char                           path[64];
+    uint16_t                       slot;
+    int                            fd;
+    ssize_t                        rdsz;
+
+    task_p = NULL;
+    for (slot = 0; slot < LINUX_SYSMON_MAX_TASKS; ++slot)
+    {
+        if (state->per_task[slot].tid == 0)
+        {
+            task_p = &state->per_task[slot];
+            break;
+        }
+    }
+
+    if (task_p == NULL)
+    {
+        /* table is full, this thread will not be accounted */
+        return;
+    }
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/schedstat", (int)tid);
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        /* thread may have exited already */
+        return;
+    }
+
+    task_p->stat_fd    = fd;
+    task_p->tid        = tid;
+    task_p->is_present = true;
+    if (linux_sysmon_read_task_runtime(state, task_p, &task_p->last_run_time) != CFE_PSP_SUCCESS)
+    {
+        linux_sysmon_release_task(task_p);
+        return;
+    }
+
+    task_p->generation = (task_p->generation % (LINUX_SYSMON_TASK_GEN_LIMIT - 1)) + 1;
+
+    snprintf(path, sizeof(path), "/proc/self/task/%d/comm", (int)tid);
+    fd = open(path, O_RDONLY);
+    if (fd >= 0)
+    {
+        rdsz = read(fd, task_p->name, sizeof(task_p->name) - 1);
+        if (rdsz > 0 && task_p->name[rdsz - 1] == '\n')
+        {
+            --rdsz;
+        }
+        task_p->name[rdsz > 0 ? rdsz : 0] = 0;
+        close(fd);
+    }
+}
+
+void linux_sysmon_update_taskstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms)
+{
+    linux_sysmon_taskload_entry_t *task_p;
+    struct dirent *                de;
+    const char *                   name_end;
+    uint64_t                       value;
+    uint64_t                       run_time;
+    uint16_t                       slot;
+    uint16_t                       num_tasks;
+
+    if (state->task_dir == NULL)
+    {
+        return;
+    }
+
+    for (slot = 0; slot < LINUX_SYSMON_MAX_TASKS; ++slot)
+    {
+        state->per_task[slot].is_present = false;
+    }
+
+    /* The directory remains open, rewinding it gets the current thread list */
+    rewinddir(state->task_dir);
+    while ((de = readdir(state->task_dir)) != NULL)
+    {
+        name_end = de->d_name + strlen(de->d_name);
+        if (linux_sysmon_parse_u64(de->d_name, name_end, &value) != name_end || value == 0)
+        {
+            /* not a thread ID (e.g. "." or "..") */
+            continue;
+        }
+
+        for (slot = 0; slot < LINUX_SYSMON_MAX_TASKS; ++slot)
+        {
+            if (state->per_task[slot].tid == (pid_t)value)
             {
-                line_size = 0;
+                state->per_task[slot].is_present = true;
+                break;
             }
+        }
 
-            eol_p = memchr(line_data, '\n', line_size);
+        if (slot == LINUX_SYSMON_MAX_TASKS)
+        {
+            linux_sysmon_open_task(state, (pid_t)value);
         }
+    }
 
-        if (line_size >= sizeof(line_data))
+    num_tasks = 0;
+    for (slot = 0; slot < LINUX_SYSMON_MAX_TASKS; ++slot)
+    {
+        task_p = &state->per_task[slot];
+        if (task_p->tid == 0)
         {
-            /* not supposed to happen, drop data */
-            OS_printf("CFE_PSP(linux_sysmon): malformed data from /proc/schedstat\n");
-            break;
+            continue;
+        }
+
+        if (!task_p->is_present || linux_sysmon_read_task_runtime(state, task_p, &run_time) != CFE_PSP_SUCCESS)
+        {
+            /* thread has exited */
+            linux_sysmon_release_task(task_p);
+            continue;
         }
+
+        task_p->avg_load      = linux_sysmon_calc_load(run_time - task_p->last_run_time, elapsed_ms);
+        task_p->last_run_time = run_time;
+        num_tasks             = slot + 1;
+
+        LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): task %d (%s) load=%06x\n", (int)task_p->tid, task_p->name,
+                           (unsigned int)task_p->avg_load);
     }
 
-    state->num_cpus = 1 + highest_cpu_num;
+    state->num_tasks = num_tasks;
+}
+
+void linux_sysmon_release_all_tasks(linux_sysmon_cpuload_state_t *state)
+{
+    uint16_t slot;
+
+    for (slot = 0; slot < LINUX_SYSMON_MAX_TASKS; ++slot)
+    {
+        if (state->per_task[slot].tid != 0)
+        {
+            linux_sysmon_release_task(&state->per_task[slot]);
+        }
+    }
+
+    if (state->task_dir != NULL)
+    {
+        closedir(state->task_dir);
+        state->task_dir = NULL;
+    }
+
+    state->num_tasks = 0;
 }
 
 void *linux_sysmon_Task(void *arg)
@@ -274,6 +537,9 @@ void *linux_sysmon_Task(void *arg)
     memset(&pfd, 0, sizeof(pfd));
 
     linux_sysmon_update_schedstat(state, 0);
+    pthread_mutex_lock(&linux_sysmon_global.task_lock);
+    linux_sysmon_update_taskstat(state, 0);
+    pthread_mutex_unlock(&linux_sysmon_global.task_lock);
 
     while (state->should_run)
     {
@@ -288,6 +554,9 @@ void *linux_sysmon_Task(void *arg)
         CFE_PSP_GetTime(&curr_sample);
         msec_diff = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(curr_sample, last_sample));
         linux_sysmon_update_schedstat(state, msec_diff);
+        pthread_mutex_lock(&linux_sysmon_global.task_lock);
+        linux_sysmon_update_taskstat(state, msec_diff);
+        pthread_mutex_unlock(&linux_sysmon_global.task_lock);
     }
 
     return NULL;
@@ -298,6 +567,9 @@ void *linux_sysmon_Task(void *arg)
  * ------------------------------------------------------
  *  Starts the cpu load watcher function
  *
+ *  Per-thread accounting is best-effort; if /proc/self/task cannot be
+ *  opened then only the per-cpu data is collected.
+ *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state)
 {
@@ -323,6 +595,12 @@ int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state)
         }
         else
         {
+            state->task_dir = opendir("/proc/self/task");
+            if (state->task_dir == NULL)
+            {
+                perror("opendir(/proc/self/task)");
+            }
+
             state->should_run = true;
             if (pthread_create(&state->task_id, NULL, linux_sysmon_Task, state) < 0)
             {
@@ -331,6 +609,9 @@ int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state)
                 /* Clean up */
                 state->should_run = false;
                 close(state->dev_fd);
+                pthread_mutex_lock(&linux_sysmon_global.task_lock);
+                linux_sysmon_release_all_tasks(state);
+                pthread_mutex_unlock(&linux_sysmon_global.task_lock);
             }
             else
             {
@@ -351,6 +632,9 @@ int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state)
                     pthread_cancel(state->task_id);
                     pthread_join(state->task_id, NULL);
                     close(state->dev_fd);
+                    pthread_mutex_lock(&linux_sysmon_global.task_lock);
+                    linux_sysmon_release_all_tasks(state);
+                    pthread_mutex_unlock(&linux_sysmon_global.task_lock);
                 }
                 else
                 {
@@ -376,6 +660,9 @@ int32_t linux_sysmon_Stop(linux_sysmon_cpuload_state_t *state)
         pthread_cancel(state->task_id);
         pthread_join(state->task_id, NULL);
         close(state->dev_fd);
+        pthread_mutex_lock(&linux_sysmon_global.task_lock);
+        linux_sysmon_release_all_tasks(state);
+        pthread_mutex_unlock(&linux_sysmon_global.task_lock);
     }
 
     return CFE_PSP_SUCCESS;
@@ -551,6 +838,80 @@ int32_t linux_sysmon_cpu_load_dispatch(uint32_t CommandCode, uint16_t Subchannel
     return StatusCode;
 }
 
+int32_t linux_sysmon_task_load_dispatch(uint32_t CommandCode, uint16_t Subchannel, CFE_PSP_IODriver_Arg_t Arg)
+{
+    int32_t                       StatusCode;
+    linux_sysmon_cpuload_state_t *state;
+
+    /* There is just one global cpuload object */
+    state      = &linux_sysmon_global.cpu_load;
+    StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
+    switch (CommandCode)
+    {
+        case CFE_PSP_IODriver_NOOP:
+        case CFE_PSP_IODriver_ANALOG_IO_NOOP:
+        {
+            StatusCode = CFE_PSP_SUCCESS;
+            break;
+        }
+        case CFE_PSP_IODriver_LOOKUP_SUBCHANNEL: /**< const char * argument, looks up a thread name and returns
+                                                    the subchannel (table slot and generation) assigned to it */
+        {
+            uint16_t i;
+
+            pthread_mutex_lock(&linux_sysmon_global.task_lock);
+            for (i = 0; i < state->num_tasks; ++i)
+            {
+                if (state->per_task[i].tid != 0 && strcmp(Arg.ConstStr, state->per_task[i].name) == 0)
+                {
+                    StatusCode = i | (state->per_task[i].generation << LINUX_SYSMON_TASK_SLOT_BITS);
+                    break;
+                }
+            }
+            pthread_mutex_unlock(&linux_sysmon_global.task_lock);
+
+            break;
+        }
+        case CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS:
+        {
+            CFE_PSP_IODriver_AnalogRdWr_t *RdWr = Arg.Vptr;
+            uint32_t                       ch;
+            uint16_t                       slot;
+            uint16_t                       generation;
+
+            slot       = Subchannel & LINUX_SYSMON_TASK_SLOT_MASK;
+            generation = Subchannel >> LINUX_SYSMON_TASK_SLOT_BITS;
+
+            pthread_mutex_lock(&linux_sysmon_global.task_lock);
+            if (generation != 0)
+            {
+                /* a single thread from a lookup, which fails if the slot was reassigned since */
+                if (RdWr->NumChannels == 1 && slot < state->num_tasks && state->per_task[slot].tid != 0 &&
+                    state->per_task[slot].generation == generation)
+                {
+                    RdWr->Samples[0] = state->per_task[slot].avg_load;
+                    StatusCode       = CFE_PSP_SUCCESS;
+                }
+            }
+            else if (Subchannel < state->num_tasks && (Subchannel + RdWr->NumChannels) <= state->num_tasks)
+            {
+                /* a range of slots, free slots within the range read as zero load */
+                for (ch = 0; ch < RdWr->NumChannels; ++ch)
+                {
+                    RdWr->Samples[ch] = state->per_task[Subchannel + ch].avg_load;
+                }
+                StatusCode = CFE_PSP_SUCCESS;
+            }
+            pthread_mutex_unlock(&linux_sysmon_global.task_lock);
+            break;
+        }
+        default:
+            break;
+    }
+
+    return StatusCode;
+}
+
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 /*    linux_sysmon_DevCmd()                                         */
 /* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
@@ -584,6 +945,9 @@ int32_t linux_sysmon_DevCmd(uint32_t CommandCode, uint16_t SubsystemId, uint16_t
         case LINUX_SYSMON_CPULOAD_SUBSYS:
             StatusCode = linux_sysmon_cpu_load_dispatch(CommandCode, SubchannelId, Arg);
             break;
+        case LINUX_SYSMON_TASKLOAD_SUBSYS:
+            StatusCode = linux_sysmon_task_load_dispatch(CommandCode, SubchannelId, Arg);
+            break;
         default:
             /* not implemented */
             break;
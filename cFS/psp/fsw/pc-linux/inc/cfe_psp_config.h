@@ -24,6 +24,7 @@
 #include <signal.h>
 #include <time.h>
 #include <pthread.h>
+#include <semaphore.h>
 
 /*
 ** This define sets the number of memory ranges that are defined in the memory range definition
@@ -59,6 +60,15 @@
 /* use the "USR1" signal to wake the idle thread when an exception occurs */
 #define CFE_PSP_EXCEPTION_EVENT_SIGNAL SIGUSR1
 
+/*
+ * Number of exception snapshots that can be pending processing by the
+ * exception handler thread at one time.  Must be a power of two.
+ *
+ * Exceptions that occur while all slots are in use are counted but
+ * otherwise dropped, in the same way as when the exception log is full.
+ */
+#define CFE_PSP_EXCEPTION_MAX_PENDING 4
+
 /*
  * The tick period that will be configured in the RTOS for the simulated
  * time base, in microseconds.  This in turn is used to drive the 1hz clock
@@ -72,6 +82,24 @@
  */
 #define CFE_PSP_SOFT_TIMEBASE_PERIOD 10000
 
+/*
+ * Directory holding the files that back the CDS, reset area and user
+ * reserved memory.  This should be a RAM-backed filesystem, so the contents
+ * survive a processor reset (restart of the process) but not a host reboot.
+ *
+ * If this is set to a hugetlbfs mount point, the areas are backed by huge
+ * pages and the sizes are rounded up to a whole number of huge pages.
+ */
+#define CFE_PSP_RESERVED_MEMORY_PATH "/dev/shm"
+
+/*
+ * Additional flags for mmap() of the reserved memory areas.
+ *
+ * MAP_POPULATE faults in the whole area at startup, rather than on first
+ * access of each page while the software is running.  Set to 0 to disable.
+ */
+#define CFE_PSP_RESERVED_MEMORY_MMAP_FLAGS MAP_POPULATE
+
 /*
 ** Global variables
 */
@@ -128,6 +156,44 @@ typedef struct
     void *bt_addrs[CFE_PSP_MAX_EXCEPTION_BACKTRACE_SIZE];
 } CFE_PSP_Exception_ContextDataEntry_t;
 
+/*
+ * A snapshot of an exception as taken by the signal handler
+ *
+ * This holds only what must be collected in the context of the signal,
+ * the rest of the processing is deferred to the exception handler thread.
+ */
+typedef struct
+{
+    volatile uint32                      State; /* free, being written, or ready to process */
+    uint32                               context_size;
+    pthread_t                            sys_task_id;
+    CFE_PSP_Exception_ContextDataEntry_t context_info;
+} CFE_PSP_ExceptionSnapshot_t;
+
+/*
+ * The state of the PSP exception handler thread
+ *
+ * This is a high priority thread that is woken by the signal handler
+ * after it stores a snapshot.  It moves the snapshot into the exception
+ * storage, reports the backtrace, and notifies the CFE.
+ *
+ * The latency measures the time from the exception until the CFE was
+ * notified, which bounds the delay before the restart decision.  It is
+ * reported in the exception summary.
+ */
+typedef struct
+{
+    pthread_t       ThreadID;
+    sem_t           Pending;
+    bool            IsRunning;
+    volatile uint32 NumCaptured;
+    volatile uint32 NumProcessed;
+    volatile uint32 NumDropped;
+    uint64          LastLatencyNs;
+
+    CFE_PSP_ExceptionSnapshot_t Slots[CFE_PSP_EXCEPTION_MAX_PENDING];
+} CFE_PSP_ExceptionHandlerState_t;
+
 /*
 ** Watchdog minimum and maximum values ( in milliseconds )
 */
@@ -145,4 +211,10 @@ typedef struct
  */
 extern CFE_PSP_IdleTaskState_t CFE_PSP_IdleTaskState;
 
+/*
+ * State of the exception handler thread, including the
+ * measured exception notification latency
+ */
+extern CFE_PSP_ExceptionHandlerState_t CFE_PSP_ExceptionHandlerState;
+
 #endif
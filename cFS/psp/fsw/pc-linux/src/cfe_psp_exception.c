@@ -34,8 +34,12 @@ S
 **  Include Files
 */
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
 
 /*
 ** cFE includes
@@ -47,6 +51,8 @@ S
 #include "cfe_psp_exceptionstorage_types.h"
 #include "cfe_psp_exceptionstorage_api.h"
 
+#include "target_config.h"
+
 #include <execinfo.h>
 #include <signal.h>
 
@@ -55,16 +61,32 @@ S
  */
 sigset_t CFE_PSP_AsyncMask;
 
+/*
+ * State of the exception handler thread
+ */
+CFE_PSP_ExceptionHandlerState_t CFE_PSP_ExceptionHandlerState;
+
+/*
+ * States of an exception snapshot slot
+ */
+#define CFE_PSP_EXCEPTION_SLOT_FREE  0
+#define CFE_PSP_EXCEPTION_SLOT_BUSY  1
+#define CFE_PSP_EXCEPTION_SLOT_READY 2
+
+#define CFE_PSP_EXCEPTION_PENDING_MASK (CFE_PSP_EXCEPTION_MAX_PENDING - 1)
+
 /***************************************************************************
  **                        FUNCTIONS DEFINITIONS
  ***************************************************************************/
 
 /*
 **
-** Installed as a signal handler to log exception events.
+** Stores the exception context directly into the exception storage
+** and wakes the idle thread.  This is the fallback for when the
+** exception handler thread is not running.
 **
 */
-void CFE_PSP_ExceptionSigHandler(int signo, siginfo_t *si, void *ctxt)
+static void CFE_PSP_ExceptionCaptureDirect(siginfo_t *si)
 {
     CFE_PSP_Exception_LogData_t *Buffer;
     int                          NumAddrs;
@@ -74,15 +96,9 @@ void CFE_PSP_ExceptionSigHandler(int signo, siginfo_t *si, void *ctxt)
      * and CFE_PSP_Exception_WriteComplete() is sensitive in that it is
      * accessing a global.
      *
-     * Cannot use a conventional lock because this is a signal handler, the
-     * solution would need to involve a signal-safe spinlock and/or C11
-     * atomic ops.
-     *
      * This means if another exception occurs on another task during this
-     * time window, it may use the same buffer.
-     *
-     * However, exceptions should be rare enough events that this is highly
-     * unlikely to occur, so leaving this unhandled for now.
+     * time window, it may use the same buffer.  This is avoided when the
+     * exception handler thread is running, as it is the only writer.
      */
     Buffer = CFE_PSP_Exception_GetNextContextBuffer();
     if (Buffer != NULL)
@@ -109,6 +125,277 @@ void CFE_PSP_ExceptionSigHandler(int signo, siginfo_t *si, void *ctxt)
     pthread_kill(CFE_PSP_IdleTaskState.ThreadID, CFE_PSP_EXCEPTION_EVENT_SIGNAL);
 }
 
+/*
+**
+** Installed as a signal handler to log exception events.
+**
+** This only takes a snapshot of the information that must be collected
+** in the context of the signal, and wakes the exception handler thread
+** to do the rest.  Everything here must be async-signal-safe.
+**
+*/
+void CFE_PSP_ExceptionSigHandler(int signo, siginfo_t *si, void *ctxt)
+{
+    CFE_PSP_ExceptionHandlerState_t *State = &CFE_PSP_ExceptionHandlerState;
+    CFE_PSP_ExceptionSnapshot_t *    Slot;
+    uint32                           Seq;
+    uint32                           Expected;
+    uint32                           i;
+    int                              NumAddrs;
+
+    if (State->IsRunning && pthread_equal(pthread_self(), State->ThreadID))
+    {
+        /*
+         * The handler thread itself faulted (e.g. while reporting a backtrace).
+         * It would never process this snapshot, and as it will be suspended it
+         * will not drain any other slots either, so stop using it.
+         */
+        __atomic_store_n(&State->IsRunning, false, __ATOMIC_SEQ_CST);
+    }
+
+    if (!State->IsRunning)
+    {
+        CFE_PSP_ExceptionCaptureDirect(si);
+        return;
+    }
+
+    /*
+     * Claim a free slot.  This uses atomic ops rather than a lock, so
+     * exceptions occurring concurrently on other threads (or nested in
+     * this one) each get their own slot.
+     */
+    Seq  = __atomic_fetch_add(&State->NumCaptured, 1, __ATOMIC_SEQ_CST);
+    Slot = NULL;
+    for (i = 0; i < CFE_PSP_EXCEPTION_MAX_PENDING; ++i)
+    {
+        Slot     = &State->Slots[(Seq + i) & CFE_PSP_EXCEPTION_PENDING_MASK];
+        Expected = CFE_PSP_EXCEPTION_SLOT_FREE;
+        if (__atomic_compare_exchange_n(&Slot->State, &Expected, CFE_PSP_EXCEPTION_SLOT_BUSY, false,
+                                        __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+        Slot = NULL;
+    }
+
+    if (Slot == NULL)
+    {
+        /* all slots are pending, nowhere to store this context */
+        __atomic_fetch_add(&State->NumDropped, 1, __ATOMIC_RELAXED);
+    }
+    else
+    {
+        /* see CFE_PSP_ExceptionCaptureDirect() regarding signal safety of these calls */
+        clock_gettime(CLOCK_MONOTONIC, &Slot->context_info.event_time);
+        memcpy(&Slot->context_info.si, si, sizeof(Slot->context_info.si));
+        NumAddrs           = backtrace(Slot->context_info.bt_addrs, CFE_PSP_MAX_EXCEPTION_BACKTRACE_SIZE);
+        Slot->context_size = offsetof(CFE_PSP_Exception_ContextDataEntry_t, bt_addrs[NumAddrs]);
+        Slot->sys_task_id  = pthread_self();
+
+        __atomic_store_n(&Slot->State, CFE_PSP_EXCEPTION_SLOT_READY, __ATOMIC_RELEASE);
+    }
+
+    /* sem_post() is signal-safe per POSIX */
+    sem_post(&State->Pending);
+}
+
+/*
+**
+** Moves a snapshot into the exception storage.
+** Called from the exception handler thread.
+**
+*/
+static void CFE_PSP_ExceptionCommitSnapshot(const CFE_PSP_ExceptionSnapshot_t *Slot)
+{
+    CFE_PSP_Exception_LogData_t *Buffer;
+
+    /* This thread is the only writer, so there is no race on the storage here */
+    Buffer = CFE_PSP_Exception_GetNextContextBuffer();
+    if (Buffer != NULL)
+    {
+        Buffer->sys_task_id  = Slot->sys_task_id;
+        Buffer->context_size = Slot->context_size;
+        memcpy(&Buffer->context_info, &Slot->context_info, Slot->context_size);
+        CFE_PSP_Exception_WriteComplete();
+    }
+}
+
+/*
+**
+** Reports the backtrace of synchronous exceptions (faults) on the console.
+** Resolving the symbols is not signal safe, which is why it is done here
+** and not in the signal handler.
+**
+*/
+static void CFE_PSP_ExceptionReportSnapshot(const CFE_PSP_ExceptionSnapshot_t *Slot)
+{
+    char **Symbols;
+    int    NumAddrs;
+    int    i;
+
+    if (sigismember(&CFE_PSP_AsyncMask, Slot->context_info.si.si_signo))
+    {
+        return;
+    }
+
+    NumAddrs = (Slot->context_size - offsetof(CFE_PSP_Exception_ContextDataEntry_t, bt_addrs)) / sizeof(void *);
+    OS_printf("CFE_PSP: Signal %d in thread 0x%lx, backtrace:\n", Slot->context_info.si.si_signo,
+              (unsigned long)Slot->sys_task_id);
+
+    Symbols = backtrace_symbols(Slot->context_info.bt_addrs, NumAddrs);
+    for (i = 0; i < NumAddrs; ++i)
+    {
+        if (Symbols != NULL)
+        {
+            OS_printf("CFE_PSP:   [%d] %s\n", i, Symbols[i]);
+        }
+        else
+        {
+            OS_printf("CFE_PSP:   [%d] %p\n", i, Slot->context_info.bt_addrs[i]);
+        }
+    }
+    free(Symbols);
+}
+
+/*
+**
+** Entry point of the exception handler thread.
+**
+** Waits for the signal handler to store snapshots, commits them to the
+** exception storage and notifies the CFE.  Reporting the backtrace is
+** done after the notification, so it does not delay the restart decision.
+**
+*/
+static void *CFE_PSP_ExceptionHandlerThread(void *arg)
+{
+    CFE_PSP_ExceptionHandlerState_t *State = &CFE_PSP_ExceptionHandlerState;
+    CFE_PSP_ExceptionSnapshot_t *    Slot;
+    struct timespec                  Oldest;
+    struct timespec                  Now;
+    uint32                           FoundMask;
+    uint32                           i;
+
+    /* Asynchronous signals should be delivered elsewhere */
+    pthread_sigmask(SIG_BLOCK, &CFE_PSP_AsyncMask, NULL);
+
+    while (true)
+    {
+        if (sem_wait(&State->Pending) != 0)
+        {
+            if (errno == EINTR)
+            {
+                /* interrupted, try again */
+                continue;
+            }
+
+            /* the semaphore is not usable, so exceptions must be processed in the signal handler */
+            OS_printf("CFE_PSP: Exception handler thread stopped: %s\n", strerror(errno));
+            State->IsRunning = false;
+            break;
+        }
+
+        FoundMask = 0;
+        memset(&Oldest, 0, sizeof(Oldest));
+        for (i = 0; i < CFE_PSP_EXCEPTION_MAX_PENDING; ++i)
+        {
+            Slot = &State->Slots[i];
+            if (__atomic_load_n(&Slot->State, __ATOMIC_ACQUIRE) != CFE_PSP_EXCEPTION_SLOT_READY)
+            {
+                continue;
+            }
+
+            CFE_PSP_ExceptionCommitSnapshot(Slot);
+
+            if (FoundMask == 0 || Slot->context_info.event_time.tv_sec < Oldest.tv_sec ||
+                (Slot->context_info.event_time.tv_sec == Oldest.tv_sec &&
+                 Slot->context_info.event_time.tv_nsec < Oldest.tv_nsec))
+            {
+                Oldest = Slot->context_info.event_time;
+            }
+
+            FoundMask |= 1U << i;
+        }
+
+        if (FoundMask != 0)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &Now);
+            State->LastLatencyNs =
+                ((uint64)(Now.tv_sec - Oldest.tv_sec) * 1000000000) + Now.tv_nsec - Oldest.tv_nsec;
+        }
+
+        /* notify the CFE of the event, same as the idle thread would */
+        if (!CFE_PSP_IdleTaskState.ShutdownReq && GLOBAL_CFE_CONFIGDATA.SystemNotify != NULL)
+        {
+            GLOBAL_CFE_CONFIGDATA.SystemNotify();
+        }
+
+        for (i = 0; i < CFE_PSP_EXCEPTION_MAX_PENDING; ++i)
+        {
+            if ((FoundMask & (1U << i)) != 0)
+            {
+                Slot = &State->Slots[i];
+                CFE_PSP_ExceptionReportSnapshot(Slot);
+
+                ++State->NumProcessed;
+                __atomic_store_n(&Slot->State, CFE_PSP_EXCEPTION_SLOT_FREE, __ATOMIC_RELEASE);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+**
+** Starts the exception handler thread
+**
+** This uses the highest real time priority if permitted, otherwise it
+** runs with the default scheduling policy.  If the thread cannot be
+** started, exceptions are processed entirely in the signal handler.
+**
+*/
+static void CFE_PSP_StartExceptionHandler(void)
+{
+    CFE_PSP_ExceptionHandlerState_t *State = &CFE_PSP_ExceptionHandlerState;
+    pthread_attr_t                   Attr;
+    struct sched_param               Param;
+    int                              ret;
+
+    memset(State, 0, sizeof(*State));
+
+    if (sem_init(&State->Pending, 0, 0) != 0)
+    {
+        OS_printf("CFE_PSP: Unable to create exception handler semaphore\n");
+        return;
+    }
+
+    pthread_attr_init(&Attr);
+    pthread_attr_setinheritsched(&Attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&Attr, SCHED_FIFO);
+    memset(&Param, 0, sizeof(Param));
+    Param.sched_priority = sched_get_priority_max(SCHED_FIFO);
+    pthread_attr_setschedparam(&Attr, &Param);
+
+    ret = pthread_create(&State->ThreadID, &Attr, CFE_PSP_ExceptionHandlerThread, NULL);
+    pthread_attr_destroy(&Attr);
+
+    if (ret == EPERM)
+    {
+        /* Not permitted to use real time scheduling, so use the defaults */
+        OS_printf("CFE_PSP: Exception handler thread using default priority\n");
+        ret = pthread_create(&State->ThreadID, NULL, CFE_PSP_ExceptionHandlerThread, NULL);
+    }
+
+    if (ret != 0)
+    {
+        OS_printf("CFE_PSP: Unable to start exception handler thread: %s\n", strerror(ret));
+        sem_destroy(&State->Pending);
+        return;
+    }
+
+    State->IsRunning = true;
+}
+
 /*
 **
 ** An extension of CFE_PSP_ExceptionSigHandler that also
@@ -220,6 +507,12 @@ void CFE_PSP_AttachExceptions(void)
     sigdelset(&CFE_PSP_AsyncMask, SIGBUS);
     sigdelset(&CFE_PSP_AsyncMask, SIGSEGV);
 
+    /*
+     * Start the thread which completes the processing of exceptions,
+     * before any handlers that depend on it are installed.
+     */
+    CFE_PSP_StartExceptionHandler();
+
     /*
      * Install sigint_handler as the signal handler for SIGINT.
      *
@@ -269,6 +562,7 @@ void CFE_PSP_SetDefaultExceptionEnvironment(void)
 int32 CFE_PSP_ExceptionGetSummary_Impl(const CFE_PSP_Exception_LogData_t *Buffer, char *ReasonBuf, uint32 ReasonSize)
 {
     const char *ComputedReason = "unknown";
+    size_t      ReasonLen;
 
     /* check the "code" within the siginfo structure, which reveals more info about the FP exception */
     if (Buffer->context_info.si.si_signo == SIGFPE)
@@ -320,5 +614,17 @@ int32 CFE_PSP_ExceptionGetSummary_Impl(const CFE_PSP_Exception_LogData_t *Buffer
         (void)snprintf(ReasonBuf, ReasonSize, "Caught Signal %d", Buffer->context_info.si.si_signo);
     }
 
+    /*
+     * Also report how long the handler thread took to notify the CFE of the
+     * most recent exception(s), which bounds the delay of the restart decision.
+     * This is not known if the exception was processed in the signal handler.
+     */
+    ReasonLen = strlen(ReasonBuf);
+    if (CFE_PSP_ExceptionHandlerState.LastLatencyNs != 0 && ReasonLen < ReasonSize)
+    {
+        (void)snprintf(&ReasonBuf[ReasonLen], ReasonSize - ReasonLen, ", notified in %lu us",
+                       (unsigned long)(CFE_PSP_ExceptionHandlerState.LastLatencyNs / 1000));
+    }
+
     return CFE_PSP_SUCCESS;
 }
@@ -40,9 +40,9 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <string.h>
-#include <sys/types.h>
-#include <sys/ipc.h>
-#include <sys/shm.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/vfs.h>
 #include <fcntl.h>
 
 /*
@@ -62,9 +62,9 @@
 #include "cfe_psp_config.h"
 #include "cfe_psp_memory.h"
 
-#define CFE_PSP_CDS_KEY_FILE      ".cdskeyfile"
-#define CFE_PSP_RESET_KEY_FILE    ".resetkeyfile"
-#define CFE_PSP_RESERVED_KEY_FILE ".reservedkeyfile"
+#define CFE_PSP_CDS_SEGMENT_NAME      "cds"
+#define CFE_PSP_RESET_SEGMENT_NAME    "reset"
+#define CFE_PSP_RESERVED_SEGMENT_NAME "reserved"
 
 #include "target_config.h"
 
@@ -82,6 +82,16 @@ typedef struct
     CFE_PSP_ExceptionStorage_t         ExceptionStorage;
 } CFE_PSP_LinuxReservedAreaFixedLayout_t;
 
+/*
+ * A reserved memory area, backed by a file under CFE_PSP_RESERVED_MEMORY_PATH
+ */
+typedef struct
+{
+    char   Path[OS_MAX_LOCAL_PATH_LEN];
+    void * BlockPtr;
+    size_t MappedSize;
+} CFE_PSP_LinuxMemorySegment_t;
+
 /*
 ** Internal prototypes for this module
 */
@@ -108,9 +118,15 @@ extern unsigned int _fini;
 /*
 ** Global variables
 */
-int ResetAreaShmId;
-int CDSShmId;
-int UserShmId;
+static CFE_PSP_LinuxMemorySegment_t CFE_PSP_ResetAreaSegment;
+static CFE_PSP_LinuxMemorySegment_t CFE_PSP_CDSSegment;
+static CFE_PSP_LinuxMemorySegment_t CFE_PSP_UserReservedSegment;
+
+/*
+ * Prefix for the backing file names, unique to the working directory of
+ * this instance so several instances on one host do not share memory.
+ */
+static char CFE_PSP_SegmentNamePrefix[64];
 
 /*
 ** Pointer to the vxWorks USER_RESERVED_MEMORY area
@@ -120,64 +136,131 @@ CFE_PSP_ReservedMemoryMap_t CFE_PSP_ReservedMemoryMap;
 
 /*
 *********************************************************************************
-** CDS related functions
+** Memory segment helper functions
 *********************************************************************************
 */
-/*
-**
-*/
+
 /******************************************************************************
 **
-**  Purpose: This function is used by the ES startup code to initialize the
-**            Critical Data store area
-**
+**  Purpose:
+**    Maps (and possibly creates) the file backing a reserved memory area.
+**    Any failure is fatal, as the PSP cannot operate without these areas.
 **
 **  Arguments:
-**    (none)
+**    Segment - segment state to fill in
+**    Name    - short name of the segment, used in the file name
+**    Size    - minimum size of the segment
 **
 **  Return:
-**    (none)
+**    Address of the mapped segment
 */
-
-void CFE_PSP_InitCDS(void)
+static void *CFE_PSP_MapMemorySegment(CFE_PSP_LinuxMemorySegment_t *Segment, const char *Name, size_t Size)
 {
-    key_t key;
+    int           fd;
+    size_t        align_mask;
+    struct statfs FsInfo;
 
-    /*
-    ** Make the Shared memory key
-    */
-    if ((key = ftok(CFE_PSP_CDS_KEY_FILE, 'R')) == -1)
+    snprintf(Segment->Path, sizeof(Segment->Path), "%s/%s.%s", CFE_PSP_RESERVED_MEMORY_PATH,
+             CFE_PSP_SegmentNamePrefix, Name);
+
+    fd = open(Segment->Path, O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+    if (fd < 0)
     {
-        perror("CFE_PSP - Cannot Create CDS Shared memory key");
+        perror("CFE_PSP - Cannot open reserved memory file");
         CFE_PSP_Panic(CFE_PSP_ERROR);
     }
 
     /*
-    ** connect to (and possibly create) the segment:
-    */
-    if ((CDSShmId = shmget(key, CFE_PSP_CDS_SIZE, 0644 | IPC_CREAT)) == -1)
+     * The file size must be a whole number of pages of the backing filesystem,
+     * which reports its page size as the block size (this is the huge page
+     * size on hugetlbfs)
+     */
+    if (fstatfs(fd, &FsInfo) == 0 && FsInfo.f_bsize > 0)
     {
-        perror("CFE_PSP - Cannot shmget CDS Shared memory Segment");
+        align_mask = FsInfo.f_bsize - 1;
+    }
+    else
+    {
+        align_mask = sysconf(_SC_PAGESIZE) - 1;
+    }
+
+    Segment->MappedSize = (Size + align_mask) & ~align_mask;
+
+    /* Existing content is preserved if the file is already the right size */
+    if (ftruncate(fd, Segment->MappedSize) < 0)
+    {
+        perror("CFE_PSP - Cannot set size of reserved memory file");
         CFE_PSP_Panic(CFE_PSP_ERROR);
     }
 
-    /*
-    ** attach to the segment to get a pointer to it:
-    */
-    CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr = shmat(CDSShmId, (void *)0, 0);
-    if (CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr == (void *)(-1))
+    Segment->BlockPtr = mmap(NULL, Segment->MappedSize, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | CFE_PSP_RESERVED_MEMORY_MMAP_FLAGS, fd, 0);
+    if (Segment->BlockPtr == MAP_FAILED)
     {
-        perror("CFE_PSP - Cannot shmat to CDS Shared memory Segment");
+        perror("CFE_PSP - Cannot mmap reserved memory file");
         CFE_PSP_Panic(CFE_PSP_ERROR);
     }
 
+    /* The mapping holds a reference to the file, so the descriptor is not needed */
+    close(fd);
+
+    return Segment->BlockPtr;
+}
+
+/******************************************************************************
+**
+**  Purpose:
+**    Unmaps a reserved memory area and removes its backing file.
+**
+**  Arguments:
+**    Segment - segment to remove
+**
+**  Return:
+**    0 on success, -1 if the backing file could not be removed
+*/
+static int CFE_PSP_UnmapMemorySegment(CFE_PSP_LinuxMemorySegment_t *Segment)
+{
+    if (Segment->BlockPtr != NULL)
+    {
+        munmap(Segment->BlockPtr, Segment->MappedSize);
+        Segment->BlockPtr = NULL;
+    }
+
+    return unlink(Segment->Path);
+}
+
+/*
+*********************************************************************************
+** CDS related functions
+*********************************************************************************
+*/
+/*
+**
+*/
+/******************************************************************************
+**
+**  Purpose: This function is used by the ES startup code to initialize the
+**            Critical Data store area
+**
+**
+**  Arguments:
+**    (none)
+**
+**  Return:
+**    (none)
+*/
+
+void CFE_PSP_InitCDS(void)
+{
+    CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr =
+        CFE_PSP_MapMemorySegment(&CFE_PSP_CDSSegment, CFE_PSP_CDS_SEGMENT_NAME, CFE_PSP_CDS_SIZE);
     CFE_PSP_ReservedMemoryMap.CDSMemory.BlockSize = CFE_PSP_CDS_SIZE;
 }
 
 /******************************************************************************
 **
 **  Purpose:
-**   This is an internal function to delete the CDS Shared memory segment.
+**   This is an internal function to delete the CDS memory segment.
 **
 **  Arguments:
 **    (none)
@@ -187,19 +270,13 @@ void CFE_PSP_InitCDS(void)
 */
 void CFE_PSP_DeleteCDS(void)
 {
-    int             ReturnCode;
-    struct shmid_ds ShmCtrl;
-
-    ReturnCode = shmctl(CDSShmId, IPC_RMID, &ShmCtrl);
-
-    if (ReturnCode == 0)
+    if (CFE_PSP_UnmapMemorySegment(&CFE_PSP_CDSSegment) == 0)
     {
-        OS_printf("CFE_PSP: Critical Data Store Shared memory segment removed\n");
+        OS_printf("CFE_PSP: Critical Data Store memory segment removed\n");
     }
     else
     {
-        OS_printf("CFE_PSP: Error Removing Critical Data Store Shared memory Segment.\n");
-        OS_printf("CFE_PSP: It can be manually checked and removed using the ipcs and ipcrm commands.\n");
+        OS_printf("CFE_PSP: Error Removing Critical Data Store memory segment %s\n", CFE_PSP_CDSSegment.Path);
     }
 }
 
@@ -226,6 +303,30 @@ int32 CFE_PSP_GetCDSSize(uint32 *SizeOfCDS)
     return return_code;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS)
+{
+    int32 return_code;
+
+    if (PtrToCDS == NULL || SizeOfCDS == NULL)
+    {
+        return_code = CFE_PSP_ERROR;
+    }
+    else
+    {
+        *PtrToCDS   = (cpuaddr)CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr;
+        *SizeOfCDS  = CFE_PSP_ReservedMemoryMap.CDSMemory.BlockSize;
+        return_code = CFE_PSP_SUCCESS;
+    }
+
+    return return_code;
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -316,25 +417,16 @@ int32 CFE_PSP_ReadFromCDS(void *PtrToDataToRead, uint32 CDSOffset, uint32 NumByt
 */
 void CFE_PSP_InitResetArea(void)
 {
-    key_t                                   key;
     size_t                                  total_size;
     size_t                                  reset_offset;
     size_t                                  align_mask;
     cpuaddr                                 block_addr;
     CFE_PSP_LinuxReservedAreaFixedLayout_t *FixedBlocksPtr;
-    /*
-    ** Make the Shared memory key
-    */
-    if ((key = ftok(CFE_PSP_RESET_KEY_FILE, 'R')) == -1)
-    {
-        perror("CFE_PSP - Cannot Create Reset Area Shared memory key");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
 
     /*
      * NOTE: Historically the CFE ES reset area also contains the Exception log.
      * This is now allocated as a separate structure in the PSP, but it can
-     * reside in this shared memory segment so it will be preserved on a processor
+     * reside in this memory segment so it will be preserved on a processor
      * reset.
      */
     align_mask   = sysconf(_SC_PAGESIZE) - 1; /* align blocks to whole memory pages */
@@ -344,24 +436,8 @@ void CFE_PSP_InitResetArea(void)
     total_size += CFE_PSP_RESET_AREA_SIZE;
     total_size = (total_size + align_mask) & ~align_mask;
 
-    /*
-    ** connect to (and possibly create) the segment:
-    */
-    if ((ResetAreaShmId = shmget(key, total_size, 0644 | IPC_CREAT)) == -1)
-    {
-        perror("CFE_PSP - Cannot shmget Reset Area Shared memory Segment");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
-
-    /*
-    ** attach to the segment to get a pointer to it:
-    */
-    block_addr = (cpuaddr)shmat(ResetAreaShmId, (void *)0, 0);
-    if (block_addr == (cpuaddr)(-1))
-    {
-        perror("CFE_PSP - Cannot shmat to Reset Area Shared memory Segment");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
+    block_addr =
+        (cpuaddr)CFE_PSP_MapMemorySegment(&CFE_PSP_ResetAreaSegment, CFE_PSP_RESET_SEGMENT_NAME, total_size);
 
     FixedBlocksPtr = (CFE_PSP_LinuxReservedAreaFixedLayout_t *)block_addr;
     block_addr += reset_offset;
@@ -376,7 +452,7 @@ void CFE_PSP_InitResetArea(void)
 /******************************************************************************
 **
 **  Purpose:
-**   This is an internal function to delete the Reset Area Shared memory segment.
+**   This is an internal function to delete the Reset Area memory segment.
 **
 **  Arguments:
 **    (none)
@@ -386,19 +462,13 @@ void CFE_PSP_InitResetArea(void)
 */
 void CFE_PSP_DeleteResetArea(void)
 {
-    int             ReturnCode;
-    struct shmid_ds ShmCtrl;
-
-    ReturnCode = shmctl(ResetAreaShmId, IPC_RMID, &ShmCtrl);
-
-    if (ReturnCode == 0)
+    if (CFE_PSP_UnmapMemorySegment(&CFE_PSP_ResetAreaSegment) == 0)
     {
-        OS_printf("Reset Area Shared memory segment removed\n");
+        OS_printf("Reset Area memory segment removed\n");
     }
     else
     {
-        OS_printf("Error Removing Reset Area Shared memory Segment.\n");
-        OS_printf("It can be manually checked and removed using the ipcs and ipcrm commands.\n");
+        OS_printf("Error Removing Reset Area memory segment %s\n", CFE_PSP_ResetAreaSegment.Path);
     }
 }
 
@@ -446,43 +516,15 @@ int32 CFE_PSP_GetResetArea(cpuaddr *PtrToResetArea, uint32 *SizeOfResetArea)
 */
 void CFE_PSP_InitUserReservedArea(void)
 {
-    key_t key;
-
-    /*
-    ** Make the Shared memory key
-    */
-    if ((key = ftok(CFE_PSP_RESERVED_KEY_FILE, 'R')) == -1)
-    {
-        perror("CFE_PSP - Cannot Create User Reserved Area Shared memory key");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
-
-    /*
-    ** connect to (and possibly create) the segment:
-    */
-    if ((UserShmId = shmget(key, CFE_PSP_USER_RESERVED_SIZE, 0644 | IPC_CREAT)) == -1)
-    {
-        perror("CFE_PSP - Cannot shmget User Reserved Area Shared memory Segment");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
-
-    /*
-    ** attach to the segment to get a pointer to it:
-    */
-    CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockPtr = shmat(UserShmId, (void *)0, 0);
-    if (CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockPtr == (void *)(-1))
-    {
-        perror("CFE_PSP - Cannot shmat to User Reserved Area Shared memory Segment");
-        CFE_PSP_Panic(CFE_PSP_ERROR);
-    }
-
+    CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockPtr = CFE_PSP_MapMemorySegment(
+        &CFE_PSP_UserReservedSegment, CFE_PSP_RESERVED_SEGMENT_NAME, CFE_PSP_USER_RESERVED_SIZE);
     CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockSize = CFE_PSP_USER_RESERVED_SIZE;
 }
 
 /******************************************************************************
 **
 **  Purpose:
-**   This is an internal function to delete the User Reserved Shared memory segment.
+**   This is an internal function to delete the User Reserved memory segment.
 **
 **  Arguments:
 **    (none)
@@ -492,19 +534,13 @@ void CFE_PSP_InitUserReservedArea(void)
 */
 void CFE_PSP_DeleteUserReservedArea(void)
 {
-    int             ReturnCode;
-    struct shmid_ds ShmCtrl;
-
-    ReturnCode = shmctl(UserShmId, IPC_RMID, &ShmCtrl);
-
-    if (ReturnCode == 0)
+    if (CFE_PSP_UnmapMemorySegment(&CFE_PSP_UserReservedSegment) == 0)
     {
-        OS_printf("User Reserved Area Shared memory segment removed\n");
+        OS_printf("User Reserved Area memory segment removed\n");
     }
     else
     {
-        OS_printf("Error Removing User Reserved Area Shared memory Segment.\n");
-        OS_printf("It can be manually checked and removed using the ipcs and ipcrm commands.\n");
+        OS_printf("Error Removing User Reserved Area memory segment %s\n", CFE_PSP_UserReservedSegment.Path);
     }
 }
 
@@ -602,18 +638,21 @@ int32 CFE_PSP_GetVolatileDiskMem(cpuaddr *PtrToVolDisk, uint32 *SizeOfVolDisk)
 */
 void CFE_PSP_SetupReservedMemoryMap(void)
 {
-    int tempFd;
+    struct stat DirInfo;
 
     /*
-    ** Create the key files for the shared memory segments
-    ** The files are not needed, so they are closed right away.
+    ** Name the backing files after the user and the identity of the working
+    ** directory, so a restarted instance finds its own files again while other
+    ** instances on the same host (run from other directories) get separate ones.
     */
-    tempFd = open(CFE_PSP_CDS_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU);
-    close(tempFd);
-    tempFd = open(CFE_PSP_RESET_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU);
-    close(tempFd);
-    tempFd = open(CFE_PSP_RESERVED_KEY_FILE, O_RDONLY | O_CREAT, S_IRWXU);
-    close(tempFd);
+    if (stat(".", &DirInfo) < 0)
+    {
+        perror("CFE_PSP - Cannot stat working directory");
+        CFE_PSP_Panic(CFE_PSP_ERROR);
+    }
+
+    snprintf(CFE_PSP_SegmentNamePrefix, sizeof(CFE_PSP_SegmentNamePrefix), "cfe-%lu-%lx-%lx",
+             (unsigned long)getuid(), (unsigned long)DirInfo.st_dev, (unsigned long)DirInfo.st_ino);
 
     /*
      * The setup of each section is done as a separate init.
@@ -645,11 +684,11 @@ int32 CFE_PSP_InitProcessorReservedMemory(uint32 RestartType)
      */
     if (RestartType == CFE_PSP_RST_TYPE_POWERON)
     {
-        OS_printf("CFE_PSP: Clearing out CFE CDS Shared memory segment.\n");
+        OS_printf("CFE_PSP: Clearing out CFE CDS memory segment.\n");
         memset(CFE_PSP_ReservedMemoryMap.CDSMemory.BlockPtr, 0, CFE_PSP_CDS_SIZE);
-        OS_printf("CFE_PSP: Clearing out CFE Reset Shared memory segment.\n");
+        OS_printf("CFE_PSP: Clearing out CFE Reset memory segment.\n");
         memset(CFE_PSP_ReservedMemoryMap.ResetMemory.BlockPtr, 0, CFE_PSP_RESET_AREA_SIZE);
-        OS_printf("CFE_PSP: Clearing out CFE User Reserved Shared memory segment.\n");
+        OS_printf("CFE_PSP: Clearing out CFE User Reserved memory segment.\n");
         memset(CFE_PSP_ReservedMemoryMap.UserReservedMemory.BlockPtr, 0, CFE_PSP_USER_RESERVED_SIZE);
 
         memset(CFE_PSP_ReservedMemoryMap.BootPtr, 0, sizeof(*CFE_PSP_ReservedMemoryMap.BootPtr));
@@ -675,7 +714,7 @@ int32 CFE_PSP_InitProcessorReservedMemory(uint32 RestartType)
      * Reset the boot record validity flag (always).
      *
      * If an unclean shutdown occurs, such as a software crash or abort, this
-     * will remain in the shm structure and it can be detected at startup.
+     * will remain in the reset area and it can be detected at startup.
      *
      * This can be used to differentiate between an intentional and unintentional
      * processor reset.
@@ -691,7 +730,7 @@ int32 CFE_PSP_InitProcessorReservedMemory(uint32 RestartType)
 /******************************************************************************
 **
 **  Purpose:
-**    This function cleans up all of the shared memory segments in the
+**    This function cleans up all of the reserved memory segments in the
 **     Linux/OSX ports.
 **
 **  Arguments:
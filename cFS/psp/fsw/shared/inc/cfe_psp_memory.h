@@ -50,6 +50,22 @@ typedef struct
     uint32  Attributes;
 } CFE_PSP_MemTable_t;
 
+/**
+** \brief Memory Table Search Index
+**
+** Positions of the usable entries in the system memory table, sorted by
+** start address.  The entries may overlap, so MaxEnd[i] holds the highest
+** end address of any of the first i+1 sorted entries, which bounds how far
+** back a search from a given address has to look.
+*/
+typedef struct
+{
+    uint32  NumEntries;                       /**< Number of sorted entries */
+    uint32  LastValidPos;                     /**< Table position + 1 of the last entry not marked invalid, 0 if none */
+    uint32  Position[CFE_PSP_MEM_TABLE_SIZE]; /**< Table positions, sorted by start address */
+    cpuaddr MaxEnd[CFE_PSP_MEM_TABLE_SIZE];   /**< Running maximum of end addresses in sorted order */
+} CFE_PSP_MemTableIndex_t;
+
 /**
 ** \brief Memory Block Type
 */
@@ -79,6 +95,14 @@ typedef struct
      * that allow CFE applications to query the general system memory map.
      */
     CFE_PSP_MemTable_t SysMemoryTable[CFE_PSP_MEM_TABLE_SIZE];
+
+    /**
+     * \brief Search index of the system memory table
+     *
+     * Must be rebuilt via CFE_PSP_MemRangeIndexRebuild() whenever
+     * SysMemoryTable is modified.
+     */
+    CFE_PSP_MemTableIndex_t SysMemoryIndex;
 } CFE_PSP_ReservedMemoryMap_t;
 
 /**
@@ -88,6 +112,14 @@ typedef struct
  */
 void CFE_PSP_SetupReservedMemoryMap(void);
 
+/**
+ * \brief Rebuild the search index of the system memory table
+ *
+ * This is called by CFE_PSP_MemRangeSet(), and must also be called by any
+ * other code which modifies the system memory table directly.
+ */
+void CFE_PSP_MemRangeIndexRebuild(void);
+
 /*
  * CFE_PSP_InitProcessorReservedMemory initializes all of the memory in the
  * BSP that is preserved on a processor reset. The memory includes the
@@ -23,6 +23,125 @@
 #include "cfe_psp.h"
 #include "cfe_psp_memory.h"
 
+/*
+ * Largest amount copied by a single call to CFE_PSP_MemCpy() in the block access
+ * functions.  This is a multiple of every supported word size, so chunks after the
+ * first start at the same alignment as the first one.
+ */
+#define CFE_PSP_MEM_BLOCK_CHUNK_SIZE 0x40000000
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Checks a range against a single memory table entry
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_PSP_MemRangeCheckEntry(const CFE_PSP_MemTable_t *SysMemPtr, cpuaddr StartAddressToTest,
+                                        cpuaddr EndAddressToTest, uint32 MemoryType)
+{
+    cpuaddr StartAddressInTable = SysMemPtr->StartAddr;
+    cpuaddr EndAddressInTable   = SysMemPtr->StartAddr + SysMemPtr->Size;
+    uint32  TypeInTable         = SysMemPtr->MemoryType;
+    int32   ReturnCode;
+
+    /*
+    ** Step 1: Get the Address to Fit within the range
+    */
+    if ((StartAddressToTest >= StartAddressInTable) && (StartAddressToTest < EndAddressInTable))
+    {
+        /*
+        ** Step 2: Does the End Address Fit within the Range?
+        **         should not have to test the lower address,
+        **         since the StartAddressToTest is already in the range.
+        */
+        if (EndAddressToTest <= EndAddressInTable)
+        {
+            /*
+            ** Step 3: Is the type OK?
+            */
+            if (MemoryType == CFE_PSP_MEM_ANY || MemoryType == TypeInTable)
+            {
+                ReturnCode = CFE_PSP_SUCCESS;
+            }
+            else
+            {
+                ReturnCode = CFE_PSP_INVALID_MEM_TYPE;
+            }
+        }
+        else
+        {
+            ReturnCode = CFE_PSP_INVALID_MEM_RANGE;
+        }
+    }
+    else
+    {
+        ReturnCode = CFE_PSP_INVALID_MEM_ADDR;
+    }
+
+    return ReturnCode;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_PSP_MemRangeIndexRebuild(void)
+{
+    CFE_PSP_MemTableIndex_t * IndexPtr = &CFE_PSP_ReservedMemoryMap.SysMemoryIndex;
+    const CFE_PSP_MemTable_t *SysMemPtr;
+    cpuaddr                   StartAddr;
+    cpuaddr                   EndAddr;
+    uint32                    i;
+    uint32                    j;
+
+    IndexPtr->NumEntries   = 0;
+    IndexPtr->LastValidPos = 0;
+
+    for (i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    {
+        SysMemPtr = &CFE_PSP_ReservedMemoryMap.SysMemoryTable[i];
+        if (SysMemPtr->MemoryType == CFE_PSP_MEM_INVALID)
+        {
+            continue;
+        }
+
+        IndexPtr->LastValidPos = i + 1;
+
+        /* An empty entry can never contain an address, so it does not need to be searched */
+        if (SysMemPtr->Size == 0)
+        {
+            continue;
+        }
+
+        /*
+         * Insertion sort by start address - the table is small, and only
+         * rebuilt when the memory map is configured.
+         */
+        StartAddr = SysMemPtr->StartAddr;
+        j         = IndexPtr->NumEntries;
+        while (j > 0 && CFE_PSP_ReservedMemoryMap.SysMemoryTable[IndexPtr->Position[j - 1]].StartAddr > StartAddr)
+        {
+            IndexPtr->Position[j] = IndexPtr->Position[j - 1];
+            --j;
+        }
+        IndexPtr->Position[j] = i;
+        ++IndexPtr->NumEntries;
+    }
+
+    EndAddr = 0;
+    for (j = 0; j < IndexPtr->NumEntries; j++)
+    {
+        SysMemPtr = &CFE_PSP_ReservedMemoryMap.SysMemoryTable[IndexPtr->Position[j]];
+        if (EndAddr < SysMemPtr->StartAddr + SysMemPtr->Size)
+        {
+            EndAddr = SysMemPtr->StartAddr + SysMemPtr->Size;
+        }
+        IndexPtr->MaxEnd[j] = EndAddr;
+    }
+}
+
 /*----------------------------------------------------------------
  *
  * Implemented per public API
@@ -31,14 +150,12 @@
  *-----------------------------------------------------------------*/
 int32 CFE_PSP_MemValidateRange(cpuaddr Address, size_t Size, uint32 MemoryType)
 {
-    cpuaddr             StartAddressToTest = Address;
-    cpuaddr             EndAddressToTest   = Address + Size;
-    cpuaddr             StartAddressInTable;
-    cpuaddr             EndAddressInTable;
-    uint32              TypeInTable;
-    int32               ReturnCode = CFE_PSP_INVALID_MEM_ADDR;
-    size_t              i;
-    CFE_PSP_MemTable_t *SysMemPtr;
+    cpuaddr                        StartAddressToTest = Address;
+    cpuaddr                        EndAddressToTest   = Address + Size;
+    const CFE_PSP_MemTableIndex_t *IndexPtr           = &CFE_PSP_ReservedMemoryMap.SysMemoryIndex;
+    uint32                         Low;
+    uint32                         High;
+    uint32                         Mid;
 
     /*
     ** Before searching table, do a preliminary parameter validation
@@ -53,72 +170,51 @@ int32 CFE_PSP_MemValidateRange(cpuaddr Address, size_t Size, uint32 MemoryType)
         return CFE_PSP_INVALID_MEM_RANGE;
     }
 
-    SysMemPtr = CFE_PSP_ReservedMemoryMap.SysMemoryTable;
-    for (i = 0; i < CFE_PSP_MEM_TABLE_SIZE; i++)
+    /*
+    ** Binary search for the number of entries that start at or below the address,
+    ** only those entries can possibly contain it.
+    */
+    Low  = 0;
+    High = IndexPtr->NumEntries;
+    while (Low < High)
     {
-        /*
-        ** Only look at valid memory table entries
-        */
-        if (SysMemPtr->MemoryType != CFE_PSP_MEM_INVALID)
+        Mid = Low + ((High - Low) / 2);
+        if (CFE_PSP_ReservedMemoryMap.SysMemoryTable[IndexPtr->Position[Mid]].StartAddr <= StartAddressToTest)
+        {
+            Low = Mid + 1;
+        }
+        else
         {
-            StartAddressInTable = SysMemPtr->StartAddr;
-            EndAddressInTable   = SysMemPtr->StartAddr + SysMemPtr->Size;
-            TypeInTable         = SysMemPtr->MemoryType;
+            High = Mid;
+        }
+    }
 
-            /*
-            ** Step 1: Get the Address to Fit within the range
-            */
-            if ((StartAddressToTest >= StartAddressInTable) && (StartAddressToTest < EndAddressInTable))
-            {
-                /*
-                ** Step 2: Does the End Address Fit within the Range?
-                **         should not have to test the lower address,
-                **         since the StartAddressToTest is already in the range.
-                **         Can it be fooled by overflowing the 32 bit int?
-                */
-                if (EndAddressToTest <= EndAddressInTable)
-                {
-                    /*
-                    ** Step 3: Is the type OK?
-                    */
-                    if (MemoryType == CFE_PSP_MEM_ANY)
-                    {
-                        ReturnCode = CFE_PSP_SUCCESS;
-                        break; /* The range is valid, break out of the loop */
-                    }
-                    else if (MemoryType == CFE_PSP_MEM_RAM && TypeInTable == CFE_PSP_MEM_RAM)
-                    {
-                        ReturnCode = CFE_PSP_SUCCESS;
-                        break; /* The range is valid, break out of the loop */
-                    }
-                    else if (MemoryType == CFE_PSP_MEM_EEPROM && TypeInTable == CFE_PSP_MEM_EEPROM)
-                    {
-                        ReturnCode = CFE_PSP_SUCCESS;
-                        break; /* The range is valid, break out of the loop */
-                    }
-                    else
-                    {
-                        ReturnCode = CFE_PSP_INVALID_MEM_TYPE;
-                        /* The range is not valid, move to the next entry */
-                    }
-                }
-                else
-                {
-                    ReturnCode = CFE_PSP_INVALID_MEM_RANGE;
-                    /* The range is not valid, move to the next entry */
-                }
-            }
-            else
-            {
-                ReturnCode = CFE_PSP_INVALID_MEM_ADDR;
-                /* The range is not valid, move to the next entry */
-            }
-        } /* End if MemoryType != CFE_PSP_MEM_INVALID */
+    /*
+    ** Walk back through the candidates, stopping once none of the remaining
+    ** entries extends past the address.  Entries may overlap, so any of
+    ** the candidates may be the one with a matching type.
+    */
+    while (Low > 0 && IndexPtr->MaxEnd[Low - 1] > StartAddressToTest)
+    {
+        --Low;
+        if (CFE_PSP_MemRangeCheckEntry(&CFE_PSP_ReservedMemoryMap.SysMemoryTable[IndexPtr->Position[Low]],
+                                       StartAddressToTest, EndAddressToTest, MemoryType) == CFE_PSP_SUCCESS)
+        {
+            return CFE_PSP_SUCCESS;
+        }
+    }
 
-        ++SysMemPtr;
+    /*
+    ** No entry matched.  For compatibility with the historical linear scan
+    ** of the table, report the reason that the last valid entry was rejected.
+    */
+    if (IndexPtr->LastValidPos == 0)
+    {
+        return CFE_PSP_INVALID_MEM_ADDR;
+    }
 
-    } /* End for */
-    return ReturnCode;
+    return CFE_PSP_MemRangeCheckEntry(&CFE_PSP_ReservedMemoryMap.SysMemoryTable[IndexPtr->LastValidPos - 1],
+                                      StartAddressToTest, EndAddressToTest, MemoryType);
 }
 
 /*----------------------------------------------------------------
@@ -176,6 +272,8 @@ int32 CFE_PSP_MemRangeSet(uint32 RangeNum, uint32 MemoryType, cpuaddr StartAddr,
     SysMemPtr->WordSize   = WordSize;
     SysMemPtr->Attributes = Attributes;
 
+    CFE_PSP_MemRangeIndexRebuild();
+
     return CFE_PSP_SUCCESS;
 }
 
@@ -210,3 +308,80 @@ int32 CFE_PSP_MemRangeGet(uint32 RangeNum, uint32 *MemoryType, cpuaddr *StartAdd
 
     return CFE_PSP_SUCCESS;
 }
+
+/*----------------------------------------------------------------
+ *
+ * Local helper function, not invoked outside this unit
+ * Copies a block which has already been validated, in chunks that fit CFE_PSP_MemCpy()
+ *
+ *-----------------------------------------------------------------*/
+static int32 CFE_PSP_MemBlockCopy(void *Dest, const void *Src, size_t Size)
+{
+    int32  Status = CFE_PSP_SUCCESS;
+    size_t Chunk;
+
+    while (Size > 0 && Status == CFE_PSP_SUCCESS)
+    {
+        Chunk = Size;
+        if (Chunk > CFE_PSP_MEM_BLOCK_CHUNK_SIZE)
+        {
+            Chunk = CFE_PSP_MEM_BLOCK_CHUNK_SIZE;
+        }
+
+        Status = CFE_PSP_MemCpy(Dest, Src, (uint32)Chunk);
+
+        Dest = (uint8 *)Dest + Chunk;
+        Src  = (const uint8 *)Src + Chunk;
+        Size -= Chunk;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_MemReadBlock(cpuaddr SrcAddress, void *DestBuffer, size_t Size)
+{
+    int32 Status;
+
+    if (DestBuffer == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    Status = CFE_PSP_MemValidateRange(SrcAddress, Size, CFE_PSP_MEM_ANY);
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        Status = CFE_PSP_MemBlockCopy(DestBuffer, (const void *)SrcAddress, Size);
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_PSP_MemWriteBlock(cpuaddr DestAddress, const void *SrcBuffer, size_t Size)
+{
+    int32 Status;
+
+    if (SrcBuffer == NULL)
+    {
+        return CFE_PSP_INVALID_POINTER;
+    }
+
+    Status = CFE_PSP_MemValidateRange(DestAddress, Size, CFE_PSP_MEM_RAM);
+    if (Status == CFE_PSP_SUCCESS)
+    {
+        Status = CFE_PSP_MemBlockCopy((void *)DestAddress, SrcBuffer, Size);
+    }
+
+    return Status;
+}
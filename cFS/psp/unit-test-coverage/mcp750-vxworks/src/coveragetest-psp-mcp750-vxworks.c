@@ -96,4 +96,6 @@ void UtTest_Setup(void)
     ADD_TEST(CFE_PSP_MemRanges);
     ADD_TEST(CFE_PSP_MemRangeSet);
     ADD_TEST(CFE_PSP_MemRangeGet);
+    ADD_TEST(CFE_PSP_MemReadBlock);
+    ADD_TEST(CFE_PSP_MemWriteBlock);
 }
@@ -173,6 +173,37 @@ void Test_CFE_PSP_EepromWrite8_WriteHighBitOrder(void)
     UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
 }
 
+/* ********************************
+ * CFE_PSP_EepromWriteBlock
+ * ********************************/
+void Test_CFE_PSP_EepromWriteBlock_Nominal(void)
+{
+    /* Arrange */
+    static const uint8 UtData[12] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    cpuaddr            UtAddress;
+
+    /* Start one byte past a word boundary, so the block has a head, body and tail */
+    UtAddress = (cpuaddr)&UT_RAM_BLOCK.u8[1];
+
+    /* Act */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(UtAddress, UtData, sizeof(UtData)), CFE_PSP_SUCCESS);
+
+    /* Assert - 3 leading and 1 trailing byte go through the 8 bit write */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 4);
+    UtAssert_MemCmp(&UT_RAM_BLOCK.u8[4], &UtData[3], 4, "Whole word written directly");
+}
+
+void Test_CFE_PSP_EepromWriteBlock_Error(void)
+{
+    /* Arrange */
+    uint32 UtData = 0x11223344;
+
+    /* Act */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock((cpuaddr)&UT_RAM_BLOCK.u32[0], NULL, 4), CFE_PSP_INVALID_POINTER);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock((cpuaddr)&UT_RAM_BLOCK.u32[0], &UtData, 0), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(UT_RAM_BLOCK.u32[0], 0);
+}
+
 void Test_CFE_PSP_EepromWriteEnable(void)
 {
     /*
@@ -229,6 +260,8 @@ void UtTest_Setup(void)
     ADD_TEST(Test_CFE_PSP_EepromWrite16_WriteHighBitOrder);
     ADD_TEST(Test_CFE_PSP_EepromWrite8_WriteLowBitOrder);
     ADD_TEST(Test_CFE_PSP_EepromWrite8_WriteHighBitOrder);
+    ADD_TEST(Test_CFE_PSP_EepromWriteBlock_Nominal);
+    ADD_TEST(Test_CFE_PSP_EepromWriteBlock_Error);
     ADD_TEST(Test_CFE_PSP_EepromWriteEnable);
     ADD_TEST(Test_CFE_PSP_EepromWriteDisable);
     ADD_TEST(Test_CFE_PSP_EepromPowerUp);
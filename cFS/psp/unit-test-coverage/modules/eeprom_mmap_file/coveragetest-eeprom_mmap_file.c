@@ -47,10 +47,15 @@
 #include "PCS_sys_mman.h"
 #include "PCS_unistd.h"
 
-extern void eeprom_mmap_file_Init(uint32 PspModuleId);
+extern void  eeprom_mmap_file_Init(uint32 PspModuleId);
+extern int32 CFE_PSP_SetupEEPROM(uint32 EEPROMSize, cpuaddr *EEPROMAddress);
 
 #define UT_RAMBLOCK_SIZE 32
 
+/* Simulated mapping for the write combining tests, 32 pages of 256 bytes */
+#define UT_EEPROM_PAGE_SIZE  256
+#define UT_EEPROM_IMAGE_SIZE (32 * UT_EEPROM_PAGE_SIZE)
+
 static union
 {
     uint8  u8[UT_RAMBLOCK_SIZE];
@@ -58,6 +63,43 @@ static union
     uint32 u32[UT_RAMBLOCK_SIZE / sizeof(uint32)];
 } UT_RAM_BLOCK;
 
+static union
+{
+    uint8  u8[UT_EEPROM_IMAGE_SIZE];
+    uint32 u32[UT_EEPROM_IMAGE_SIZE / sizeof(uint32)];
+} UT_EEPROM_IMAGE;
+
+/* Range passed to the most recent msync() call */
+static void * UT_MsyncAddr;
+static size_t UT_MsyncLen;
+
+static void UT_Handler_mmap(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    void *Result = UserObj;
+
+    UT_Stub_SetReturnValue(FuncKey, Result);
+}
+
+static int32 UT_Hook_msync(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    UT_MsyncAddr = UT_Hook_GetArgValueByName(Context, "addr", void *);
+    UT_MsyncLen  = UT_Hook_GetArgValueByName(Context, "len", size_t);
+
+    return StubRetcode;
+}
+
+static cpuaddr UT_SetupEepromImage(void)
+{
+    cpuaddr EepromAddress;
+
+    UT_SetHandlerFunction(UT_KEY(PCS_mmap), UT_Handler_mmap, &UT_EEPROM_IMAGE);
+    UT_SetDefaultReturnValue(UT_KEY(PCS_sysconf), UT_EEPROM_PAGE_SIZE);
+    UtAssert_INT32_EQ(CFE_PSP_SetupEEPROM(sizeof(UT_EEPROM_IMAGE), &EepromAddress), CFE_PSP_SUCCESS);
+    UtAssert_ADDRESS_EQ(EepromAddress, &UT_EEPROM_IMAGE);
+
+    return EepromAddress;
+}
+
 void Test_eeprom_mmap_file_Init(void)
 {
     /*
@@ -65,7 +107,15 @@ void Test_eeprom_mmap_file_Init(void)
     */
 
     /* nominal */
+    UT_SetDefaultReturnValue(UT_KEY(PCS_sysconf), UT_EEPROM_PAGE_SIZE);
+    UtAssert_VOIDCALL(eeprom_mmap_file_Init(1));
+    UtAssert_STUB_COUNT(CFE_PSP_MemRangeSet, 1);
+
+    /* system page size not available, nothing is opened */
+    UT_SetDeferredRetcode(UT_KEY(PCS_sysconf), 1, -1);
     UtAssert_VOIDCALL(eeprom_mmap_file_Init(1));
+    UtAssert_STUB_COUNT(PCS_open, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRangeSet, 1);
 
     /* fail to mmap file */
     UT_SetDeferredRetcode(UT_KEY(PCS_mmap), 1, -1);
@@ -134,12 +184,55 @@ void Test_CFE_PSP_EepromWrite8(void)
     UtAssert_UINT8_EQ(UT_RAM_BLOCK.u8[5], 0xCC);
 }
 
+void Test_CFE_PSP_EepromWriteBlock(void)
+{
+    /*
+    int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+    */
+    cpuaddr UtAddress;
+    uint32  UtData[4] = {0x11111111, 0x22222222, 0x33333333, 0x44444444};
+
+    UtAddress = UT_SetupEepromImage();
+    UT_SetHookFunction(UT_KEY(PCS_msync), UT_Hook_msync, NULL);
+
+    /* Writes outside of an enable window are only recorded, the disable call syncs them */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(UtAddress + 8, UtData, sizeof(UtData)), CFE_PSP_SUCCESS);
+    UtAssert_MemCmp(&UT_EEPROM_IMAGE.u32[2], UtData, sizeof(UtData), "Block written to image");
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + UT_EEPROM_PAGE_SIZE, 0x55), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite16(UtAddress + UT_EEPROM_PAGE_SIZE + 2, 0x6666), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite32(UtAddress + UT_EEPROM_PAGE_SIZE + 4, 0x77777777), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 0);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 1);
+    UtAssert_ADDRESS_EQ(UT_MsyncAddr, &UT_EEPROM_IMAGE);
+    UtAssert_UINT32_EQ(UT_MsyncLen, 2 * UT_EEPROM_PAGE_SIZE);
+
+    /* Null data pointer */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(UtAddress, NULL, sizeof(UtData)), CFE_PSP_INVALID_POINTER);
+
+    /* sync failure is reported by the disable call */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(UtAddress, UtData, sizeof(UtData)), CFE_PSP_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(PCS_msync), 1, -1);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_ERROR);
+
+    /* The sync of a partial last page stops at the end of the mapping */
+    UT_ResetState(UT_KEY(PCS_msync));
+    UT_SetHookFunction(UT_KEY(PCS_msync), UT_Hook_msync, NULL);
+    UtAssert_INT32_EQ(CFE_PSP_SetupEEPROM(UT_EEPROM_IMAGE_SIZE - 16, &UtAddress), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(UtAddress + UT_EEPROM_IMAGE_SIZE - 24, UtData, 8), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 1);
+    UtAssert_ADDRESS_EQ(UT_MsyncAddr, &UT_EEPROM_IMAGE.u8[UT_EEPROM_IMAGE_SIZE - UT_EEPROM_PAGE_SIZE]);
+    UtAssert_UINT32_EQ(UT_MsyncLen, UT_EEPROM_PAGE_SIZE - 16);
+}
+
 void Test_CFE_PSP_EepromWriteEnable(void)
 {
     /*
     int32 CFE_PSP_EepromWriteEnable(uint32 Bank)
     */
-    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
 }
 
 void Test_CFE_PSP_EepromWriteDisable(void)
@@ -147,7 +240,53 @@ void Test_CFE_PSP_EepromWriteDisable(void)
     /*
     int32 CFE_PSP_EepromWriteDisable(uint32 Bank)
     */
-    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    cpuaddr UtAddress;
+    uint32  Page;
+
+    UtAddress = UT_SetupEepromImage();
+
+    /* Writes to adjacent and overlapping pages are combined into one sync */
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite32(UtAddress + (2 * UT_EEPROM_PAGE_SIZE), 0x11223344), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite32(UtAddress, 0x55667788), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite16(UtAddress + UT_EEPROM_PAGE_SIZE - 2, 0x99AA), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + UT_EEPROM_PAGE_SIZE + 1, 0xBB), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 0);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 1);
+    UtAssert_UINT32_EQ(UT_EEPROM_IMAGE.u32[0], 0x55667788);
+
+    /* Separate ranges are synced individually */
+    UT_ResetState(UT_KEY(PCS_msync));
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress, 0x01), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + (4 * UT_EEPROM_PAGE_SIZE), 0x02), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + (8 * UT_EEPROM_PAGE_SIZE), 0x03), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 3);
+
+    /* Exceeding the range table collapses everything into one covering range */
+    UT_ResetState(UT_KEY(PCS_msync));
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_SUCCESS);
+    for (Page = 0; Page < 20; Page += 2)
+    {
+        UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + (Page * UT_EEPROM_PAGE_SIZE), Page), CFE_PSP_SUCCESS);
+    }
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 2);
+
+    /* Failed sync leaves the range dirty, so it is retried on the next disable */
+    UT_ResetState(UT_KEY(PCS_msync));
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteEnable(1), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress, 0x01), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(UtAddress + (4 * UT_EEPROM_PAGE_SIZE), 0x02), CFE_PSP_SUCCESS);
+    UT_SetDeferredRetcode(UT_KEY(PCS_msync), 2, -1);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_ERROR);
+    UtAssert_STUB_COUNT(PCS_msync, 2);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 3);
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteDisable(1), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_msync, 3);
 }
 
 void Test_CFE_PSP_EepromPowerUp(void)
@@ -175,6 +314,9 @@ void ResetTest(void)
 {
     UT_ResetState(0);
     memset(&UT_RAM_BLOCK, 0, sizeof(UT_RAM_BLOCK));
+    memset(&UT_EEPROM_IMAGE, 0, sizeof(UT_EEPROM_IMAGE));
+    UT_MsyncAddr = NULL;
+    UT_MsyncLen  = 0;
 }
 
 /*
@@ -186,6 +328,7 @@ void UtTest_Setup(void)
     ADD_TEST(Test_CFE_PSP_EepromWrite32);
     ADD_TEST(Test_CFE_PSP_EepromWrite16);
     ADD_TEST(Test_CFE_PSP_EepromWrite8);
+    ADD_TEST(Test_CFE_PSP_EepromWriteBlock);
     ADD_TEST(Test_CFE_PSP_EepromWriteEnable);
     ADD_TEST(Test_CFE_PSP_EepromWriteDisable);
     ADD_TEST(Test_CFE_PSP_EepromPowerUp);
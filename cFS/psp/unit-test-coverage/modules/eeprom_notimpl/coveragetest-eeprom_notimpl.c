@@ -78,6 +78,16 @@ void Test_CFE_PSP_EepromWrite8(void)
     UtAssert_INT32_EQ(CFE_PSP_EepromWrite8(0, 1), CFE_PSP_ERROR_NOT_IMPLEMENTED);
 }
 
+void Test_CFE_PSP_EepromWriteBlock(void)
+{
+    /*
+    int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+    */
+    uint32 UtData = 1;
+
+    UtAssert_INT32_EQ(CFE_PSP_EepromWriteBlock(0, &UtData, sizeof(UtData)), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
+
 void Test_CFE_PSP_EepromWriteEnable(void)
 {
     /*
@@ -124,6 +134,7 @@ void UtTest_Setup(void)
     ADD_TEST(Test_CFE_PSP_EepromWrite32);
     ADD_TEST(Test_CFE_PSP_EepromWrite16);
     ADD_TEST(Test_CFE_PSP_EepromWrite8);
+    ADD_TEST(Test_CFE_PSP_EepromWriteBlock);
     ADD_TEST(Test_CFE_PSP_EepromWriteEnable);
     ADD_TEST(Test_CFE_PSP_EepromWriteDisable);
     ADD_TEST(Test_CFE_PSP_EepromPowerUp);
@@ -35,6 +35,8 @@
  * Coverage test for VxWorks timebase module implementation
  */
 
+#include <string.h>
+
 #include "utassert.h"
 #include "utstubs.h"
 #include "uttest.h"
@@ -61,6 +63,11 @@ static int32 Stub_DeviceMutex(uint32 CommandCode, uint16 Instance, uint16 SubCha
     return UT_DEFAULT_IMPL(Stub_DeviceMutex);
 }
 
+static void Stub_Completion(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests, void *UserArg)
+{
+    UT_DEFAULT_IMPL(Stub_Completion);
+}
+
 /*
  * --------------------------------------------
  * Instantiation of a Stub IO Driver with no mutex
@@ -149,6 +156,12 @@ void Test_iodriver_Init(void)
      * void iodriver_Init(uint32 PspModuleId)
      */
     UtAssert_VOIDCALL(iodriver_Init(1));
+    UtAssert_STUB_COUNT(OS_TaskCreate, 1);
+
+    /* Failure to start the worker is not fatal */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    UtAssert_VOIDCALL(iodriver_Init(1));
+    UtAssert_STUB_COUNT(OS_TaskCreate, 2);
 }
 
 void Test_CFE_PSP_IODriver_GetAPI(void)
@@ -175,6 +188,21 @@ void Test_CFE_PSP_IODriver_GetAPI(void)
     UtAssert_BOOL_TRUE(ApiPtr->DeviceCommand == Stub_DeviceCommand);
 }
 
+void Test_CFE_PSP_IODriver_GetAPI_NotDeviceDriver(void)
+{
+    /* Test For:
+     * CFE_PSP_IODriver_API_t *CFE_PSP_IODriver_GetAPI(uint32 PspModuleId)
+     */
+    CFE_PSP_IODriver_API_t *ApiPtr;
+    CFE_PSP_ModuleApi_t     SimpleApi = {.ModuleType = CFE_PSP_MODULE_TYPE_SIMPLE};
+
+    /* Requesting a module that is not a device driver should return a default API */
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Module_GetAPIEntry), UtHandler_CFE_PSP_Module_GetAPIEntry, (void *)&SimpleApi);
+    UtAssert_NOT_NULL(ApiPtr = CFE_PSP_IODriver_GetAPI(0));
+    UtAssert_BOOL_TRUE(ApiPtr->DeviceCommand == NULL);
+    UtAssert_BOOL_TRUE(ApiPtr->DeviceMutex == NULL);
+}
+
 void Test_CFE_PSP_IODriver_GetMutex(void)
 {
     /* Test For:
@@ -229,6 +257,161 @@ void Test_CFE_PSP_IODriver_Command(void)
     UtAssert_STUB_COUNT(Stub_DeviceMutex, 1);
 }
 
+void Test_CFE_PSP_IODriver_CommandBatch(void)
+{
+    /* Test For:
+     * int32 CFE_PSP_IODriver_CommandBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests)
+     */
+    CFE_PSP_IODriver_Request_t UtRequests[3];
+    uint32                     i;
+
+    memset(UtRequests, 0, sizeof(UtRequests));
+    for (i = 0; i < 3; ++i)
+    {
+        UtRequests[i].Location.PspModuleId  = 1;
+        UtRequests[i].Location.SubsystemId  = 1;
+        UtRequests[i].Location.SubchannelId = i;
+        UtRequests[i].CommandCode           = 1;
+    }
+
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(NULL, 1), CFE_PSP_INVALID_POINTER);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(UtRequests, 0), CFE_PSP_SUCCESS);
+
+    /* Driver without a command function */
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Module_GetAPIEntry), UtHandler_CFE_PSP_Module_GetAPIEntry,
+                          (void *)&Ut_NoopAPI);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(UtRequests, 3), CFE_PSP_ERROR);
+    UtAssert_INT32_EQ(UtRequests[2].Result, CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* Requests to the same device share one API lookup and one lock acquisition */
+    UT_ResetState(UT_KEY(CFE_PSP_Module_GetAPIEntry));
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Module_GetAPIEntry), UtHandler_CFE_PSP_Module_GetAPIEntry,
+                          (void *)&CFE_PSP_StubWithMut_API);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(UtRequests, 3), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_PSP_Module_GetAPIEntry, 1);
+    UtAssert_STUB_COUNT(Stub_DeviceCommand, 3);
+    UtAssert_STUB_COUNT(Stub_DeviceMutex, 3);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+    UtAssert_INT32_EQ(UtRequests[0].Result, CFE_PSP_SUCCESS);
+
+    /* A request which requires a different lock releases the current one first,
+     * a request which requires no lock keeps the current one */
+    UT_ResetState(UT_KEY(OS_MutSemTake));
+    UT_ResetState(UT_KEY(OS_MutSemGive));
+    UT_ResetState(UT_KEY(Stub_DeviceMutex));
+    UT_SetDeferredRetcode(UT_KEY(Stub_DeviceMutex), 1, 3);
+    UT_SetDeferredRetcode(UT_KEY(Stub_DeviceMutex), 1, -1);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(UtRequests, 3), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+
+    /* A failed request is reported in its result and in the overall status */
+    UT_ResetState(UT_KEY(Stub_DeviceMutex));
+    UT_SetDeferredRetcode(UT_KEY(Stub_DeviceCommand), 2, -1);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_CommandBatch(UtRequests, 3), CFE_PSP_ERROR);
+    UtAssert_INT32_EQ(UtRequests[0].Result, CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(UtRequests[1].Result, -1);
+    UtAssert_INT32_EQ(UtRequests[2].Result, CFE_PSP_SUCCESS);
+}
+
+void Test_CFE_PSP_IODriver_SubmitBatch(void)
+{
+    /* Test For:
+     * int32 CFE_PSP_IODriver_SubmitBatch(CFE_PSP_IODriver_Request_t *Requests, uint32 NumRequests,
+     *                                    CFE_PSP_IODriver_CompletionFunc_t CompletionFunc, void *UserArg)
+     * bool CFE_PSP_IODriver_ProcessQueue(void)
+     * void CFE_PSP_IODriver_WorkerTask(void)
+     * int32 CFE_PSP_IODriver_StartWorker(void)
+     * int32 CFE_PSP_IODriver_GetQueueStats(CFE_PSP_IODriver_QueueStats_t *Stats)
+     */
+    const CFE_PSP_IODriver_Location_t UtLocation = {1, 1, 1};
+    CFE_PSP_IODriver_Request_t        UtRequests[2];
+    CFE_PSP_IODriver_QueueStats_t     Stats;
+    uint32                            i;
+
+    memset(UtRequests, 0, sizeof(UtRequests));
+    UtRequests[0].Location = UtLocation;
+    UtRequests[1].Location = UtLocation;
+
+    /* The worker is started at init, outside of any application */
+    UtAssert_VOIDCALL(iodriver_Init(1));
+    UtAssert_STUB_COUNT(OS_TaskCreate, 1);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Module_GetAPIEntry), UtHandler_CFE_PSP_Module_GetAPIEntry,
+                          (void *)&CFE_PSP_StubNoMut_API);
+
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(NULL, 1, Stub_Completion, NULL), CFE_PSP_INVALID_POINTER);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_GetQueueStats(NULL), CFE_PSP_INVALID_POINTER);
+
+    /* The worker was deleted (e.g. by application cleanup) and cannot be restarted */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetInfo), 1, OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 2, Stub_Completion, NULL), CFE_PSP_ERROR);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    /* Nominal, the next submission starts a new worker */
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 2, Stub_Completion, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 3);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_GetQueueStats(&Stats), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.BatchesSubmitted, 1);
+    UtAssert_UINT32_EQ(Stats.CurrentDepth, 1);
+
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+    UtAssert_STUB_COUNT(Stub_DeviceCommand, 2);
+    UtAssert_STUB_COUNT(Stub_Completion, 1);
+    UtAssert_BOOL_FALSE(CFE_PSP_IODriver_ProcessQueue());
+
+    /* Fill the queue, the last submission must be rejected, and no completion callback is OK */
+    for (i = 0; i < 16; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_SUCCESS);
+    }
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_ERROR);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 3);
+
+    /* Worker drains the queue until the semaphore take fails */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 17, OS_ERROR);
+    UtAssert_VOIDCALL(CFE_PSP_IODriver_WorkerTask());
+    UtAssert_STUB_COUNT(Stub_DeviceCommand, 18);
+    UtAssert_STUB_COUNT(Stub_Completion, 1);
+
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_GetQueueStats(&Stats), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Stats.BatchesSubmitted, 17);
+    UtAssert_UINT32_EQ(Stats.BatchesRejected, 1);
+    UtAssert_UINT32_EQ(Stats.BatchesCompleted, 17);
+    UtAssert_UINT32_EQ(Stats.RequestsCompleted, 18);
+    UtAssert_UINT32_EQ(Stats.CurrentDepth, 0);
+    UtAssert_UINT32_EQ(Stats.MaxDepth, 16);
+
+    /* The worker exited, so the next submission starts a new one */
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 4);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 4);
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+
+    /* The worker was deleted while idle, the next submission replaces it and the batch still runs */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskGetInfo), 1, OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, Stub_Completion, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 5);
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+    UtAssert_STUB_COUNT(Stub_Completion, 2);
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(OS_TaskCreate, 5);
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+
+    /* Latency is measured on the monotonic PSP timebase */
+    UT_ResetState(UT_KEY(CFE_PSP_GetTime));
+    UtAssert_INT32_EQ(CFE_PSP_IODriver_SubmitBatch(UtRequests, 1, NULL, NULL), CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(CFE_PSP_GetTime, 1);
+    UtAssert_BOOL_TRUE(CFE_PSP_IODriver_ProcessQueue());
+    UtAssert_STUB_COUNT(CFE_PSP_GetTime, 2);
+    UtAssert_STUB_COUNT(OS_GetLocalTime, 0);
+}
+
 void Test_CFE_PSP_IODriver_FindByName(void)
 {
     /* Test For:
@@ -271,10 +454,17 @@ void ResetTest(void)
  */
 void UtTest_Setup(void)
 {
-    ADD_TEST(Test_iodriver_Init);
+    /*
+     * Test_iodriver_Init creates the mutexes that the later tests lock,
+     * so it runs as a setup sequence
+     */
+    UtTest_AddSetup(Test_iodriver_Init, "Test_iodriver_Init");
     ADD_TEST(Test_CFE_PSP_IODriver_GetAPI);
+    ADD_TEST(Test_CFE_PSP_IODriver_GetAPI_NotDeviceDriver);
     ADD_TEST(Test_CFE_PSP_IODriver_GetMutex);
     ADD_TEST(Test_CFE_PSP_IODriver_HashMutex);
     ADD_TEST(Test_CFE_PSP_IODriver_Command);
+    ADD_TEST(Test_CFE_PSP_IODriver_CommandBatch);
+    ADD_TEST(Test_CFE_PSP_IODriver_SubmitBatch);
     ADD_TEST(Test_CFE_PSP_IODriver_FindByName);
 }
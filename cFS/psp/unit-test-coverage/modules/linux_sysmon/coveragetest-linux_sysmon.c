@@ -32,9 +32,12 @@
  * \file
  * \ingroup  modules
  *
- * Coverage test for VxWorks timebase module implementation
+ * Coverage test for Linux sysmon module implementation
  */
 
+#include <stdio.h>
+#include <string.h>
+
 #include "utassert.h"
 #include "utstubs.h"
 #include "uttest.h"
@@ -43,800 +46,651 @@
 #include "cfe_psp_config.h"
 #include "cfe_psp_module.h"
 
-#include "PCS_arch_ppc_vxPpcLib.h"
+#include "iodriver_analog_io.h"
+#include "iodriver_base.h"
+#include "iodriver_impl.h"
+
+#include "PCS_dirent.h"
+#include "PCS_fcntl.h"
+#include "PCS_poll.h"
+#include "PCS_pthread.h"
+#include "PCS_unistd.h"
 
 /*
- * Reference to the API entry point for the module
+ * The module state is opaque to the test, it is only passed back to the
+ * functions under test and observed through the device command interface.
  */
-extern CFE_PSP_ModuleApi_t CFE_PSP_timebase_vxworks_API;
+typedef struct linux_sysmon_cpuload_state linux_sysmon_cpuload_state_t;
 
-const CFE_PSP_ModuleApi_t *TgtAPI = &CFE_PSP_timebase_vxworks_API;
+extern CFE_PSP_ModuleApi_t CFE_PSP_linux_sysmon_API;
 
-UT_PSP_TimeBase_VxWorks_TestConfig_t UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG;
+extern const char *linux_sysmon_parse_u64(const char *line_data, const char *line_end, uint64_t *value);
+extern void        linux_sysmon_update_schedstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms);
+extern void        linux_sysmon_update_taskstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms);
+extern int32_t linux_sysmon_task_load_dispatch(uint32_t CommandCode, uint16_t Subchannel, CFE_PSP_IODriver_Arg_t Arg);
 
-typedef struct
-{
-    uint32 u;
-    uint32 l;
-} PSP_VxWorks_TimeBaseVal_t;
+#define UT_SYSMON_AGGREGATE_SUBSYS 0
+#define UT_SYSMON_CPULOAD_SUBSYS   1
+#define UT_SYSMON_TASKLOAD_SUBSYS  2
+#define UT_SYSMON_MAX_TASKS        64
+#define UT_SYSMON_READ_BUFSIZE     8192
 
-void ModuleTest_ResetState(void)
-{
-    memset(&UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG, 0, sizeof(UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG));
-}
+/* Subchannel of a task lookup, which holds the slot generation above the slot */
+#define UT_SYSMON_TASK_SUBCH(slot, gen) ((slot) | ((gen) << 6))
 
-int32 UTHOOK_vxTimeBaseGet(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
-{
-    PSP_VxWorks_TimeBaseVal_t *val = UserObj;
-    uint32 *                   u   = UT_Hook_GetArgValueByName(Context, "u", uint32 *);
-    uint32 *                   l   = UT_Hook_GetArgValueByName(Context, "l", uint32 *);
+/* Thread IDs at or above this value are generated, not listed in UT_SysMon_Tasks */
+#define UT_SYSMON_GENERIC_TID 1000
 
-    *u = val->u;
-    *l = val->l;
+const CFE_PSP_ModuleApi_t *TgtAPI = &CFE_PSP_linux_sysmon_API;
 
-    return StubRetcode;
-}
-
-void Test_Nominal(void)
+/*
+ * Simulated thread as seen through /proc/self/task
+ */
+typedef struct
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
-
-    /* Nominal test with a simple 1:1 ratio */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 1;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 1;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 1000000000);
-
-    /* Check operation of CFE_PSP_GetTime() */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0;
-    VxTime.l = 10000;
-    CFE_PSP_GetTime(&OsTime);
-
-    UtAssert_UINT32_EQ(OS_TimeGetNanosecondsPart(OsTime), 10000);
-}
-
-void Test_Non_Reducible(void)
+    uint32      Tid;
+    const char *Comm;       /**< content of the "comm" file */
+    bool        IsListed;   /**< thread appears in the task directory */
+    bool        CanOpen;    /**< schedstat file can be opened */
+    int32       ReadStatus; /**< if nonzero, the result of reading schedstat */
+    uint64_t    RunTime;    /**< total on-cpu time in nanoseconds */
+} UT_SysMon_Task_t;
+
+static UT_SysMon_Task_t UT_SysMon_Tasks[] = {
+    {100, "taskA\n", true, true, 0, 1000000000}, {101, "taskB", true, true, 0, 2000000000},
+    {102, "taskX\n", true, false, 0, 0},         {103, "taskC\n", false, true, 0, 0},
+    {104, "taskD\n", true, true, -1, 0},
+};
+
+static struct
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
-
-    /* Use an oddball ratio of of some primes, will not be reducible */
-    /* Ratio is 43*3 / 53*2  => 129/106 */
-    /* This translates to about ~1.217ns per tick */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 43 * 3;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 53 * 2;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 821705426);
-
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * This test requires that the conversion uses the actual ratio,
-     * otherwise a rounding error will be noticed.
-     * For example:
-     * Conversion using 1.217ns/tick yields 52269758 usec (wrong).
-     * Conversion using actual ratio yields 52268947 usec.
-     */
+    struct PCS_dirent Entries[UT_SYSMON_MAX_TASKS + 16];
+    uint32            Count;
+    uint32            Pos;
+} UT_SysMon_TaskDir;
 
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 10;
-    VxTime.l = 5000;
-    CFE_PSP_GetTime(&OsTime);
+static PCS_pthread_start_routine_t   UT_SysMon_TaskEntry;
+static linux_sysmon_cpuload_state_t *UT_SysMon_State;
 
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 52268947, "CFE_PSP_GetTime() Microseconds (%lld) == 52268947", (long long)TestTime);
-}
+static char UT_SysMon_LongLine[UT_SYSMON_READ_BUFSIZE + 16];
 
-void Test_Reducible_1(void)
+static UT_SysMon_Task_t *UT_SysMon_FindTask(uint32 Tid)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
-
-    memset(&OsTime, 0, sizeof(OsTime));
+    uint32 i;
 
-    /* Test with a ratio that is also 1:1, but can be reduced */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 1000;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 1000;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 1000000000);
+    for (i = 0; i < (sizeof(UT_SysMon_Tasks) / sizeof(UT_SysMon_Tasks[0])); ++i)
+    {
+        if (UT_SysMon_Tasks[i].Tid == Tid)
+        {
+            return &UT_SysMon_Tasks[i];
+        }
+    }
 
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * Externally calculated value should be 10376293541461622 usec.
-     * If overflow occurs then value will be wrong.
-     */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x90000000; /* nearing 64-bit limit */
-    VxTime.l = 0;
-    CFE_PSP_GetTime(&OsTime);
-
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 10376293541461622, "CFE_PSP_GetTime() Microseconds (%lld) == 10376293541461622",
-                  (long long)TestTime);
+    return NULL;
 }
 
-void Test_Reducible_2(void)
+/* Builds the task directory listing from the simulated threads, plus any generic ones */
+static void UT_SysMon_ListTasks(uint32 NumGeneric)
 {
-    OS_time_t                 OsTime;
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    int64                     TestTime;
+    static const char *const Others[] = {".", "..", "0", "12a"};
+    uint32                   i;
 
-    memset(&OsTime, 0, sizeof(OsTime));
-
-    /* Test with a ratio that can be reduced */
-    /* Final reduced ratio should be 12:5 with 100ns OS ticks */
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodNumerator   = 84000;
-    UT_PSP_TIMEBASE_VXWORKS_TESTCONFIG.PeriodDenominator = 350;
-    TgtAPI->Init(0);
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerTicksPerSecond(), 4166666);
-
-    /*
-     * Check operation of CFE_PSP_GetTime()
-     *
-     * Externally calculated value should be 276701161105643274 usec.
-     * If overflow occurs then value will be wrong.
-     */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x10000000; /* nearing 64-bit limit */
-    VxTime.l = 0;
-    CFE_PSP_GetTime(&OsTime);
-
-    TestTime = OS_TimeGetTotalMicroseconds(OsTime);
-    UtAssert_True(TestTime == 276701161105643274, "CFE_PSP_GetTime() Microseconds(%lld) == 276701161105643274",
-                  (long long)TestTime);
-}
-
-void Test_Rollover(void)
-{
-    /* This function always returns 0 */
-    UtAssert_UINT32_EQ(CFE_PSP_GetTimerLow32Rollover(), 0);
+    memset(&UT_SysMon_TaskDir, 0, sizeof(UT_SysMon_TaskDir));
+    for (i = 0; i < (sizeof(Others) / sizeof(Others[0])); ++i)
+    {
+        snprintf(UT_SysMon_TaskDir.Entries[UT_SysMon_TaskDir.Count].d_name, sizeof(UT_SysMon_TaskDir.Entries[0].d_name),
+                 "%s", Others[i]);
+        ++UT_SysMon_TaskDir.Count;
+    }
+    for (i = 0; i < (sizeof(UT_SysMon_Tasks) / sizeof(UT_SysMon_Tasks[0])); ++i)
+    {
+        if (UT_SysMon_Tasks[i].IsListed)
+        {
+            snprintf(UT_SysMon_TaskDir.Entries[UT_SysMon_TaskDir.Count].d_name,
+                     sizeof(UT_SysMon_TaskDir.Entries[0].d_name), "%u", (unsigned int)UT_SysMon_Tasks[i].Tid);
+            ++UT_SysMon_TaskDir.Count;
+        }
+    }
+    for (i = 0; i < NumGeneric; ++i)
+    {
+        snprintf(UT_SysMon_TaskDir.Entries[UT_SysMon_TaskDir.Count].d_name, sizeof(UT_SysMon_TaskDir.Entries[0].d_name),
+                 "%u", (unsigned int)(UT_SYSMON_GENERIC_TID + i));
+        ++UT_SysMon_TaskDir.Count;
+    }
 }
 
-/******************************************************************************
-**
-**  Purpose:
-**    Provides a common interface to system timebase. This routine
-**    is in the BSP because it is sometimes implemented in hardware and
-**    sometimes taken care of by the RTOS.
-**
-**  Arguments:
-**
-**  Return:
-**  Timebase register value
-*/
-void Test_Get_Timebase(void)
+static void UT_readdir_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    PSP_VxWorks_TimeBaseVal_t VxTime;
-    uint32                    tbu;
-    uint32                    tbl;
+    struct PCS_dirent *Result = NULL;
 
-    /* The value from vxTimeBaseGet() should be passed through unchanged */
-    UT_SetHookFunction(UT_KEY(PCS_vxTimeBaseGet), UTHOOK_vxTimeBaseGet, &VxTime);
-    VxTime.u = 0x00112233;
-    VxTime.l = 0x44556677;
-
-    CFE_PSP_Get_Timebase(&tbu, &tbl);
+    if (UT_SysMon_TaskDir.Pos < UT_SysMon_TaskDir.Count)
+    {
+        Result = &UT_SysMon_TaskDir.Entries[UT_SysMon_TaskDir.Pos];
+        ++UT_SysMon_TaskDir.Pos;
+    }
 
-    UtAssert_UINT32_EQ(tbu, VxTime.u);
-    UtAssert_UINT32_EQ(tbl, VxTime.l);
+    UT_Stub_SetReturnValue(FuncKey, Result);
 }
 
-/*
- * Macro to add a test case to the list of tests to execute
- */
-#define ADD_TEST(test) UtTest_Add(test, ModuleTest_ResetState, NULL, #test)
-
-/*
- * Register the test cases to execute with the unit test tool
- */
-void UtTest_Setup(void)
+static void UT_rewinddir_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    ADD_TEST(Test_Nominal);
-    ADD_TEST(Test_Non_Reducible);
-    ADD_TEST(Test_Reducible_1);
-    ADD_TEST(Test_Reducible_2);
-    ADD_TEST(Test_Rollover);
-    ADD_TEST(Test_Get_Timebase);
+    UT_SysMon_TaskDir.Pos = 0;
 }
-/***********************************************************************
- *  Copyright (c) 2017, United States government as represented by the
- *  administrator of the National Aeronautics and Space Administration.
- *  All rights reserved. This software was created at NASA Glenn
- *  Research Center pursuant to government contracts.
- *
- *  \file linux_sysmon.c
- *
- ***********************************************************************/
 
 /*
- * NOTE: This relies on the Linux Kernel sched stats via the /proc filesystem.
- * Documented here: https://docs.kernel.org/scheduler/sched-stats.html
+ * The schedstat file of thread N is opened as fd 2N, and its comm file as 2N+1
  */
-
-/************************************************************************
- * Includes
- ************************************************************************/
-
-#include <fcntl.h>
-#include <ctype.h>
-#include <unistd.h>
-#include <errno.h>
-#include <string.h>
-#include <pthread.h>
-#include <stdint.h>
-#include <poll.h>
-
-#include "cfe_psp.h"
-#include "cfe_psp_module.h"
-#include "osapi-clock.h"
-
-#include "iodriver_impl.h"
-#include "iodriver_analog_io.h"
-
-/********************************************************************
- * Local Defines
- ********************************************************************/
-
-#define LINUX_SYSMON_AGGREGATE_SUBSYS   0
-#define LINUX_SYSMON_CPULOAD_SUBSYS     1
-#define LINUX_SYSMON_AGGR_CPULOAD_SUBCH 0
-#define LINUX_SYSMON_MAX_CPUS           128
-#define LINUX_SYSMON_SAMPLE_DELAY       30
-
-#ifdef DEBUG_BUILD
-#define LINUX_SYSMON_DEBUG(...) OS_printf(__VA_ARGS__)
-#else
-#define LINUX_SYSMON_DEBUG(...)
-#endif
-
-/********************************************************************
- * Local Type Definitions
- ********************************************************************/
-
-typedef struct linux_sysmon_cpuload_core
+static void UT_open_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context, va_list va)
 {
-    CFE_PSP_IODriver_AdcCode_t avg_load;
-    unsigned long              last_run_time;
-} linux_sysmon_cpuload_core_t;
-
-typedef struct linux_sysmon_cpuload_state
-{
-    volatile bool is_running;
-    volatile bool should_run;
-
-    uint8_t   num_cpus;
-    pthread_t task_id;
-    int       dev_fd;
-    uint32_t  num_samples;
-    uint64_t  last_sample_time;
-
-    linux_sysmon_cpuload_core_t per_core[LINUX_SYSMON_MAX_CPUS];
-} linux_sysmon_cpuload_state_t;
-
-typedef struct linux_sysmon_state
-{
-    uint32_t                     local_module_id;
-    linux_sysmon_cpuload_state_t cpu_load;
-} linux_sysmon_state_t;
-
-/********************************************************************
- * Local Function Prototypes
- ********************************************************************/
-
-static void *  linux_sysmon_Task(void *arg);
-static int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state);
-static int32_t linux_sysmon_Stop(linux_sysmon_cpuload_state_t *state);
-static void    linux_sysmon_Init(uint32_t local_module_id);
-
-/* Function that starts up linux_sysmon driver. */
-static int32_t linux_sysmon_DevCmd(uint32_t CommandCode, uint16_t SubsystemId, uint16_t SubchannelId,
-                                   CFE_PSP_IODriver_Arg_t Arg);
-
-/********************************************************************
- * Global Data
- ********************************************************************/
-
-/* linux_sysmon device command that is called by iodriver to start up linux_sysmon */
-CFE_PSP_IODriver_API_t linux_sysmon_DevApi = {.DeviceCommand = linux_sysmon_DevCmd};
-
-CFE_PSP_MODULE_DECLARE_IODEVICEDRIVER(linux_sysmon);
-
-static linux_sysmon_state_t linux_sysmon_global;
-
-static const char *linux_sysmon_subsystem_names[]  = {"aggregate", "per-cpu", NULL};
-static const char *linux_sysmon_subchannel_names[] = {"cpu-load", NULL};
-
-/***********************************************************************
- * Global Functions
- ********************************************************************/
-
-void linux_sysmon_Init(uint32_t local_module_id)
-{
-    memset(&linux_sysmon_global, 0, sizeof(linux_sysmon_global));
-
-    linux_sysmon_global.local_module_id = local_module_id;
-}
-
-void linux_sysmon_read_cpuuse_line(const char *line_data, unsigned int *cpu_num, unsigned long *run_time)
-{
-    unsigned long value;
-    const char *  val_end;
-    int           val_count;
-
-    /* each "cpu" line contains the cpu number followed by 9 values */
-    for (val_count = 0; val_count < 10 && *line_data != 0; ++val_count)
+    const char *      file = UT_Hook_GetArgValueByName(Context, "file", const char *);
+    UT_SysMon_Task_t *Task;
+    unsigned int      Tid;
+    char              Kind[16];
+    int               Result;
+
+    Result = -1;
+    if (sscanf(file, "/proc/self/task/%u/%15s", &Tid, Kind) == 2)
     {
-        while (isspace((unsigned char)*line_data))
-        {
-            ++line_data;
-        }
-        value = strtoul(line_data, (char **)&val_end, 10);
-        if (val_end == line_data)
+        Task = UT_SysMon_FindTask(Tid);
+        if (strcmp(Kind, "comm") == 0)
         {
-            /* not a number, something went wrong */
-            break;
+            Result = (2 * Tid) + 1;
         }
-
-        line_data = val_end;
-
-        switch (val_count)
+        else if (Task == NULL || Task->CanOpen)
         {
-            case 0: /* this is the cpu number */
-                *cpu_num = value;
-                break;
-
-            case 7: /* this is the number of nanoseconds spent executing instructions on this CPU */
-                *run_time = value;
-                break;
-
-            default: /* don't care about this one */
-                break;
+            Result = 2 * Tid;
         }
     }
+
+    UT_Stub_SetReturnValue(FuncKey, Result);
 }
 
-void linux_sysmon_update_schedstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms)
+static void UT_pread_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    unsigned int  cpu_time_ms;
-    unsigned int  cpu_num;
-    unsigned int  highest_cpu_num;
-    unsigned long run_time;
-    char          line_data[256];
-    size_t        line_size;
-    ssize_t       line_rdsz;
-    char *        eol_p;
-
-    linux_sysmon_cpuload_core_t *core_p;
-
-    line_size       = 0;
-    highest_cpu_num = 0;
+    int               fd     = UT_Hook_GetArgValueByName(Context, "fd", int);
+    void *            buf    = UT_Hook_GetArgValueByName(Context, "buf", void *);
+    size_t            nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    UT_SysMon_Task_t *Task;
+    PCS_ssize_t       Result;
+
+    Task = UT_SysMon_FindTask(fd / 2);
+    if (Task != NULL && Task->ReadStatus != 0)
+    {
+        Result = Task->ReadStatus;
+    }
+    else
+    {
+        Result = snprintf(buf, nbytes, "%llu 1000 2\n", (unsigned long long)(Task != NULL ? Task->RunTime : 0));
+    }
 
-    /* Reset to beginning of file to re-read it */
-    lseek(state->dev_fd, 0, SEEK_SET);
+    UT_Stub_SetReturnValue(FuncKey, Result);
+}
 
-    while (true)
+static void UT_read_Handler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    int               fd     = UT_Hook_GetArgValueByName(Context, "fd", int);
+    void *            buf    = UT_Hook_GetArgValueByName(Context, "buf", void *);
+    size_t            nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    UT_SysMon_Task_t *Task;
+    PCS_ssize_t       Result;
+
+    Task   = UT_SysMon_FindTask(fd / 2);
+    Result = strlen(Task != NULL ? Task->Comm : "generic\n");
+    if (Result > nbytes)
     {
-        line_rdsz = read(state->dev_fd, &line_data[line_size], sizeof(line_data) - line_size);
-        if (line_rdsz <= 0)
-        {
-            /* error (not expected) or EOF, stop reading */
-            break;
-        }
+        Result = nbytes;
+    }
+    memcpy(buf, Task != NULL ? Task->Comm : "generic\n", Result);
 
-        /* check for newline char */
-        eol_p = memchr(&line_data[line_size], '\n', line_rdsz);
-        line_size += line_rdsz;
+    UT_Stub_SetReturnValue(FuncKey, Result);
+}
 
-        while (eol_p != NULL)
-        {
-            *eol_p = 0;
-            ++eol_p;
-
-            if (strncmp("cpu", line_data, 3) == 0)
-            {
-                cpu_num  = -1;
-                run_time = 0;
-                linux_sysmon_read_cpuuse_line(&line_data[3], &cpu_num, &run_time);
-
-                if (cpu_num < LINUX_SYSMON_MAX_CPUS)
-                {
-                    core_p = &state->per_core[cpu_num];
-                    if (cpu_num > highest_cpu_num)
-                    {
-                        highest_cpu_num = cpu_num;
-                    }
-                }
-                else
-                {
-                    core_p = NULL;
-                }
-
-                if (core_p != NULL)
-                {
-                    cpu_time_ms =
-                        OS_TimeGetTotalMilliseconds(OS_TimeFromTotalNanoseconds(run_time - core_p->last_run_time));
-                    core_p->last_run_time = run_time;
-                    if (cpu_time_ms >= elapsed_ms)
-                    {
-                        core_p->avg_load = 0xFFFFFF; /* max */
-                    }
-                    else if (elapsed_ms == 0)
-                    {
-                        core_p->avg_load = 0;
-                    }
-                    else
-                    {
-                        core_p->avg_load = (0x1000 * cpu_time_ms) / elapsed_ms;
-                        core_p->avg_load |= (core_p->avg_load << 12); /* Expand from 12->24 bit */
-                    }
-                    LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): CPU%u time_ms=%u ms, load=%06x\n", cpu_num, cpu_time_ms,
-                                       (unsigned int)core_p->avg_load);
-                }
-            }
-
-            line_rdsz = eol_p - &line_data[0];
-            if (line_rdsz < line_size)
-            {
-                memmove(line_data, eol_p, line_size - line_rdsz);
-                line_size -= line_rdsz;
-            }
-            else
-            {
-                line_size = 0;
-            }
-
-            eol_p = memchr(line_data, '\n', line_size);
-        }
+static int32 UT_pthread_create_Hook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    UT_SysMon_TaskEntry = UT_Hook_GetArgValueByName(Context, "start_routine", PCS_pthread_start_routine_t);
+    UT_SysMon_State     = UT_Hook_GetArgValueByName(Context, "arg", linux_sysmon_cpuload_state_t *);
 
-        if (line_size >= sizeof(line_data))
-        {
-            /* not supposed to happen, drop data */
-            OS_printf("CFE_PSP(linux_sysmon): malformed data from /proc/schedstat\n");
-            break;
-        }
-    }
+    return StubRetcode;
+}
 
-    state->num_cpus = 1 + highest_cpu_num;
+/* The worker task would take the first sample while the start routine is waiting */
+static int32 UT_TaskDelay_Hook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    linux_sysmon_update_schedstat(UT_SysMon_State, 0);
+
+    return StubRetcode;
 }
 
-void *linux_sysmon_Task(void *arg)
+/* Stops the driver while the worker task is waiting for its next sample */
+static int32 UT_poll_Hook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
 {
-    linux_sysmon_cpuload_state_t *state = arg;
+    CFE_PSP_IODriver_API_t *EntryAPI = TgtAPI->ExtendedApi;
 
-    OS_time_t     last_sample;
-    OS_time_t     curr_sample;
-    OS_time_t     next_sample;
-    int           msec_diff;
-    struct pollfd pfd;
+    EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0, CFE_PSP_IODriver_U32ARG(0));
 
-    CFE_PSP_GetTime(&next_sample);
-    curr_sample = next_sample;
-    memset(&pfd, 0, sizeof(pfd));
+    return StubRetcode;
+}
 
-    linux_sysmon_update_schedstat(state, 0);
+static void UT_SysMon_Start(void)
+{
+    CFE_PSP_IODriver_API_t *EntryAPI = TgtAPI->ExtendedApi;
+
+    UT_SetHookFunction(UT_KEY(PCS_pthread_create), UT_pthread_create_Hook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskDelay), UT_TaskDelay_Hook, NULL);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(1)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_NOT_NULL(UT_SysMon_State);
+}
 
-    while (state->should_run)
-    {
-        next_sample = OS_TimeAdd(next_sample, OS_TimeFromTotalSeconds(LINUX_SYSMON_SAMPLE_DELAY));
-        msec_diff   = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(next_sample, curr_sample));
-        if (msec_diff > 0)
-        {
-            poll(&pfd, 0, msec_diff);
-        }
+static void UT_SysMon_SetSchedstat(const char *Data)
+{
+    UT_ResetState(UT_KEY(PCS_pread));
+    UT_SetDataBuffer(UT_KEY(PCS_pread), (void *)Data, strlen(Data), false);
+}
 
-        last_sample = curr_sample;
-        CFE_PSP_GetTime(&curr_sample);
-        msec_diff = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(curr_sample, last_sample));
-        linux_sysmon_update_schedstat(state, msec_diff);
-    }
+static void UT_SysMon_ReadCpuLoad(uint16 NumChannels, CFE_PSP_IODriver_AdcCode_t *Samples)
+{
+    CFE_PSP_IODriver_API_t *      EntryAPI = TgtAPI->ExtendedApi;
+    CFE_PSP_IODriver_AnalogRdWr_t RdWr     = {.NumChannels = NumChannels, .Samples = Samples};
 
-    return NULL;
+    EntryAPI->DeviceCommand(CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS, UT_SYSMON_CPULOAD_SUBSYS, 0,
+                            CFE_PSP_IODriver_VPARG(&RdWr));
 }
 
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
- * linux_sysmon_Start()
- * ------------------------------------------------------
- *  Starts the cpu load watcher function
- *
- * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-int32_t linux_sysmon_Start(linux_sysmon_cpuload_state_t *state)
+static int32 UT_SysMon_ReadTaskLoad(uint16 Subchannel, uint16 NumChannels, CFE_PSP_IODriver_AdcCode_t *Samples)
 {
-    int32_t StatusCode;
-    int32_t DelayCount;
+    CFE_PSP_IODriver_AnalogRdWr_t RdWr = {.NumChannels = NumChannels, .Samples = Samples};
 
-    DelayCount = 0;
-    if (state->is_running)
-    {
-        /* already running, nothing to do */
-        StatusCode = CFE_PSP_SUCCESS;
-    }
-    else
-    {
-        /* start clean */
-        memset(state, 0, sizeof(*state));
-        StatusCode = CFE_PSP_ERROR;
+    return linux_sysmon_task_load_dispatch(CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS, Subchannel,
+                                           CFE_PSP_IODriver_VPARG(&RdWr));
+}
 
-        state->dev_fd = open("/proc/schedstat", O_RDONLY);
-        if (state->dev_fd < 0)
-        {
-            perror("open(/proc/schedstat)");
-        }
-        else
-        {
-            state->should_run = true;
-            if (pthread_create(&state->task_id, NULL, linux_sysmon_Task, state) < 0)
-            {
-                perror("pthread_create()");
-
-                /* Clean up */
-                state->should_run = false;
-                close(state->dev_fd);
-            }
-            else
-            {
-                /* wait for the "num_cpus" to become nonzero, this should be
-                 * initialized in the first sample taken by the worker task */
-                while (state->num_cpus == 0 && DelayCount < 100000000 /*jphfix*/)
-                {
-                    ++DelayCount;
-                    OS_TaskDelay(10);
-                }
-
-                if (state->num_cpus == 0)
-                {
-                    OS_printf("CFE_PSP(Linux_SysMon): Failed to detect number of CPUs\n");
-
-                    /* Clean up */
-                    state->should_run = false;
-                    pthread_cancel(state->task_id);
-                    pthread_join(state->task_id, NULL);
-                    close(state->dev_fd);
-                }
-                else
-                {
-                    OS_printf("CFE_PSP(Linux_SysMon): Started CPU utilization monitoring on %u CPU(s)\n",
-                              (unsigned int)state->num_cpus);
-
-                    StatusCode        = CFE_PSP_SUCCESS;
-                    state->is_running = true;
-                }
-            }
-        }
-    }
+static int32 UT_SysMon_LookupTask(const char *Name)
+{
+    return linux_sysmon_task_load_dispatch(CFE_PSP_IODriver_LOOKUP_SUBCHANNEL, 0, CFE_PSP_IODriver_CONST_STR(Name));
+}
 
-    return StatusCode;
+static const char *UT_SysMon_ParseU64(const char *Str, uint64_t *Value)
+{
+    return linux_sysmon_parse_u64(Str, Str + strlen(Str), Value);
 }
 
-int32_t linux_sysmon_Stop(linux_sysmon_cpuload_state_t *state)
+void Test_linux_sysmon_parse_u64(void)
 {
-    if (state->is_running)
-    {
-        state->should_run = false;
-        state->is_running = false;
-        pthread_cancel(state->task_id);
-        pthread_join(state->task_id, NULL);
-        close(state->dev_fd);
-    }
+    /*
+     * Test Case For:
+     * const char *linux_sysmon_parse_u64(const char *line_data, const char *line_end, uint64_t *value)
+     */
+    const char *Str;
+    uint64_t    Value;
+
+    /* Leading blanks are skipped, parsing stops at the first non-digit */
+    Str   = " \t123 x";
+    Value = 0;
+    UtAssert_ADDRESS_EQ(UT_SysMon_ParseU64(Str, &Value), Str + 5);
+    UtAssert_True(Value == 123, "Value (%llu) == 123", (unsigned long long)Value);
+
+    /* Parsing stops at the end of the line even in the middle of a number */
+    Str = "4567";
+    UtAssert_ADDRESS_EQ(linux_sysmon_parse_u64(Str, Str + 2, &Value), Str + 2);
+    UtAssert_True(Value == 45, "Value (%llu) == 45", (unsigned long long)Value);
+
+    /* No digits */
+    UtAssert_NULL(UT_SysMon_ParseU64("", &Value));
+    UtAssert_NULL(UT_SysMon_ParseU64("  \t", &Value));
+    UtAssert_NULL(UT_SysMon_ParseU64("abc", &Value));
+
+    /* Largest value that fits */
+    Str = "18446744073709551615";
+    UtAssert_ADDRESS_EQ(UT_SysMon_ParseU64(Str, &Value), Str + 20);
+    UtAssert_True(Value == UINT64_MAX, "Value (%llu) == UINT64_MAX", (unsigned long long)Value);
+
+    /* Overflow */
+    Value = 0;
+    UtAssert_NULL(UT_SysMon_ParseU64("18446744073709551616", &Value));
+    UtAssert_NULL(UT_SysMon_ParseU64("99999999999999999999", &Value));
+    UtAssert_NULL(UT_SysMon_ParseU64("184467440737095516150", &Value));
+    UtAssert_True(Value == 0, "Value (%llu) not written on overflow", (unsigned long long)Value);
+}
 
-    return CFE_PSP_SUCCESS;
+void Test_linux_sysmon_update_schedstat(void)
+{
+    /*
+     * Test Case For:
+     * void linux_sysmon_update_schedstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms)
+     */
+    CFE_PSP_IODriver_AdcCode_t Samples[3];
+    CFE_PSP_IODriver_AdcCode_t Aggregate;
+    CFE_PSP_IODriver_API_t *   EntryAPI = TgtAPI->ExtendedApi;
+
+    CFE_PSP_IODriver_AnalogRdWr_t RdWr = {.NumChannels = 1, .Samples = &Aggregate};
+
+    UT_SysMon_Start();
+
+    /* Baseline sample, delivered in short reads which split lines and values */
+    UT_SysMon_SetSchedstat("version 15\ntimestamp 4295\n"
+                           "cpu0 0 0 0 0 0 0 1000000000 0 0\n"
+                           "domain0 00000003 0 0\n"
+                           "cpu1 0 0 0 0 0 0 2000000000 0 0\n");
+    UT_SetDeferredRetcode(UT_KEY(PCS_pread), 1, 7);
+    UT_SetDeferredRetcode(UT_KEY(PCS_pread), 1, 20);
+    UT_SetDeferredRetcode(UT_KEY(PCS_pread), 1, 13);
+    UtAssert_VOIDCALL(linux_sysmon_update_schedstat(UT_SysMon_State, 0));
+    UtAssert_STUB_COUNT(PCS_pread, 5);
+
+    memset(Samples, 0xFF, sizeof(Samples));
+    UT_SysMon_ReadCpuLoad(2, Samples);
+    UtAssert_UINT32_EQ(Samples[0], 0);
+    UtAssert_UINT32_EQ(Samples[1], 0);
+
+    /* Only two cpus, a third channel is out of range */
+    UT_SysMon_ReadCpuLoad(3, Samples);
+    UtAssert_UINT32_EQ(Samples[2], 0xFFFFFFFF);
+
+    /* One second later, cpu0 ran for 500ms and cpu1 for 250ms, starting with a single byte read */
+    UT_SysMon_SetSchedstat("cpu0 0 0 0 0 0 0 1500000000 0 0\n"
+                           "cpu1 0 0 0 0 0 0 2250000000 0 0\n");
+    UT_SetDeferredRetcode(UT_KEY(PCS_pread), 1, 1);
+    UtAssert_VOIDCALL(linux_sysmon_update_schedstat(UT_SysMon_State, 1000));
+    UT_SysMon_ReadCpuLoad(2, Samples);
+    UtAssert_UINT32_EQ(Samples[0], 0x800800);
+    UtAssert_UINT32_EQ(Samples[1], 0x400400);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_VPARG(&RdWr)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Aggregate, 0x600600);
+
+    /* Lines which are not valid per-cpu data are ignored, including an overflowing counter */
+    UT_SysMon_SetSchedstat("cpu\ncpuX 1\ncpu0 1 2 3\n"
+                           "cpu200 0 0 0 0 0 0 5 0 0\n"
+                           "cpu1 0 0 0 0 0 0 99999999999999999999 0 0\n"
+                           "cpu0 0 0 0 0 0 0 1500000000 0 0");
+    UtAssert_VOIDCALL(linux_sysmon_update_schedstat(UT_SysMon_State, 1000));
+    memset(Samples, 0xFF, sizeof(Samples));
+    UT_SysMon_ReadCpuLoad(1, Samples);
+    UtAssert_UINT32_EQ(Samples[0], 0x800800);
+    UT_SysMon_ReadCpuLoad(2, Samples);
+    UtAssert_UINT32_EQ(Samples[1], 0xFFFFFFFF);
+
+    /* Read error */
+    UT_ResetState(UT_KEY(PCS_pread));
+    UT_SetDefaultReturnValue(UT_KEY(PCS_pread), -1);
+    UtAssert_VOIDCALL(linux_sysmon_update_schedstat(UT_SysMon_State, 1000));
+    UtAssert_STUB_COUNT(PCS_pread, 1);
+
+    /* A line which does not fit in the buffer is dropped */
+    memset(UT_SysMon_LongLine, 'x', sizeof(UT_SysMon_LongLine) - 1);
+    UT_SysMon_LongLine[sizeof(UT_SysMon_LongLine) - 1] = 0;
+    UT_SysMon_SetSchedstat(UT_SysMon_LongLine);
+    UT_ResetState(UT_KEY(OS_printf));
+    UtAssert_VOIDCALL(linux_sysmon_update_schedstat(UT_SysMon_State, 1000));
+    UtAssert_STUB_COUNT(OS_printf, 1);
+    UtAssert_STUB_COUNT(PCS_pread, 1);
 }
 
-int32_t linux_sysmon_calc_aggregate_cpu(linux_sysmon_cpuload_state_t *state, CFE_PSP_IODriver_AdcCode_t *Val)
+void Test_linux_sysmon_update_taskstat(void)
 {
-    uint8_t  cpu;
-    uint32_t sum;
+    /*
+     * Test Case For:
+     * void linux_sysmon_update_taskstat(linux_sysmon_cpuload_state_t *state, int elapsed_ms)
+     */
+    CFE_PSP_IODriver_AdcCode_t Samples[3];
 
-    sum = 0;
-    for (cpu = 0; cpu < state->num_cpus; ++cpu)
-    {
-        sum += state->per_core[cpu].avg_load;
-    }
+    UT_SysMon_Start();
 
-    if (cpu == 0)
-    {
-        *Val = 0;
-        return CFE_PSP_ERROR;
-    }
+    UT_SetHandlerFunction(UT_KEY(PCS_readdir), UT_readdir_Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(PCS_rewinddir), UT_rewinddir_Handler, NULL);
+    UT_SetVaHandlerFunction(UT_KEY(PCS_open), UT_open_Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(PCS_pread), UT_pread_Handler, NULL);
+    UT_SetHandlerFunction(UT_KEY(PCS_read), UT_read_Handler, NULL);
+    UT_ResetState(UT_KEY(PCS_close));
 
-    /* average of all cpus */
-    sum /= cpu;
-    LINUX_SYSMON_DEBUG("CFE_PSP(linux_sysmon): Aggregate CPU load=%06x\n", (unsigned int)sum);
-    *Val = sum;
+    /*
+     * First sample: taskA and taskB are accounted.  taskX cannot be opened,
+     * and the run time of taskD cannot be read, so neither is accounted.
+     */
+    UT_SysMon_ListTasks(0);
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 0));
+    UtAssert_STUB_COUNT(PCS_close, 3);
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskA"), UT_SYSMON_TASK_SUBCH(0, 1));
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskB"), UT_SYSMON_TASK_SUBCH(1, 1));
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskX"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskD"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* One second later, taskA ran for 250ms and taskB for 500ms */
+    UT_SysMon_FindTask(100)->RunTime += 250000000;
+    UT_SysMon_FindTask(101)->RunTime += 500000000;
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 1000));
+    memset(Samples, 0xFF, sizeof(Samples));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(0, 2, Samples), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Samples[0], 0x400400);
+    UtAssert_UINT32_EQ(Samples[1], 0x800800);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(1, 2, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    memset(Samples, 0xFF, sizeof(Samples));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(1, 1), 1, Samples), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Samples[0], 0x800800);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(1, 1), 2, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(1, 2), 1, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(2, 1), 1, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
 
-    return CFE_PSP_SUCCESS;
+    /*
+     * taskA exits and taskC starts between samples.  The slot of taskA is
+     * only released after the directory scan, so taskC gets a new slot and
+     * the old slot reads as zero load.
+     */
+    UT_SysMon_FindTask(100)->IsListed = false;
+    UT_SysMon_FindTask(103)->IsListed = true;
+    UT_SysMon_ListTasks(0);
+    UT_ResetState(UT_KEY(PCS_close));
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 1000));
+    UtAssert_STUB_COUNT(PCS_close, 3);
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskA"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskC"), UT_SYSMON_TASK_SUBCH(2, 1));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(0, 1), 1, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    memset(Samples, 0xFF, sizeof(Samples));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(0, 3, Samples), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(Samples[0], 0);
+    UtAssert_UINT32_EQ(Samples[1], 0);
+
+    /* taskB is still listed, but exits before its run time is read */
+    UT_SysMon_FindTask(101)->ReadStatus = -1;
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 1000));
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskB"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskC"), UT_SYSMON_TASK_SUBCH(2, 1));
+
+    /* All tasks gone */
+    UT_SysMon_FindTask(101)->IsListed = false;
+    UT_SysMon_FindTask(103)->IsListed = false;
+    UT_SysMon_ListTasks(0);
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 1000));
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskC"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(0, 1, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* More threads than the table holds, the excess is not accounted */
+    UT_SysMon_ListTasks(UT_SYSMON_MAX_TASKS + 1);
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 0));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_MAX_TASKS - 1, 1, Samples), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(0, UT_SYSMON_MAX_TASKS + 1, NULL), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* A slot that is assigned to another thread has a new generation, so older lookups do not read it */
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("generic"), UT_SYSMON_TASK_SUBCH(0, 2));
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(0, 1), 1, Samples), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(UT_SYSMON_TASK_SUBCH(0, 2), 1, Samples), CFE_PSP_SUCCESS);
+
+    /* The table is only accessed while it is locked */
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(PCS_pthread_mutex_lock)),
+                       UT_GetStubCount(UT_KEY(PCS_pthread_mutex_unlock)));
+
+    /* Restore the simulated threads for other tests */
+    UT_SysMon_FindTask(100)->IsListed   = true;
+    UT_SysMon_FindTask(100)->RunTime    = 1000000000;
+    UT_SysMon_FindTask(101)->IsListed   = true;
+    UT_SysMon_FindTask(101)->RunTime    = 2000000000;
+    UT_SysMon_FindTask(101)->ReadStatus = 0;
 }
 
-int32_t linux_sysmon_aggregate_dispatch(uint32_t CommandCode, uint16_t Subchannel, CFE_PSP_IODriver_Arg_t Arg)
+void Test_linux_sysmon_task_load_dispatch(void)
 {
-    int32_t                       StatusCode;
-    linux_sysmon_cpuload_state_t *state;
-
-    /* There is just one global cpuload object */
-    state      = &linux_sysmon_global.cpu_load;
-    StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
-    switch (CommandCode)
-    {
-        case CFE_PSP_IODriver_NOOP:
-        case CFE_PSP_IODriver_ANALOG_IO_NOOP:
-        {
-            /* NO-OP should return success -
-             * This is a required opcode as "generic" clients may use it to
-             * determine if a certain set of opcodes are supported or not
-             */
-            StatusCode = CFE_PSP_SUCCESS;
-            break;
-        }
-        /* Start/stop opcodes */
-        case CFE_PSP_IODriver_SET_RUNNING: /**< int32_t argument, 0=stop 1=start device */
-        {
-            if (Arg.U32)
-            {
-                StatusCode = linux_sysmon_Start(state);
-            }
-            else
-            {
-                StatusCode = linux_sysmon_Stop(state);
-            }
-            break;
-        }
-        case CFE_PSP_IODriver_GET_RUNNING: /**< no argument, returns positive nonzero (true) if running and zero (false)
-                                              if stopped, negative on error */
-        {
-            StatusCode = state->is_running;
-            break;
-        }
-        case CFE_PSP_IODriver_SET_CONFIGURATION: /**< const string argument (device-dependent content) */
-        case CFE_PSP_IODriver_GET_CONFIGURATION: /**< void * argument (device-dependent content) */
-        {
-            /* not implemented for now */
-            break;
-        }
-        case CFE_PSP_IODriver_LOOKUP_SUBSYSTEM: /**< const char * argument, looks up name and returns positive
-                                                    value for subsystem number, negative value for error */
-        {
-            uint16_t i;
-
-            for (i = 0; linux_sysmon_subsystem_names[i] != NULL; ++i)
-            {
-                if (strcmp(Arg.ConstStr, linux_sysmon_subsystem_names[i]) == 0)
-                {
-                    StatusCode = i;
-                    break;
-                }
-            }
-
-            break;
-        }
-        case CFE_PSP_IODriver_LOOKUP_SUBCHANNEL: /**< const char * argument, looks up name and returns positive
-                                                    value for channel number, negative value for error */
-        {
-            uint16_t i;
-
-            for (i = 0; linux_sysmon_subchannel_names[i] != NULL; ++i)
-            {
-                if (strcmp(Arg.ConstStr, linux_sysmon_subchannel_names[i]) == 0)
-                {
-                    StatusCode = i;
-                    break;
-                }
-            }
-
-            break;
-        }
-        case CFE_PSP_IODriver_QUERY_DIRECTION: /**< CFE_PSP_IODriver_Direction_t argument */
-        {
-            CFE_PSP_IODriver_Direction_t *DirPtr = (CFE_PSP_IODriver_Direction_t *)Arg.Vptr;
-            if (DirPtr != NULL)
-            {
-                *DirPtr    = CFE_PSP_IODriver_Direction_INPUT_ONLY;
-                StatusCode = CFE_PSP_SUCCESS;
-            }
-            break;
-        }
-        case CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS:
-        {
-            CFE_PSP_IODriver_AnalogRdWr_t *RdWr = Arg.Vptr;
+    /*
+     * Test Case For:
+     * int32_t linux_sysmon_task_load_dispatch(uint32_t CommandCode, uint16_t Subchannel, CFE_PSP_IODriver_Arg_t Arg)
+     */
+    CFE_PSP_IODriver_API_t *EntryAPI = TgtAPI->ExtendedApi;
+
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_NOOP, UT_SYSMON_TASKLOAD_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_ANALOG_IO_NOOP, UT_SYSMON_TASKLOAD_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_TASKLOAD_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* Nothing accounted before the driver is started */
+    UtAssert_INT32_EQ(UT_SysMon_LookupTask("taskA"), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(UT_SysMon_ReadTaskLoad(0, 1, NULL), CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* Unknown subsystem */
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_NOOP, 3, 0, CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+}
 
-            if (RdWr->NumChannels == 1 && Subchannel == LINUX_SYSMON_AGGR_CPULOAD_SUBCH)
-            {
-                StatusCode = linux_sysmon_calc_aggregate_cpu(state, RdWr->Samples);
-            }
-            break;
-        }
-        default:
-            break;
-    }
+void Test_linux_sysmon_aggregate_dispatch(void)
+{
+    CFE_PSP_IODriver_API_t *      EntryAPI = TgtAPI->ExtendedApi;
+    CFE_PSP_IODriver_AdcCode_t    Sample;
+    CFE_PSP_IODriver_AnalogRdWr_t RdWr = {.NumChannels = 1, .Samples = &Sample};
+    CFE_PSP_IODriver_Direction_t  Dir;
+
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_NOOP, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_CONFIGURATION, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_LOOKUP_SUBSYSTEM, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_CONST_STR("per-task")),
+                      UT_SYSMON_TASKLOAD_SUBSYS);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_LOOKUP_SUBSYSTEM, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_CONST_STR("none")),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_LOOKUP_SUBCHANNEL, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_CONST_STR("cpu-load")),
+                      0);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_LOOKUP_SUBCHANNEL, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_CONST_STR("none")),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_QUERY_DIRECTION, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_VPARG(&Dir)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(Dir, CFE_PSP_IODriver_Direction_INPUT_ONLY);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_QUERY_DIRECTION, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_VPARG(NULL)),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+
+    /* No cpus known before the driver is started */
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_VPARG(&RdWr)),
+                      CFE_PSP_ERROR);
+    RdWr.NumChannels = 2;
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_VPARG(&RdWr)),
+                      CFE_PSP_ERROR_NOT_IMPLEMENTED);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_NOOP, UT_SYSMON_CPULOAD_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+}
 
-    return StatusCode;
+void Test_linux_sysmon_StartStop(void)
+{
+    CFE_PSP_IODriver_API_t *EntryAPI = TgtAPI->ExtendedApi;
+
+    /* Failure to open the schedstat file */
+    UT_SetDeferredRetcode(UT_KEY(PCS_open), 1, -1);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(1)),
+                      CFE_PSP_ERROR);
+    UtAssert_STUB_COUNT(PCS_pthread_create, 0);
+
+    /* Failure to start the worker */
+    UT_SetDeferredRetcode(UT_KEY(PCS_pthread_create), 1, -1);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(1)),
+                      CFE_PSP_ERROR);
+    UtAssert_STUB_COUNT(PCS_closedir, 1);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_GET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      false);
+
+    /* Per-thread accounting is skipped if the task directory cannot be opened */
+    UT_SetDeferredRetcode(UT_KEY(PCS_opendir), 1, -1);
+    UT_SysMon_Start();
+    UtAssert_VOIDCALL(linux_sysmon_update_taskstat(UT_SysMon_State, 1000));
+    UtAssert_STUB_COUNT(PCS_readdir, 0);
+
+    /* Already running */
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(1)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_pthread_create, 2);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_GET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      true);
+
+    /* Stop, and stop again */
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_pthread_join, 1);
+    UtAssert_INT32_EQ(EntryAPI->DeviceCommand(CFE_PSP_IODriver_SET_RUNNING, UT_SYSMON_AGGREGATE_SUBSYS, 0,
+                                              CFE_PSP_IODriver_U32ARG(0)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_STUB_COUNT(PCS_pthread_join, 1);
 }
 
-int32_t linux_sysmon_cpu_load_dispatch(uint32_t CommandCode, uint16_t Subchannel, CFE_PSP_IODriver_Arg_t Arg)
+void Test_linux_sysmon_Task(void)
 {
-    int32_t                       StatusCode;
-    linux_sysmon_cpuload_state_t *state;
+    /* The worker samples once at startup, then once per period until stopped */
+    UT_SysMon_Start();
+    UtAssert_True(UT_SysMon_TaskEntry != NULL, "Worker entry point captured");
+
+    UT_ResetState(UT_KEY(PCS_pread));
+    UT_SetHookFunction(UT_KEY(PCS_poll), UT_poll_Hook, NULL);
+    UtAssert_NULL(UT_SysMon_TaskEntry(UT_SysMon_State));
+    UtAssert_STUB_COUNT(PCS_poll, 1);
+    UtAssert_STUB_COUNT(PCS_pread, 2);
+    UtAssert_STUB_COUNT(PCS_pthread_join, 1);
+
+    /* The per-task table is updated while locked, for each sample and when released on stop */
+    UtAssert_STUB_COUNT(PCS_pthread_mutex_lock, 3);
+    UtAssert_STUB_COUNT(PCS_pthread_mutex_unlock, 3);
+}
 
-    /* There is just one global cpuload object */
-    state      = &linux_sysmon_global.cpu_load;
-    StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
-    switch (CommandCode)
-    {
-        case CFE_PSP_IODriver_NOOP:
-        case CFE_PSP_IODriver_ANALOG_IO_NOOP:
-        {
-            /* NO-OP should return success -
-             * This is a required opcode as "generic" clients may use it to
-             * determine if a certain set of opcodes are supported or not
-             */
-            StatusCode = CFE_PSP_SUCCESS;
-            break;
-        }
-        case CFE_PSP_IODriver_ANALOG_IO_READ_CHANNELS:
-        {
-            CFE_PSP_IODriver_AnalogRdWr_t *RdWr = Arg.Vptr;
-            uint32_t                       ch;
-
-            if (Subchannel < state->num_cpus && (Subchannel + RdWr->NumChannels) <= state->num_cpus)
-            {
-                for (ch = Subchannel; ch < (Subchannel + RdWr->NumChannels); ++ch)
-                {
-                    RdWr->Samples[ch] = state->per_core[ch].avg_load;
-                }
-            }
-            break;
-        }
-        default:
-            break;
-    }
+/*
+ * Macro to add a test case to the list of tests to execute
+ */
+#define ADD_TEST(test) UtTest_Add(test, ResetTest, NULL, #test)
 
-    return StatusCode;
+void ResetTest(void)
+{
+    UT_ResetState(0);
+    UT_SysMon_TaskEntry = NULL;
+    UT_SysMon_State     = NULL;
+    TgtAPI->Init(0);
 }
 
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-/*    linux_sysmon_DevCmd()                                         */
-/* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-/**
- * \brief Main entry point for API.
- *
- * This function is called through iodriver to invoke the linux_sysmon module.
- *
- * \par Assumptions, External Events, and Notes:
- *          None
- *
- * \param[in] CommandCode  The CFE_PSP_IODriver_xxx command.
- * \param[in] SubsystemId  The monitor subsystem identifier
- * \param[in] SubchannelId The monitor subchannel identifier
- * \param[in] Arg          The arguments for the corresponding command.
- *
- * \returns Status code
- * \retval #CFE_PSP_SUCCESS if successful
+/*
+ * Register the test cases to execute with the unit test tool
  */
-int32_t linux_sysmon_DevCmd(uint32_t CommandCode, uint16_t SubsystemId, uint16_t SubchannelId,
-                            CFE_PSP_IODriver_Arg_t Arg)
+void UtTest_Setup(void)
 {
-    int32_t StatusCode;
-
-    StatusCode = CFE_PSP_ERROR_NOT_IMPLEMENTED;
-    switch (SubsystemId)
-    {
-        case LINUX_SYSMON_AGGREGATE_SUBSYS:
-            StatusCode = linux_sysmon_aggregate_dispatch(CommandCode, SubchannelId, Arg);
-            break;
-        case LINUX_SYSMON_CPULOAD_SUBSYS:
-            StatusCode = linux_sysmon_cpu_load_dispatch(CommandCode, SubchannelId, Arg);
-            break;
-        default:
-            /* not implemented */
-            break;
-    }
-
-    return StatusCode;
+    ADD_TEST(Test_linux_sysmon_parse_u64);
+    ADD_TEST(Test_linux_sysmon_update_schedstat);
+    ADD_TEST(Test_linux_sysmon_update_taskstat);
+    ADD_TEST(Test_linux_sysmon_task_load_dispatch);
+    ADD_TEST(Test_linux_sysmon_aggregate_dispatch);
+    ADD_TEST(Test_linux_sysmon_StartStop);
+    ADD_TEST(Test_linux_sysmon_Task);
 }
@@ -0,0 +1,43 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  adaptors
+ *
+ * Access to the pc-linux exception handler state, which is defined
+ * with types that are only valid when compiled with the stub headers
+ */
+
+#ifndef UT_ADAPTOR_EXCEPTION_HANDLER_H
+#define UT_ADAPTOR_EXCEPTION_HANDLER_H
+
+#include "common_types.h"
+
+void   UT_ExceptionHandlerAdaptor_Init(void);
+void   UT_ExceptionHandlerAdaptor_Raise(int signo, int code, bool Suspend);
+void   UT_ExceptionHandlerAdaptor_SetShutdownReq(bool ShutdownReq);
+bool   UT_ExceptionHandlerAdaptor_IsRunning(void);
+uint32 UT_ExceptionHandlerAdaptor_GetNumCaptured(void);
+uint32 UT_ExceptionHandlerAdaptor_GetNumProcessed(void);
+uint32 UT_ExceptionHandlerAdaptor_GetNumDropped(void);
+uint64 UT_ExceptionHandlerAdaptor_GetLastLatencyNs(void);
+uint32 UT_ExceptionHandlerAdaptor_GetMaxPending(void);
+uint32 UT_ExceptionHandlerAdaptor_GetMaxEntries(void);
+
+#endif
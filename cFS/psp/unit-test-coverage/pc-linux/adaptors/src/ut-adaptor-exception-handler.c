@@ -0,0 +1,109 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * \file
+ * \ingroup  adaptors
+ */
+
+#include "ut-adaptor-exception-handler.h"
+#include "cfe_psp_config.h"
+#include "cfe_psp_memory.h"
+#include "cfe_psp_exceptionstorage_types.h"
+
+extern void CFE_PSP_ExceptionSigHandler(int signo, siginfo_t *si, void *ctxt);
+extern void CFE_PSP_ExceptionSigHandlerSuspend(int signo, siginfo_t *si, void *ctxt);
+
+/*
+ * These are normally defined in cfe_psp_start.c and cfe_psp_memory.c,
+ * which are not part of this coverage test
+ */
+CFE_PSP_IdleTaskState_t     CFE_PSP_IdleTaskState;
+CFE_PSP_ReservedMemoryMap_t CFE_PSP_ReservedMemoryMap;
+
+static CFE_PSP_ExceptionStorage_t UT_ExceptionStorage;
+
+static const CFE_PSP_ExceptionStorage_t      UT_DEFAULT_EXCEPTIONSTORAGE = {0};
+static const CFE_PSP_IdleTaskState_t         UT_DEFAULT_IDLETASKSTATE    = {0};
+static const CFE_PSP_ExceptionHandlerState_t UT_DEFAULT_HANDLERSTATE     = {0};
+
+void UT_ExceptionHandlerAdaptor_Init(void)
+{
+    UT_ExceptionStorage           = UT_DEFAULT_EXCEPTIONSTORAGE;
+    CFE_PSP_IdleTaskState         = UT_DEFAULT_IDLETASKSTATE;
+    CFE_PSP_ExceptionHandlerState = UT_DEFAULT_HANDLERSTATE;
+
+    CFE_PSP_ReservedMemoryMap.ExceptionStoragePtr = &UT_ExceptionStorage;
+}
+
+void UT_ExceptionHandlerAdaptor_Raise(int signo, int code, bool Suspend)
+{
+    siginfo_t si = {0};
+
+    si.si_signo = signo;
+    si.si_code  = code;
+
+    if (Suspend)
+    {
+        CFE_PSP_ExceptionSigHandlerSuspend(signo, &si, NULL);
+    }
+    else
+    {
+        CFE_PSP_ExceptionSigHandler(signo, &si, NULL);
+    }
+}
+
+void UT_ExceptionHandlerAdaptor_SetShutdownReq(bool ShutdownReq)
+{
+    CFE_PSP_IdleTaskState.ShutdownReq = ShutdownReq;
+}
+
+bool UT_ExceptionHandlerAdaptor_IsRunning(void)
+{
+    return CFE_PSP_ExceptionHandlerState.IsRunning;
+}
+
+uint32 UT_ExceptionHandlerAdaptor_GetNumCaptured(void)
+{
+    return CFE_PSP_ExceptionHandlerState.NumCaptured;
+}
+
+uint32 UT_ExceptionHandlerAdaptor_GetNumProcessed(void)
+{
+    return CFE_PSP_ExceptionHandlerState.NumProcessed;
+}
+
+uint32 UT_ExceptionHandlerAdaptor_GetNumDropped(void)
+{
+    return CFE_PSP_ExceptionHandlerState.NumDropped;
+}
+
+uint64 UT_ExceptionHandlerAdaptor_GetLastLatencyNs(void)
+{
+    return CFE_PSP_ExceptionHandlerState.LastLatencyNs;
+}
+
+uint32 UT_ExceptionHandlerAdaptor_GetMaxPending(void)
+{
+    return CFE_PSP_EXCEPTION_MAX_PENDING;
+}
+
+uint32 UT_ExceptionHandlerAdaptor_GetMaxEntries(void)
+{
+    return CFE_PSP_MAX_EXCEPTION_ENTRIES;
+}
@@ -0,0 +1,294 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#include "coveragetest-psp-pc-linux.h"
+#include "ut-adaptor-exception-handler.h"
+
+#include "cfe_psp.h"
+
+#include "PCS_cfe_configdata.h"
+#include "PCS_errno.h"
+#include "PCS_execinfo.h"
+#include "PCS_pthread.h"
+#include "PCS_semaphore.h"
+#include "PCS_signal.h"
+#include "PCS_stdlib.h"
+#include "PCS_time.h"
+
+/* Entry point of the exception handler thread, as passed to pthread_create() */
+static PCS_pthread_start_routine_t UT_HandlerThreadEntry;
+
+/*
+ * Outcome of successive sem_wait() calls made by the handler thread,
+ * as a status and the errno value to set if the status is not zero
+ */
+typedef struct
+{
+    int32 Status;
+    int   ErrorCode;
+} UT_SemWaitResult_t;
+
+static const UT_SemWaitResult_t *UT_SemWaitResults;
+
+static char  UT_Symbol0[] = "UT_Symbol0";
+static char  UT_Symbol1[] = "UT_Symbol1";
+static char *UT_Symbols[] = {UT_Symbol0, UT_Symbol1};
+
+static int32 UT_pthread_create_Hook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                    const UT_StubContext_t *Context)
+{
+    UT_HandlerThreadEntry = UT_Hook_GetArgValueByName(Context, "start_routine", PCS_pthread_start_routine_t);
+
+    return StubRetcode;
+}
+
+static int32 UT_sem_wait_Hook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    PCS_errno = UT_SemWaitResults[CallCount].ErrorCode;
+
+    return UT_SemWaitResults[CallCount].Status;
+}
+
+static void UT_Handler_backtrace_symbols(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    char **Result = UT_Symbols;
+
+    UT_Stub_SetReturnValue(FuncKey, Result);
+}
+
+/* Starts the exception handling with a fresh state and storage */
+static void UT_StartExceptionHandler(void)
+{
+    UT_HandlerThreadEntry = NULL;
+    UT_ExceptionHandlerAdaptor_Init();
+    UT_SetHookFunction(UT_KEY(PCS_pthread_create), UT_pthread_create_Hook, NULL);
+    UtAssert_VOIDCALL(CFE_PSP_AttachExceptions());
+    UtAssert_BOOL_TRUE(UT_ExceptionHandlerAdaptor_IsRunning());
+}
+
+/* Runs the handler thread until the given sem_wait() results are used up */
+static void UT_RunExceptionHandler(const UT_SemWaitResult_t *Results)
+{
+    UT_SemWaitResults = Results;
+    UT_ResetState(UT_KEY(PCS_sem_wait));
+    UT_SetHookFunction(UT_KEY(PCS_sem_wait), UT_sem_wait_Hook, NULL);
+    UtAssert_True(UT_HandlerThreadEntry != NULL, "Handler thread entry point captured");
+    UtAssert_NULL(UT_HandlerThreadEntry(NULL));
+}
+
+static void UT_CheckSummary(const char *Expected)
+{
+    uint32    ContextLogId;
+    osal_id_t TaskId;
+    char      ReasonBuf[128];
+
+    UtAssert_INT32_EQ(CFE_PSP_Exception_GetSummary(&ContextLogId, &TaskId, ReasonBuf, sizeof(ReasonBuf)),
+                      CFE_PSP_SUCCESS);
+    UtAssert_STRINGBUF_EQ(ReasonBuf, sizeof(ReasonBuf), Expected, -1);
+}
+
+void Test_CFE_PSP_AttachExceptions(void)
+{
+    /* Nominal, the handler thread is started before any signal handler is attached */
+    UT_StartExceptionHandler();
+    UtAssert_STUB_COUNT(PCS_pthread_create, 1);
+    UtAssert_STUB_COUNT(PCS_sigaction, 2);
+
+    /* Not permitted to use real time scheduling, retries with the default attributes */
+    UT_ResetState(UT_KEY(PCS_pthread_create));
+    UT_SetDeferredRetcode(UT_KEY(PCS_pthread_create), 1, PCS_EPERM);
+    UtAssert_VOIDCALL(CFE_PSP_AttachExceptions());
+    UtAssert_STUB_COUNT(PCS_pthread_create, 2);
+    UtAssert_BOOL_TRUE(UT_ExceptionHandlerAdaptor_IsRunning());
+
+    /* The thread cannot be started, so exceptions will be processed in the signal handler */
+    UT_ResetState(UT_KEY(PCS_pthread_create));
+    UT_SetDefaultReturnValue(UT_KEY(PCS_pthread_create), PCS_EINVAL);
+    UtAssert_VOIDCALL(CFE_PSP_AttachExceptions());
+    UtAssert_BOOL_FALSE(UT_ExceptionHandlerAdaptor_IsRunning());
+    UtAssert_STUB_COUNT(PCS_sem_destroy, 1);
+
+    /* The semaphore cannot be created */
+    UT_ResetState(UT_KEY(PCS_pthread_create));
+    UT_SetDeferredRetcode(UT_KEY(PCS_sem_init), 1, -1);
+    UtAssert_VOIDCALL(CFE_PSP_AttachExceptions());
+    UtAssert_BOOL_FALSE(UT_ExceptionHandlerAdaptor_IsRunning());
+    UtAssert_STUB_COUNT(PCS_pthread_create, 0);
+}
+
+void Test_CFE_PSP_SetDefaultExceptionEnvironment(void)
+{
+    /* Synchronous exceptions also mask the same signal */
+    UtAssert_VOIDCALL(CFE_PSP_SetDefaultExceptionEnvironment());
+    UtAssert_STUB_COUNT(PCS_sigaction, 1);
+    UtAssert_STUB_COUNT(PCS_sigaddset, 1);
+
+    /* Asynchronous signals */
+    UT_SetDefaultReturnValue(UT_KEY(PCS_sigismember), 1);
+    UtAssert_VOIDCALL(CFE_PSP_SetDefaultExceptionEnvironment());
+    UtAssert_STUB_COUNT(PCS_sigaction, 2);
+    UtAssert_STUB_COUNT(PCS_sigaddset, 1);
+}
+
+void Test_CFE_PSP_ExceptionSigHandler(void)
+{
+    uint32 MaxEntries = UT_ExceptionHandlerAdaptor_GetMaxEntries();
+    uint32 MaxPending = UT_ExceptionHandlerAdaptor_GetMaxPending();
+    uint32 i;
+
+    /* Without the handler thread, the context is stored directly and the idle thread is woken */
+    UT_ExceptionHandlerAdaptor_Init();
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGINT, 0, false));
+    UtAssert_UINT32_EQ(CFE_PSP_Exception_GetCount(), 1);
+    UtAssert_STUB_COUNT(PCS_pthread_kill, 1);
+    UtAssert_STUB_COUNT(PCS_sem_post, 0);
+
+    /* Once the storage is full, the idle thread is still woken */
+    for (i = 0; i < MaxEntries; ++i)
+    {
+        UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGINT, 0, false));
+    }
+    UtAssert_UINT32_EQ(CFE_PSP_Exception_GetCount(), MaxEntries);
+    UtAssert_STUB_COUNT(PCS_pthread_kill, MaxEntries + 1);
+
+    /* Synchronous exceptions do not return to the application */
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_INTDIV, true));
+    UtAssert_STUB_COUNT(PCS_sigsuspend, 1);
+
+    /* With the handler thread, only a snapshot is taken and the thread is woken */
+    UT_StartExceptionHandler();
+    UT_ResetState(UT_KEY(PCS_pthread_kill));
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGTERM, 0, false));
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumCaptured(), 1);
+    UtAssert_UINT32_EQ(CFE_PSP_Exception_GetCount(), 0);
+    UtAssert_STUB_COUNT(PCS_sem_post, 1);
+    UtAssert_STUB_COUNT(PCS_pthread_kill, 0);
+
+    /* When all slots are pending the exception is dropped, but the thread is still woken */
+    for (i = 0; i < MaxPending; ++i)
+    {
+        UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGTERM, 0, false));
+    }
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumCaptured(), MaxPending + 1);
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumDropped(), 1);
+    UtAssert_STUB_COUNT(PCS_sem_post, MaxPending + 1);
+
+    /* A fault in the handler thread itself is stored directly, and the thread is no longer used */
+    UT_StartExceptionHandler();
+    UT_ResetState(UT_KEY(PCS_sem_post));
+    UT_ResetState(UT_KEY(PCS_sigsuspend));
+    UT_SetDefaultReturnValue(UT_KEY(PCS_pthread_equal), 1);
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGSEGV, 0, true));
+    UtAssert_BOOL_FALSE(UT_ExceptionHandlerAdaptor_IsRunning());
+    UtAssert_UINT32_EQ(CFE_PSP_Exception_GetCount(), 1);
+    UtAssert_STUB_COUNT(PCS_pthread_kill, 1);
+    UtAssert_STUB_COUNT(PCS_sigsuspend, 1);
+    UtAssert_STUB_COUNT(PCS_sem_post, 0);
+}
+
+void Test_CFE_PSP_ExceptionHandlerThread(void)
+{
+    /*
+     * The signal handler timestamps each exception, and the thread reads the
+     * clock again once the snapshots are committed.  The latency is measured
+     * from the oldest exception, which is the second one raised here.
+     */
+    struct PCS_timespec UT_Times[] = {{100, 5000}, {100, 1000}, {100, 44000}};
+
+    const UT_SemWaitResult_t Nominal[]  = {{0, 0}, {-1, PCS_EINTR}, {-1, PCS_EINVAL}};
+    const UT_SemWaitResult_t Spurious[] = {{0, 0}, {0, 0}, {-1, PCS_EINVAL}};
+    const UT_SemWaitResult_t Once[]     = {{0, 0}, {-1, PCS_EINVAL}};
+
+    /* Snapshots are committed and the CFE is notified, then the fault is reported */
+    UT_StartExceptionHandler();
+    UT_SetDataBuffer(UT_KEY(PCS_clock_gettime), UT_Times, sizeof(UT_Times), false);
+    UT_SetDefaultReturnValue(UT_KEY(PCS_backtrace), 2);
+    UT_SetHandlerFunction(UT_KEY(PCS_backtrace_symbols), UT_Handler_backtrace_symbols, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(PCS_sigismember), 0);
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_INTDIV, false));
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGINT, 0, false));
+    UT_RunExceptionHandler(Nominal);
+    UtAssert_STUB_COUNT(PCS_sem_wait, 3);
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumProcessed(), 2);
+    UtAssert_UINT32_EQ(CFE_PSP_Exception_GetCount(), 2);
+    UtAssert_STUB_COUNT(PCS_SystemNotify, 1);
+    UtAssert_STUB_COUNT(PCS_backtrace_symbols, 2);
+    UtAssert_STUB_COUNT(PCS_free, 2);
+    UtAssert_True(UT_ExceptionHandlerAdaptor_GetLastLatencyNs() == 43000, "Latency measured from oldest exception");
+
+    /* The summary reports the time it took until the CFE was notified */
+    UT_CheckSummary("Integer divide by zero at ip 0x0, notified in 43 us");
+    UT_CheckSummary("Caught SIGINT, notified in 43 us");
+
+    /* The thread stops if the semaphore cannot be used, the signal handler then does the processing */
+    UtAssert_BOOL_FALSE(UT_ExceptionHandlerAdaptor_IsRunning());
+
+    /*
+     * Asynchronous signals are not reported on the console, and the CFE is not
+     * notified during shutdown.  A wakeup without a snapshot (e.g. when it was
+     * dropped) does not change the latency.
+     */
+    UT_ResetState(0);
+    UT_StartExceptionHandler();
+    UT_ExceptionHandlerAdaptor_SetShutdownReq(true);
+    UT_SetDefaultReturnValue(UT_KEY(PCS_sigismember), 1);
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGTERM, 0, false));
+    UT_RunExceptionHandler(Spurious);
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumProcessed(), 1);
+    UtAssert_STUB_COUNT(PCS_SystemNotify, 0);
+    UtAssert_STUB_COUNT(PCS_backtrace_symbols, 0);
+
+    /* Backtrace of a fault is printed as addresses if the symbols cannot be resolved */
+    UT_ResetState(0);
+    UT_StartExceptionHandler();
+    UT_SetDefaultReturnValue(UT_KEY(PCS_backtrace), 2);
+    UtAssert_VOIDCALL(UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_INTDIV, false));
+    UT_RunExceptionHandler(Once);
+    UtAssert_STUB_COUNT(PCS_sem_wait, 2);
+    UtAssert_STUB_COUNT(PCS_backtrace_symbols, 1);
+    UtAssert_UINT32_EQ(UT_ExceptionHandlerAdaptor_GetNumProcessed(), 1);
+}
+
+void Test_CFE_PSP_ExceptionGetSummary_Impl(void)
+{
+    /* Exceptions processed in the signal handler have no notification latency */
+    UT_ExceptionHandlerAdaptor_Init();
+
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_INTDIV, false);
+    UT_CheckSummary("Integer divide by zero at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_INTOVF, false);
+    UT_CheckSummary("Integer overflow at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTDIV, false);
+    UT_CheckSummary("Floating-point divide by zero at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTOVF, false);
+    UT_CheckSummary("Floating-point overflow at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTUND, false);
+    UT_CheckSummary("Floating-point underflow at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTRES, false);
+    UT_CheckSummary("Floating-point inexact result at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTINV, false);
+    UT_CheckSummary("Invalid floating-point operation at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, PCS_FPE_FLTSUB, false);
+    UT_CheckSummary("Subscript out of range at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGFPE, 0, false);
+    UT_CheckSummary("Unknown SIGFPE at ip 0x0");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGINT, 0, false);
+    UT_CheckSummary("Caught SIGINT");
+    UT_ExceptionHandlerAdaptor_Raise(PCS_SIGTERM, 0, false);
+    UT_CheckSummary("Caught Signal 7942");
+}
@@ -0,0 +1,40 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+#ifndef COVERAGETEST_PSP_PC_LINUX_H
+#define COVERAGETEST_PSP_PC_LINUX_H
+
+#include "utassert.h"
+#include "uttest.h"
+#include "utstubs.h"
+
+#include "coveragetest-psp-shared.h"
+
+#define ADD_TEST(test) UtTest_Add((Test_##test), Psp_Test_Setup, Psp_Test_Teardown, #test)
+
+void Psp_Test_Setup(void);
+void Psp_Test_Teardown(void);
+
+/* Coverage test cases for cfs_psp_exception.c */
+void Test_CFE_PSP_AttachExceptions(void);
+void Test_CFE_PSP_SetDefaultExceptionEnvironment(void);
+void Test_CFE_PSP_ExceptionSigHandler(void);
+void Test_CFE_PSP_ExceptionHandlerThread(void);
+void Test_CFE_PSP_ExceptionGetSummary_Impl(void);
+
+#endif
@@ -39,6 +39,19 @@ void Test_CFE_PSP_GetCDSSize(void)
     UtAssert_INT32_EQ(CFE_PSP_GetCDSSize(&SizeOfCDS), OS_SUCCESS);
 }
 
+void Test_CFE_PSP_GetCDSArea(void)
+{
+    cpuaddr PtrToCDS;
+    uint32  SizeOfCDS;
+
+    /* Test both NULL pointer guards */
+    UtAssert_INT32_EQ(CFE_PSP_GetCDSArea(NULL, &SizeOfCDS), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_PSP_GetCDSArea(&PtrToCDS, NULL), OS_ERROR);
+
+    /* Nominal/success path */
+    UtAssert_INT32_EQ(CFE_PSP_GetCDSArea(&PtrToCDS, &SizeOfCDS), OS_SUCCESS);
+}
+
 void Test_CFE_PSP_WriteToCDS(void)
 {
     uint32 CDSOffset = 8;
@@ -23,8 +23,16 @@
 #include "PCS_stdlib.h"
 #include "PCS_cfe_configdata.h"
 
+extern void CFE_PSP_SetupReservedMemoryMap(void);
+
+/* Block of 'heap' memory for the reserved memory map that restart writes the boot record into */
+static uint32 UT_RestartMemoryMapBuffer[1024];
+
 void Test_CFE_PSP_Restart(void)
 {
+    UT_SetDataBuffer(UT_KEY(PCS_malloc), UT_RestartMemoryMapBuffer, sizeof(UT_RestartMemoryMapBuffer), false);
+    CFE_PSP_SetupReservedMemoryMap();
+
     CFE_PSP_Restart(CFE_PSP_RST_TYPE_PROCESSOR);
     UtAssert_STUB_COUNT(PCS_exit, 1);
     UT_ResetState(UT_KEY(PCS_exit)); /* Reset so cleared for next test */
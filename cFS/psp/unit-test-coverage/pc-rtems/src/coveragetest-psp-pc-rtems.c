@@ -34,6 +34,7 @@ void UtTest_Setup(void)
 
     /* Coverage test cases for cfs_psp_memory.c */
     ADD_TEST(CFE_PSP_GetCDSSize);
+    ADD_TEST(CFE_PSP_GetCDSArea);
     ADD_TEST(CFE_PSP_WriteToCDS);
     ADD_TEST(CFE_PSP_ReadFromCDS);
     ADD_TEST(CFE_PSP_GetResetArea);
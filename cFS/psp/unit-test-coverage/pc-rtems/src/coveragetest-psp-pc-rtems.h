@@ -37,6 +37,7 @@ void Test_CFE_PSP_SetDefaultExceptionEnvironment(void);
 
 /* Coverage test cases for cfs_psp_memory.c */
 void Test_CFE_PSP_GetCDSSize(void);
+void Test_CFE_PSP_GetCDSArea(void);
 void Test_CFE_PSP_WriteToCDS(void);
 void Test_CFE_PSP_ReadFromCDS(void);
 void Test_CFE_PSP_GetResetArea(void);
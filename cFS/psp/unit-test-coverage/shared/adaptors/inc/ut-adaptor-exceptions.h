@@ -48,6 +48,7 @@ uint32 UT_Get_Exception_Id(struct CFE_PSP_Exception_LogData *Buffer);
 void   UT_Generate_Exception_Context(struct CFE_PSP_Exception_LogData *Buffer, size_t Size);
 
 void UT_Set_Exception_StoragePtr(void *Ptr);
+void UT_Set_Exception_DefaultStorage(void);
 void UT_Set_Exception_StorageReadWrite(uint32 rd, uint32 wr);
 
 #endif
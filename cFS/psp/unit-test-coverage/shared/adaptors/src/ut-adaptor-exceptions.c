@@ -35,6 +35,8 @@
  *
  */
 
+#include <string.h>
+
 #include "ut-adaptor-exceptions.h"
 #include "cfe_psp_config.h"
 #include "cfe_psp_memory.h"
@@ -42,11 +44,19 @@
 #define CFE_PSP_MAX_EXCEPTION_ENTRIES        4
 #define CFE_PSP_MAX_EXCEPTION_BACKTRACE_SIZE 16
 
+static CFE_PSP_ExceptionStorage_t UT_ExceptionStorage;
+
 void UT_Set_Exception_StoragePtr(void *Ptr)
 {
     CFE_PSP_ReservedMemoryMap.ExceptionStoragePtr = Ptr;
 }
 
+void UT_Set_Exception_DefaultStorage(void)
+{
+    memset(&UT_ExceptionStorage, 0, sizeof(UT_ExceptionStorage));
+    CFE_PSP_ReservedMemoryMap.ExceptionStoragePtr = &UT_ExceptionStorage;
+}
+
 void UT_Set_Exception_StorageReadWrite(uint32 rd, uint32 wr)
 {
     CFE_PSP_ReservedMemoryMap.ExceptionStoragePtr->NumRead    = rd;
@@ -46,6 +46,7 @@ uint32 UT_Get_MemRange_MaxEntries(void)
 void UT_ClearMemRangeTable(void)
 {
     memset(CFE_PSP_ReservedMemoryMap.SysMemoryTable, 0, sizeof(CFE_PSP_ReservedMemoryMap.SysMemoryTable));
+    CFE_PSP_MemRangeIndexRebuild();
 }
 
 void UT_SetupMemRangeTable(uint32 EntryNum, uint32 MemType, cpuaddr StartAddr, size_t Size, uint32 WordSize)
@@ -58,4 +59,6 @@ void UT_SetupMemRangeTable(uint32 EntryNum, uint32 MemType, cpuaddr StartAddr, s
     SysMemPtr->StartAddr  = StartAddr;
     SysMemPtr->WordSize   = WordSize;
     SysMemPtr->Size       = Size;
+
+    CFE_PSP_MemRangeIndexRebuild();
 }
\ No newline at end of file
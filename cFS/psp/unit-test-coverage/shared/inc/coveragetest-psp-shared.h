@@ -67,5 +67,7 @@ void Test_CFE_PSP_MemValidateRange(void);
 void Test_CFE_PSP_MemRanges(void);
 void Test_CFE_PSP_MemRangeSet(void);
 void Test_CFE_PSP_MemRangeGet(void);
+void Test_CFE_PSP_MemReadBlock(void);
+void Test_CFE_PSP_MemWriteBlock(void);
 
 #endif
@@ -51,6 +51,8 @@ void Test_CFE_PSP_Exception_GetBuffer(void)
     struct CFE_PSP_Exception_LogData *Ptr0;
     struct CFE_PSP_Exception_LogData *Ptr1;
 
+    UT_Set_Exception_DefaultStorage();
+
     Ptr0 = CFE_PSP_Exception_GetBuffer(0);
     UtAssert_True(Ptr0 != NULL, "CFE_PSP_Exception_GetBuffer(0) (%p) != NULL", (void *)Ptr0);
     Ptr1 = CFE_PSP_Exception_GetBuffer(1);
@@ -73,6 +75,7 @@ void Test_CFE_PSP_Exception_GetNextContextBuffer(void)
     uint32 NumEntries;
     uint32 Count;
 
+    UT_Set_Exception_DefaultStorage();
     CFE_PSP_Exception_Reset();
     UtAssert_ZERO(CFE_PSP_Exception_GetCount());
     NumEntries = UT_Get_Exception_MaxEntries();
@@ -103,6 +106,7 @@ void Test_CFE_PSP_Exception_GetSummary(void)
     osal_id_t TestId;
 
     /* Nominal - no exceptions pending should return CFE_PSP_NO_EXCEPTION_DATA */
+    UT_Set_Exception_DefaultStorage();
     CFE_PSP_Exception_Reset();
     UtAssert_INT32_EQ(CFE_PSP_Exception_GetSummary(&LogId, &TaskId, ReasonBuf, sizeof(ReasonBuf)),
                       CFE_PSP_NO_EXCEPTION_DATA);
@@ -153,6 +157,7 @@ void Test_CFE_PSP_Exception_CopyContext(void)
     uint32                            LargeBuf[4];
     uint32                            CFE_PSP_EXCEPTION_ID_BASE;
 
+    UT_Set_Exception_DefaultStorage();
     CFE_PSP_Exception_Reset();
     CFE_PSP_EXCEPTION_ID_BASE = ((OS_OBJECT_TYPE_USER + 0x101) << OS_OBJECT_TYPE_SHIFT);
     LogId                     = OS_OBJECT_INDEX_MASK + OS_OBJECT_INDEX_MASK + CFE_PSP_EXCEPTION_ID_BASE;
@@ -33,6 +33,8 @@
  * \ingroup  vxworks
  */
 
+#include <string.h>
+
 #include "utassert.h"
 #include "utstubs.h"
 
@@ -41,6 +43,8 @@
 
 void Test_CFE_PSP_MemValidateRange(void)
 {
+    uint32 i;
+
     /* Test Case For:
      * int32 CFE_PSP_MemValidateRange(cpuaddr Address, size_t Size, uint32 MemoryType)
      */
@@ -64,6 +68,27 @@ void Test_CFE_PSP_MemValidateRange(void)
 
     /* Validate a range that crosses from one region into another */
     UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x800, 0x1000, CFE_PSP_MEM_RAM), CFE_PSP_INVALID_MEM_ADDR);
+
+    /* Overlapping entries, set out of address order, where the match is not the nearest entry */
+    UT_ClearMemRangeTable();
+    UT_SetupMemRangeTable(1, CFE_PSP_MEM_EEPROM, 0x2000, 0x1000, 4);
+    UT_SetupMemRangeTable(2, CFE_PSP_MEM_RAM, 0, 0x10000, 4);
+    UT_SetupMemRangeTable(3, CFE_PSP_MEM_RAM, 0x20000, 0x100, 4);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x2100, 0x10, CFE_PSP_MEM_EEPROM), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x2100, 0x10, CFE_PSP_MEM_RAM), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x20010, 0x10, CFE_PSP_MEM_RAM), CFE_PSP_SUCCESS);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x18000, 0x10, CFE_PSP_MEM_ANY), CFE_PSP_INVALID_MEM_ADDR);
+
+    /* When nothing matches, the status reflects the last entry not marked invalid */
+    UT_ClearMemRangeTable();
+    for (i = 0; i < UT_Get_MemRange_MaxEntries(); ++i)
+    {
+        UT_SetupMemRangeTable(i, CFE_PSP_MEM_INVALID, 0, 0, 4);
+    }
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x100, 0x10, CFE_PSP_MEM_ANY), CFE_PSP_INVALID_MEM_ADDR);
+    UT_SetupMemRangeTable(0, CFE_PSP_MEM_RAM, 0, 0x1000, 4);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x100, 0x10, CFE_PSP_MEM_EEPROM), CFE_PSP_INVALID_MEM_TYPE);
+    UtAssert_INT32_EQ(CFE_PSP_MemValidateRange(0x800, 0x1000, CFE_PSP_MEM_RAM), CFE_PSP_INVALID_MEM_RANGE);
 }
 
 void Test_CFE_PSP_MemRanges(void)
@@ -115,3 +140,52 @@ void Test_CFE_PSP_MemRangeGet(void)
     UtAssert_INT32_EQ(CFE_PSP_MemRangeGet(0, &MemType, &StartAddr, &MemSize, &WordSize, NULL), CFE_PSP_INVALID_POINTER);
     UtAssert_INT32_EQ(CFE_PSP_MemRangeGet(0, &MemType, &StartAddr, &MemSize, &WordSize, &Attribs), CFE_PSP_SUCCESS);
 }
+
+void Test_CFE_PSP_MemReadBlock(void)
+{
+    /* Test Case For:
+     * int32 CFE_PSP_MemReadBlock(cpuaddr SrcAddress, void *DestBuffer, size_t Size)
+     */
+    uint8 SrcBuf[16];
+    uint8 DstBuf[16];
+
+    memset(SrcBuf, 0xA5, sizeof(SrcBuf));
+    memset(DstBuf, 0, sizeof(DstBuf));
+
+    UT_ClearMemRangeTable();
+    UtAssert_INT32_EQ(CFE_PSP_MemReadBlock((cpuaddr)SrcBuf, NULL, sizeof(DstBuf)), CFE_PSP_INVALID_POINTER);
+    UtAssert_INT32_EQ(CFE_PSP_MemReadBlock((cpuaddr)SrcBuf, DstBuf, sizeof(DstBuf)), CFE_PSP_INVALID_MEM_ADDR);
+    UtAssert_ZERO(DstBuf[0]);
+
+    /* Any memory type may be read */
+    UT_SetupMemRangeTable(0, CFE_PSP_MEM_EEPROM, (cpuaddr)SrcBuf, sizeof(SrcBuf), 4);
+    UtAssert_INT32_EQ(CFE_PSP_MemReadBlock((cpuaddr)SrcBuf, DstBuf, sizeof(DstBuf)), CFE_PSP_SUCCESS);
+    UtAssert_MemCmp(DstBuf, SrcBuf, sizeof(DstBuf), "Block read");
+    UtAssert_INT32_EQ(CFE_PSP_MemReadBlock((cpuaddr)SrcBuf, DstBuf, 0), CFE_PSP_SUCCESS);
+}
+
+void Test_CFE_PSP_MemWriteBlock(void)
+{
+    /* Test Case For:
+     * int32 CFE_PSP_MemWriteBlock(cpuaddr DestAddress, const void *SrcBuffer, size_t Size)
+     */
+    uint8 SrcBuf[16];
+    uint8 DstBuf[16];
+
+    memset(SrcBuf, 0xA5, sizeof(SrcBuf));
+    memset(DstBuf, 0, sizeof(DstBuf));
+
+    UT_ClearMemRangeTable();
+    UtAssert_INT32_EQ(CFE_PSP_MemWriteBlock((cpuaddr)DstBuf, NULL, sizeof(SrcBuf)), CFE_PSP_INVALID_POINTER);
+
+    /* EEPROM is not writable through this API (using the last entry, so it determines the status) */
+    UT_SetupMemRangeTable(UT_Get_MemRange_MaxEntries() - 1, CFE_PSP_MEM_EEPROM, (cpuaddr)DstBuf, sizeof(DstBuf), 4);
+    UtAssert_INT32_EQ(CFE_PSP_MemWriteBlock((cpuaddr)DstBuf, SrcBuf, sizeof(SrcBuf)), CFE_PSP_INVALID_MEM_TYPE);
+
+    UT_ClearMemRangeTable();
+    UT_SetupMemRangeTable(0, CFE_PSP_MEM_RAM, (cpuaddr)DstBuf, sizeof(DstBuf), 4);
+    UtAssert_INT32_EQ(CFE_PSP_MemWriteBlock((cpuaddr)DstBuf, SrcBuf, sizeof(SrcBuf) + 1), CFE_PSP_INVALID_MEM_ADDR);
+    UtAssert_ZERO(DstBuf[0]);
+    UtAssert_INT32_EQ(CFE_PSP_MemWriteBlock((cpuaddr)DstBuf, SrcBuf, sizeof(SrcBuf)), CFE_PSP_SUCCESS);
+    UtAssert_MemCmp(DstBuf, SrcBuf, sizeof(DstBuf), "Block write");
+}
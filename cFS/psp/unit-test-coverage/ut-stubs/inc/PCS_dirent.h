@@ -0,0 +1,48 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for dirent.h */
+#ifndef PCS_DIRENT_H
+#define PCS_DIRENT_H
+
+#include "PCS_basetypes.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in dirent.h */
+/* ----------------------------------------- */
+
+/* ----------------------------------------- */
+/* types normally defined in dirent.h */
+/* ----------------------------------------- */
+typedef struct PCS_DIR PCS_DIR;
+
+struct PCS_dirent
+{
+    char d_name[256];
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in dirent.h */
+/* ----------------------------------------- */
+
+extern int                PCS_closedir(PCS_DIR *dirp);
+extern PCS_DIR *          PCS_opendir(const char *name);
+extern struct PCS_dirent *PCS_readdir(PCS_DIR *dirp);
+extern void               PCS_rewinddir(PCS_DIR *dirp);
+
+#endif
@@ -66,6 +66,7 @@
 #define PCS_EROFS     0x1809
 #define PCS_EBADF     0x180b
 #define PCS_ENOENT    0x180c
+#define PCS_EPERM     0x180d
 
 /* ----------------------------------------- */
 /* types normally defined in errno.h */
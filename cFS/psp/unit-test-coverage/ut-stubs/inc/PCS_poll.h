@@ -0,0 +1,50 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for poll.h */
+#ifndef PCS_POLL_H
+#define PCS_POLL_H
+
+#include "PCS_basetypes.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in poll.h */
+/* ----------------------------------------- */
+
+#define PCS_POLLIN  0x1E01
+#define PCS_POLLOUT 0x1E02
+
+/* ----------------------------------------- */
+/* types normally defined in poll.h */
+/* ----------------------------------------- */
+typedef unsigned long PCS_nfds_t;
+
+struct PCS_pollfd
+{
+    int   fd;
+    short events;
+    short revents;
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in poll.h */
+/* ----------------------------------------- */
+
+extern int PCS_poll(struct PCS_pollfd *fds, PCS_nfds_t nfds, int timeout);
+
+#endif
@@ -0,0 +1,73 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for pthread.h */
+#ifndef PCS_PTHREAD_H
+#define PCS_PTHREAD_H
+
+#include "PCS_basetypes.h"
+#include "PCS_sched.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in pthread.h */
+/* ----------------------------------------- */
+
+#define PCS_PTHREAD_EXPLICIT_SCHED 0x2201
+
+/* ----------------------------------------- */
+/* types normally defined in pthread.h */
+/* ----------------------------------------- */
+typedef unsigned long PCS_pthread_t;
+
+typedef struct
+{
+    int flags;
+} PCS_pthread_attr_t;
+
+typedef struct
+{
+    int lock;
+} PCS_pthread_mutex_t;
+
+typedef struct
+{
+    int flags;
+} PCS_pthread_mutexattr_t;
+
+typedef void *(*PCS_pthread_start_routine_t)(void *);
+
+/* ----------------------------------------- */
+/* prototypes normally declared in pthread.h */
+/* ----------------------------------------- */
+
+extern int           PCS_pthread_attr_destroy(PCS_pthread_attr_t *attr);
+extern int           PCS_pthread_attr_init(PCS_pthread_attr_t *attr);
+extern int           PCS_pthread_attr_setinheritsched(PCS_pthread_attr_t *attr, int inheritsched);
+extern int           PCS_pthread_attr_setschedparam(PCS_pthread_attr_t *attr, const struct PCS_sched_param *param);
+extern int           PCS_pthread_attr_setschedpolicy(PCS_pthread_attr_t *attr, int policy);
+extern int           PCS_pthread_cancel(PCS_pthread_t thread);
+extern int           PCS_pthread_create(PCS_pthread_t *thread, const PCS_pthread_attr_t *attr,
+                                        PCS_pthread_start_routine_t start_routine, void *arg);
+extern int           PCS_pthread_equal(PCS_pthread_t t1, PCS_pthread_t t2);
+extern int           PCS_pthread_join(PCS_pthread_t thread, void **retval);
+extern int           PCS_pthread_mutex_init(PCS_pthread_mutex_t *mutex, const PCS_pthread_mutexattr_t *attr);
+extern int           PCS_pthread_mutex_lock(PCS_pthread_mutex_t *mutex);
+extern int           PCS_pthread_mutex_unlock(PCS_pthread_mutex_t *mutex);
+extern PCS_pthread_t PCS_pthread_self(void);
+
+#endif
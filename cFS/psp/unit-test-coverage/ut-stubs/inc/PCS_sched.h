@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for sched.h */
+#ifndef PCS_SCHED_H
+#define PCS_SCHED_H
+
+#include "PCS_basetypes.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in sched.h */
+/* ----------------------------------------- */
+
+#define PCS_SCHED_FIFO 0x2001
+
+/* ----------------------------------------- */
+/* types normally defined in sched.h */
+/* ----------------------------------------- */
+
+struct PCS_sched_param
+{
+    int sched_priority;
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in sched.h */
+/* ----------------------------------------- */
+
+extern int PCS_sched_get_priority_max(int policy);
+
+#endif
@@ -0,0 +1,86 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for signal.h */
+#ifndef PCS_SIGNAL_H
+#define PCS_SIGNAL_H
+
+#include "PCS_basetypes.h"
+#include "PCS_pthread.h"
+
+/* ----------------------------------------- */
+/* constants normally defined in signal.h */
+/* ----------------------------------------- */
+
+#define PCS_SIGINT  0x1F01
+#define PCS_SIGILL  0x1F02
+#define PCS_SIGFPE  0x1F03
+#define PCS_SIGBUS  0x1F04
+#define PCS_SIGSEGV 0x1F05
+#define PCS_SIGTERM 0x1F06
+#define PCS_SIGUSR1 0x1F07
+
+#define PCS_SIG_BLOCK  0x1F11
+#define PCS_SA_SIGINFO 0x1F21
+
+#define PCS_FPE_INTDIV 0x1F31
+#define PCS_FPE_INTOVF 0x1F32
+#define PCS_FPE_FLTDIV 0x1F33
+#define PCS_FPE_FLTOVF 0x1F34
+#define PCS_FPE_FLTUND 0x1F35
+#define PCS_FPE_FLTRES 0x1F36
+#define PCS_FPE_FLTINV 0x1F37
+#define PCS_FPE_FLTSUB 0x1F38
+
+/* ----------------------------------------- */
+/* types normally defined in signal.h */
+/* ----------------------------------------- */
+
+typedef struct
+{
+    unsigned long bits;
+} PCS_sigset_t;
+
+typedef struct
+{
+    int   si_signo;
+    int   si_code;
+    void *si_addr;
+} PCS_siginfo_t;
+
+struct PCS_sigaction
+{
+    void (*sa_sigaction)(int, PCS_siginfo_t *, void *);
+    PCS_sigset_t sa_mask;
+    int          sa_flags;
+};
+
+/* ----------------------------------------- */
+/* prototypes normally declared in signal.h */
+/* ----------------------------------------- */
+
+extern int PCS_pthread_kill(PCS_pthread_t thread, int sig);
+extern int PCS_pthread_sigmask(int how, const PCS_sigset_t *set, PCS_sigset_t *oldset);
+extern int PCS_sigaction(int signum, const struct PCS_sigaction *act, struct PCS_sigaction *oldact);
+extern int PCS_sigaddset(PCS_sigset_t *set, int signum);
+extern int PCS_sigdelset(PCS_sigset_t *set, int signum);
+extern int PCS_sigfillset(PCS_sigset_t *set);
+extern int PCS_sigismember(const PCS_sigset_t *set, int signum);
+extern int PCS_sigsuspend(const PCS_sigset_t *mask);
+
+#endif
@@ -34,6 +34,8 @@
 #define PCS_MAP_SHARED  0x1D25
 #define PCS_MAP_PRIVATE 0x1D26
 #define PCS_MAP_FIXED   0x1D27
+#define PCS_MS_ASYNC    0x1D28
+#define PCS_MS_SYNC     0x1D29
 
 /* ----------------------------------------- */
 /* types normally defined in sys/mman.h */
@@ -44,5 +46,6 @@
 /* ----------------------------------------- */
 
 extern void *PCS_mmap(void *addr, size_t len, int prot, int flags, int fildes, PCS_off_t off);
+extern int   PCS_msync(void *addr, size_t len, int flags);
 
 #endif
@@ -33,6 +33,7 @@
 #define PCS_STDIN_FILENO  0x1C04
 #define PCS_STDOUT_FILENO 0x1C05
 #define PCS_STDERR_FILENO 0x1C06
+#define PCS_SC_PAGESIZE   0x1C07
 
 /* ----------------------------------------- */
 /* types normally defined in unistd.h */
@@ -50,6 +51,7 @@ extern long int    PCS_gethostid(void);
 extern int         PCS_gethostname(char *name, size_t len);
 extern PCS_pid_t   PCS_getpid(void);
 extern PCS_off_t   PCS_lseek(int fd, PCS_off_t offset, int whence);
+extern PCS_ssize_t PCS_pread(int fd, void *buf, size_t nbytes, PCS_off_t offset);
 extern PCS_ssize_t PCS_read(int fd, void *buf, size_t nbytes);
 extern int         PCS_rmdir(const char *path);
 extern long int    PCS_sysconf(int name);
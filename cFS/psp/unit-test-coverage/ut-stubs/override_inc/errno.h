@@ -65,6 +65,7 @@
 #define EROFS     PCS_EROFS
 #define EBADF     PCS_EBADF
 #define ENOENT    PCS_ENOENT
+#define EPERM     PCS_EPERM
 
 #define errno PCS_errno
 
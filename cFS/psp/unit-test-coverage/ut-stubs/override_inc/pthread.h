@@ -0,0 +1,51 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for pthread.h */
+#ifndef OVERRIDE_PTHREAD_H
+#define OVERRIDE_PTHREAD_H
+
+#include "PCS_pthread.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in pthread.h */
+/* ----------------------------------------- */
+
+#define PTHREAD_EXPLICIT_SCHED PCS_PTHREAD_EXPLICIT_SCHED
+
+#define pthread_t      PCS_pthread_t
+#define pthread_attr_t PCS_pthread_attr_t
+
+#define pthread_mutex_t     PCS_pthread_mutex_t
+#define pthread_mutexattr_t PCS_pthread_mutexattr_t
+
+#define pthread_attr_destroy         PCS_pthread_attr_destroy
+#define pthread_attr_init            PCS_pthread_attr_init
+#define pthread_attr_setinheritsched PCS_pthread_attr_setinheritsched
+#define pthread_attr_setschedparam   PCS_pthread_attr_setschedparam
+#define pthread_attr_setschedpolicy  PCS_pthread_attr_setschedpolicy
+#define pthread_cancel               PCS_pthread_cancel
+#define pthread_create               PCS_pthread_create
+#define pthread_equal                PCS_pthread_equal
+#define pthread_join                 PCS_pthread_join
+#define pthread_mutex_init           PCS_pthread_mutex_init
+#define pthread_mutex_lock           PCS_pthread_mutex_lock
+#define pthread_mutex_unlock         PCS_pthread_mutex_unlock
+#define pthread_self                 PCS_pthread_self
+
+#endif
@@ -0,0 +1,36 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for semaphore.h */
+#ifndef OVERRIDE_SEMAPHORE_H
+#define OVERRIDE_SEMAPHORE_H
+
+#include "PCS_semaphore.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in semaphore.h */
+/* ----------------------------------------- */
+
+#define sem_t PCS_sem_t
+
+#define sem_destroy PCS_sem_destroy
+#define sem_init    PCS_sem_init
+#define sem_post    PCS_sem_post
+#define sem_wait    PCS_sem_wait
+
+#endif
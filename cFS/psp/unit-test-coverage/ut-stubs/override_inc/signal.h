@@ -0,0 +1,61 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for signal.h */
+#ifndef OVERRIDE_SIGNAL_H
+#define OVERRIDE_SIGNAL_H
+
+#include "PCS_signal.h"
+
+/* ----------------------------------------- */
+/* mappings for declarations in signal.h */
+/* ----------------------------------------- */
+
+#define SIGINT  PCS_SIGINT
+#define SIGILL  PCS_SIGILL
+#define SIGFPE  PCS_SIGFPE
+#define SIGBUS  PCS_SIGBUS
+#define SIGSEGV PCS_SIGSEGV
+#define SIGTERM PCS_SIGTERM
+#define SIGUSR1 PCS_SIGUSR1
+
+#define SIG_BLOCK  PCS_SIG_BLOCK
+#define SA_SIGINFO PCS_SA_SIGINFO
+
+#define FPE_INTDIV PCS_FPE_INTDIV
+#define FPE_INTOVF PCS_FPE_INTOVF
+#define FPE_FLTDIV PCS_FPE_FLTDIV
+#define FPE_FLTOVF PCS_FPE_FLTOVF
+#define FPE_FLTUND PCS_FPE_FLTUND
+#define FPE_FLTRES PCS_FPE_FLTRES
+#define FPE_FLTINV PCS_FPE_FLTINV
+#define FPE_FLTSUB PCS_FPE_FLTSUB
+
+#define sigset_t  PCS_sigset_t
+#define siginfo_t PCS_siginfo_t
+
+#define pthread_kill    PCS_pthread_kill
+#define pthread_sigmask PCS_pthread_sigmask
+#define sigaction       PCS_sigaction
+#define sigaddset       PCS_sigaddset
+#define sigdelset       PCS_sigdelset
+#define sigfillset      PCS_sigfillset
+#define sigismember     PCS_sigismember
+#define sigsuspend      PCS_sigsuspend
+
+#endif
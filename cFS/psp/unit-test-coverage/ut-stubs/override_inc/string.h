@@ -27,6 +27,7 @@
 /* ----------------------------------------- */
 #define memcmp   PCS_memcmp
 #define memcpy   PCS_memcpy
+#define memmove  PCS_memmove
 #define memset   PCS_memset
 #define memchr   PCS_memchr
 #define strcmp   PCS_strcmp
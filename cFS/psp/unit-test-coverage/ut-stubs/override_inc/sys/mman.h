@@ -33,8 +33,11 @@
 #define MAP_SHARED  PCS_MAP_SHARED
 #define MAP_PRIVATE PCS_MAP_PRIVATE
 #define MAP_FIXED   PCS_MAP_FIXED
+#define MS_ASYNC    PCS_MS_ASYNC
+#define MS_SYNC     PCS_MS_SYNC
 
 #define off_t PCS_off_t
 #define mmap  PCS_mmap
+#define msync PCS_msync
 
 #endif
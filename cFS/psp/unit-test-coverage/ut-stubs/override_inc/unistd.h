@@ -32,6 +32,7 @@
 #define STDIN_FILENO  PCS_STDIN_FILENO
 #define STDOUT_FILENO PCS_STDOUT_FILENO
 #define STDERR_FILENO PCS_STDERR_FILENO
+#define _SC_PAGESIZE  PCS_SC_PAGESIZE
 
 #define close       PCS_close
 #define ftruncate   PCS_ftruncate
@@ -41,6 +42,7 @@
 #define gethostname PCS_gethostname
 #define getpid      PCS_getpid
 #define lseek       PCS_lseek
+#define pread       PCS_pread
 #define read        PCS_read
 #define rmdir       PCS_rmdir
 #define sysconf     PCS_sysconf
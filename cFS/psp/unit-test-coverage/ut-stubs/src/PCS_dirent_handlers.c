@@ -0,0 +1,46 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/* PSP coverage stub replacement for dirent.h */
+#include "utstubs.h"
+
+#include "PCS_dirent.h"
+
+struct PCS_DIR
+{
+    int d;
+};
+
+void UT_DefaultHandler_PCS_opendir(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* PCS_DIR *PCS_opendir(const char *name) */
+    PCS_DIR *      retval;
+    static PCS_DIR OPENDIR_DP = {0};
+
+    if (UT_Stub_GetInt32StatusCode(Context, NULL))
+    {
+        /* any status code means failure, which is always a NULL directory */
+        retval = NULL;
+    }
+    else
+    {
+        retval = &OPENDIR_DP;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, retval);
+}
@@ -0,0 +1,88 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_dirent header
+ */
+
+#include "PCS_dirent.h"
+#include "utgenstub.h"
+
+void UT_DefaultHandler_PCS_opendir(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_closedir()
+ * ----------------------------------------------------
+ */
+int PCS_closedir(PCS_DIR *dirp)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_closedir, int);
+
+    UT_GenStub_AddParam(PCS_closedir, PCS_DIR *, dirp);
+
+    UT_GenStub_Execute(PCS_closedir, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_closedir, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_opendir()
+ * ----------------------------------------------------
+ */
+PCS_DIR *PCS_opendir(const char *name)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_opendir, PCS_DIR *);
+
+    UT_GenStub_AddParam(PCS_opendir, const char *, name);
+
+    UT_GenStub_Execute(PCS_opendir, Basic, UT_DefaultHandler_PCS_opendir);
+
+    return UT_GenStub_GetReturnValue(PCS_opendir, PCS_DIR *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_readdir()
+ * ----------------------------------------------------
+ */
+struct PCS_dirent *PCS_readdir(PCS_DIR *dirp)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_readdir, struct PCS_dirent *);
+
+    UT_GenStub_AddParam(PCS_readdir, PCS_DIR *, dirp);
+
+    UT_GenStub_Execute(PCS_readdir, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_readdir, struct PCS_dirent *);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_rewinddir()
+ * ----------------------------------------------------
+ */
+void PCS_rewinddir(PCS_DIR *dirp)
+{
+    UT_GenStub_AddParam(PCS_rewinddir, PCS_DIR *, dirp);
+
+    UT_GenStub_Execute(PCS_rewinddir, Basic, NULL);
+}
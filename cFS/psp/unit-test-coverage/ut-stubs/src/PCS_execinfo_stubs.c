@@ -0,0 +1,60 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_execinfo header
+ */
+
+#include "PCS_execinfo.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_backtrace()
+ * ----------------------------------------------------
+ */
+int PCS_backtrace(void **buffer, int size)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_backtrace, int);
+
+    UT_GenStub_AddParam(PCS_backtrace, void **, buffer);
+    UT_GenStub_AddParam(PCS_backtrace, int, size);
+
+    UT_GenStub_Execute(PCS_backtrace, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_backtrace, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_backtrace_symbols()
+ * ----------------------------------------------------
+ */
+char **PCS_backtrace_symbols(void *const *buffer, int size)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_backtrace_symbols, char **);
+
+    UT_GenStub_AddParam(PCS_backtrace_symbols, void *const *, buffer);
+    UT_GenStub_AddParam(PCS_backtrace_symbols, int, size);
+
+    UT_GenStub_Execute(PCS_backtrace_symbols, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_backtrace_symbols, char **);
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_poll header
+ */
+
+#include "PCS_poll.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_poll()
+ * ----------------------------------------------------
+ */
+int PCS_poll(struct PCS_pollfd *fds, PCS_nfds_t nfds, int timeout)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_poll, int);
+
+    UT_GenStub_AddParam(PCS_poll, struct PCS_pollfd *, fds);
+    UT_GenStub_AddParam(PCS_poll, PCS_nfds_t, nfds);
+    UT_GenStub_AddParam(PCS_poll, int, timeout);
+
+    UT_GenStub_Execute(PCS_poll, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_poll, int);
+}
@@ -0,0 +1,242 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_pthread header
+ */
+
+#include "PCS_pthread.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_attr_destroy()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_attr_destroy(PCS_pthread_attr_t *attr)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_attr_destroy, int);
+
+    UT_GenStub_AddParam(PCS_pthread_attr_destroy, PCS_pthread_attr_t *, attr);
+
+    UT_GenStub_Execute(PCS_pthread_attr_destroy, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_attr_destroy, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_attr_init()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_attr_init(PCS_pthread_attr_t *attr)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_attr_init, int);
+
+    UT_GenStub_AddParam(PCS_pthread_attr_init, PCS_pthread_attr_t *, attr);
+
+    UT_GenStub_Execute(PCS_pthread_attr_init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_attr_init, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_attr_setinheritsched()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_attr_setinheritsched(PCS_pthread_attr_t *attr, int inheritsched)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_attr_setinheritsched, int);
+
+    UT_GenStub_AddParam(PCS_pthread_attr_setinheritsched, PCS_pthread_attr_t *, attr);
+    UT_GenStub_AddParam(PCS_pthread_attr_setinheritsched, int, inheritsched);
+
+    UT_GenStub_Execute(PCS_pthread_attr_setinheritsched, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_attr_setinheritsched, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_attr_setschedparam()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_attr_setschedparam(PCS_pthread_attr_t *attr, const struct PCS_sched_param *param)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_attr_setschedparam, int);
+
+    UT_GenStub_AddParam(PCS_pthread_attr_setschedparam, PCS_pthread_attr_t *, attr);
+    UT_GenStub_AddParam(PCS_pthread_attr_setschedparam, const struct PCS_sched_param *, param);
+
+    UT_GenStub_Execute(PCS_pthread_attr_setschedparam, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_attr_setschedparam, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_attr_setschedpolicy()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_attr_setschedpolicy(PCS_pthread_attr_t *attr, int policy)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_attr_setschedpolicy, int);
+
+    UT_GenStub_AddParam(PCS_pthread_attr_setschedpolicy, PCS_pthread_attr_t *, attr);
+    UT_GenStub_AddParam(PCS_pthread_attr_setschedpolicy, int, policy);
+
+    UT_GenStub_Execute(PCS_pthread_attr_setschedpolicy, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_attr_setschedpolicy, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_cancel()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_cancel(PCS_pthread_t thread)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_cancel, int);
+
+    UT_GenStub_AddParam(PCS_pthread_cancel, PCS_pthread_t, thread);
+
+    UT_GenStub_Execute(PCS_pthread_cancel, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_cancel, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_create()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_create(PCS_pthread_t *thread, const PCS_pthread_attr_t *attr,
+                       PCS_pthread_start_routine_t start_routine, void *arg)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_create, int);
+
+    UT_GenStub_AddParam(PCS_pthread_create, PCS_pthread_t *, thread);
+    UT_GenStub_AddParam(PCS_pthread_create, const PCS_pthread_attr_t *, attr);
+    UT_GenStub_AddParam(PCS_pthread_create, PCS_pthread_start_routine_t, start_routine);
+    UT_GenStub_AddParam(PCS_pthread_create, void *, arg);
+
+    UT_GenStub_Execute(PCS_pthread_create, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_create, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_equal()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_equal(PCS_pthread_t t1, PCS_pthread_t t2)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_equal, int);
+
+    UT_GenStub_AddParam(PCS_pthread_equal, PCS_pthread_t, t1);
+    UT_GenStub_AddParam(PCS_pthread_equal, PCS_pthread_t, t2);
+
+    UT_GenStub_Execute(PCS_pthread_equal, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_equal, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_join()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_join(PCS_pthread_t thread, void **retval)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_join, int);
+
+    UT_GenStub_AddParam(PCS_pthread_join, PCS_pthread_t, thread);
+    UT_GenStub_AddParam(PCS_pthread_join, void **, retval);
+
+    UT_GenStub_Execute(PCS_pthread_join, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_join, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_mutex_init()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_mutex_init(PCS_pthread_mutex_t *mutex, const PCS_pthread_mutexattr_t *attr)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_mutex_init, int);
+
+    UT_GenStub_AddParam(PCS_pthread_mutex_init, PCS_pthread_mutex_t *, mutex);
+    UT_GenStub_AddParam(PCS_pthread_mutex_init, const PCS_pthread_mutexattr_t *, attr);
+
+    UT_GenStub_Execute(PCS_pthread_mutex_init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_mutex_init, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_mutex_lock()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_mutex_lock(PCS_pthread_mutex_t *mutex)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_mutex_lock, int);
+
+    UT_GenStub_AddParam(PCS_pthread_mutex_lock, PCS_pthread_mutex_t *, mutex);
+
+    UT_GenStub_Execute(PCS_pthread_mutex_lock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_mutex_lock, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_mutex_unlock()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_mutex_unlock(PCS_pthread_mutex_t *mutex)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_mutex_unlock, int);
+
+    UT_GenStub_AddParam(PCS_pthread_mutex_unlock, PCS_pthread_mutex_t *, mutex);
+
+    UT_GenStub_Execute(PCS_pthread_mutex_unlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_mutex_unlock, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_self()
+ * ----------------------------------------------------
+ */
+PCS_pthread_t PCS_pthread_self(void)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_self, PCS_pthread_t);
+
+    UT_GenStub_Execute(PCS_pthread_self, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_self, PCS_pthread_t);
+}
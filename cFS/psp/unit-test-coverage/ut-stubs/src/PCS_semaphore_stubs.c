@@ -0,0 +1,92 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_semaphore header
+ */
+
+#include "PCS_semaphore.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sem_destroy()
+ * ----------------------------------------------------
+ */
+int PCS_sem_destroy(PCS_sem_t *sem)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sem_destroy, int);
+
+    UT_GenStub_AddParam(PCS_sem_destroy, PCS_sem_t *, sem);
+
+    UT_GenStub_Execute(PCS_sem_destroy, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sem_destroy, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sem_init()
+ * ----------------------------------------------------
+ */
+int PCS_sem_init(PCS_sem_t *sem, int pshared, unsigned int value)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sem_init, int);
+
+    UT_GenStub_AddParam(PCS_sem_init, PCS_sem_t *, sem);
+    UT_GenStub_AddParam(PCS_sem_init, int, pshared);
+    UT_GenStub_AddParam(PCS_sem_init, unsigned int, value);
+
+    UT_GenStub_Execute(PCS_sem_init, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sem_init, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sem_post()
+ * ----------------------------------------------------
+ */
+int PCS_sem_post(PCS_sem_t *sem)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sem_post, int);
+
+    UT_GenStub_AddParam(PCS_sem_post, PCS_sem_t *, sem);
+
+    UT_GenStub_Execute(PCS_sem_post, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sem_post, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sem_wait()
+ * ----------------------------------------------------
+ */
+int PCS_sem_wait(PCS_sem_t *sem)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sem_wait, int);
+
+    UT_GenStub_AddParam(PCS_sem_wait, PCS_sem_t *, sem);
+
+    UT_GenStub_Execute(PCS_sem_wait, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sem_wait, int);
+}
@@ -0,0 +1,162 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in PCS_signal header
+ */
+
+#include "PCS_signal.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_kill()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_kill(PCS_pthread_t thread, int sig)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_kill, int);
+
+    UT_GenStub_AddParam(PCS_pthread_kill, PCS_pthread_t, thread);
+    UT_GenStub_AddParam(PCS_pthread_kill, int, sig);
+
+    UT_GenStub_Execute(PCS_pthread_kill, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_kill, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pthread_sigmask()
+ * ----------------------------------------------------
+ */
+int PCS_pthread_sigmask(int how, const PCS_sigset_t *set, PCS_sigset_t *oldset)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pthread_sigmask, int);
+
+    UT_GenStub_AddParam(PCS_pthread_sigmask, int, how);
+    UT_GenStub_AddParam(PCS_pthread_sigmask, const PCS_sigset_t *, set);
+    UT_GenStub_AddParam(PCS_pthread_sigmask, PCS_sigset_t *, oldset);
+
+    UT_GenStub_Execute(PCS_pthread_sigmask, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_pthread_sigmask, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigaction()
+ * ----------------------------------------------------
+ */
+int PCS_sigaction(int signum, const struct PCS_sigaction *act, struct PCS_sigaction *oldact)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigaction, int);
+
+    UT_GenStub_AddParam(PCS_sigaction, int, signum);
+    UT_GenStub_AddParam(PCS_sigaction, const struct PCS_sigaction *, act);
+    UT_GenStub_AddParam(PCS_sigaction, struct PCS_sigaction *, oldact);
+
+    UT_GenStub_Execute(PCS_sigaction, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigaction, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigaddset()
+ * ----------------------------------------------------
+ */
+int PCS_sigaddset(PCS_sigset_t *set, int signum)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigaddset, int);
+
+    UT_GenStub_AddParam(PCS_sigaddset, PCS_sigset_t *, set);
+    UT_GenStub_AddParam(PCS_sigaddset, int, signum);
+
+    UT_GenStub_Execute(PCS_sigaddset, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigaddset, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigdelset()
+ * ----------------------------------------------------
+ */
+int PCS_sigdelset(PCS_sigset_t *set, int signum)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigdelset, int);
+
+    UT_GenStub_AddParam(PCS_sigdelset, PCS_sigset_t *, set);
+    UT_GenStub_AddParam(PCS_sigdelset, int, signum);
+
+    UT_GenStub_Execute(PCS_sigdelset, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigdelset, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigfillset()
+ * ----------------------------------------------------
+ */
+int PCS_sigfillset(PCS_sigset_t *set)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigfillset, int);
+
+    UT_GenStub_AddParam(PCS_sigfillset, PCS_sigset_t *, set);
+
+    UT_GenStub_Execute(PCS_sigfillset, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigfillset, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigismember()
+ * ----------------------------------------------------
+ */
+int PCS_sigismember(const PCS_sigset_t *set, int signum)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigismember, int);
+
+    UT_GenStub_AddParam(PCS_sigismember, const PCS_sigset_t *, set);
+    UT_GenStub_AddParam(PCS_sigismember, int, signum);
+
+    UT_GenStub_Execute(PCS_sigismember, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigismember, int);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_sigsuspend()
+ * ----------------------------------------------------
+ */
+int PCS_sigsuspend(const PCS_sigset_t *mask)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_sigsuspend, int);
+
+    UT_GenStub_AddParam(PCS_sigsuspend, const PCS_sigset_t *, mask);
+
+    UT_GenStub_Execute(PCS_sigsuspend, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_sigsuspend, int);
+}
@@ -66,6 +66,23 @@ void UT_DefaultHandler_PCS_memcpy(void *UserObj, UT_EntryKey_t FuncKey, const UT
     }
 }
 
+void UT_DefaultHandler_PCS_memmove(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* void *PCS_memmove(void *dest, const void *src, size_t n) */
+    void *      dest = UT_Hook_GetArgValueByName(Context, "dest", void *);
+    const void *src  = UT_Hook_GetArgValueByName(Context, "src", const void *);
+    size_t      n    = UT_Hook_GetArgValueByName(Context, "n", size_t);
+
+    void *Result;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, NULL))
+    {
+        /* Perform the real operation */
+        Result = memmove(dest, src, n);
+        UT_Stub_SetReturnValue(FuncKey, Result);
+    }
+}
+
 void UT_DefaultHandler_PCS_memchr(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     /* void * PCS_memchr(const void *s, int c, size_t n) */
@@ -85,8 +102,8 @@ void UT_DefaultHandler_PCS_memchr(void *UserObj, UT_EntryKey_t FuncKey, const UT
 
 void UT_DefaultHandler_PCS_memcmp(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
-    /* int PCS_memcmp(void *dest, const void *src, size_t n) */
-    void *      dest = UT_Hook_GetArgValueByName(Context, "dest", void *);
+    /* int PCS_memcmp(const void *dest, const void *src, size_t n) */
+    const void *dest = UT_Hook_GetArgValueByName(Context, "dest", const void *);
     const void *src  = UT_Hook_GetArgValueByName(Context, "src", const void *);
     size_t      n    = UT_Hook_GetArgValueByName(Context, "n", size_t);
 
@@ -28,6 +28,7 @@
 void UT_DefaultHandler_PCS_memchr(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_memcmp(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_memcpy(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_PCS_memmove(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_memset(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_strcat(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_strchr(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -63,11 +64,11 @@ void *PCS_memchr(const void *s, int c, size_t n)
  * Generated stub function for PCS_memcmp()
  * ----------------------------------------------------
  */
-int PCS_memcmp(void *dest, const void *src, size_t n)
+int PCS_memcmp(const void *dest, const void *src, size_t n)
 {
     UT_GenStub_SetupReturnBuffer(PCS_memcmp, int);
 
-    UT_GenStub_AddParam(PCS_memcmp, void *, dest);
+    UT_GenStub_AddParam(PCS_memcmp, const void *, dest);
     UT_GenStub_AddParam(PCS_memcmp, const void *, src);
     UT_GenStub_AddParam(PCS_memcmp, size_t, n);
 
@@ -94,6 +95,24 @@ void *PCS_memcpy(void *dest, const void *src, size_t n)
     return UT_GenStub_GetReturnValue(PCS_memcpy, void *);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_memmove()
+ * ----------------------------------------------------
+ */
+void *PCS_memmove(void *dest, const void *src, size_t n)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_memmove, void *);
+
+    UT_GenStub_AddParam(PCS_memmove, void *, dest);
+    UT_GenStub_AddParam(PCS_memmove, const void *, src);
+    UT_GenStub_AddParam(PCS_memmove, size_t, n);
+
+    UT_GenStub_Execute(PCS_memmove, Basic, UT_DefaultHandler_PCS_memmove);
+
+    return UT_GenStub_GetReturnValue(PCS_memmove, void *);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for PCS_memset()
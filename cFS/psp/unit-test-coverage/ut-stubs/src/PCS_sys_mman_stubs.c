@@ -45,3 +45,21 @@ void *PCS_mmap(void *addr, size_t len, int prot, int flags, int fildes, PCS_off_
 
     return UT_GenStub_GetReturnValue(PCS_mmap, void *);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_msync()
+ * ----------------------------------------------------
+ */
+int PCS_msync(void *addr, size_t len, int flags)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_msync, int);
+
+    UT_GenStub_AddParam(PCS_msync, void *, addr);
+    UT_GenStub_AddParam(PCS_msync, size_t, len);
+    UT_GenStub_AddParam(PCS_msync, int, flags);
+
+    UT_GenStub_Execute(PCS_msync, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(PCS_msync, int);
+}
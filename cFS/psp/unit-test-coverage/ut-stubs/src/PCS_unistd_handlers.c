@@ -113,6 +113,40 @@ void UT_DefaultHandler_PCS_read(void *UserObj, UT_EntryKey_t FuncKey, const UT_S
     }
 }
 
+/*
+ * Unlike read() this does not make up data, so the end of the data buffer reads as EOF.
+ * A positive status code limits the size of a single read, to simulate short reads.
+ */
+void UT_DefaultHandler_PCS_pread(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* PCS_ssize_t PCS_pread(int fd, void *buf, size_t nbytes, PCS_off_t offset) */
+    void *      buf    = UT_Hook_GetArgValueByName(Context, "buf", void *);
+    size_t      nbytes = UT_Hook_GetArgValueByName(Context, "nbytes", size_t);
+    int32       Status;
+    size_t      CopySize;
+    PCS_ssize_t retval;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &Status))
+    {
+        Status = PCS_MAX_RDWR_SIZE;
+    }
+
+    if (Status > 0)
+    {
+        if (Status > nbytes)
+        {
+            CopySize = nbytes;
+        }
+        else
+        {
+            CopySize = Status;
+        }
+
+        retval = UT_Stub_CopyToLocal(FuncKey, buf, CopySize);
+        UT_Stub_SetReturnValue(FuncKey, retval);
+    }
+}
+
 void UT_DefaultHandler_PCS_write(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
 {
     /* PCS_ssize_t PCS_write(int fd, const void *buf, size_t nbytes) */
@@ -26,6 +26,7 @@
 #include "utgenstub.h"
 
 void UT_DefaultHandler_PCS_gethostname(void *, UT_EntryKey_t, const UT_StubContext_t *);
+void UT_DefaultHandler_PCS_pread(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_read(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_PCS_write(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
@@ -153,6 +154,25 @@ PCS_off_t PCS_lseek(int fd, PCS_off_t offset, int whence)
     return UT_GenStub_GetReturnValue(PCS_lseek, PCS_off_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for PCS_pread()
+ * ----------------------------------------------------
+ */
+PCS_ssize_t PCS_pread(int fd, void *buf, size_t nbytes, PCS_off_t offset)
+{
+    UT_GenStub_SetupReturnBuffer(PCS_pread, PCS_ssize_t);
+
+    UT_GenStub_AddParam(PCS_pread, int, fd);
+    UT_GenStub_AddParam(PCS_pread, void *, buf);
+    UT_GenStub_AddParam(PCS_pread, size_t, nbytes);
+    UT_GenStub_AddParam(PCS_pread, PCS_off_t, offset);
+
+    UT_GenStub_Execute(PCS_pread, Basic, UT_DefaultHandler_PCS_pread);
+
+    return UT_GenStub_GetReturnValue(PCS_pread, PCS_ssize_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for PCS_read()
@@ -150,3 +150,40 @@ void UT_DefaultHandler_CFE_PSP_GetCDSSize(void *UserObj, UT_EntryKey_t FuncKey,
         *SizeOfCDS = TempSize;
     }
 }
+
+/*****************************************************************************/
+/**
+** \brief CFE_PSP_GetCDSArea stub function
+**
+** \par Description
+**        This function is used to mimic the response of the PSP function
+**        CFE_PSP_GetCDSArea.  The area is the data buffer registered for
+**        this function, or NULL/0 if none is registered.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        Returns either OS_SUCCESS or OS_ERROR.
+**
+******************************************************************************/
+void UT_DefaultHandler_CFE_PSP_GetCDSArea(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS) */
+    cpuaddr *PtrToCDS  = UT_Hook_GetArgValueByName(Context, "PtrToCDS", cpuaddr *);
+    uint32 * SizeOfCDS = UT_Hook_GetArgValueByName(Context, "SizeOfCDS", uint32 *);
+
+    int32  status;
+    size_t TempSize;
+    void * TempAddr;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status >= 0)
+    {
+        UT_GetDataBuffer(UT_KEY(CFE_PSP_GetCDSArea), &TempAddr, &TempSize, NULL);
+
+        *PtrToCDS  = (cpuaddr)TempAddr;
+        *SizeOfCDS = TempSize;
+    }
+}
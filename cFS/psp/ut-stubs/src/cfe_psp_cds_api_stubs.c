@@ -25,10 +25,28 @@
 #include "cfe_psp_cds_api.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_PSP_GetCDSArea(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_GetCDSSize(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_ReadFromCDS(void *, UT_EntryKey_t, const UT_StubContext_t *);
 void UT_DefaultHandler_CFE_PSP_WriteToCDS(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_GetCDSArea()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_GetCDSArea(cpuaddr *PtrToCDS, uint32 *SizeOfCDS)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_GetCDSArea, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_GetCDSArea, cpuaddr *, PtrToCDS);
+    UT_GenStub_AddParam(CFE_PSP_GetCDSArea, uint32 *, SizeOfCDS);
+
+    UT_GenStub_Execute(CFE_PSP_GetCDSArea, Basic, UT_DefaultHandler_CFE_PSP_GetCDSArea);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_GetCDSArea, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_GetCDSSize()
@@ -108,6 +108,24 @@ int32 CFE_PSP_EepromWrite8(cpuaddr MemoryAddress, uint8 ByteValue)
     return UT_GenStub_GetReturnValue(CFE_PSP_EepromWrite8, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_EepromWriteBlock()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_EepromWriteBlock(cpuaddr MemoryAddress, const void *DataPtr, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_EepromWriteBlock, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_EepromWriteBlock, cpuaddr, MemoryAddress);
+    UT_GenStub_AddParam(CFE_PSP_EepromWriteBlock, const void *, DataPtr);
+    UT_GenStub_AddParam(CFE_PSP_EepromWriteBlock, size_t, Size);
+
+    UT_GenStub_Execute(CFE_PSP_EepromWriteBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_EepromWriteBlock, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_EepromWriteDisable()
@@ -173,6 +173,24 @@ uint32 CFE_PSP_MemRanges(void)
     return UT_GenStub_GetReturnValue(CFE_PSP_MemRanges, uint32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_MemReadBlock()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_MemReadBlock(cpuaddr SrcAddress, void *DestBuffer, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_MemReadBlock, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_MemReadBlock, cpuaddr, SrcAddress);
+    UT_GenStub_AddParam(CFE_PSP_MemReadBlock, void *, DestBuffer);
+    UT_GenStub_AddParam(CFE_PSP_MemReadBlock, size_t, Size);
+
+    UT_GenStub_Execute(CFE_PSP_MemReadBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_MemReadBlock, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_MemValidateRange()
@@ -190,3 +208,21 @@ int32 CFE_PSP_MemValidateRange(cpuaddr Address, size_t Size, uint32 MemoryType)
 
     return UT_GenStub_GetReturnValue(CFE_PSP_MemValidateRange, int32);
 }
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_PSP_MemWriteBlock()
+ * ----------------------------------------------------
+ */
+int32 CFE_PSP_MemWriteBlock(cpuaddr DestAddress, const void *SrcBuffer, size_t Size)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_PSP_MemWriteBlock, int32);
+
+    UT_GenStub_AddParam(CFE_PSP_MemWriteBlock, cpuaddr, DestAddress);
+    UT_GenStub_AddParam(CFE_PSP_MemWriteBlock, const void *, SrcBuffer);
+    UT_GenStub_AddParam(CFE_PSP_MemWriteBlock, size_t, Size);
+
+    UT_GenStub_Execute(CFE_PSP_MemWriteBlock, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_PSP_MemWriteBlock, int32);
+}
@@ -0,0 +1,56 @@
+/************************************************************************
+ * NASA Docket No. GSC-19,200-1, and identified as "cFS Draco"
+ *
+ * Copyright (c) 2023 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/*
+** File: cfe_psp_module_handlers.c
+**
+** Purpose:
+** Unit test stubs for PSP module routines
+**
+** Notes:
+** Minimal work is done, only what is required for unit testing
+**
+*/
+
+/*
+** Includes
+*/
+
+#include "cfe_psp_module.h"
+#include "utstubs.h"
+
+void UT_DefaultHandler_CFE_PSP_Module_GetAPIEntry(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    /* int32 CFE_PSP_Module_GetAPIEntry(uint32 PspModuleId, CFE_PSP_ModuleApi_t **API) */
+    static CFE_PSP_ModuleApi_t default_api = {0};
+    CFE_PSP_ModuleApi_t **     API         = UT_Hook_GetArgValueByName(Context, "API", CFE_PSP_ModuleApi_t **);
+
+    int32 status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    /* The real function always outputs an API on success, this one is not of any module type */
+    if (status >= 0)
+    {
+        *API = &default_api;
+    }
+    else
+    {
+        *API = NULL;
+    }
+}
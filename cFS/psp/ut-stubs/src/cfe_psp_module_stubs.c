@@ -25,6 +25,8 @@
 #include "cfe_psp_module.h"
 #include "utgenstub.h"
 
+void UT_DefaultHandler_CFE_PSP_Module_GetAPIEntry(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_PSP_ModuleInit()
@@ -65,7 +67,7 @@ int32 CFE_PSP_Module_GetAPIEntry(uint32 PspModuleId, CFE_PSP_ModuleApi_t **API)
     UT_GenStub_AddParam(CFE_PSP_Module_GetAPIEntry, uint32, PspModuleId);
     UT_GenStub_AddParam(CFE_PSP_Module_GetAPIEntry, CFE_PSP_ModuleApi_t **, API);
 
-    UT_GenStub_Execute(CFE_PSP_Module_GetAPIEntry, Basic, NULL);
+    UT_GenStub_Execute(CFE_PSP_Module_GetAPIEntry, Basic, UT_DefaultHandler_CFE_PSP_Module_GetAPIEntry);
 
     return UT_GenStub_GetReturnValue(CFE_PSP_Module_GetAPIEntry, int32);
 }
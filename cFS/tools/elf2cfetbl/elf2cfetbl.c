@@ -31,6 +31,9 @@
 #include <ctype.h>
 #include <time.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <limits.h>
 #include "ELF_Structures.h"
 #include "cfe_tbl_filedef.h"
@@ -80,6 +83,12 @@ int32 OutputDataToTargetFile(void);
 void  OutputVersionInfo(void);
 void  OutputHelpInfo(void);
 int32 LocateAndReadUserObject(void);
+int32 ReadSrcFileData(uint64 Offset, void *Dest, size_t Size);
+int32 ReadSrcFileString(uint64 Offset, char *Dest, size_t MaxLen);
+int32 BuildSymbolHashIndex(void);
+int32 FindSymbolByName(const char *Name);
+int32 ConvertSrcFile(void);
+int32 ProcessBatch(void);
 
 void PrintSymbol32(union Elf_Sym *Symbol);
 void PrintSymbol64(union Elf_Sym *Symbol);
@@ -118,6 +127,16 @@ bool TableDataIsAllZeros = false;
 FILE *SrcFileDesc = NULL;
 FILE *DstFileDesc = NULL;
 
+/* Read-only mapping of the entire source file, NULL if the file could not be mapped */
+const uint8 *SrcFileImage     = NULL;
+size_t       SrcFileImageSize = 0;
+
+/* Non-option command line arguments; in batch mode every one of these is a source file */
+char **FileArgs    = NULL;
+int32  NumFileArgs = 0;
+bool   BatchMode   = false;
+int32  BatchJobs   = 0;
+
 CFE_FS_Header_t    FileHeader;
 CFE_TBL_File_Hdr_t TableHeader;
 
@@ -138,6 +157,10 @@ char **           SymbolNames;
 int32             TblDefSymbolIndex = -1;
 CFE_TBL_FileDef_t TblFileDef;
 int32             UserObjSymbolIndex = -1;
+uint8 *           UserObjectData     = NULL;
+int32 *           SymbolHashIndex     = NULL;
+int32 *           SymbolTrimHashIndex = NULL;
+uint32            SymbolHashMask      = 0;
 uint32            SpacecraftID       = 0;
 uint32            ProcessorID        = 0;
 uint32            ApplicationID      = 0;
@@ -622,20 +645,52 @@ void CheckStatusCleanupAndExit(int32 status)
 int main(int argc, char *argv[])
 {
     int32 Status = SUCCESS;
-    int32 i      = 0;
 
     Status = ProcessCmdLineOptions(argc, argv);
-    CheckStatusAndExit(Status);
+    if (Status == SUCCESS)
+    {
+        if (ReportVersion)
+            OutputVersionInfo();
 
-    if (ReportVersion)
-        OutputVersionInfo();
+        if (OutputHelp)
+            OutputHelpInfo();
 
-    if (OutputHelp)
-        OutputHelpInfo();
+        if (BatchMode)
+        {
+            Status = ProcessBatch();
+        }
+        else
+        {
+            Status = GetSrcFilename();
+        }
+    }
+
+    /* The file arguments are copied out by now, either into SrcFilename or by each batch worker */
+    if (FileArgs != NULL)
+    {
+        free(FileArgs);
+        FileArgs = NULL;
+    }
 
-    Status = GetSrcFilename();
     CheckStatusAndExit(Status);
 
+    if (BatchMode)
+    {
+        return Status;
+    }
+
+    return ConvertSrcFile();
+}
+
+/**
+ *
+ */
+
+int32 ConvertSrcFile(void)
+{
+    int32 Status = SUCCESS;
+    int32 i      = 0;
+
     Status = OpenSrcFile();
     CheckStatusAndExit(Status);
 
@@ -683,6 +738,9 @@ int main(int argc, char *argv[])
         CheckStatusCleanupAndExit(Status);
     }
 
+    Status = BuildSymbolHashIndex();
+    CheckStatusCleanupAndExit(Status);
+
     if (TblDefSymbolIndex == -1)
     {
         printf("Error! Unable to locate '%s' object in '%s'.\n", TBL_DEF_SYMBOL_NAME, SrcFilename);
@@ -707,7 +765,87 @@ int main(int argc, char *argv[])
 
     FreeMemoryAllocations();
 
-    return SUCCESS;
+    return Status;
+}
+
+/**
+ *
+ */
+
+int32 ProcessBatch(void)
+{
+    int32 Status     = SUCCESS;
+    int32 NextFile   = 0;
+    int32 NumRunning = 0;
+    int   WaitStatus;
+    pid_t Pid;
+
+    if (NumFileArgs == 0)
+    {
+        printf("Error! No source files specified for batch conversion\n");
+        return FAILED;
+    }
+
+    if (BatchJobs <= 0)
+    {
+        BatchJobs = (int32)sysconf(_SC_NPROCESSORS_ONLN);
+        if (BatchJobs <= 0)
+        {
+            BatchJobs = 1;
+        }
+    }
+
+    /* Flush before forking so buffered output is not duplicated in each worker */
+    fflush(stdout);
+
+    /*
+     * Each file is converted in its own worker process.  All of the conversion state
+     * in this tool is global, so a forked worker gets a private copy of it for free.
+     */
+    while ((NextFile < NumFileArgs) || (NumRunning > 0))
+    {
+        if ((NextFile < NumFileArgs) && (NumRunning < BatchJobs))
+        {
+            Pid = fork();
+            if (Pid == 0)
+            {
+                strncpy(SrcFilename, FileArgs[NextFile], PATH_MAX - 1);
+                SrcFilename[PATH_MAX - 1] = '\0';
+                Status                    = ConvertSrcFile();
+                fflush(stdout);
+                _exit(Status);
+            }
+            else if (Pid < 0)
+            {
+                printf("Error! Unable to start worker for '%s'\n", FileArgs[NextFile]);
+                Status = FAILED;
+            }
+            else
+            {
+                NumRunning++;
+            }
+            NextFile++;
+        }
+        else
+        {
+            Pid = wait(&WaitStatus);
+            if (Pid < 0)
+            {
+                break;
+            }
+
+            NumRunning--;
+            if (!WIFEXITED(WaitStatus) || WEXITSTATUS(WaitStatus) != SUCCESS)
+            {
+                Status = FAILED;
+            }
+        }
+    }
+
+    if (Verbose)
+        printf("Batch conversion of %d file(s) complete, status = %d\n", NumFileArgs, Status);
+
+    return Status;
 }
 
 /**
@@ -872,7 +1010,10 @@ void DeallocateSymbols(void)
         {
             free(SymbolPtrs[i]);
 
-            if (SymbolNames[i] != NULL)
+            /* Names that point into the mapped source file are not owned here */
+            if ((SymbolNames[i] != NULL) &&
+                ((SrcFileImage == NULL) || ((const uint8 *)SymbolNames[i] < SrcFileImage) ||
+                 ((const uint8 *)SymbolNames[i] >= &SrcFileImage[SrcFileImageSize])))
             {
                 free(SymbolNames[i]);
             }
@@ -892,6 +1033,30 @@ void FreeMemoryAllocations(void)
     DeallocateSymbols();
     DeallocateSectionHeaders();
 
+    if (SymbolHashIndex != NULL)
+    {
+        free(SymbolHashIndex);
+        SymbolHashIndex = NULL;
+    }
+
+    if (SymbolTrimHashIndex != NULL)
+    {
+        free(SymbolTrimHashIndex);
+        SymbolTrimHashIndex = NULL;
+    }
+
+    if (UserObjectData != NULL)
+    {
+        free(UserObjectData);
+        UserObjectData = NULL;
+    }
+
+    if (SrcFileImage != NULL)
+    {
+        munmap((void *)SrcFileImage, SrcFileImageSize);
+        SrcFileImage = NULL;
+    }
+
     if (SrcFileDesc != NULL)
     {
         fclose(SrcFileDesc);
@@ -909,10 +1074,8 @@ void FreeMemoryAllocations(void)
 
 int32 ProcessCmdLineOptions(int ArgumentCount, char *Arguments[])
 {
-    int32     Status              = SUCCESS;
-    bool      InputFileSpecified  = false;
-    bool      OutputFileSpecified = false;
-    int       i                   = 1;
+    int32     Status = SUCCESS;
+    int       i      = 1;
     char *    EndPtr;
     uint32    MaxDay;
     struct tm FileEpochTm;
@@ -920,6 +1083,13 @@ int32 ProcessCmdLineOptions(int ArgumentCount, char *Arguments[])
     time_t    FileEpochInSecs;
     time_t    ScEpochInSecs;
 
+    FileArgs = (char **)malloc(sizeof(char *) * ArgumentCount);
+    if (FileArgs == NULL)
+    {
+        printf("Error! Insufficient memory for command line arguments\n");
+        return FAILED;
+    }
+
     while ((i < ArgumentCount) && (Status == SUCCESS))
     {
         if ((Arguments[i][0] == '-') && (Arguments[i][1] == 't'))
@@ -1214,25 +1384,54 @@ int32 ProcessCmdLineOptions(int ArgumentCount, char *Arguments[])
                 }
             }
         }
-        else if (!InputFileSpecified)
+        else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'b'))
         {
-            strncpy(SrcFilename, Arguments[i], PATH_MAX - 1);
-            SrcFilename[PATH_MAX - 1] = '\0';
-            InputFileSpecified        = true;
+            BatchMode = true;
+            if (Arguments[i][2] != '\0')
+            {
+                BatchJobs = strtol(&Arguments[i][2], &EndPtr, 0);
+                if ((*EndPtr != '\0') || (BatchJobs < 0))
+                {
+                    printf("Error!, Number of batch jobs '%s' cannot be interpreted as a positive integer.\n",
+                           &Arguments[i][2]);
+                    Status = FAILED;
+                }
+            }
         }
-        else if (!OutputFileSpecified)
+        else if ((Arguments[i][0] == '-') && (Arguments[i][1] == 'o'))
         {
-            strncpy(DstFilename, Arguments[i], PATH_MAX - 1);
+            strncpy(DstFilename, &Arguments[i][2], PATH_MAX - 1);
             DstFilename[PATH_MAX - 1] = '\0';
-            OutputFileSpecified       = true;
         }
         else
         {
-            printf("\nError! Unknown Command Line Option '%s'\n", Arguments[i]);
-            Status = FAILED;
+            FileArgs[NumFileArgs] = Arguments[i];
+            NumFileArgs++;
         }
         i++;
     }
+
+    /* Outside of batch mode the arguments are "SrcFilename [DestDirectory]" */
+    if (!BatchMode && (Status == SUCCESS))
+    {
+        if (NumFileArgs > 0)
+        {
+            strncpy(SrcFilename, FileArgs[0], PATH_MAX - 1);
+            SrcFilename[PATH_MAX - 1] = '\0';
+        }
+
+        if (NumFileArgs > 1)
+        {
+            strncpy(DstFilename, FileArgs[1], PATH_MAX - 1);
+            DstFilename[PATH_MAX - 1] = '\0';
+        }
+
+        if (NumFileArgs > 2)
+        {
+            printf("\nError! Unknown Command Line Option '%s'\n", FileArgs[2]);
+            Status = FAILED;
+        }
+    }
     FileEpochTm.tm_sec   = FileEpoch.Second;
     FileEpochTm.tm_min   = FileEpoch.Minute;
     FileEpochTm.tm_hour  = FileEpoch.Hour;
@@ -1284,6 +1483,7 @@ void OutputHelpInfo(void)
     printf("\nElf Object File to cFE Table Image File Conversion Tool (elf2cfetbl)\n\n");
     printf("elf2cfetbl [-tTblName] [-d\"Description\"] [-h] [-v] [-V] [-s#] [-p#] [-n] \n");
     printf("           [-T] [-eYYYY:MM:DD:hh:mm:ss] [-fYYYY:MM:DD:hh:mm:ss] SrcFilename [DestDirectory]\n");
+    printf("elf2cfetbl -b[#] [-oDestDirectory] [options] SrcFilename [SrcFilename ...]\n");
     printf("   where:\n");
     printf("   -tTblName             replaces the table name specified in the object file with 'TblName'\n");
     printf("   -d\"Description\"       replaces the description specified in the object file with 'Description'\n");
@@ -1337,6 +1537,11 @@ void OutputHelpInfo(void)
     printf("                         If no epoch is specified, the default epoch is 1970:01:01:00:00:00\n");
     printf("                         This option requires the '-T' option, defined above, to be specified to have any "
            "effect\n");
+    printf("   -b#                   enables batch mode.  Every SrcFilename given is converted, using up to # "
+           "worker processes.\n");
+    printf("                         If # is omitted or zero, one worker per online CPU is used.\n");
+    printf("   -oDestDirectory       specifies the directory in which the cFE Table Image files are to be created.\n");
+    printf("                         This is the only way to specify the directory in batch mode.\n");
     printf("   SrcFilename           specifies the object file to be converted\n");
     printf("   DestDirectory         specifies the directory in which the cFE Table Image file is to be created.\n");
     printf("                         If a directory is not specified './' is assumed.\n");
@@ -1344,6 +1549,7 @@ void OutputHelpInfo(void)
     printf("EXAMPLES:\n");
     printf("   elf2cfetbl MyObjectFile ../../TblDefaultImgDir/\n");
     printf("   elf2cfetbl -s12 -p0x0D -a016 -e2000:01:01:00:00:00 MyObjectFile ../../TblDefaultImgDir/\n");
+    printf("   elf2cfetbl -b4 -o../../TblDefaultImgDir/ MyObjectFile1 MyObjectFile2 MyObjectFile3\n");
     printf("\n");
     printf("NOTE: The name of the target file is specified within the source file as part of the CFE_TBL_FILEDEF "
            "macro.\n");
@@ -1408,9 +1614,27 @@ int32 OpenSrcFile(void)
     }
 
     /* Obtain time of object file's last modification */
-    RtnCode = stat(SrcFilename, &SrcFileStats);
+    RtnCode = fstat(fileno(SrcFileDesc), &SrcFileStats);
     if (RtnCode == 0)
     {
+        /*
+         * Map the whole object file so headers, symbols and strings can be
+         * resolved directly from memory.  If the mapping is not possible the
+         * stdio path is still used as a fallback.
+         */
+        if (S_ISREG(SrcFileStats.st_mode) && SrcFileStats.st_size > 0)
+        {
+            SrcFileImage = mmap(NULL, SrcFileStats.st_size, PROT_READ, MAP_PRIVATE, fileno(SrcFileDesc), 0);
+            if (SrcFileImage == MAP_FAILED)
+            {
+                SrcFileImage = NULL;
+            }
+            else
+            {
+                SrcFileImageSize = SrcFileStats.st_size;
+            }
+        }
+
         SrcFileTimeInScEpoch = SrcFileStats.st_mtime + EpochDelta;
 
         if (Verbose)
@@ -1470,6 +1694,67 @@ int32 OpenDstFile(void)
     return SUCCESS;
 }
 
+/**
+ *
+ */
+
+int32 ReadSrcFileData(uint64 Offset, void *Dest, size_t Size)
+{
+    if (SrcFileImage != NULL)
+    {
+        if ((Offset > SrcFileImageSize) || (Size > (SrcFileImageSize - Offset)))
+        {
+            return FAILED;
+        }
+
+        memcpy(Dest, &SrcFileImage[Offset], Size);
+        return SUCCESS;
+    }
+
+    if ((Offset > LONG_MAX) || (fseek(SrcFileDesc, (long)Offset, SEEK_SET) != 0))
+    {
+        return FAILED;
+    }
+
+    if ((Size != 0) && (fread(Dest, Size, 1, SrcFileDesc) != 1))
+    {
+        return FAILED;
+    }
+
+    return SUCCESS;
+}
+
+/**
+ *
+ */
+
+int32 ReadSrcFileString(uint64 Offset, char *Dest, size_t MaxLen)
+{
+    size_t i = 0;
+    int    c;
+
+    if (SrcFileImage != NULL)
+    {
+        while ((i < (MaxLen - 1)) && ((Offset + i) < SrcFileImageSize) && (SrcFileImage[Offset + i] != 0))
+        {
+            Dest[i] = SrcFileImage[Offset + i];
+            i++;
+        }
+    }
+    else if ((Offset <= LONG_MAX) && (fseek(SrcFileDesc, (long)Offset, SEEK_SET) == 0))
+    {
+        while ((i < (MaxLen - 1)) && ((c = fgetc(SrcFileDesc)) != EOF) && (c != 0))
+        {
+            Dest[i] = c;
+            i++;
+        }
+    }
+
+    Dest[i] = '\0';
+
+    return SUCCESS;
+}
+
 /**
  *
  */
@@ -1488,9 +1773,8 @@ int32 checkELFFileMagicNumber(void)
 
 int32 GetElfHeader(void)
 {
-    int32  Status      = SUCCESS;
-    size_t NumHdrsRead = 0;
-    char   VerboseStr[60];
+    int32 Status = SUCCESS;
+    char  VerboseStr[60];
     int32  EndiannessCheck = 0x01020304;
 
     if (((char *)&EndiannessCheck)[0] == 0x01)
@@ -1506,9 +1790,9 @@ int32 GetElfHeader(void)
     }
 
     /* Begin by reading e_ident characters */
-    NumHdrsRead = fread(&ElfHeader, EI_NIDENT, 1, SrcFileDesc);
+    Status = ReadSrcFileData(0, &ElfHeader, EI_NIDENT);
 
-    if (NumHdrsRead != 1)
+    if (Status != SUCCESS)
     {
         printf("Experienced error attempting to read e_ident of ELF Header from file '%s'\n", SrcFilename);
         return FAILED;
@@ -1628,14 +1912,14 @@ int32 GetElfHeader(void)
     /* Now that e_ident is processed (with word size), read rest of the header */
     if (TargetWordsizeIs32Bit)
     {
-        NumHdrsRead = fread(&(ElfHeader.Ehdr32.e_type), sizeof(Elf32_Ehdr) - EI_NIDENT, 1, SrcFileDesc);
+        Status = ReadSrcFileData(EI_NIDENT, &(ElfHeader.Ehdr32.e_type), sizeof(Elf32_Ehdr) - EI_NIDENT);
     }
     else
     {
-        NumHdrsRead = fread(&(ElfHeader.Ehdr64.e_type), sizeof(Elf64_Ehdr) - EI_NIDENT, 1, SrcFileDesc);
+        Status = ReadSrcFileData(EI_NIDENT, &(ElfHeader.Ehdr64.e_type), sizeof(Elf64_Ehdr) - EI_NIDENT);
     }
 
-    if (NumHdrsRead != 1)
+    if (Status != SUCCESS)
     {
         printf("Experienced error attempting to read remaining ELF Header from file '%s'\n", SrcFilename);
         return FAILED;
@@ -1695,12 +1979,10 @@ int32 GetElfHeader(void)
 
 int32 GetSectionHeader(int32 SectionIndex, union Elf_Shdr *SectionHeader)
 {
-    int32  Status      = SUCCESS;
-    size_t NumHdrsRead = 0;
-    char   VerboseStr[60];
-    int64  SeekOffset;
-    int32  Shentsize;
-    int32  i = 0;
+    int32 Status = SUCCESS;
+    char  VerboseStr[MAX_SECTION_HDR_NAME_LEN];
+    int64 SeekOffset;
+    int32 Shentsize;
 
     if (TargetWordsizeIs32Bit)
     {
@@ -1718,24 +2000,16 @@ int32 GetSectionHeader(int32 SectionIndex, union Elf_Shdr *SectionHeader)
         SeekOffset = SeekOffset + (SectionIndex * Shentsize);
     }
 
-    Status = fseek(SrcFileDesc, SeekOffset, SEEK_SET);
-
-    if (Status != 0)
-    {
-        printf("Error locating Section Header #%d in file '%s'\n", SectionIndex, SrcFilename);
-        return FAILED;
-    }
-
     if (TargetWordsizeIs32Bit)
     {
-        NumHdrsRead = fread(SectionHeader, sizeof(Elf32_Shdr), 1, SrcFileDesc);
+        Status = ReadSrcFileData(SeekOffset, SectionHeader, sizeof(Elf32_Shdr));
     }
     else
     {
-        NumHdrsRead = fread(SectionHeader, sizeof(Elf64_Shdr), 1, SrcFileDesc);
+        Status = ReadSrcFileData(SeekOffset, SectionHeader, sizeof(Elf64_Shdr));
     }
 
-    if (NumHdrsRead != 1)
+    if (Status != SUCCESS)
     {
         printf("Experienced error attempting to read Section Header #%d from file '%s'\n", SectionIndex, SrcFilename);
         return FAILED;
@@ -1752,12 +2026,7 @@ int32 GetSectionHeader(int32 SectionIndex, union Elf_Shdr *SectionHeader)
         SeekOffset = SectionHeaderStringTableDataOffset + get_sh_name(SectionHeader);
         if (Verbose)
             printf("   sh_name       = 0x%08x - ", get_sh_name(SectionHeader));
-        fseek(SrcFileDesc, SeekOffset, SEEK_SET);
-
-        while ((VerboseStr[i] = fgetc(SrcFileDesc)) != '\0')
-        {
-            i++;
-        }
+        ReadSrcFileString(SeekOffset, VerboseStr, sizeof(VerboseStr));
         if (Verbose)
             printf("%s\n", VerboseStr);
 
@@ -1894,41 +2163,22 @@ int32 GetSectionHeader(int32 SectionIndex, union Elf_Shdr *SectionHeader)
 
 int32 GetSymbol(int32 SymbolIndex, union Elf_Sym *Symbol)
 {
-    int32    Status            = SUCCESS;
-    int32    NumSymRead        = 0;
-    uint64_t calculated_offset = SymbolTableDataOffset + (SymbolIndex * SymbolTableEntrySize);
-    int32_t  SeekOffset        = (int32_t)calculated_offset;
-    char     VerboseStr[60];
-    int32    i = 0;
-
-    memset(VerboseStr, 0, sizeof(VerboseStr));
-
-    if (SeekOffset != calculated_offset)
-    {
-        printf("Error: SeekOffset may not be %lu\n", (long unsigned int)calculated_offset);
-        Status = FAILED;
-    }
-    else
-    {
-        Status = fseek(SrcFileDesc, SeekOffset, SEEK_SET);
-    }
-
-    if (Status != 0)
-    {
-        printf("Error locating Symbol #%d in file '%s'\n", SymbolIndex, SrcFilename);
-        return FAILED;
-    }
+    int32       Status     = SUCCESS;
+    uint64_t    SeekOffset = SymbolTableDataOffset + (SymbolIndex * SymbolTableEntrySize);
+    char        VerboseStr[MAX_SECTION_HDR_NAME_LEN];
+    const char *MappedName = NULL;
+    size_t      MaxLen;
 
     if (TargetWordsizeIs32Bit)
     {
-        NumSymRead = fread(Symbol, sizeof(Elf32_Sym), 1, SrcFileDesc);
+        Status = ReadSrcFileData(SeekOffset, Symbol, sizeof(Elf32_Sym));
     }
     else
     {
-        NumSymRead = fread(Symbol, sizeof(Elf64_Sym), 1, SrcFileDesc);
+        Status = ReadSrcFileData(SeekOffset, Symbol, sizeof(Elf64_Sym));
     }
 
-    if (NumSymRead != 1)
+    if (Status != SUCCESS)
     {
         printf("Experienced error attempting to read Symbol #%d from file '%s'\n", SymbolIndex, SrcFilename);
         return FAILED;
@@ -1943,19 +2193,43 @@ int32 GetSymbol(int32 SymbolIndex, union Elf_Sym *Symbol)
     SeekOffset = StringTableDataOffset + get_st_name(Symbol);
     if (Verbose)
         printf("   st_name  = 0x%08x - ", get_st_name(Symbol));
-    fseek(SrcFileDesc, SeekOffset, SEEK_SET);
 
-    while ((i < sizeof(VerboseStr)) && ((VerboseStr[i] = fgetc(SrcFileDesc)) != '\0'))
+    /*
+     * When the file is mapped, a name that fits is used in place rather than
+     * copied out.  Longer names are truncated into a private copy as before.
+     */
+    if ((SrcFileImage != NULL) && (SeekOffset < SrcFileImageSize))
     {
-        i++;
+        MaxLen = SrcFileImageSize - SeekOffset;
+        if (MaxLen > sizeof(VerboseStr))
+        {
+            MaxLen = sizeof(VerboseStr);
+        }
+        if (memchr(&SrcFileImage[SeekOffset], 0, MaxLen) != NULL)
+        {
+            MappedName = (const char *)&SrcFileImage[SeekOffset];
+        }
     }
 
-    VerboseStr[i] = '\0'; /* Just in case i=sizeof(VerboseStr) */
+    if (MappedName != NULL)
+    {
+        SymbolNames[SymbolIndex] = (char *)MappedName;
+    }
+    else
+    {
+        ReadSrcFileString(SeekOffset, VerboseStr, sizeof(VerboseStr));
 
-    SymbolNames[SymbolIndex] = malloc(i + 1);
-    strcpy(SymbolNames[SymbolIndex], VerboseStr);
+        SymbolNames[SymbolIndex] = malloc(strlen(VerboseStr) + 1);
+        if (SymbolNames[SymbolIndex] == NULL)
+        {
+            printf("Error! Insufficient memory to store Symbol Names\n");
+            return FAILED;
+        }
+        strcpy(SymbolNames[SymbolIndex], VerboseStr);
+    }
 
-    if ((strcmp(VerboseStr, TBL_DEF_SYMBOL_NAME) == 0) || (strcmp(&VerboseStr[1], TBL_DEF_SYMBOL_NAME) == 0))
+    if ((strcmp(SymbolNames[SymbolIndex], TBL_DEF_SYMBOL_NAME) == 0) ||
+        ((SymbolNames[SymbolIndex][0] != '\0') && (strcmp(&SymbolNames[SymbolIndex][1], TBL_DEF_SYMBOL_NAME) == 0)))
     {
         if (Verbose)
             printf("*** %s ***\n", SymbolNames[SymbolIndex]);
@@ -2238,6 +2512,148 @@ void SwapUInt64(uint64 *ValueToSwap)
     BytePtr[3] = TempByte;
 }
 
+/**
+ *
+ */
+
+static uint32 SymbolNameHash(const char *Name, size_t Length)
+{
+    uint32 Hash = 2166136261U; /* FNV-1a */
+
+    while (Length > 0)
+    {
+        Hash ^= (uint8)*Name;
+        Hash *= 16777619U;
+        Name++;
+        Length--;
+    }
+
+    return Hash;
+}
+
+/**
+ *
+ */
+
+static void InsertSymbolHash(int32 *Index, uint32 Hash, int32 SymbolIndex)
+{
+    uint32 Slot;
+
+    Slot = Hash & SymbolHashMask;
+    while (Index[Slot] >= 0)
+    {
+        Slot = (Slot + 1) & SymbolHashMask;
+    }
+    Index[Slot] = SymbolIndex;
+}
+
+/**
+ *
+ */
+
+int32 BuildSymbolHashIndex(void)
+{
+    uint32 TableSize = 16;
+    uint32 Slot;
+    size_t Length;
+    int32  i;
+
+    while (TableSize < (2 * NumSymbols))
+    {
+        TableSize <<= 1;
+    }
+
+    SymbolHashIndex     = malloc(sizeof(int32) * TableSize);
+    SymbolTrimHashIndex = malloc(sizeof(int32) * TableSize);
+    if ((SymbolHashIndex == NULL) || (SymbolTrimHashIndex == NULL))
+    {
+        printf("Error! Insufficient memory for Symbol hash index\n");
+        return FAILED;
+    }
+
+    SymbolHashMask = TableSize - 1;
+    for (Slot = 0; Slot < TableSize; Slot++)
+    {
+        SymbolHashIndex[Slot]     = -1;
+        SymbolTrimHashIndex[Slot] = -1;
+    }
+
+    /*
+     * The object search accepts a symbol that matches the name exactly or
+     * that has one extra character, so each symbol is indexed by its full
+     * name and again by its name less the last character.
+     *
+     * Symbols are inserted in table order with linear probing, so a lookup
+     * always finds the lowest-numbered symbol of a given key first.
+     */
+    for (i = 0; i < NumSymbols; i++)
+    {
+        Length = strlen(SymbolNames[i]);
+        InsertSymbolHash(SymbolHashIndex, SymbolNameHash(SymbolNames[i], Length), i);
+        if (Length > 0)
+        {
+            InsertSymbolHash(SymbolTrimHashIndex, SymbolNameHash(SymbolNames[i], Length - 1), i);
+        }
+    }
+
+    return SUCCESS;
+}
+
+/**
+ *
+ */
+
+int32 FindSymbolByName(const char *Name)
+{
+    uint32 Hash;
+    uint32 Slot;
+    size_t Length;
+    int32  Found = -1;
+    int32  Idx;
+
+    if ((SymbolHashIndex == NULL) || (SymbolTrimHashIndex == NULL))
+    {
+        return -1;
+    }
+
+    Length = strlen(Name);
+    Hash   = SymbolNameHash(Name, Length);
+
+    Slot = Hash & SymbolHashMask;
+    while (SymbolHashIndex[Slot] >= 0)
+    {
+        Idx = SymbolHashIndex[Slot];
+        if (strcmp(SymbolNames[Idx], Name) == 0)
+        {
+            Found = Idx;
+            break;
+        }
+        Slot = (Slot + 1) & SymbolHashMask;
+    }
+
+    /*
+     * A symbol with one extra character is also a match, and whichever
+     * comes first in the symbol table wins, same as a linear scan would
+     */
+    Slot = Hash & SymbolHashMask;
+    while (SymbolTrimHashIndex[Slot] >= 0)
+    {
+        Idx = SymbolTrimHashIndex[Slot];
+        if ((Found >= 0) && (Idx > Found))
+        {
+            break;
+        }
+        if ((strlen(SymbolNames[Idx]) == (Length + 1)) && (strncmp(SymbolNames[Idx], Name, Length) == 0))
+        {
+            Found = Idx;
+            break;
+        }
+        Slot = (Slot + 1) & SymbolHashMask;
+    }
+
+    return Found;
+}
+
 /**
  *
  */
@@ -2273,9 +2689,7 @@ int32 GetStringFromMap(char *Result, ElfStrMap *Map, int32 Key)
 
 int32 GetTblDefInfo(void)
 {
-    int32    Status      = SUCCESS;
-    uint32   SeekOffset  = 0;
-    int32    NumDefsRead = 0;
+    int32    Status = SUCCESS;
     uint64_t calculated_offset;
 
     /* Read the data to be used to format the CFE File and Table Headers */
@@ -2288,17 +2702,9 @@ int32 GetTblDefInfo(void)
     }
     else
     {
-        /* fseek expects a long int, sh_offset and st_value are uint64 for elf64 */
         calculated_offset = get_sh_offset(SectionHeaderPtrs[get_st_shndx(SymbolPtrs[TblDefSymbolIndex])]) +
                             get_st_value(SymbolPtrs[TblDefSymbolIndex]);
-        SeekOffset = (uint32_t)(calculated_offset);
-        if (SeekOffset != calculated_offset)
-        {
-            printf("Error: SeekOffset may not be %lu\n", (long unsigned int)calculated_offset);
-            Status = FAILED;
-        }
-        fseek(SrcFileDesc, SeekOffset, SEEK_SET);
-        NumDefsRead = fread(&TblFileDef, sizeof(CFE_TBL_FileDef_t), 1, SrcFileDesc);
+        Status = ReadSrcFileData(calculated_offset, &TblFileDef, sizeof(CFE_TBL_FileDef_t));
 
         /* ensuring all are strings are null-terminated */
         TblFileDef.ObjectName[sizeof(TblFileDef.ObjectName) - 1]   = '\0';
@@ -2306,7 +2712,7 @@ int32 GetTblDefInfo(void)
         TblFileDef.Description[sizeof(TblFileDef.Description) - 1] = '\0';
         TblFileDef.TgtFilename[sizeof(TblFileDef.TgtFilename) - 1] = '\0';
 
-        if (NumDefsRead != 1)
+        if (Status != SUCCESS)
         {
             printf("Error! Unable to read data content of '%s' from '%s'.\n", TBL_DEF_SYMBOL_NAME, SrcFilename);
             Status = FAILED;
@@ -2345,17 +2751,26 @@ int32 GetTblDefInfo(void)
 
 int32 LocateAndReadUserObject(void)
 {
-    int32    Status     = SUCCESS;
-    int32    i          = 0;
-    int32    j          = 0;
-    uint32   SeekOffset = 0;
-    uint8    AByte;
+    int32    Status = SUCCESS;
+    int32    i      = 0;
+    int32    j      = 0;
     uint64_t calculated_offset;
 
     /* Search the symbol table for the user defined object */
     if (Verbose)
         printf("\nTrying to match ObjectName '%s'... (length %lu)", TblFileDef.ObjectName,
                (long unsigned int)strlen(TblFileDef.ObjectName));
+
+    /*
+     * The hash index returns the same symbol the scan below would settle on,
+     * so starting the scan there ends it on the first pass
+     */
+    i = FindSymbolByName(TblFileDef.ObjectName);
+    if (i < 0)
+    {
+        i = 0;
+    }
+
     while (i < NumSymbols)
     {
         if (Verbose)
@@ -2445,13 +2860,6 @@ int32 LocateAndReadUserObject(void)
             /* Locate data associated with symbol */
             calculated_offset = get_sh_offset(SectionHeaderPtrs[get_st_shndx(SymbolPtrs[UserObjSymbolIndex])]) +
                                 get_st_value(SymbolPtrs[UserObjSymbolIndex]);
-            SeekOffset = (uint32_t)(calculated_offset);
-            if (SeekOffset != calculated_offset)
-            {
-                printf("Error: SeekOffset may not be %lu\n", (long unsigned int)calculated_offset);
-                Status = FAILED;
-            }
-            fseek(SrcFileDesc, SeekOffset, SEEK_SET);
 
             /* Determine if the elf file contained the size of the object */
             if (get_st_size(SymbolPtrs[UserObjSymbolIndex]) != 0)
@@ -2478,13 +2886,28 @@ int32 LocateAndReadUserObject(void)
                 set_st_size(SymbolPtrs[UserObjSymbolIndex], TblFileDef.ObjectSize);
             }
 
+            /* Read the whole object in one access; it is written out in one piece as well */
+            UserObjectData = malloc(get_st_size(SymbolPtrs[UserObjSymbolIndex]) + 1);
+            if (UserObjectData == NULL)
+            {
+                printf("Error! Insufficient memory to store '%s' object data\n", TblFileDef.ObjectName);
+                return FAILED;
+            }
+
+            Status = ReadSrcFileData(calculated_offset, UserObjectData, get_st_size(SymbolPtrs[UserObjSymbolIndex]));
+            if (Status != SUCCESS)
+            {
+                printf("Error! Unable to read data content of '%s' from '%s'.\n", TblFileDef.ObjectName,
+                       SrcFilename);
+                return FAILED;
+            }
+
             if (Verbose)
             {
                 printf("Object Data:\n");
                 for (i = 0; i < get_st_size(SymbolPtrs[UserObjSymbolIndex]); i++)
                 {
-                    AByte = fgetc(SrcFileDesc);
-                    printf(" 0x%02x", AByte);
+                    printf(" 0x%02x", UserObjectData[i]);
                     j++;
                     if (j == 16)
                     {
@@ -2492,8 +2915,6 @@ int32 LocateAndReadUserObject(void)
                         j = 0;
                     }
                 }
-                /* Reset the file pointer */
-                fseek(SrcFileDesc, SeekOffset, SEEK_SET);
             }
         }
     }
@@ -2632,13 +3053,9 @@ int32 OutputDataToTargetFile(void)
             fwrite(&AByte, 1, 1, DstFileDesc);
         }
     }
-    else
+    else if (get_st_size(SymbolPtrs[UserObjSymbolIndex]) != 0)
     {
-        for (i = 0; i < get_st_size(SymbolPtrs[UserObjSymbolIndex]); i++)
-        {
-            AByte = fgetc(SrcFileDesc);
-            fwrite(&AByte, 1, 1, DstFileDesc);
-        }
+        fwrite(UserObjectData, get_st_size(SymbolPtrs[UserObjSymbolIndex]), 1, DstFileDesc);
     }
 
     return Status;
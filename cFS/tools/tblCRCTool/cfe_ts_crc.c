@@ -17,7 +17,7 @@
  ************************************************************************/
 
 /*
- *  This program calculates the CRC-16/ARC of a given table file.
+ *  This program calculates the CRC-16/ARC of one or more table files.
  *
  *  Algorithm:
  *    - Name: CRC-16/ARC
@@ -26,10 +26,14 @@
  *    - Reflect Input/Output: true
  *    - XorOut: 0x0000
  *
- *  Inputs: One string containing the filename of the table file to CRC.
+ *  The CRC itself is computed by the same source used for CFE_ES_CalculateCRC
+ *  in flight (cfe_es_crc.c), so ground and flight results are always identical.
  *
- *  Outputs: Prints to the terminal the filename, size, and CRC.
- *           Returns 0 if successful.
+ *  Inputs: One or more table file names, plus options (see usage).
+ *
+ *  Outputs: Prints to the terminal the filename, size, and CRC of each file,
+ *           either in the traditional verbose layout or one line per file.
+ *           Returns 0 if every file was processed successfully.
  *
  *  Author: Mike Blau, GSFC Code 582
  */
@@ -37,8 +41,12 @@
 #include <fcntl.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdbool.h>
 #include <unistd.h>
 #include <errno.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "cfe_ts_crc_version.h"
 
@@ -52,123 +60,348 @@
 #include "cfe_fs_extern_typedefs.h"
 #include "cfe_tbl_extern_typedefs.h"
 
+/* Flight CRC algorithm table (CFE ES) */
+#include "cfe_es_crc.h"
+
+/* Size of the read buffer used when a file cannot be memory mapped */
+#define CFE_TS_CRC_READ_BUFFER_SIZE (64 * 1024)
+
+/* Upper limit on the number of worker threads */
+#define CFE_TS_CRC_MAX_JOBS 256
+
+typedef struct
+{
+    const char *          Name;
+    CFE_ES_CrcType_Enum_t CrcType;
+} CrcAlgoName_t;
+
+typedef struct
+{
+    const char *Filename;
+    ssize_t     FileSize;
+    uint32      FileCRC;
+    int         ErrorNum;
+    const char *ErrorText;
+} FileResult_t;
+
+typedef struct
+{
+    FileResult_t *        Results;
+    int                   NumFiles;
+    int                   NextFile;
+    CFE_ES_CrcType_Enum_t CrcType;
+    pthread_mutex_t       Lock;
+} WorkQueue_t;
+
+static const CrcAlgoName_t CRC_ALGO_NAMES[] = {
+    {"16_ARC", CFE_ES_CrcType_16_ARC},
+    {"CRC_16", CFE_ES_CrcType_CRC_16},
+    {"NONE", CFE_ES_CrcType_NONE},
+};
+
 /*
 **             Function Prologue
 **
 ** Function: CalculateCRC  (originated from lro-cfe-4.2.1 delivery - 2/4/09)
 **
 ** Purpose:  Perform a CRC calculation on a range of memory.
+**           Dispatches to the flight implementation of the selected algorithm.
 **
 */
-uint32 CalculateCRC(void *DataPtr, uint32 DataLength, uint32 InputCRC)
+uint32 CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t CrcType)
 {
-    int32  i;
-    int16  Index;
-    int16  Crc = 0;
-    uint8 *BufPtr;
-
-    static const uint16 CrcTable[256] = {
-
-        0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1,
-        0xC481, 0x0440, 0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40,
-        0xC901, 0x09C0, 0x0880, 0xC841, 0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1,
-        0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41, 0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-        0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040, 0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1,
-        0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441, 0x3C00, 0xFCC1, 0xFD81, 0x3D40,
-        0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840, 0x2800, 0xE8C1,
-        0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-        0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0,
-        0x2080, 0xE041, 0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740,
-        0xA501, 0x65C0, 0x6480, 0xA441, 0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0,
-        0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840, 0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-        0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40, 0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1,
-        0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041, 0x5000, 0x90C1, 0x9181, 0x5140,
-        0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440, 0x9C01, 0x5CC0,
-        0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-        0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0,
-        0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341,
-        0x4100, 0x81C1, 0x8081, 0x4040};
-
-    Crc    = (int16)(0xFFFF & InputCRC);
-    BufPtr = (uint8 *)DataPtr;
-
-    for (i = 0; i < DataLength; i++, BufPtr++)
-    {
-        Index = ((Crc ^ *BufPtr) & 0x00FF);
-        Crc   = ((Crc >> 8) & 0x00FF) ^ CrcTable[Index];
-    }
-
-    return Crc;
+    if (DataLength == 0)
+    {
+        return InputCRC;
+    }
+
+    return CFE_ES_ComputeCRC_GetParams(CrcType)->Algorithm(DataPtr, DataLength, InputCRC);
 }
 
-int main(int argc, char **argv)
+/*
+** Compute the CRC of a single table file, skipping the cFE file and table headers.
+** The file is memory mapped when possible, otherwise it is read in large blocks.
+*/
+void ComputeFileCRC(FileResult_t *Result, CFE_ES_CrcType_Enum_t CrcType)
 {
-    ssize_t readSize;
-    off_t   skipSize = 0;
-    ssize_t fileSize = 0;
-    uint32  fileCRC  = 0;
-    int     fd;
-    char    buffer[100];
-    off_t   offsetReturn = 0;
-    char    VersionString[CFE_TS_CRC_CFG_MAX_VERSION_STR_LEN];
+    char *       ReadBuffer;
+    off_t        skipSize;
+    ssize_t      readSize;
+    struct stat  FileStats;
+    uint8 *      FileImage;
+    int          fd;
 
-    /* check for valid input */
-    if ((argc != 2) || (strncmp(argv[1], "--help", 100) == 0))
-    {
-        snprintf(VersionString, CFE_TS_CRC_CFG_MAX_VERSION_STR_LEN,
-        "%s %s %s (Codename %s), Last Official Release: %s %s)",
-        "tblCRCTool", CFE_TS_CRC_REVISION == 0 ? "Development Build" : "Release",
-        CFE_TS_CRC_VERSION, CFE_TS_CRC_BUILD_CODENAME, "tblCRCTool", CFE_TS_CRC_LAST_OFFICIAL);
-        printf("%s\n", VersionString);
-        printf("\nUsage: cfe_ts_crc [filename]\n");
-        exit(EXIT_FAILURE);
-    }
     /* Set to skip the header (116 bytes) */
     skipSize = sizeof(CFE_FS_Header_t) + sizeof(CFE_TBL_File_Hdr_t);
 
+    Result->FileSize = 0;
+    Result->FileCRC  = 0;
+    Result->ErrorNum = 0;
+
     /* open the input file if possible */
-    fd = open(argv[1], O_RDONLY);
+    fd = open(Result->Filename, O_RDONLY);
     if (fd < 0)
     {
-        printf("\ncfe_ts_crc error: can't open input file!\n");
-        perror(argv[1]);
-        exit(EXIT_FAILURE);
+        Result->ErrorNum  = errno;
+        Result->ErrorText = "can't open input file!";
+        return;
     }
+
+    if ((fstat(fd, &FileStats) == 0) && S_ISREG(FileStats.st_mode))
+    {
+        if (FileStats.st_size > skipSize)
+        {
+            FileImage = mmap(NULL, FileStats.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (FileImage != MAP_FAILED)
+            {
+                Result->FileSize = FileStats.st_size - skipSize;
+                Result->FileCRC  = CalculateCRC(&FileImage[skipSize], Result->FileSize, 0, CrcType);
+                munmap(FileImage, FileStats.st_size);
+                close(fd);
+                return;
+            }
+        }
+        else
+        {
+            /* Nothing beyond the headers, so the result is an empty CRC */
+            close(fd);
+            return;
+        }
+    }
+
     /* seek past the number of bytes requested */
-    offsetReturn = lseek(fd, skipSize, SEEK_SET);
-    if (offsetReturn != skipSize)
+    if (lseek(fd, skipSize, SEEK_SET) != skipSize)
     {
-        printf("\ncfe_ts_crc error: lseek failed!\n");
-        printf("%s\n", strerror(errno));
-        exit(EXIT_FAILURE);
+        Result->ErrorNum  = errno;
+        Result->ErrorText = "lseek failed!";
+        close(fd);
+        return;
+    }
+
+    /* read the input file a large block at a time */
+    ReadBuffer = malloc(CFE_TS_CRC_READ_BUFFER_SIZE);
+    if (ReadBuffer == NULL)
+    {
+        Result->ErrorNum  = ENOMEM;
+        Result->ErrorText = "file read failed!";
+        close(fd);
+        return;
     }
 
-    /* read the input file 100 bytes at a time */
     do
     {
-        readSize = read(fd, buffer, sizeof(buffer));
+        readSize = read(fd, ReadBuffer, CFE_TS_CRC_READ_BUFFER_SIZE);
         if (readSize < 0)
         {
-            printf("\ncfe_ts_crc error: file read failed!\n");
-            printf("%s\n", strerror(errno));
-            exit(EXIT_FAILURE);
+            Result->ErrorNum  = errno;
+            Result->ErrorText = "file read failed!";
+            break;
         }
-        fileCRC = CalculateCRC(buffer, readSize, fileCRC);
-        fileSize += readSize;
+        Result->FileCRC = CalculateCRC(ReadBuffer, readSize, Result->FileCRC, CrcType);
+        Result->FileSize += readSize;
     } while (readSize > 0);
 
-    /* print the size/CRC results */
-    printf("\nTable File Name:            %s\nTable Size:                 %ld Bytes\nExpected TS Validation CRC: "
-           "0x%08lX\n\n",
-           argv[1], (long)fileSize, (unsigned long)fileCRC);
+    free(ReadBuffer);
 
     /* Close file and check*/
-    if (close(fd) != 0)
+    if ((close(fd) != 0) && (Result->ErrorNum == 0))
     {
-        printf("\nerror: Cannot close file!\n");
-        printf("%s\n", strerror(errno));
+        Result->ErrorNum  = errno;
+        Result->ErrorText = "Cannot close file!";
+    }
+}
+
+/*
+** Worker thread entry point: claims files from the shared queue until none remain.
+*/
+void *CrcWorker(void *Arg)
+{
+    WorkQueue_t *Queue = Arg;
+    int          Index;
+
+    while (true)
+    {
+        pthread_mutex_lock(&Queue->Lock);
+        Index = Queue->NextFile;
+        if (Index < Queue->NumFiles)
+        {
+            Queue->NextFile++;
+        }
+        pthread_mutex_unlock(&Queue->Lock);
+
+        if (Index >= Queue->NumFiles)
+        {
+            break;
+        }
+
+        ComputeFileCRC(&Queue->Results[Index], Queue->CrcType);
+    }
+
+    return NULL;
+}
+
+void OutputUsage(void)
+{
+    char VersionString[CFE_TS_CRC_CFG_MAX_VERSION_STR_LEN];
+
+    snprintf(VersionString, CFE_TS_CRC_CFG_MAX_VERSION_STR_LEN,
+    "%s %s %s (Codename %s), Last Official Release: %s %s)",
+    "tblCRCTool", CFE_TS_CRC_REVISION == 0 ? "Development Build" : "Release",
+    CFE_TS_CRC_VERSION, CFE_TS_CRC_BUILD_CODENAME, "tblCRCTool", CFE_TS_CRC_LAST_OFFICIAL);
+    printf("%s\n", VersionString);
+    printf("\nUsage: cfe_ts_crc [-m] [-j jobs] [-a algorithm] [filename ...]\n");
+    printf("   -m            print one line per file: <CRC> <size> <filename>\n");
+    printf("   -j jobs       number of files to process in parallel (0 = one per online CPU)\n");
+    printf("   -a algorithm  CRC algorithm: 16_ARC (default), CRC_16 or NONE\n");
+}
+
+int main(int argc, char **argv)
+{
+    FileResult_t *        Results;
+    WorkQueue_t           Queue;
+    pthread_t             Workers[CFE_TS_CRC_MAX_JOBS];
+    CFE_ES_CrcType_Enum_t CrcType     = CFE_ES_CrcType_16_ARC;
+    bool                  MachineMode = false;
+    long                  NumJobs     = 1;
+    int                   NumFiles;
+    int                   NumStarted;
+    int                   ExitStatus = EXIT_SUCCESS;
+    int                   opt;
+    int                   i;
+    size_t                j;
+
+    /* check for valid input */
+    for (i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--help", 100) == 0)
+        {
+            OutputUsage();
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    while ((opt = getopt(argc, argv, "mj:a:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 'm':
+                MachineMode = true;
+                break;
+
+            case 'j':
+                NumJobs = strtol(optarg, NULL, 0);
+                if (NumJobs <= 0)
+                {
+                    NumJobs = sysconf(_SC_NPROCESSORS_ONLN);
+                }
+                break;
+
+            case 'a':
+                for (j = 0; j < sizeof(CRC_ALGO_NAMES) / sizeof(CRC_ALGO_NAMES[0]); j++)
+                {
+                    if (strcmp(optarg, CRC_ALGO_NAMES[j].Name) == 0)
+                    {
+                        CrcType = CRC_ALGO_NAMES[j].CrcType;
+                        break;
+                    }
+                }
+                if (j == sizeof(CRC_ALGO_NAMES) / sizeof(CRC_ALGO_NAMES[0]))
+                {
+                    printf("\ncfe_ts_crc error: unknown CRC algorithm '%s'\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+
+            default:
+                OutputUsage();
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    NumFiles = argc - optind;
+    if (NumFiles <= 0)
+    {
+        OutputUsage();
         exit(EXIT_FAILURE);
     }
 
-    return 0;
+    Results = calloc(NumFiles, sizeof(FileResult_t));
+    if (Results == NULL)
+    {
+        printf("\ncfe_ts_crc error: %s\n", strerror(ENOMEM));
+        exit(EXIT_FAILURE);
+    }
+
+    for (i = 0; i < NumFiles; i++)
+    {
+        Results[i].Filename = argv[optind + i];
+    }
+
+    if (NumJobs < 1)
+    {
+        NumJobs = 1;
+    }
+    if (NumJobs > NumFiles)
+    {
+        NumJobs = NumFiles;
+    }
+    if (NumJobs > CFE_TS_CRC_MAX_JOBS)
+    {
+        NumJobs = CFE_TS_CRC_MAX_JOBS;
+    }
+
+    Queue.Results  = Results;
+    Queue.NumFiles = NumFiles;
+    Queue.NextFile = 0;
+    Queue.CrcType  = CrcType;
+    pthread_mutex_init(&Queue.Lock, NULL);
+
+    /* The calling thread always takes part, so only the extra workers are spawned */
+    NumStarted = 0;
+    while ((NumStarted < (NumJobs - 1)) && (pthread_create(&Workers[NumStarted], NULL, CrcWorker, &Queue) == 0))
+    {
+        NumStarted++;
+    }
+
+    CrcWorker(&Queue);
+
+    for (i = 0; i < NumStarted; i++)
+    {
+        pthread_join(Workers[i], NULL);
+    }
+
+    pthread_mutex_destroy(&Queue.Lock);
+
+    /* print the size/CRC results, always in command line order */
+    for (i = 0; i < NumFiles; i++)
+    {
+        if (Results[i].ErrorNum != 0)
+        {
+            ExitStatus = EXIT_FAILURE;
+            if (MachineMode)
+            {
+                printf("ERROR %s: %s\n", Results[i].Filename, strerror(Results[i].ErrorNum));
+            }
+            else
+            {
+                printf("\ncfe_ts_crc error: %s\n", Results[i].ErrorText);
+                printf("%s: %s\n", Results[i].Filename, strerror(Results[i].ErrorNum));
+            }
+        }
+        else if (MachineMode)
+        {
+            printf("0x%08lX %ld %s\n", (unsigned long)Results[i].FileCRC, (long)Results[i].FileSize,
+                   Results[i].Filename);
+        }
+        else
+        {
+            printf("\nTable File Name:            %s\nTable Size:                 %ld Bytes\nExpected TS Validation "
+                   "CRC: 0x%08lX\n\n",
+                   Results[i].Filename, (long)Results[i].FileSize, (unsigned long)Results[i].FileCRC);
+        }
+    }
+
+    free(Results);
+
+    return ExitStatus;
 }